@@ -203,5 +203,8 @@ if(NOT USE_INTERNAL_LIBS)
   endif()
 endif()
 
+# the sink without a sound device, for headless runs and benchmarks
+list(APPEND AUDIO_BACKENDS_LIST "null")
+
 # Atomic library
 list(APPEND PLATFORM_REQUIRED_DEPS Atomic)
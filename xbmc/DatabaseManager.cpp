@@ -11,6 +11,7 @@
 #include "ServiceBroker.h"
 #include "TextureDatabase.h"
 #include "addons/AddonDatabase.h"
+#include "dbwrappers/QueryProfiler.h"
 #include "music/MusicDatabase.h"
 #include "pvr/PVRDatabase.h"
 #include "pvr/epg/EpgDatabase.h"
@@ -21,13 +22,15 @@
 #include "view/ViewDatabase.h"
 
 #include <algorithm>
+#include <chrono>
 #include <mutex>
 #include <stdexcept>
 
 using namespace PVR;
 
-CDatabaseManager::CDatabaseManager() :
-  m_bIsUpgrading(false)
+CDatabaseManager::CDatabaseManager()
+  : m_bIsUpgrading(false),
+    m_queryProfiler(std::make_shared<CQueryProfiler>())
 {
   // Initialize the addon database (must be before the addon manager is init'd)
   ADDON::CAddonDatabase db;
@@ -44,6 +47,10 @@ bool CDatabaseManager::Initialize()
   if (m_initialized)
     return false;
 
+  // don't keep connections to the databases of a previous profile
+  m_connectionPool.Clear();
+  m_queryProfiler->Reset();
+
   const bool rc = InitializeInternal();
 
   m_bIsUpgrading = false;
@@ -60,6 +67,10 @@ bool CDatabaseManager::InitializeInternal()
   const std::shared_ptr<CAdvancedSettings> advancedSettings =
       CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
 
+  m_queryProfiler->SetEnabled(advancedSettings->m_databaseQueryProfiling);
+  m_queryProfiler->SetSlowQueryTime(
+      std::chrono::milliseconds(advancedSettings->m_databaseSlowQueryTime));
+
   // NOTE: CAddonDatabase initialized in the constructor
   // NOTE: Order here is important. In particular, CTextureDatabase has to be updated
   //       before CVideoDatabase.
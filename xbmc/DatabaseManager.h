@@ -8,13 +8,16 @@
 
 #pragma once
 
+#include "dbwrappers/DatabaseConnectionPool.h"
 #include "threads/CriticalSection.h"
 
 #include <atomic>
 #include <map>
+#include <memory>
 #include <string>
 
 class CDatabase;
+class CQueryProfiler;
 class DatabaseSettings;
 
 /*!
@@ -62,6 +65,14 @@ public:
 
   void LocalizationChanged();
 
+  /*! \brief Get the pool of connections to the databases which are currently not used.
+   */
+  CDatabaseConnectionPool& GetConnectionPool() { return m_connectionPool; }
+
+  /*! \brief Get the profiler the statements run on the databases are recorded in.
+   */
+  const std::shared_ptr<CQueryProfiler>& GetQueryProfiler() const { return m_queryProfiler; }
+
 private:
   std::atomic<bool> m_bIsUpgrading;
   std::atomic<bool> m_connecting{false};
@@ -82,4 +93,6 @@ private:
 
   CCriticalSection            m_section;     ///< Critical section protecting m_dbStatus.
   std::map<std::string, DBStatus> m_dbStatus; ///< Our database status map.
+  CDatabaseConnectionPool m_connectionPool;
+  std::shared_ptr<CQueryProfiler> m_queryProfiler;
 };
@@ -375,29 +375,46 @@ void CFileItemList::Sort(SortDescription sortDescription)
         static_cast<SortAttribute>(sortDescription.sortAttributes | SortAttributeIgnoreFolders);
   }
 
+  // the keys are built for every sort, the items may have changed in any way since the last one
   const Fields fields = SortUtils::GetFieldsForSorting(sortDescription.sortBy);
-  SortItems sortItems(static_cast<size_t>(Size()));
-  for (int index = 0; index < Size(); index++)
+  SortItems sortItems(m_items.size());
+  for (size_t index = 0; index < m_items.size(); index++)
   {
     sortItems[index] = std::make_shared<SortItem>();
     m_items[index]->ToSortable(*sortItems[index], fields);
-    (*sortItems[index])[Field::ID] = index;
   }
+  const SortKeys keys =
+      SortUtils::GetSortKeys(sortDescription.sortBy, sortDescription.sortAttributes, sortItems);
+  if (keys.size() != m_items.size())
+    return;
 
   // do the sorting
-  SortUtils::Sort(sortDescription, sortItems);
+  const std::vector<size_t> order =
+      SortUtils::GetSortOrder(sortDescription.sortOrder, sortDescription.sortAttributes, keys);
 
   // apply the new order to the existing CFileItems
   std::vector<std::shared_ptr<CFileItem>> sortedFileItems;
-  sortedFileItems.reserve(Size());
-  for (const auto& sortItem : sortItems)
+  sortedFileItems.reserve(m_items.size());
+  for (const size_t index : order)
   {
-    std::shared_ptr<CFileItem> item =
-        m_items[static_cast<int>(sortItem->at(Field::ID).asInteger())];
     // Set the sort label in the CFileItem
-    item->SetSortLabel(sortItem->at(Field::SORT).asWideString());
+    m_items[index]->SetSortLabel(keys[index].label);
+
+    sortedFileItems.emplace_back(std::move(m_items[index]));
+  }
 
-    sortedFileItems.emplace_back(std::move(item));
+  if (sortDescription.limitStart > 0 &&
+      static_cast<size_t>(sortDescription.limitStart) < sortedFileItems.size())
+  {
+    sortedFileItems.erase(sortedFileItems.begin(),
+                          sortedFileItems.begin() + sortDescription.limitStart);
+    sortDescription.limitEnd -= sortDescription.limitStart;
+  }
+  if (sortDescription.limitEnd > 0 &&
+      static_cast<size_t>(sortDescription.limitEnd) < sortedFileItems.size())
+  {
+    sortedFileItems.erase(sortedFileItems.begin() + sortDescription.limitEnd,
+                          sortedFileItems.end());
   }
 
   // replace the current list with the re-ordered one
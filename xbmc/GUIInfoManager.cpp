@@ -11528,6 +11528,18 @@ bool CGUIInfoManager::GetBool(int condition1, int contextWindow, const CGUIListI
   return (condition1 < 0) ? !bReturn : bReturn;
 }
 
+const std::atomic<unsigned int>* CGUIInfoManager::GetBoolChangeCounter(int condition1) const
+{
+  const int condition = std::abs(condition1);
+  if (condition >= LISTITEM_START && condition <= LISTITEM_END)
+    return nullptr;
+
+  if (condition >= MULTI_INFO_START && condition <= MULTI_INFO_END)
+    return m_infoProviders.GetBoolChangeCounter(m_multiInfo[condition - MULTI_INFO_START]);
+
+  return m_infoProviders.GetBoolChangeCounter(CGUIInfo(condition));
+}
+
 bool CGUIInfoManager::GetMultiInfoBool(const CGUIInfo &info, int contextWindow, const CGUIListItem *item)
 {
   bool bReturn = false;
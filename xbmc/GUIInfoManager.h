@@ -14,6 +14,7 @@
 #include "messaging/IMessageTarget.h"
 #include "threads/CriticalSection.h"
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <set>
@@ -103,6 +104,14 @@ public:
   bool GetInt(int& value, int info, int contextWindow, const CGUIListItem* item = nullptr) const;
   bool GetBool(int condition, int contextWindow, const CGUIListItem* item = nullptr);
 
+  /*! \brief Get the change counter of a bool condition
+   \param condition the condition, as returned by TranslateSingleString
+   \return a counter which is increased whenever the value of the condition may have changed, or
+   nullptr if the condition has to be evaluated every frame
+   \sa KODI::GUILIB::GUIINFO::IGUIInfoProvider::GetBoolChangeCounter
+   */
+  const std::atomic<unsigned int>* GetBoolChangeCounter(int condition) const;
+
   std::string GetItemLabel(const CFileItem *item, int contextWindow, int info, std::string *fallback = nullptr) const;
   std::string GetItemImage(const CGUIListItem *item, int contextWindow, int info, std::string *fallback = nullptr) const;
   /*! \brief Get integer value of info.
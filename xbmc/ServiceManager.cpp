@@ -86,6 +86,8 @@ bool CServiceManager::InitForTesting()
   m_subTagRegistryManager = std::make_unique<KODI::UTILS::I18N::CSubTagRegistryManager>();
   m_subTagRegistryManager->Initialize();
 
+  m_dataCacheCore = std::make_unique<CDataCacheCore>();
+
   init_level = 1;
   return true;
 }
@@ -93,6 +95,7 @@ bool CServiceManager::InitForTesting()
 void CServiceManager::DeinitTesting()
 {
   init_level = 0;
+  m_dataCacheCore.reset();
   m_subTagRegistryManager.reset();
   m_fileExtensionProvider.reset();
   m_extsMimeSupportList.reset();
@@ -34,12 +34,29 @@
 #include <mutex>
 #include <optional>
 #include <string.h>
+#include <utility>
+#include <vector>
 
 using namespace XFILE;
 using namespace std::chrono_literals;
 
+namespace
+{
+// Lookup index entries are re-read from the database after this time, so that the daily
+// hash check of updateable images still kicks in
+constexpr auto INDEX_ENTRY_LIFETIME = 1h;
+// Maximum number of entries in the lookup index before it is cleared
+constexpr size_t MAX_INDEX_SIZE = 50000;
+// Number of textures with pending use counts which triggers writing them
+constexpr size_t USE_COUNT_BATCH_SIZE = 100;
+// Maximum time use counts are held back before being written
+constexpr auto USE_COUNT_FLUSH_INTERVAL = 30s;
+} // unnamed namespace
+
 CTextureCache::CTextureCache()
-  : CJobQueue(false, 1, CJob::PRIORITY_LOW_PAUSABLE), m_cleanTimer{[this]() { CleanTimer(); }}
+  : CJobQueue(false, 1, CJob::PRIORITY_LOW_PAUSABLE),
+    m_cleanTimer{[this]() { CleanTimer(); }},
+    m_useCountTimer{[this]() { FlushUseCounts(); }}
 {
 }
 
@@ -56,7 +73,15 @@ void CTextureCache::Initialize()
 void CTextureCache::Deinitialize()
 {
   m_cleanTimer.Stop(true);
+  m_useCountTimer.Stop(true);
   CancelJobs();
+  FlushUseCounts(true);
+
+  {
+    std::unique_lock lock(m_indexSection);
+    m_index.clear();
+    m_indexGeneration++;
+  }
 
   std::unique_lock lock(m_databaseSection);
   m_database.Close();
@@ -245,45 +270,140 @@ bool CTextureCache::ClearCachedImage(int id)
 
 bool CTextureCache::GetCachedTexture(const std::string &url, CTextureDetails &details)
 {
-  std::unique_lock lock(m_databaseSection);
-  return m_database.GetCachedTexture(url, details);
+  unsigned int generation;
+  {
+    std::unique_lock lock(m_indexSection);
+    const auto it = m_index.find(url);
+    if (it != m_index.end() &&
+        std::chrono::steady_clock::now() - it->second.loaded < INDEX_ENTRY_LIFETIME)
+    {
+      if (it->second.found)
+        details = it->second.details;
+      return it->second.found;
+    }
+    generation = m_indexGeneration;
+  }
+
+  CTextureDetails row;
+  bool found;
+  {
+    std::unique_lock lock(m_databaseSection);
+    if (!m_database.IsOpen())
+      return false;
+    found = m_database.GetCachedTexture(url, row);
+  }
+
+  {
+    // don't store the row if the image was changed while it was read
+    std::unique_lock lock(m_indexSection);
+    if (generation == m_indexGeneration)
+    {
+      if (m_index.size() >= MAX_INDEX_SIZE)
+        m_index.clear();
+      m_index.insert_or_assign(url, IndexEntry{found, row, std::chrono::steady_clock::now()});
+    }
+  }
+
+  if (found)
+    details = row;
+  return found;
 }
 
 bool CTextureCache::AddCachedTexture(const std::string &url, const CTextureDetails &details)
 {
   std::unique_lock lock(m_databaseSection);
-  return m_database.AddCachedTexture(url, details);
+  const bool result = m_database.AddCachedTexture(url, details);
+  // the id of the texture is assigned by the database, so let the next lookup read it
+  RemoveFromIndex(url);
+  return result;
 }
 
 void CTextureCache::IncrementUseCount(const CTextureDetails &details)
 {
-  static const size_t count_before_update = 100;
   std::unique_lock lock(m_useCountSection);
-  m_useCounts.reserve(count_before_update);
-  m_useCounts.push_back(details);
-  if (m_useCounts.size() >= count_before_update)
+  auto it = m_useCounts.try_emplace(details.id, details, 0).first;
+  it->second.second++;
+  if (m_useCounts.size() >= USE_COUNT_BATCH_SIZE)
   {
-    AddJob(new CTextureUseCountJob(m_useCounts));
+    lock.unlock();
+    FlushUseCounts();
+  }
+  else if (!m_useCountTimer.IsRunning())
+    m_useCountTimer.Start(USE_COUNT_FLUSH_INTERVAL);
+}
+
+void CTextureCache::FlushUseCounts(bool wait /* = false */)
+{
+  std::vector<std::pair<CTextureDetails, unsigned int>> useCounts;
+  {
+    std::unique_lock lock(m_useCountSection);
+    if (m_useCounts.empty())
+      return;
+    useCounts.reserve(m_useCounts.size());
+    for (auto& [id, useCount] : m_useCounts)
+      useCounts.emplace_back(std::move(useCount));
     m_useCounts.clear();
   }
+
+  if (!wait)
+  {
+    AddJob(new CTextureUseCountJob(useCounts));
+    return;
+  }
+
+  std::unique_lock lock(m_databaseSection);
+  if (!m_database.IsOpen())
+    return;
+  m_database.BeginTransaction();
+  for (const auto& [details, count] : useCounts)
+    m_database.IncrementUseCount(details, count);
+  m_database.CommitTransaction();
 }
 
 bool CTextureCache::SetCachedTextureValid(const std::string &url, bool updateable)
 {
   std::unique_lock lock(m_databaseSection);
-  return m_database.SetCachedTextureValid(url, updateable);
+  const bool result = m_database.SetCachedTextureValid(url, updateable);
+  RemoveFromIndex(url);
+  return result;
 }
 
 bool CTextureCache::ClearCachedTexture(const std::string &url, std::string &cachedURL)
 {
   std::unique_lock lock(m_databaseSection);
-  return m_database.ClearCachedTexture(url, cachedURL);
+  const bool result = m_database.ClearCachedTexture(url, cachedURL);
+  RemoveFromIndex(url);
+  return result;
 }
 
 bool CTextureCache::ClearCachedTexture(int id, std::string &cachedURL)
 {
   std::unique_lock lock(m_databaseSection);
-  return m_database.ClearCachedTexture(id, cachedURL);
+  const bool result = m_database.ClearCachedTexture(id, cachedURL);
+  RemoveFromIndex(id);
+  return result;
+}
+
+void CTextureCache::ForgetCachedImage(const std::string& image)
+{
+  const std::string url = IMAGE_FILES::ToCacheKey(image);
+  if (!url.empty())
+    RemoveFromIndex(url);
+}
+
+void CTextureCache::RemoveFromIndex(const std::string& url)
+{
+  std::unique_lock lock(m_indexSection);
+  m_index.erase(url);
+  m_indexGeneration++;
+}
+
+void CTextureCache::RemoveFromIndex(int textureID)
+{
+  std::unique_lock lock(m_indexSection);
+  std::erase_if(m_index, [textureID](const auto& entry)
+                { return entry.second.found && entry.second.details.id == textureID; });
+  m_indexGeneration++;
 }
 
 std::string CTextureCache::GetCacheFile(const std::string &url)
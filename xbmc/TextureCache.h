@@ -20,8 +20,11 @@
 #include <atomic>
 #include <chrono>
 #include <memory>
+#include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 class CGUIDialogProgress;
@@ -165,6 +168,13 @@ public:
   bool Export(const std::string &image, const std::string &destination, bool overwrite);
   bool Export(const std::string &image, const std::string &destination); //! @todo BACKWARD COMPATIBILITY FOR MUSIC THUMBS
 
+  /*! \brief Drop an image from the lookup index
+   The next lookup of the image reads it from the database again. Needs to be called after
+   altering the texture database directly, e.g. via CTextureDatabase::InvalidateCachedTexture.
+   \param image url of the original image
+   */
+  void ForgetCachedImage(const std::string& image);
+
   bool CleanAllUnusedImages();
 
 private:
@@ -210,6 +220,18 @@ private:
    */
   void IncrementUseCount(const CTextureDetails &details);
 
+  /*! \brief Write the locally stored use counts to the database
+   \param wait whether to write them directly instead of via a CUseCountJob
+   \sa IncrementUseCount
+   */
+  void FlushUseCounts(bool wait = false);
+
+  /*! \brief Remove entries from the lookup index
+   \param url url of the original image to remove
+   */
+  void RemoveFromIndex(const std::string& url);
+  void RemoveFromIndex(int textureID);
+
   /*! \brief Set a previously cached texture as valid in the database
    Thread-safe wrapper of CTextureDatabase::SetCachedTextureValid
    \param image url of the original image
@@ -239,7 +261,21 @@ private:
   std::set<std::string> m_processinglist; ///< currently processing list to avoid 2 jobs being processed at once
   CCriticalSection     m_processingSection;
   CEvent               m_completeEvent; ///< Set whenever a job has finished
-  std::vector<CTextureDetails> m_useCounts; ///< Use count tracking
+  /*! \brief Entry of the lookup index
+   Caches the database row of an image, or its absence if found is false.
+   */
+  struct IndexEntry
+  {
+    bool found{false};
+    CTextureDetails details;
+    std::chrono::steady_clock::time_point loaded;
+  };
+  std::unordered_map<std::string, IndexEntry> m_index; ///< url -> database row lookup index
+  unsigned int m_indexGeneration{0}; ///< Bumped on removals, guards against racing lookups
+  CCriticalSection m_indexSection;
+
+  std::map<int, std::pair<CTextureDetails, unsigned int>> m_useCounts; ///< Use count tracking
   CCriticalSection             m_useCountSection;
+  CTimer m_useCountTimer;
 };
 
@@ -226,7 +226,9 @@ std::string CTextureCacheJob::GetImageHash(const std::string &url)
   return "";
 }
 
-CTextureUseCountJob::CTextureUseCountJob(const std::vector<CTextureDetails> &textures) : m_textures(textures)
+CTextureUseCountJob::CTextureUseCountJob(
+    const std::vector<std::pair<CTextureDetails, unsigned int>>& textures)
+  : m_textures(textures)
 {
 }
 
@@ -247,8 +249,8 @@ bool CTextureUseCountJob::DoWork()
   if (db.Open())
   {
     db.BeginTransaction();
-    for (std::vector<CTextureDetails>::const_iterator i = m_textures.begin(); i != m_textures.end(); ++i)
-      db.IncrementUseCount(*i);
+    for (const auto& [details, count] : m_textures)
+      db.IncrementUseCount(details, count);
     db.CommitTransaction();
   }
   return true;
@@ -14,6 +14,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 class CTexture;
@@ -102,16 +103,18 @@ private:
 };
 
 /* \brief Job class for storing the use count of textures
+ Each texture is stored together with the number of uses to add.
  */
 class CTextureUseCountJob : public CJob
 {
 public:
-  explicit CTextureUseCountJob(const std::vector<CTextureDetails> &textures);
+  explicit CTextureUseCountJob(
+      const std::vector<std::pair<CTextureDetails, unsigned int>>& textures);
 
   const char* GetType() const override { return "usecount"; }
   bool Equals(const CJob* job) const override;
   bool DoWork() override;
 
 private:
-  std::vector<CTextureDetails> m_textures;
+  std::vector<std::pair<CTextureDetails, unsigned int>> m_textures;
 };
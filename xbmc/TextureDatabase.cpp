@@ -205,9 +205,10 @@ void CTextureDatabase::UpdateTables(int version)
   }
 }
 
-bool CTextureDatabase::IncrementUseCount(const CTextureDetails &details)
+bool CTextureDatabase::IncrementUseCount(const CTextureDetails& details,
+                                         unsigned int count /* = 1 */)
 {
-  std::string sql = PrepareSQL("UPDATE sizes SET usecount=usecount+1, lastusetime=CURRENT_TIMESTAMP WHERE idtexture=%u AND width=%u AND height=%u", details.id, details.width, details.height);
+  std::string sql = PrepareSQL("UPDATE sizes SET usecount=usecount+%u, lastusetime=CURRENT_TIMESTAMP WHERE idtexture=%u AND width=%u AND height=%u", count, details.id, details.width, details.height);
   if (!ExecuteQuery(sql))
     return false;
   sql = PrepareSQL("UPDATE texture SET lastlibrarycheck=NULL WHERE id=%u", details.id);
@@ -47,7 +47,7 @@ public:
   bool SetCachedTextureValid(const std::string &originalURL, bool updateable);
   bool ClearCachedTexture(const std::string &originalURL, std::string &cacheFile);
   bool ClearCachedTexture(int textureID, std::string &cacheFile);
-  bool IncrementUseCount(const CTextureDetails &details);
+  bool IncrementUseCount(const CTextureDetails& details, unsigned int count = 1);
 
   /*! \brief Invalidate a previously cached texture
    Invalidates the texture hash, and sets the texture update time to the current time so that
@@ -682,6 +682,7 @@ bool CAddonMgr::FindAddon(const std::string& addonId,
   std::map<std::string, AddonDisabledReason, std::less<>> tmpDisabled;
   m_database->GetDisabled(tmpDisabled);
   m_disabled = std::move(tmpDisabled);
+  ++m_stateChangeCounter;
 
   m_updateRules->RefreshRulesMap(*m_database);
   return true;
@@ -718,6 +719,7 @@ bool CAddonMgr::FindAddons()
   std::map<std::string, AddonDisabledReason, std::less<>> tmpDisabled;
   m_database->GetDisabled(tmpDisabled);
   m_disabled = std::move(tmpDisabled);
+  ++m_stateChangeCounter;
 
   m_updateRules->RefreshRulesMap(*m_database);
 
@@ -741,6 +743,7 @@ bool CAddonMgr::UnloadAddon(const std::string& addonId)
   }
 
   m_installedAddons.erase(addonId);
+  ++m_stateChangeCounter;
   CLog::LogF(LOGDEBUG, "{} unloaded", addonId);
 
   lock.unlock();
@@ -795,6 +798,7 @@ void CAddonMgr::OnPostUnInstall(const std::string& id)
 {
   std::unique_lock lock(m_critSection);
   m_disabled.erase(id);
+  ++m_stateChangeCounter;
   RemoveAllUpdateRulesFromList(id);
   CServiceBroker::GetResourcesComponent().GetLocalizeStrings().ClearAddonStrings(id);
   m_events.Publish(AddonEvents::UnInstalled(id));
@@ -844,6 +848,7 @@ bool CAddonMgr::DisableAddon(const std::string& id, AddonDisabledReason disabled
     return false;
   if (!m_disabled.try_emplace(id, disabledReason).second)
     return false;
+  ++m_stateChangeCounter;
 
   //success
   CLog::Log(LOGDEBUG, "CAddonMgr: {} disabled", id);
@@ -901,6 +906,7 @@ bool CAddonMgr::EnableSingle(const std::string& id)
   if (!m_database->EnableAddon(id))
     return false;
   m_disabled.erase(id);
+  ++m_stateChangeCounter;
 
   // If enabling a repo add-on without an origin, set its origin to its own id
   if (addon->HasType(AddonType::REPOSITORY) && addon->Origin().empty())
@@ -11,6 +11,7 @@
 #include "threads/CriticalSection.h"
 #include "utils/EventStream.h"
 
+#include <atomic>
 #include <cstdint>
 #include <map>
 #include <memory>
@@ -96,6 +97,11 @@ public:
   CEventStream<AddonEvent>& Events() { return m_events; }
   CEventStream<AddonEvent>& UnloadEvents() { return m_unloadEvents; }
 
+  /*! \brief Get a counter which is increased whenever add-ons are installed, removed, enabled or
+   disabled
+   */
+  const std::atomic<unsigned int>& GetStateChangeCounter() const { return m_stateChangeCounter; }
+
   IAddonMgrCallback* GetCallbackForType(AddonType type);
   bool RegisterAddonMgrCallback(AddonType type, IAddonMgrCallback* cb) const;
   void UnregisterAddonMgrCallback(AddonType type) const;
@@ -683,6 +689,7 @@ private:
   std::unique_ptr<CAddonUpdateRules> m_updateRules;
   CEventSource<AddonEvent> m_events;
   CBlockingEventSource<AddonEvent> m_unloadEvents;
+  std::atomic<unsigned int> m_stateChangeCounter{0};
   std::set<std::string, std::less<>> m_systemAddons;
   std::set<std::string, std::less<>> m_optionalSystemAddons;
   AddonInfoMap m_installedAddons;
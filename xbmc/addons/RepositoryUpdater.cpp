@@ -9,6 +9,7 @@
 #include "RepositoryUpdater.h"
 
 #include "ServiceBroker.h"
+#include "TextureCache.h"
 #include "TextureDatabase.h"
 #include "addons/AddonDatabase.h"
 #include "addons/AddonEvents.h"
@@ -98,6 +99,13 @@ bool CRepositoryUpdateJob::DoWork()
     textureDB.Open();
     textureDB.BeginMultipleExecute();
 
+    std::vector<std::string> invalidated;
+    const auto invalidate = [&textureDB, &invalidated](const std::string& url)
+    {
+      textureDB.InvalidateCachedTexture(url);
+      invalidated.emplace_back(url);
+    };
+
     for (const auto& addon : addons)
     {
       AddonPtr oldAddon;
@@ -109,16 +117,24 @@ bool CRepositoryUpdateJob::DoWork()
           CLog::Log(LOGDEBUG, "CRepository: invalidating cached art for '{}'", addon->ID());
 
         if (!oldAddon->Icon().empty())
-          textureDB.InvalidateCachedTexture(oldAddon->Icon());
+          invalidate(oldAddon->Icon());
 
         for (const auto& path : oldAddon->Screenshots())
-          textureDB.InvalidateCachedTexture(path);
+          invalidate(path);
 
         for (const auto& [_, arturl] : oldAddon->Art())
-          textureDB.InvalidateCachedTexture(arturl);
+          invalidate(arturl);
       }
     }
-    textureDB.CommitMultipleExecute();
+
+    // forget the images only once the database has been updated, a lookup in between would
+    // bring back the old entries otherwise
+    const auto textureCache = CServiceBroker::GetTextureCache();
+    if (textureDB.CommitMultipleExecute() && textureCache)
+    {
+      for (const auto& url : invalidated)
+        textureCache->ForgetCachedImage(url);
+    }
   }
 
   database.UpdateRepositoryContent(m_repo->ID(), m_repo->Version(), newChecksum, addons);
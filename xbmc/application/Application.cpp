@@ -139,6 +139,7 @@
 #include "utils/LangCodeExpander.h"
 #include "utils/PlayerUtils.h"
 #include "utils/RegExp.h"
+#include "utils/SaveFileStateQueue.h"
 #include "utils/Screenshot.h"
 #include "utils/StringUtils.h"
 #include "utils/SystemInfo.h"
@@ -235,10 +236,12 @@ CApplication::CApplication(void)
   RegisterComponent(std::make_shared<CApplicationSkinHandling>(this, this, m_bInitializing));
   RegisterComponent(std::make_shared<CApplicationVolumeHandling>());
   RegisterComponent(std::make_shared<CApplicationStackHelper>());
+  RegisterComponent(std::make_shared<CSaveFileStateQueue>());
 }
 
 CApplication::~CApplication(void)
 {
+  DeregisterComponent(typeid(CSaveFileStateQueue));
   DeregisterComponent(typeid(CApplicationStackHelper));
   DeregisterComponent(typeid(CApplicationVolumeHandling));
   DeregisterComponent(typeid(CApplicationSkinHandling));
@@ -1746,6 +1749,10 @@ bool CApplication::Stop(int exitCode)
   const auto appPlayer = GetComponent<CApplicationPlayer>();
   appPlayer->ClosePlayer();
 
+  // write the state of the files played before the network and the databases go away
+  CLog::Log(LOGINFO, "Saving file states");
+  GetComponent<CSaveFileStateQueue>()->Stop();
+
   {
     // close inbound port
     CServiceBroker::UnregisterAppPort();
@@ -8,6 +8,7 @@
 
 #include "ApplicationPlay.h"
 
+#include "ApplicationComponents.h"
 #include "ApplicationStackHelper.h"
 #include "FileItem.h"
 #include "PlayListPlayer.h"
@@ -26,6 +27,7 @@
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/DiscsUtils.h"
+#include "utils/SaveFileStateQueue.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 #include "video/Bookmark.h"
@@ -129,6 +131,9 @@ void CApplicationPlay::GetOptionsAndUpdateItem()
       path = m_item.GetProperty("original_listitem_url").asString();
     }
 
+    // the state of the item may not have been written yet if it has just been played
+    CServiceBroker::GetAppComponents().GetComponent<CSaveFileStateQueue>()->Flush(m_item);
+
     // Note that we need to load the tag from database also if the item already has a tag,
     // because for example the (full) video info for strm files will be loaded here.
     db.LoadVideoInfo(path, *m_item.GetVideoInfoTag());
@@ -33,7 +33,7 @@
 #include "settings/MediaSettings.h"
 #include "settings/SettingsComponent.h"
 #include "storage/MediaManager.h"
-#include "utils/SaveFileStateJob.h"
+#include "utils/SaveFileStateQueue.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
@@ -391,9 +391,27 @@ void CApplicationPlayerCallback::OnPlayerCloseFile(const CFileItem& file,
           ->GetCurrentProfile()
           .canWriteDatabases())
   {
-    CSaveFileState::DoWork(fileItem, bookmark, UpdatePlayCount(fileItem, bookmark));
-
-    stackHelper->SetStackFileIds(fileItem.GetVideoInfoTag()->m_iFileId);
+    const auto queue = components.GetComponent<CSaveFileStateQueue>();
+    if (stackHelper->GetStack(file) == nullptr)
+    {
+      // the state is written in the background
+      queue->Add(fileItem, bookmark, UpdatePlayCount(fileItem, bookmark));
+    }
+    else
+    {
+      // the next part of the stack is played with the file id the stack gets in the library, so
+      // the state of a stack is written right away
+      int fileId{fileItem.GetVideoInfoTag()->m_iFileId};
+      queue->Add(fileItem, bookmark, UpdatePlayCount(fileItem, bookmark),
+                 [&fileId](const CFileItem& savedItem)
+                 {
+                   if (savedItem.HasVideoInfoTag())
+                     fileId = savedItem.GetVideoInfoTag()->m_iFileId;
+                 });
+      queue->Flush(fileItem);
+
+      stackHelper->SetStackFileIds(fileId);
+    }
   }
 }
 
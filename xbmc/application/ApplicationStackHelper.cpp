@@ -8,6 +8,7 @@
 
 #include "ApplicationStackHelper.h"
 
+#include "ApplicationComponents.h"
 #include "FileItem.h"
 #include "FileItemList.h"
 #include "ServiceBroker.h"
@@ -18,6 +19,7 @@
 #include "settings/AdvancedSettings.h"
 #include "settings/MediaSettings.h"
 #include "settings/SettingsComponent.h"
+#include "utils/SaveFileStateQueue.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
@@ -159,6 +161,10 @@ void CApplicationStackHelper::GetStackPartAndOptions(CFileItem& item,
                                                      CPlayerOptions& options,
                                                      bool restart)
 {
+  // the state of the stack may not have been written yet if it has just been played
+  if (!restart)
+    CServiceBroker::GetAppComponents().GetComponent<CSaveFileStateQueue>()->Flush(item);
+
   std::unique_lock stackLock(m_critSection);
 
   std::chrono::milliseconds start{0ms};
@@ -15,6 +15,7 @@
 #include "cores/AudioEngine/AEResampleFactory.h"
 #include "cores/AudioEngine/Encoders/AEEncoderFFmpeg.h"
 #include "cores/AudioEngine/Interfaces/IAudioCallback.h"
+#include "cores/AudioEngine/Utils/AEKernels.h"
 #include "cores/AudioEngine/Utils/AEStreamData.h"
 #include "cores/AudioEngine/Utils/AEStreamInfo.h"
 #include "cores/AudioEngine/Utils/AEUtil.h"
@@ -2198,15 +2199,8 @@ bool CActiveAE::RunStages()
 
               for(int j=0; j<out->pkt->planes; j++)
               {
-#if defined(HAVE_SSE) && defined(__SSE__)
-                CAEUtil::SSEMulArray((float*)out->pkt->data[j]+i*nb_floats, volume, nb_floats);
-#else
-                float* fbuffer = (float*) out->pkt->data[j]+i*nb_floats;
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  fbuffer[k] *= volume;
-                }
-#endif
+                CAEKernels::Mul(reinterpret_cast<float*>(out->pkt->data[j]) + i * nb_floats, volume,
+                                nb_floats);
               }
             }
           }
@@ -2267,24 +2261,8 @@ bool CActiveAE::RunStages()
               {
                 float *dst = (float*)out->pkt->data[j]+i*nb_floats;
                 float *src = (float*)mix->pkt->data[j]+i*nb_floats;
-#if defined(HAVE_SSE) && defined(__SSE__)
-                CAEUtil::SSEMulAddArray(dst, src, volume, nb_floats);
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  if (fabs(dst[k]) > 1.0f)
-                  {
-                    needClamp = true;
-                    break;
-                  }
-                }
-#else
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  dst[k] += src[k] * volume;
-                  if (fabs(dst[k]) > 1.0f)
-                    needClamp = true;
-                }
-#endif
+                if (CAEKernels::MulAdd(dst, src, volume, nb_floats) > 1.0f)
+                  needClamp = true;
               }
             }
             mix->Return();
@@ -2299,7 +2277,7 @@ bool CActiveAE::RunStages()
         int nb_floats = out->pkt->nb_samples * out->pkt->config.channels / out->pkt->planes;
         for (int i=0; i<out->pkt->planes; i++)
         {
-          CAEUtil::ClampArray((float*)out->pkt->data[i], nb_floats);
+          CAEKernels::SoftClamp(reinterpret_cast<float*>(out->pkt->data[i]), nb_floats);
         }
       }
 
@@ -2673,12 +2651,7 @@ void CActiveAE::MixSounds(CSoundPacket &dstSample)
       out = (float*)dstSample.data[j];
       sample_buffer = (float*)(it->sound->GetSound(false)->data[j]+start);
       int nb_floats = mix_samples * dstSample.config.channels / dstSample.planes;
-#if defined(HAVE_SSE) && defined(__SSE__)
-      CAEUtil::SSEMulAddArray(out, sample_buffer, volume, nb_floats);
-#else
-      for (int k = 0; k < nb_floats; ++k)
-        *out++ += *sample_buffer++ * volume;
-#endif
+      CAEKernels::MulAdd(out, sample_buffer, volume, nb_floats);
     }
 
     it->samples_played += mix_samples;
@@ -2703,13 +2676,7 @@ void CActiveAE::Deamplify(CSoundPacket &dstSample)
     for(int j=0; j<dstSample.planes; j++)
     {
       float* buffer = reinterpret_cast<float*>(dstSample.data[j]);
-#if defined(HAVE_SSE) && defined(__SSE__)
-      CAEUtil::SSEMulArray(buffer, volume, nb_floats);
-#else
-      float *fbuffer = buffer;
-      for (int i = 0; i < nb_floats; i++)
-        *fbuffer++ *= volume;
-#endif
+      CAEKernels::Mul(buffer, volume, nb_floats);
     }
   }
 }
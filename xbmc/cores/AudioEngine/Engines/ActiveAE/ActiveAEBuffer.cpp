@@ -11,12 +11,61 @@
 #include "ActiveAE.h"
 #include "ActiveAEFilter.h"
 #include "cores/AudioEngine/AEResampleFactory.h"
+#include "cores/AudioEngine/Utils/AEKernels.h"
 #include "cores/AudioEngine/Utils/AEUtil.h"
 
 #include <memory>
 
 using namespace ActiveAE;
 
+namespace
+{
+// sample format conversions the kernels do without a resampler
+bool CanConvert(AEDataFormat src, AEDataFormat dst)
+{
+  if (dst == AE_FMT_FLOAT)
+    return src == AE_FMT_FLOATP || src == AE_FMT_S16NE || src == AE_FMT_S32NE;
+  if (dst == AE_FMT_FLOATP)
+    return src == AE_FMT_FLOAT || src == AE_FMT_S16NEP || src == AE_FMT_S32NEP;
+  return false;
+}
+
+void Convert(AEDataFormat srcFormat, const CSoundPacket& src, CSoundPacket& dst)
+{
+  const unsigned int channels = src.config.channels;
+  const size_t samples = static_cast<size_t>(src.nb_samples) * channels / src.planes;
+
+  switch (srcFormat)
+  {
+    case AE_FMT_FLOATP:
+      CAEKernels::Interleave(reinterpret_cast<float*>(dst.data[0]),
+                             reinterpret_cast<const float* const*>(src.data), channels,
+                             src.nb_samples);
+      break;
+    case AE_FMT_FLOAT:
+      CAEKernels::Deinterleave(reinterpret_cast<float* const*>(dst.data),
+                               reinterpret_cast<const float*>(src.data[0]), channels,
+                               src.nb_samples);
+      break;
+    case AE_FMT_S16NE:
+    case AE_FMT_S16NEP:
+      for (int i = 0; i < src.planes; i++)
+        CAEKernels::S16ToFloat(reinterpret_cast<float*>(dst.data[i]),
+                               reinterpret_cast<const int16_t*>(src.data[i]), samples);
+      break;
+    case AE_FMT_S32NE:
+    case AE_FMT_S32NEP:
+      for (int i = 0; i < src.planes; i++)
+        CAEKernels::S32ToFloat(reinterpret_cast<float*>(dst.data[i]),
+                               reinterpret_cast<const int32_t*>(src.data[i]), samples);
+      break;
+    default:
+      break;
+  }
+  dst.nb_samples = src.nb_samples;
+}
+} // unnamed namespace
+
 CSoundPacket::CSoundPacket(const SampleConfig& conf, int samples) : config(conf)
 {
   data = CActiveAE::AllocSoundSample(config, samples, bytes_per_sample, planes, linesize);
@@ -157,18 +206,43 @@ bool CActiveAEBufferPoolResample::Create(
   if ((m_format.m_channelLayout.Count() < m_inputFormat.m_channelLayout.Count() && !normalize))
     m_normalize = false;
 
-  if (m_inputFormat.m_channelLayout != m_format.m_channelLayout ||
-      m_inputFormat.m_sampleRate != m_format.m_sampleRate ||
-      m_inputFormat.m_dataFormat != m_format.m_dataFormat ||
-      m_inputFormat.m_frames != m_format.m_frames || m_changeResampler)
+  if (NeedsResampler() || m_changeResampler)
   {
     ChangeResampler();
   }
   return true;
 }
 
+bool CActiveAEBufferPoolResample::NeedsResampler() const
+{
+  if (m_inputFormat.m_channelLayout != m_format.m_channelLayout ||
+      m_inputFormat.m_sampleRate != m_format.m_sampleRate ||
+      m_inputFormat.m_frames != m_format.m_frames)
+    return true;
+
+  if (m_inputFormat.m_dataFormat == m_format.m_dataFormat)
+  {
+    // a forced resampler follows the resample ratio without switching
+    return m_inputFormat.m_dataFormat != AE_FMT_RAW &&
+           (m_forceResampler || m_resampleRatio != 1.0);
+  }
+
+  return m_forceResampler || m_resampleRatio != 1.0 ||
+         !CanConvert(m_inputFormat.m_dataFormat, m_format.m_dataFormat);
+}
+
 void CActiveAEBufferPoolResample::ChangeResampler()
 {
+  m_changeResampler = false;
+
+  // formats that match go straight through, this is reevaluated on every flush and on changes
+  // of the settings
+  if (!NeedsResampler())
+  {
+    m_resampler.reset();
+    return;
+  }
+
   m_resampler = CAEResampleFactory::Create();
 
   SampleConfig dstConfig, srcConfig;
@@ -189,8 +263,6 @@ void CActiveAEBufferPoolResample::ChangeResampler()
   m_resampler->Init(dstConfig, srcConfig, m_stereoUpmix, m_normalize, m_centerMixLevel,
                     m_remap ? &m_format.m_channelLayout : nullptr, m_resampleQuality,
                     m_forceResampler, m_mixSubLevel);
-
-  m_changeResampler = false;
 }
 
 bool CActiveAEBufferPoolResample::ResampleBuffers(int64_t timestamp)
@@ -202,14 +274,29 @@ bool CActiveAEBufferPoolResample::ResampleBuffers(int64_t timestamp)
   {
     if (m_changeResampler)
     {
-      if (m_changeResampler)
-        ChangeResampler();
+      ChangeResampler();
       return true;
     }
+    const bool convert = m_inputFormat.m_dataFormat != m_format.m_dataFormat;
     while(!m_inputSamples.empty())
     {
+      if (convert && m_freeSamples.empty())
+        break;
+
       in = m_inputSamples.front();
       m_inputSamples.pop_front();
+      // the center mix level only matters when downmixing
+      m_centerMixLevel = in->centerMixLevel;
+      if (convert)
+      {
+        CSampleBuffer* out = GetFreeBuffer();
+        Convert(m_inputFormat.m_dataFormat, *in->pkt, *out->pkt);
+        out->timestamp = in->timestamp;
+        out->pkt_start_offset = in->pkt_start_offset;
+        out->centerMixLevel = in->centerMixLevel;
+        in->Return();
+        in = out;
+      }
       if (timestamp)
       {
         in->timestamp = timestamp;
@@ -424,6 +511,11 @@ void CActiveAEBufferPoolResample::SetDrain(bool drain)
 void CActiveAEBufferPoolResample::SetRR(double rr)
 {
   m_resampleRatio = rr;
+
+  // the resampler is kept once the ratio is back at 1.0, switching back and forth while syncing
+  // would be audible. It is dropped again by the next flush
+  if (!m_resampler && NeedsResampler())
+    m_changeResampler = true;
 }
 
 double CActiveAEBufferPoolResample::GetRR() const
@@ -99,6 +99,11 @@ public:
 
 protected:
   void ChangeResampler();
+  /*!
+   \brief Whether the stage needs a resampler, without one the buffers are passed on as they are
+   or only converted to the output sample format
+   */
+  bool NeedsResampler() const;
 
   uint8_t *m_planes[16];
   bool m_empty = true;
@@ -0,0 +1,196 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ServiceBroker.h"
+#include "cores/AudioEngine/AESinkFactory.h"
+#include "cores/AudioEngine/Engines/ActiveAE/ActiveAE.h"
+#include "cores/AudioEngine/Interfaces/AEStream.h"
+#include "cores/AudioEngine/Sinks/AESinkNULL.h"
+#include "cores/AudioEngine/Utils/AEStreamData.h"
+#include "settings/Settings.h"
+#include "settings/SettingsComponent.h"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <numbers>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ActiveAE;
+using namespace std::chrono_literals;
+
+namespace
+{
+struct StreamSpec
+{
+  unsigned int sampleRate;
+  AEStdChLayout layout;
+  //! 1.0 for none, close to 1.0 for resampling, further off for atempo (see the atempo threshold)
+  double resampleRatio;
+};
+
+struct StreamFeed
+{
+  IAE::StreamPtr stream;
+  AEAudioFormat format;
+  std::vector<float> samples; //!< a second of a sine, interleaved
+  uint64_t fed{0};
+};
+
+/*!
+ Runs the engine with the null sink and streams fed as fast as the engine takes them, and
+ reports the throughput, the time the engine took to produce a period of the sink and the
+ underruns of the sink.
+
+ Run with --gtest_also_run_disabled_tests --gtest_filter=TestActiveAEBenchmark.*
+ */
+class TestActiveAEBenchmark : public ::testing::Test
+{
+protected:
+  void Run(const std::string& device,
+           const std::vector<StreamSpec>& specs,
+           std::chrono::seconds length)
+  {
+    const auto settings = CServiceBroker::GetSettingsComponent()->GetSettings();
+    settings->SetString(CSettings::SETTING_AUDIOOUTPUT_AUDIODEVICE, "NULL:" + device);
+    // don't keep the sink busy with silence in between
+    settings->SetInt(CSettings::SETTING_AUDIOOUTPUT_STREAMSILENCE, 0);
+
+    AE::CAESinkFactory::ClearSinks();
+    CAESinkNULL::Register();
+
+    auto ae = std::make_unique<CActiveAE>();
+    CServiceBroker::RegisterAE(ae.get());
+    ae->Start();
+
+    std::vector<StreamFeed> feeds;
+    for (const StreamSpec& spec : specs)
+    {
+      StreamFeed feed;
+      feed.format.m_dataFormat = AE_FMT_FLOAT;
+      feed.format.m_sampleRate = spec.sampleRate;
+      feed.format.m_channelLayout = spec.layout;
+      const unsigned int channels = feed.format.m_channelLayout.Count();
+      feed.samples.resize(static_cast<size_t>(spec.sampleRate) * channels);
+      for (size_t i = 0; i < feed.samples.size(); ++i)
+      {
+        const float t = static_cast<float>(i / channels) / spec.sampleRate;
+        feed.samples[i] = 0.25f * std::sin(2.0f * std::numbers::pi_v<float> * 440.0f * t);
+      }
+      const unsigned int options = spec.resampleRatio != 1.0 ? AESTREAM_FORCE_RESAMPLE : 0;
+      feed.stream = ae->MakeStream(feed.format, options);
+      ASSERT_NE(nullptr, feed.stream);
+      if (spec.resampleRatio != 1.0)
+        feed.stream->SetResampleRatio(spec.resampleRatio);
+      feeds.emplace_back(std::move(feed));
+    }
+
+    CAESinkNULL::ResetStats();
+    const auto start = std::chrono::steady_clock::now();
+    const auto deadline = start + length * 4 + 30s;
+
+    bool fed = false;
+    while (!fed && std::chrono::steady_clock::now() < deadline)
+    {
+      fed = true;
+      bool added = false;
+      for (StreamFeed& feed : feeds)
+      {
+        const uint64_t total = feed.format.m_sampleRate * length.count();
+        if (feed.fed >= total)
+          continue;
+        fed = false;
+
+        const unsigned int channels = feed.format.m_channelLayout.Count();
+        const unsigned int second = feed.format.m_sampleRate;
+        const unsigned int offset = feed.fed % second;
+        const unsigned int frames = std::min<uint64_t>(
+            {feed.stream->GetSpace() / (channels * sizeof(float)), second - offset,
+             total - feed.fed});
+        if (frames == 0)
+          continue;
+
+        const uint8_t* planes[] = {reinterpret_cast<const uint8_t*>(feed.samples.data())};
+        const unsigned int copied = feed.stream->AddData(planes, offset, frames, nullptr);
+        feed.fed += copied;
+        added |= copied > 0;
+      }
+      if (!fed && !added)
+        std::this_thread::sleep_for(1ms);
+    }
+
+    for (StreamFeed& feed : feeds)
+      feed.stream->Drain(true);
+    for (StreamFeed& feed : feeds)
+    {
+      while (!feed.stream->IsDrained() && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(1ms);
+      EXPECT_TRUE(feed.stream->IsDrained());
+    }
+
+    const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+    const CAESinkNULL::Stats stats = CAESinkNULL::GetStats();
+
+    feeds.clear();
+    ae->Shutdown();
+    CServiceBroker::UnregisterAE();
+    ae.reset();
+    AE::CAESinkFactory::ClearSinks();
+
+    const double periodTime =
+        stats.periods > 1 ? std::chrono::duration<double, std::micro>(stats.processingTime).count() /
+                                (stats.periods - 1)
+                          : 0.0;
+    std::cout << specs.size() << " streams, " << length.count() << " s on NULL:" << device << ": "
+              << duration.count() << " s, " << length.count() / duration.count()
+              << "x real time, " << stats.frames << " frames in " << stats.periods
+              << " periods, engine loop " << periodTime << " us average, "
+              << std::chrono::duration_cast<std::chrono::microseconds>(stats.maxProcessingTime)
+                     .count()
+              << " us max, " << stats.underruns << " underruns" << std::endl;
+  }
+};
+} // unnamed namespace
+
+TEST_F(TestActiveAEBenchmark, DISABLED_Mix)
+{
+  Run("fast", std::vector<StreamSpec>(4, {48000, AE_CH_LAYOUT_2_0, 1.0}), 60s);
+}
+
+TEST_F(TestActiveAEBenchmark, DISABLED_Resample)
+{
+  Run("fast",
+      {{48000, AE_CH_LAYOUT_5_1, 1.0},
+       {44100, AE_CH_LAYOUT_2_0, 1.0},
+       {44100, AE_CH_LAYOUT_2_0, 1.001},
+       {96000, AE_CH_LAYOUT_7_1, 0.999}},
+      60s);
+}
+
+TEST_F(TestActiveAEBenchmark, DISABLED_Atempo)
+{
+  Run("fast",
+      {{48000, AE_CH_LAYOUT_2_0, 1.0},
+       {48000, AE_CH_LAYOUT_2_0, 1.1},
+       {48000, AE_CH_LAYOUT_5_1, 0.9}},
+      60s);
+}
+
+TEST_F(TestActiveAEBenchmark, DISABLED_RealTime)
+{
+  Run("default",
+      {{48000, AE_CH_LAYOUT_5_1, 1.0},
+       {44100, AE_CH_LAYOUT_2_0, 1.001},
+       {48000, AE_CH_LAYOUT_2_0, 1.1}},
+      10s);
+}
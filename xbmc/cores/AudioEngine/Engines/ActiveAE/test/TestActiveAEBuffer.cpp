@@ -0,0 +1,156 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/AudioEngine/Engines/ActiveAE/ActiveAEBuffer.h"
+#include "cores/AudioEngine/Utils/AEUtil.h"
+
+#include <deque>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+using namespace ActiveAE;
+
+namespace
+{
+constexpr int FRAMES = 960;
+
+AEAudioFormat MakeFormat(AEDataFormat dataFormat, AEStdChLayout layout)
+{
+  AEAudioFormat format;
+  format.m_dataFormat = dataFormat;
+  format.m_sampleRate = 48000;
+  format.m_channelLayout = layout;
+  format.m_frames = FRAMES;
+  format.m_frameSize =
+      format.m_channelLayout.Count() * (CAEUtil::DataFormatToBits(dataFormat) >> 3);
+  return format;
+}
+
+class TestActiveAEBuffer : public ::testing::Test
+{
+protected:
+  void Create(AEDataFormat inputFormat, AEDataFormat outputFormat, AEStdChLayout layout)
+  {
+    m_input = std::make_unique<CActiveAEBufferPool>(MakeFormat(inputFormat, layout));
+    m_input->Create(100);
+    m_resample = std::make_unique<CActiveAEBufferPoolResample>(
+        m_input->m_format, MakeFormat(outputFormat, layout), AE_QUALITY_MID);
+    m_resample->Create(100, false, false);
+  }
+
+  CSampleBuffer* Add(int64_t timestamp)
+  {
+    CSampleBuffer* buffer = m_input->GetFreeBuffer();
+    buffer->pkt->nb_samples = FRAMES;
+    buffer->timestamp = timestamp;
+    buffer->pkt_start_offset = 0;
+    m_resample->m_inputSamples.push_back(buffer);
+    return buffer;
+  }
+
+  CSampleBuffer* Get()
+  {
+    EXPECT_TRUE(m_resample->ResampleBuffers());
+    if (m_resample->m_outputSamples.empty())
+      return nullptr;
+    CSampleBuffer* buffer = m_resample->m_outputSamples.front();
+    m_resample->m_outputSamples.pop_front();
+    return buffer;
+  }
+
+  std::unique_ptr<CActiveAEBufferPool> m_input;
+  std::unique_ptr<CActiveAEBufferPoolResample> m_resample;
+};
+} // unnamed namespace
+
+TEST_F(TestActiveAEBuffer, MatchingFormatsPassThrough)
+{
+  Create(AE_FMT_FLOAT, AE_FMT_FLOAT, AE_CH_LAYOUT_5_1);
+
+  CSampleBuffer* in = Add(1000);
+  CSampleBuffer* out = Get();
+  EXPECT_EQ(in, out);
+  EXPECT_EQ(1000, out->timestamp);
+  EXPECT_FLOAT_EQ(0.0f, m_resample->GetDelay());
+  out->Return();
+}
+
+TEST_F(TestActiveAEBuffer, PlanarToInterleaved)
+{
+  Create(AE_FMT_FLOATP, AE_FMT_FLOAT, AE_CH_LAYOUT_2_0);
+  const size_t freeInput = m_input->m_freeSamples.size();
+
+  CSampleBuffer* in = Add(2000);
+  in->pkt_start_offset = 10;
+  for (int ch = 0; ch < 2; ch++)
+  {
+    float* plane = reinterpret_cast<float*>(in->pkt->data[ch]);
+    for (int i = 0; i < FRAMES; i++)
+      plane[i] = ch ? -i / 1024.0f : i / 1024.0f;
+  }
+
+  CSampleBuffer* out = Get();
+  ASSERT_NE(nullptr, out);
+  EXPECT_NE(in, out);
+  EXPECT_EQ(m_resample.get(), out->pool);
+  EXPECT_EQ(freeInput, m_input->m_freeSamples.size());
+  EXPECT_EQ(FRAMES, out->pkt->nb_samples);
+  EXPECT_EQ(2000, out->timestamp);
+  EXPECT_EQ(10, out->pkt_start_offset);
+
+  const float* samples = reinterpret_cast<const float*>(out->pkt->data[0]);
+  for (int i = 0; i < FRAMES; i++)
+  {
+    EXPECT_EQ(i / 1024.0f, samples[2 * i]);
+    EXPECT_EQ(-i / 1024.0f, samples[2 * i + 1]);
+  }
+  out->Return();
+}
+
+TEST_F(TestActiveAEBuffer, S16ToFloat)
+{
+  Create(AE_FMT_S16NE, AE_FMT_FLOAT, AE_CH_LAYOUT_2_0);
+
+  CSampleBuffer* in = Add(3000);
+  int16_t* samples = reinterpret_cast<int16_t*>(in->pkt->data[0]);
+  for (int i = 0; i < 2 * FRAMES; i++)
+    samples[i] = static_cast<int16_t>(i * 16 - 16384);
+
+  CSampleBuffer* out = Get();
+  ASSERT_NE(nullptr, out);
+  const float* converted = reinterpret_cast<const float*>(out->pkt->data[0]);
+  for (int i = 0; i < 2 * FRAMES; i++)
+    EXPECT_EQ((i * 16 - 16384) / 32768.0f, converted[i]);
+  out->Return();
+}
+
+TEST_F(TestActiveAEBuffer, WaitsForFreeBuffers)
+{
+  Create(AE_FMT_FLOATP, AE_FMT_FLOAT, AE_CH_LAYOUT_2_0);
+
+  std::deque<CSampleBuffer*> outputs;
+  while (!m_resample->m_freeSamples.empty())
+  {
+    Add(0);
+    outputs.push_back(Get());
+  }
+
+  // the input waits until an output buffer is returned
+  Add(0);
+  EXPECT_FALSE(m_resample->ResampleBuffers());
+  EXPECT_EQ(1u, m_resample->m_inputSamples.size());
+
+  outputs.front()->Return();
+  outputs.pop_front();
+  outputs.push_back(Get());
+  EXPECT_TRUE(m_resample->m_inputSamples.empty());
+
+  for (CSampleBuffer* buffer : outputs)
+    buffer->Return();
+}
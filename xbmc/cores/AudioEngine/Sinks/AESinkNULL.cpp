@@ -0,0 +1,242 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AESinkNULL.h"
+
+#include "cores/AudioEngine/AESinkFactory.h"
+#include "cores/AudioEngine/Utils/AEUtil.h"
+#include "threads/CriticalSection.h"
+#include "utils/StringUtils.h"
+#include "utils/XTimeUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <mutex>
+
+namespace
+{
+constexpr unsigned int PERIOD_MS = 20;
+constexpr unsigned int PERIODS = 4;
+
+constexpr const char* DEVICE_FAST = "fast";
+
+CCriticalSection statsSection;
+CAESinkNULL::Stats stats;
+} // unnamed namespace
+
+CAESinkNULL::CAESinkNULL(bool realtime) : m_realtime(realtime)
+{
+}
+
+CAESinkNULL::~CAESinkNULL()
+{
+  Deinitialize();
+}
+
+void CAESinkNULL::Register()
+{
+  AE::AESinkRegEntry entry;
+  entry.sinkName = "NULL";
+  entry.createFunc = CAESinkNULL::Create;
+  entry.enumerateFunc = CAESinkNULL::EnumerateDevicesEx;
+  AE::CAESinkFactory::RegisterSink(entry);
+}
+
+std::unique_ptr<IAESink> CAESinkNULL::Create(std::string& device, AEAudioFormat& desiredFormat)
+{
+  auto sink = std::make_unique<CAESinkNULL>(!StringUtils::EqualsNoCase(device, DEVICE_FAST));
+  if (sink->Initialize(desiredFormat, device))
+    return sink;
+
+  return {};
+}
+
+void CAESinkNULL::EnumerateDevicesEx(AEDeviceInfoList& list, bool force)
+{
+  CAEDeviceInfo info;
+  info.m_deviceType = AE_DEVTYPE_PCM;
+  info.m_channels = AE_CH_LAYOUT_7_1;
+  info.m_sampleRates = {8000,  11025, 16000, 22050,  32000, 44100,
+                        48000, 88200, 96000, 176400, 192000};
+  info.m_dataFormats = {AE_FMT_FLOAT, AE_FMT_S32NE, AE_FMT_S24NE4, AE_FMT_S24NE3, AE_FMT_S16NE};
+  info.m_wantsIECPassthrough = false;
+  info.m_onlyPCM = true;
+
+  info.m_deviceName = "default";
+  info.m_displayName = "Null (real time)";
+  list.push_back(info);
+
+  info.m_deviceName = DEVICE_FAST;
+  info.m_displayName = "Null (as fast as possible)";
+  list.push_back(info);
+}
+
+CAESinkNULL::Stats CAESinkNULL::GetStats()
+{
+  std::unique_lock lock(statsSection);
+  return stats;
+}
+
+void CAESinkNULL::ResetStats()
+{
+  std::unique_lock lock(statsSection);
+  stats = {};
+}
+
+bool CAESinkNULL::Initialize(AEAudioFormat& format, std::string& device)
+{
+  if (format.m_dataFormat == AE_FMT_RAW || format.m_sampleRate == 0)
+    return false;
+
+  if (AE_IS_PLANAR(format.m_dataFormat))
+    format.m_dataFormat = AE_FMT_FLOAT;
+  format.m_frames = format.m_sampleRate * PERIOD_MS / 1000;
+  format.m_frameSize =
+      format.m_channelLayout.Count() * (CAEUtil::DataFormatToBits(format.m_dataFormat) >> 3);
+
+  m_format = format;
+  m_bufferFrames = static_cast<uint64_t>(format.m_frames) * PERIODS;
+  m_written = 0;
+  m_played = 0;
+  m_running = false;
+  m_lastReturn = {};
+
+  CLog::Log(LOGDEBUG, "CAESinkNULL::Initialize - {} playing {} Hz in {} periods of {} frames",
+            m_realtime ? "real time" : "as fast as possible", format.m_sampleRate, PERIODS,
+            format.m_frames);
+  return true;
+}
+
+void CAESinkNULL::Deinitialize()
+{
+  m_written = 0;
+  m_played = 0;
+  m_running = false;
+}
+
+void CAESinkNULL::UpdateClock()
+{
+  if (!m_running)
+    return;
+
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_start;
+  const uint64_t played =
+      m_startFrames + static_cast<uint64_t>(elapsed.count() * m_format.m_sampleRate);
+  if (played >= m_written)
+  {
+    // the buffer ran dry, the clock restarts with the next frames
+    m_played = m_written;
+    m_running = false;
+
+    std::unique_lock lock(statsSection);
+    stats.underruns++;
+  }
+  else
+    m_played = played;
+}
+
+void CAESinkNULL::Play(uint64_t frames)
+{
+  frames = std::min(frames, m_written - m_played);
+  if (frames == 0)
+    return;
+
+  if (m_realtime)
+  {
+    const uint64_t target = m_played + frames;
+    while (m_running && m_played < target)
+    {
+      const uint64_t remaining = target - m_played;
+      KODI::TIME::Sleep(std::chrono::microseconds(
+          (remaining * 1000000 + m_format.m_sampleRate - 1) / m_format.m_sampleRate));
+      UpdateClock();
+    }
+  }
+  else
+    m_played += frames;
+}
+
+void CAESinkNULL::GetDelay(AEDelayStatus& status)
+{
+  UpdateClock();
+  status.SetDelay(static_cast<double>(m_written - m_played) / m_format.m_sampleRate);
+}
+
+double CAESinkNULL::GetCacheTotal()
+{
+  return static_cast<double>(m_bufferFrames) / m_format.m_sampleRate;
+}
+
+unsigned int CAESinkNULL::AddPackets(uint8_t** data, unsigned int frames, unsigned int offset)
+{
+  const auto entered = std::chrono::steady_clock::now();
+
+  UpdateClock();
+
+  // block until a period, or what is left of the packet, fits into the buffer
+  const uint64_t needed = std::min<uint64_t>(frames, m_format.m_frames);
+  const uint64_t buffered = m_written - m_played;
+  if (buffered + needed > m_bufferFrames)
+    Play(buffered + needed - m_bufferFrames);
+
+  const uint64_t space = m_bufferFrames - (m_written - m_played);
+  const unsigned int written = static_cast<unsigned int>(std::min<uint64_t>(frames, space));
+  m_written += written;
+
+  if (m_realtime && !m_running && written > 0)
+  {
+    m_running = true;
+    m_start = std::chrono::steady_clock::now();
+    m_startFrames = m_played;
+  }
+
+  {
+    std::unique_lock lock(statsSection);
+    stats.frames += written;
+    stats.periods++;
+    if (m_lastReturn != std::chrono::steady_clock::time_point{})
+    {
+      const auto processingTime = entered - m_lastReturn;
+      stats.processingTime += processingTime;
+      stats.maxProcessingTime = std::max<std::chrono::nanoseconds>(stats.maxProcessingTime,
+                                                                   processingTime);
+    }
+  }
+
+  m_lastReturn = std::chrono::steady_clock::now();
+  return written;
+}
+
+void CAESinkNULL::AddPause(unsigned int millis)
+{
+  if (m_realtime)
+  {
+    KODI::TIME::Sleep(std::chrono::milliseconds(millis));
+    UpdateClock();
+  }
+  else
+    Play(static_cast<uint64_t>(millis) * m_format.m_sampleRate / 1000);
+
+  // the time paused isn't spent by the engine
+  m_lastReturn = std::chrono::steady_clock::now();
+}
+
+void CAESinkNULL::Drain()
+{
+  UpdateClock();
+  if (m_realtime && m_running)
+  {
+    // wait for the buffer to be played out, without counting it running dry as an underrun
+    const uint64_t remaining = m_written - m_played;
+    KODI::TIME::Sleep(std::chrono::microseconds(
+        (remaining * 1000000 + m_format.m_sampleRate - 1) / m_format.m_sampleRate));
+  }
+  m_played = m_written;
+  m_running = false;
+  m_lastReturn = {};
+}
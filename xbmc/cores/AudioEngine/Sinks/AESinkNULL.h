@@ -0,0 +1,78 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "cores/AudioEngine/Interfaces/AESink.h"
+#include "cores/AudioEngine/Utils/AEDeviceInfo.h"
+
+#include <chrono>
+#include <stdint.h>
+
+/*!
+ \brief A sink without a sound device, for running and benchmarking the engine headless
+
+ The samples are discarded, the sink plays them with a simulated clock. Its device "default"
+ plays them in real time: AddPackets blocks while the buffer is full and the buffer running dry
+ counts as an underrun, like a sound card would. The device "fast" plays them as fast as they
+ are added: the clock advances whenever the buffer is full, so the engine runs as fast as it can
+ while the delays it gets are the same as in real time.
+ */
+class CAESinkNULL : public IAESink
+{
+public:
+  //! What the sinks played since the last ResetStats()
+  struct Stats
+  {
+    uint64_t frames{0};
+    uint64_t periods{0}; //!< the calls of AddPackets
+    uint64_t underruns{0};
+    //! time spent outside of AddPackets between two calls, i.e. the time the engine took to
+    //! produce a period
+    std::chrono::nanoseconds processingTime{0};
+    std::chrono::nanoseconds maxProcessingTime{0};
+  };
+
+  const char* GetName() override { return "NULL"; }
+
+  explicit CAESinkNULL(bool realtime);
+  ~CAESinkNULL() override;
+
+  static void Register();
+  static std::unique_ptr<IAESink> Create(std::string& device, AEAudioFormat& desiredFormat);
+  static void EnumerateDevicesEx(AEDeviceInfoList& list, bool force = false);
+
+  static Stats GetStats();
+  static void ResetStats();
+
+  bool Initialize(AEAudioFormat& format, std::string& device) override;
+  void Deinitialize() override;
+
+  void GetDelay(AEDelayStatus& status) override;
+  double GetCacheTotal() override;
+  unsigned int AddPackets(uint8_t** data, unsigned int frames, unsigned int offset) override;
+  void AddPause(unsigned int millis) override;
+  void Drain() override;
+
+private:
+  void UpdateClock();
+  void Play(uint64_t frames);
+
+  const bool m_realtime;
+  AEAudioFormat m_format;
+  uint64_t m_bufferFrames{0};
+  uint64_t m_written{0};
+  uint64_t m_played{0};
+
+  // the real time clock, running while there are frames to play
+  bool m_running{false};
+  std::chrono::steady_clock::time_point m_start;
+  uint64_t m_startFrames{0};
+
+  std::chrono::steady_clock::time_point m_lastReturn;
+};
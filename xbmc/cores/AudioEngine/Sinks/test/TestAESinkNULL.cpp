@@ -0,0 +1,147 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/AudioEngine/Sinks/AESinkNULL.h"
+#include "cores/AudioEngine/Utils/AEUtil.h"
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr unsigned int PERIOD = 960; // 20 ms at 48 kHz
+constexpr unsigned int BUFFER = 4 * PERIOD;
+
+class TestAESinkNULL : public ::testing::Test
+{
+protected:
+  TestAESinkNULL() : m_samples(2 * BUFFER) { CAESinkNULL::ResetStats(); }
+
+  std::unique_ptr<IAESink> Create(const std::string& device)
+  {
+    m_format.m_dataFormat = AE_FMT_FLOATP;
+    m_format.m_sampleRate = 48000;
+    m_format.m_channelLayout = AE_CH_LAYOUT_2_0;
+    std::string name = device;
+    return CAESinkNULL::Create(name, m_format);
+  }
+
+  unsigned int Add(IAESink& sink, unsigned int frames)
+  {
+    uint8_t* planes[] = {reinterpret_cast<uint8_t*>(m_samples.data())};
+    return sink.AddPackets(planes, frames, 0);
+  }
+
+  static double GetDelay(IAESink& sink)
+  {
+    AEDelayStatus status;
+    sink.GetDelay(status);
+    return status.delay;
+  }
+
+  AEAudioFormat m_format;
+  std::vector<float> m_samples;
+};
+} // unnamed namespace
+
+TEST_F(TestAESinkNULL, Initialize)
+{
+  auto sink = Create("fast");
+  ASSERT_NE(nullptr, sink);
+  EXPECT_STREQ("NULL", sink->GetName());
+  EXPECT_EQ(AE_FMT_FLOAT, m_format.m_dataFormat);
+  EXPECT_EQ(PERIOD, m_format.m_frames);
+  EXPECT_EQ(8u, m_format.m_frameSize);
+  EXPECT_DOUBLE_EQ(0.08, sink->GetCacheTotal());
+  EXPECT_DOUBLE_EQ(0.0, GetDelay(*sink));
+
+  m_format.m_dataFormat = AE_FMT_RAW;
+  std::string device = "fast";
+  EXPECT_EQ(nullptr, CAESinkNULL::Create(device, m_format));
+}
+
+TEST_F(TestAESinkNULL, Enumerate)
+{
+  AEDeviceInfoList devices;
+  CAESinkNULL::EnumerateDevicesEx(devices);
+  ASSERT_EQ(2u, devices.size());
+  EXPECT_EQ("default", devices[0].m_deviceName);
+  EXPECT_EQ("fast", devices[1].m_deviceName);
+  EXPECT_TRUE(devices[1].m_streamTypes.empty());
+}
+
+TEST_F(TestAESinkNULL, FastClock)
+{
+  auto sink = Create("fast");
+  ASSERT_NE(nullptr, sink);
+
+  // nothing is played until the buffer is full
+  EXPECT_EQ(100u, Add(*sink, 100));
+  EXPECT_DOUBLE_EQ(100.0 / 48000, GetDelay(*sink));
+  for (unsigned int i = 0; i < 3; ++i)
+    EXPECT_EQ(PERIOD, Add(*sink, PERIOD));
+  EXPECT_DOUBLE_EQ((100.0 + 3 * PERIOD) / 48000, GetDelay(*sink));
+
+  // from then on the clock advances by what is added, so the delay stays the one of a full buffer
+  const auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < 1000; ++i)
+  {
+    EXPECT_EQ(PERIOD, Add(*sink, 2 * PERIOD));
+    EXPECT_DOUBLE_EQ(static_cast<double>(BUFFER) / 48000, GetDelay(*sink));
+  }
+  // 20 seconds of audio
+  EXPECT_LT(std::chrono::steady_clock::now() - start, 5s);
+
+  sink->Drain();
+  EXPECT_DOUBLE_EQ(0.0, GetDelay(*sink));
+
+  const CAESinkNULL::Stats stats = CAESinkNULL::GetStats();
+  EXPECT_EQ(100u + 1003 * PERIOD, stats.frames);
+  EXPECT_EQ(1004u, stats.periods);
+  EXPECT_EQ(0u, stats.underruns);
+  EXPECT_GE(stats.processingTime, stats.maxProcessingTime);
+}
+
+TEST_F(TestAESinkNULL, RealtimeBlocksWhileFull)
+{
+  auto sink = Create("default");
+  ASSERT_NE(nullptr, sink);
+
+  EXPECT_EQ(BUFFER, Add(*sink, BUFFER));
+  EXPECT_LE(GetDelay(*sink), 0.08);
+
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(PERIOD, Add(*sink, PERIOD));
+  EXPECT_GE(std::chrono::steady_clock::now() - start, 15ms);
+  EXPECT_LE(GetDelay(*sink), 0.08);
+  EXPECT_EQ(0u, CAESinkNULL::GetStats().underruns);
+}
+
+TEST_F(TestAESinkNULL, RealtimeUnderrun)
+{
+  auto sink = Create("default");
+  ASSERT_NE(nullptr, sink);
+
+  EXPECT_EQ(PERIOD, Add(*sink, PERIOD));
+  std::this_thread::sleep_for(100ms);
+  EXPECT_DOUBLE_EQ(0.0, GetDelay(*sink));
+  EXPECT_EQ(PERIOD, Add(*sink, PERIOD));
+  EXPECT_EQ(1u, CAESinkNULL::GetStats().underruns);
+
+  // running dry after draining is no underrun
+  sink->Drain();
+  std::this_thread::sleep_for(50ms);
+  EXPECT_EQ(PERIOD, Add(*sink, PERIOD));
+  EXPECT_EQ(1u, CAESinkNULL::GetStats().underruns);
+}
@@ -0,0 +1,146 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AEKernels.h"
+
+// built with -mavx2, MSVC provides the intrinsics without
+#if defined(__AVX2__) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+#include "AEKernelsImpl.h"
+
+#include <immintrin.h>
+
+namespace
+{
+struct AVX2
+{
+  using Float = __m256;
+  using Mask = __m256;
+  using Int = __m256i;
+  static constexpr size_t WIDTH = 8;
+
+  static Float Load(const float* p) { return _mm256_loadu_ps(p); }
+  static void Store(float* p, Float v) { _mm256_storeu_ps(p, v); }
+  static Float Set1(float v) { return _mm256_set1_ps(v); }
+  static Float Iota() { return _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f); }
+  static Float Add(Float a, Float b) { return _mm256_add_ps(a, b); }
+  static Float Mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+  static Float Div(Float a, Float b) { return _mm256_div_ps(a, b); }
+  static Float Min(Float a, Float b) { return _mm256_min_ps(a, b); }
+  static Float Max(Float a, Float b) { return _mm256_max_ps(a, b); }
+  static Float Abs(Float v)
+  {
+    return _mm256_and_ps(v, _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff)));
+  }
+  static Mask Less(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+  static Mask Greater(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+  static Float Select(Mask mask, Float a, Float b) { return _mm256_blendv_ps(b, a, mask); }
+  static float HorizontalMax(Float v)
+  {
+    __m128 m = _mm_max_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+    m = _mm_max_ss(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 1, 1, 1)));
+    return _mm_cvtss_f32(m);
+  }
+  static Int ToInt(Float v) { return _mm256_cvtps_epi32(v); }
+  static Float FromInt(Int v) { return _mm256_cvtepi32_ps(v); }
+  static Int LoadInt(const int32_t* p)
+  {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+  }
+  static void StoreInt(int32_t* p, Int v)
+  {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+  }
+  static Int LoadS16(const int16_t* p)
+  {
+    return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+  }
+  static void StoreS16(int16_t* p, Int v)
+  {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p),
+                     _mm_packs_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1)));
+  }
+};
+
+void Interleave(float* dst, const float* const* src, unsigned int channels, size_t frames)
+{
+  if (channels != 2)
+  {
+    REFERENCE::Interleave(dst, src, channels, frames);
+    return;
+  }
+
+  const float* left = src[0];
+  const float* right = src[1];
+  size_t i = 0;
+  for (; i + 8 <= frames; i += 8, dst += 16)
+  {
+    const __m256 l = _mm256_loadu_ps(left + i);
+    const __m256 r = _mm256_loadu_ps(right + i);
+    // the unpacks work on the 128 bit lanes
+    const __m256 low = _mm256_unpacklo_ps(l, r);
+    const __m256 high = _mm256_unpackhi_ps(l, r);
+    _mm256_storeu_ps(dst, _mm256_permute2f128_ps(low, high, 0x20));
+    _mm256_storeu_ps(dst + 8, _mm256_permute2f128_ps(low, high, 0x31));
+  }
+  const float* const rest[2] = {left + i, right + i};
+  REFERENCE::Interleave(dst, rest, channels, frames - i);
+}
+
+void Deinterleave(float* const* dst, const float* src, unsigned int channels, size_t frames)
+{
+  if (channels != 2)
+  {
+    REFERENCE::Deinterleave(dst, src, channels, frames);
+    return;
+  }
+
+  float* left = dst[0];
+  float* right = dst[1];
+  size_t i = 0;
+  for (; i + 8 <= frames; i += 8, src += 16)
+  {
+    const __m256 a = _mm256_loadu_ps(src);
+    const __m256 b = _mm256_loadu_ps(src + 8);
+    const __m256 low = _mm256_permute2f128_ps(a, b, 0x20);
+    const __m256 high = _mm256_permute2f128_ps(a, b, 0x31);
+    _mm256_storeu_ps(left + i, _mm256_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm256_storeu_ps(right + i, _mm256_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1)));
+  }
+  float* const rest[2] = {left + i, right + i};
+  REFERENCE::Deinterleave(rest, src, channels, frames - i);
+}
+
+using Kernels = CVectorKernels<AVX2>;
+
+const CAEKernels::Implementation AVX2_KERNELS{.name = "AVX2",
+                                              .mul = Kernels::Mul,
+                                              .mulAdd = Kernels::MulAdd,
+                                              .gainRamp = Kernels::GainRamp,
+                                              .softClamp = Kernels::SoftClamp,
+                                              .interleave = Interleave,
+                                              .deinterleave = Deinterleave,
+                                              .floatToS16 = Kernels::FloatToS16,
+                                              .s16ToFloat = Kernels::S16ToFloat,
+                                              .floatToS32 = Kernels::FloatToS32,
+                                              .s32ToFloat = Kernels::S32ToFloat};
+} // unnamed namespace
+
+const CAEKernels::Implementation* AE_KERNELS::GetAVX2()
+{
+  return &AVX2_KERNELS;
+}
+
+#else
+
+const CAEKernels::Implementation* AE_KERNELS::GetAVX2()
+{
+  return nullptr;
+}
+
+#endif
@@ -0,0 +1,91 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AEKernels.h"
+
+// built with -mavx512f, MSVC provides the intrinsics without
+#if defined(__AVX512F__) || (defined(_MSC_VER) && defined(_M_X64))
+#include "AEKernelsImpl.h"
+
+#include <immintrin.h>
+
+namespace
+{
+// AVX-512 Foundation only, which all CPUs supporting AVX-512 have
+struct AVX512
+{
+  using Float = __m512;
+  using Mask = __mmask16;
+  using Int = __m512i;
+  static constexpr size_t WIDTH = 16;
+
+  static Float Load(const float* p) { return _mm512_loadu_ps(p); }
+  static void Store(float* p, Float v) { _mm512_storeu_ps(p, v); }
+  static Float Set1(float v) { return _mm512_set1_ps(v); }
+  static Float Iota()
+  {
+    return _mm512_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f,
+                          11.0f, 12.0f, 13.0f, 14.0f, 15.0f);
+  }
+  static Float Add(Float a, Float b) { return _mm512_add_ps(a, b); }
+  static Float Mul(Float a, Float b) { return _mm512_mul_ps(a, b); }
+  static Float Div(Float a, Float b) { return _mm512_div_ps(a, b); }
+  static Float Min(Float a, Float b) { return _mm512_min_ps(a, b); }
+  static Float Max(Float a, Float b) { return _mm512_max_ps(a, b); }
+  static Float Abs(Float v)
+  {
+    return _mm512_castsi512_ps(
+        _mm512_and_si512(_mm512_castps_si512(v), _mm512_set1_epi32(0x7fffffff)));
+  }
+  static Mask Less(Float a, Float b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+  static Mask Greater(Float a, Float b) { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+  static Float Select(Mask mask, Float a, Float b) { return _mm512_mask_blend_ps(mask, b, a); }
+  static float HorizontalMax(Float v) { return _mm512_reduce_max_ps(v); }
+  static Int ToInt(Float v) { return _mm512_cvtps_epi32(v); }
+  static Float FromInt(Int v) { return _mm512_cvtepi32_ps(v); }
+  static Int LoadInt(const int32_t* p) { return _mm512_loadu_si512(p); }
+  static void StoreInt(int32_t* p, Int v) { _mm512_storeu_si512(p, v); }
+  static Int LoadS16(const int16_t* p)
+  {
+    return _mm512_cvtepi16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+  }
+  static void StoreS16(int16_t* p, Int v)
+  {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm512_cvtsepi32_epi16(v));
+  }
+};
+
+using Kernels = CVectorKernels<AVX512>;
+
+// interleaving is left to AVX2, the shuffles across lanes don't gain anything with wider vectors
+const CAEKernels::Implementation AVX512_KERNELS{.name = "AVX-512",
+                                                .mul = Kernels::Mul,
+                                                .mulAdd = Kernels::MulAdd,
+                                                .gainRamp = Kernels::GainRamp,
+                                                .softClamp = Kernels::SoftClamp,
+                                                .interleave = nullptr,
+                                                .deinterleave = nullptr,
+                                                .floatToS16 = Kernels::FloatToS16,
+                                                .s16ToFloat = Kernels::S16ToFloat,
+                                                .floatToS32 = Kernels::FloatToS32,
+                                                .s32ToFloat = Kernels::S32ToFloat};
+} // unnamed namespace
+
+const CAEKernels::Implementation* AE_KERNELS::GetAVX512()
+{
+  return &AVX512_KERNELS;
+}
+
+#else
+
+const CAEKernels::Implementation* AE_KERNELS::GetAVX512()
+{
+  return nullptr;
+}
+
+#endif
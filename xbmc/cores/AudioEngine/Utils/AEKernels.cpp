@@ -0,0 +1,158 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AEKernels.h"
+
+#include "AEKernelsImpl.h"
+#include "utils/log.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define AE_KERNELS_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#elif (defined(__arm__) || defined(_M_ARM)) && !defined(__aarch64__)
+#include "ServiceBroker.h"
+#include "utils/CPUInfo.h"
+#endif
+
+namespace
+{
+const CAEKernels::Implementation REFERENCE_KERNELS{.name = "reference",
+                                                   .mul = REFERENCE::Mul,
+                                                   .mulAdd = REFERENCE::MulAdd,
+                                                   .gainRamp = REFERENCE::GainRamp,
+                                                   .softClamp = REFERENCE::SoftClamp,
+                                                   .interleave = REFERENCE::Interleave,
+                                                   .deinterleave = REFERENCE::Deinterleave,
+                                                   .floatToS16 = REFERENCE::FloatToS16,
+                                                   .s16ToFloat = REFERENCE::S16ToFloat,
+                                                   .floatToS32 = REFERENCE::FloatToS32,
+                                                   .s32ToFloat = REFERENCE::S32ToFloat};
+
+#if defined(AE_KERNELS_X86)
+struct X86Features
+{
+  bool sse2 = false;
+  bool avx2 = false;
+  bool avx512 = false;
+};
+
+X86Features GetX86Features()
+{
+  X86Features features;
+#if defined(_MSC_VER)
+  int info[4];
+  __cpuid(info, 0);
+  const int maxLeaf = info[0];
+  __cpuid(info, 1);
+  features.sse2 = (info[3] & (1 << 26)) != 0;
+  // the OS has to save the registers, too
+  const bool osxsave = (info[2] & (1 << 27)) != 0;
+  const unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+  if (maxLeaf >= 7)
+  {
+    __cpuidex(info, 7, 0);
+    features.avx2 = (xcr0 & 0x6) == 0x6 && (info[1] & (1 << 5)) != 0;
+    features.avx512 = (xcr0 & 0xe6) == 0xe6 && (info[1] & (1 << 16)) != 0;
+  }
+#else
+  __builtin_cpu_init();
+  features.sse2 = __builtin_cpu_supports("sse2");
+  features.avx2 = __builtin_cpu_supports("avx2");
+  features.avx512 = __builtin_cpu_supports("avx512f");
+#endif
+  return features;
+}
+#else
+bool HasNEON()
+{
+#if defined(__aarch64__) || defined(_M_ARM64)
+  return true;
+#elif defined(__arm__) || defined(_M_ARM)
+  const auto cpuInfo = CServiceBroker::GetCPUInfo();
+  return cpuInfo && (cpuInfo->GetCPUFeatures() & CPU_FEATURE_NEON) == CPU_FEATURE_NEON;
+#else
+  return false;
+#endif
+}
+#endif
+
+// add an implementation, with the kernels it leaves out taken from the previous one
+void Add(std::vector<CAEKernels::Implementation>& implementations,
+         const CAEKernels::Implementation* implementation)
+{
+  if (!implementation)
+    return;
+
+  CAEKernels::Implementation completed = *implementation;
+  const CAEKernels::Implementation& previous = implementations.back();
+  if (!completed.mul)
+    completed.mul = previous.mul;
+  if (!completed.mulAdd)
+    completed.mulAdd = previous.mulAdd;
+  if (!completed.gainRamp)
+    completed.gainRamp = previous.gainRamp;
+  if (!completed.softClamp)
+    completed.softClamp = previous.softClamp;
+  if (!completed.interleave)
+    completed.interleave = previous.interleave;
+  if (!completed.deinterleave)
+    completed.deinterleave = previous.deinterleave;
+  if (!completed.floatToS16)
+    completed.floatToS16 = previous.floatToS16;
+  if (!completed.s16ToFloat)
+    completed.s16ToFloat = previous.s16ToFloat;
+  if (!completed.floatToS32)
+    completed.floatToS32 = previous.floatToS32;
+  if (!completed.s32ToFloat)
+    completed.s32ToFloat = previous.s32ToFloat;
+  implementations.emplace_back(completed);
+}
+
+std::vector<CAEKernels::Implementation> CreateImplementations()
+{
+  std::vector<CAEKernels::Implementation> implementations{REFERENCE_KERNELS};
+
+#if defined(AE_KERNELS_X86)
+  const X86Features features = GetX86Features();
+  if (features.sse2)
+  {
+    Add(implementations, AE_KERNELS::GetSSE2());
+    if (features.avx2)
+    {
+      Add(implementations, AE_KERNELS::GetAVX2());
+      if (features.avx512)
+        Add(implementations, AE_KERNELS::GetAVX512());
+    }
+  }
+#else
+  if (HasNEON())
+    Add(implementations, AE_KERNELS::GetNEON());
+#endif
+
+  return implementations;
+}
+} // unnamed namespace
+
+const std::vector<CAEKernels::Implementation>& CAEKernels::GetImplementations()
+{
+  static const std::vector<Implementation> implementations = CreateImplementations();
+  return implementations;
+}
+
+const CAEKernels::Implementation& CAEKernels::Get()
+{
+  static const Implementation& implementation = []() -> const Implementation&
+  {
+    const Implementation& best = GetImplementations().back();
+    CLog::Log(LOGINFO, "CAEKernels - using the {} kernels", best.name);
+    return best;
+  }();
+  return implementation;
+}
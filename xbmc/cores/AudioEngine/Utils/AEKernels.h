@@ -0,0 +1,117 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/*!
+ \brief Sample processing kernels of the audio engine, selected for the CPU at runtime
+
+ Every kernel has a scalar reference implementation, and implementations for SSE2, AVX2 and
+ AVX-512 on x86 and for NEON on ARM. The best one the CPU supports is picked on first use. All of
+ them produce exactly the same samples as the reference, they are built without contracting
+ multiplications and additions into fused ones.
+
+ The float to integer conversions clamp to [-1, 1] and round to the nearest integer, ties to even.
+ */
+class CAEKernels
+{
+public:
+  struct Implementation
+  {
+    const char* name;
+    void (*mul)(float* data, float gain, size_t count);
+    float (*mulAdd)(float* dst, const float* src, float gain, size_t count);
+    void (*gainRamp)(float* data, float gain, float step, size_t count);
+    void (*softClamp)(float* data, size_t count);
+    void (*interleave)(float* dst, const float* const* src, unsigned int channels, size_t frames);
+    void (*deinterleave)(float* const* dst, const float* src, unsigned int channels, size_t frames);
+    void (*floatToS16)(int16_t* dst, const float* src, size_t count);
+    void (*s16ToFloat)(float* dst, const int16_t* src, size_t count);
+    void (*floatToS32)(int32_t* dst, const float* src, size_t count);
+    void (*s32ToFloat)(float* dst, const int32_t* src, size_t count);
+  };
+
+  //! data[i] *= gain
+  static void Mul(float* data, float gain, size_t count) { Get().mul(data, gain, count); }
+
+  /*!
+   \brief dst[i] += src[i] * gain
+   \return the highest absolute value of the mixed samples, to tell whether they need clamping
+   */
+  static float MulAdd(float* dst, const float* src, float gain, size_t count)
+  {
+    return Get().mulAdd(dst, src, gain, count);
+  }
+
+  //! data[i] *= gain + step * i, for the samples of one channel
+  static void GainRamp(float* data, float gain, float step, size_t count)
+  {
+    Get().gainRamp(data, gain, step, count);
+  }
+
+  //! Clamp to [-1, 1] with a tanh like curve
+  static void SoftClamp(float* data, size_t count) { Get().softClamp(data, count); }
+
+  static void Interleave(float* dst, const float* const* src, unsigned int channels, size_t frames)
+  {
+    Get().interleave(dst, src, channels, frames);
+  }
+
+  static void Deinterleave(float* const* dst,
+                           const float* src,
+                           unsigned int channels,
+                           size_t frames)
+  {
+    Get().deinterleave(dst, src, channels, frames);
+  }
+
+  static void FloatToS16(int16_t* dst, const float* src, size_t count)
+  {
+    Get().floatToS16(dst, src, count);
+  }
+
+  static void S16ToFloat(float* dst, const int16_t* src, size_t count)
+  {
+    Get().s16ToFloat(dst, src, count);
+  }
+
+  static void FloatToS32(int32_t* dst, const float* src, size_t count)
+  {
+    Get().floatToS32(dst, src, count);
+  }
+
+  static void S32ToFloat(float* dst, const int32_t* src, size_t count)
+  {
+    Get().s32ToFloat(dst, src, count);
+  }
+
+  /*!
+   \brief The implementation used, the best one the CPU supports
+   */
+  static const Implementation& Get();
+
+  /*!
+   \brief All implementations the CPU supports, the scalar reference first and the best last
+   */
+  static const std::vector<Implementation>& GetImplementations();
+};
+
+namespace AE_KERNELS
+{
+// implemented by the translation units built for the instruction sets, nullptr if the build
+// doesn't support them. Kernels an implementation doesn't improve on are left nullptr, those of
+// the next lower one are used instead.
+const CAEKernels::Implementation* GetSSE2();
+const CAEKernels::Implementation* GetAVX2();
+const CAEKernels::Implementation* GetAVX512();
+const CAEKernels::Implementation* GetNEON();
+} // namespace AE_KERNELS
@@ -0,0 +1,144 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AEKernels.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include "AEKernelsImpl.h"
+
+#include <arm_neon.h>
+
+namespace
+{
+struct NEON
+{
+  using Float = float32x4_t;
+  using Mask = uint32x4_t;
+  using Int = int32x4_t;
+  static constexpr size_t WIDTH = 4;
+
+  static Float Load(const float* p) { return vld1q_f32(p); }
+  static void Store(float* p, Float v) { vst1q_f32(p, v); }
+  static Float Set1(float v) { return vdupq_n_f32(v); }
+  static Float Iota()
+  {
+    static const float iota[4] = {0.0f, 1.0f, 2.0f, 3.0f};
+    return vld1q_f32(iota);
+  }
+  static Float Add(Float a, Float b) { return vaddq_f32(a, b); }
+  static Float Mul(Float a, Float b) { return vmulq_f32(a, b); }
+  // vminq/vmaxq return NaN for NaN operands, unlike the reference
+  static Float Min(Float a, Float b) { return vbslq_f32(vcltq_f32(a, b), a, b); }
+  static Float Max(Float a, Float b) { return vbslq_f32(vcgtq_f32(a, b), a, b); }
+  static Float Abs(Float v) { return vabsq_f32(v); }
+  static Mask Less(Float a, Float b) { return vcltq_f32(a, b); }
+  static Mask Greater(Float a, Float b) { return vcgtq_f32(a, b); }
+  static Float Select(Mask mask, Float a, Float b) { return vbslq_f32(mask, a, b); }
+  static float HorizontalMax(Float v)
+  {
+    float32x2_t m = vpmax_f32(vget_low_f32(v), vget_high_f32(v));
+    m = vpmax_f32(m, m);
+    return vget_lane_f32(m, 0);
+  }
+  static Float FromInt(Int v) { return vcvtq_f32_s32(v); }
+  static Int LoadInt(const int32_t* p) { return vld1q_s32(p); }
+  static void StoreInt(int32_t* p, Int v) { vst1q_s32(p, v); }
+  static Int LoadS16(const int16_t* p) { return vmovl_s16(vld1_s16(p)); }
+  static void StoreS16(int16_t* p, Int v) { vst1_s16(p, vqmovn_s32(v)); }
+#if defined(__aarch64__)
+  // ARMv7 lacks a division and a conversion rounding to nearest, the reference is used there
+  static Float Div(Float a, Float b) { return vdivq_f32(a, b); }
+  static Int ToInt(Float v) { return vcvtnq_s32_f32(v); }
+#endif
+};
+
+void Interleave(float* dst, const float* const* src, unsigned int channels, size_t frames)
+{
+  if (channels != 2)
+  {
+    REFERENCE::Interleave(dst, src, channels, frames);
+    return;
+  }
+
+  const float* left = src[0];
+  const float* right = src[1];
+  size_t i = 0;
+  for (; i + 4 <= frames; i += 4, dst += 8)
+  {
+    float32x4x2_t v;
+    v.val[0] = vld1q_f32(left + i);
+    v.val[1] = vld1q_f32(right + i);
+    vst2q_f32(dst, v);
+  }
+  const float* const rest[2] = {left + i, right + i};
+  REFERENCE::Interleave(dst, rest, channels, frames - i);
+}
+
+void Deinterleave(float* const* dst, const float* src, unsigned int channels, size_t frames)
+{
+  if (channels != 2)
+  {
+    REFERENCE::Deinterleave(dst, src, channels, frames);
+    return;
+  }
+
+  float* left = dst[0];
+  float* right = dst[1];
+  size_t i = 0;
+  for (; i + 4 <= frames; i += 4, src += 8)
+  {
+    const float32x4x2_t v = vld2q_f32(src);
+    vst1q_f32(left + i, v.val[0]);
+    vst1q_f32(right + i, v.val[1]);
+  }
+  float* const rest[2] = {left + i, right + i};
+  REFERENCE::Deinterleave(rest, src, channels, frames - i);
+}
+
+using Kernels = CVectorKernels<NEON>;
+
+#if defined(__aarch64__)
+const CAEKernels::Implementation NEON_KERNELS{.name = "NEON",
+                                              .mul = Kernels::Mul,
+                                              .mulAdd = Kernels::MulAdd,
+                                              .gainRamp = Kernels::GainRamp,
+                                              .softClamp = Kernels::SoftClamp,
+                                              .interleave = Interleave,
+                                              .deinterleave = Deinterleave,
+                                              .floatToS16 = Kernels::FloatToS16,
+                                              .s16ToFloat = Kernels::S16ToFloat,
+                                              .floatToS32 = Kernels::FloatToS32,
+                                              .s32ToFloat = Kernels::S32ToFloat};
+#else
+const CAEKernels::Implementation NEON_KERNELS{.name = "NEON",
+                                              .mul = Kernels::Mul,
+                                              .mulAdd = Kernels::MulAdd,
+                                              .gainRamp = Kernels::GainRamp,
+                                              .softClamp = nullptr,
+                                              .interleave = Interleave,
+                                              .deinterleave = Deinterleave,
+                                              .floatToS16 = nullptr,
+                                              .s16ToFloat = Kernels::S16ToFloat,
+                                              .floatToS32 = nullptr,
+                                              .s32ToFloat = Kernels::S32ToFloat};
+#endif
+} // unnamed namespace
+
+const CAEKernels::Implementation* AE_KERNELS::GetNEON()
+{
+  return &NEON_KERNELS;
+}
+
+#else
+
+const CAEKernels::Implementation* AE_KERNELS::GetNEON()
+{
+  return nullptr;
+}
+
+#endif
@@ -0,0 +1,133 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AEKernels.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include "AEKernelsImpl.h"
+
+#include <emmintrin.h>
+
+namespace
+{
+struct SSE2
+{
+  using Float = __m128;
+  using Mask = __m128;
+  using Int = __m128i;
+  static constexpr size_t WIDTH = 4;
+
+  static Float Load(const float* p) { return _mm_loadu_ps(p); }
+  static void Store(float* p, Float v) { _mm_storeu_ps(p, v); }
+  static Float Set1(float v) { return _mm_set1_ps(v); }
+  static Float Iota() { return _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f); }
+  static Float Add(Float a, Float b) { return _mm_add_ps(a, b); }
+  static Float Mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+  static Float Div(Float a, Float b) { return _mm_div_ps(a, b); }
+  static Float Min(Float a, Float b) { return _mm_min_ps(a, b); }
+  static Float Max(Float a, Float b) { return _mm_max_ps(a, b); }
+  static Float Abs(Float v) { return _mm_and_ps(v, _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff))); }
+  static Mask Less(Float a, Float b) { return _mm_cmplt_ps(a, b); }
+  static Mask Greater(Float a, Float b) { return _mm_cmpgt_ps(a, b); }
+  static Float Select(Mask mask, Float a, Float b)
+  {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+  }
+  static float HorizontalMax(Float v)
+  {
+    v = _mm_max_ps(v, _mm_movehl_ps(v, v));
+    v = _mm_max_ss(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+    return _mm_cvtss_f32(v);
+  }
+  static Int ToInt(Float v) { return _mm_cvtps_epi32(v); }
+  static Float FromInt(Int v) { return _mm_cvtepi32_ps(v); }
+  static Int LoadInt(const int32_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+  static void StoreInt(int32_t* p, Int v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+  static Int LoadS16(const int16_t* p)
+  {
+    const __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+    return _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+  }
+  static void StoreS16(int16_t* p, Int v)
+  {
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_packs_epi32(v, v));
+  }
+};
+
+void Interleave(float* dst, const float* const* src, unsigned int channels, size_t frames)
+{
+  if (channels != 2)
+  {
+    REFERENCE::Interleave(dst, src, channels, frames);
+    return;
+  }
+
+  const float* left = src[0];
+  const float* right = src[1];
+  size_t i = 0;
+  for (; i + 4 <= frames; i += 4, dst += 8)
+  {
+    const __m128 l = _mm_loadu_ps(left + i);
+    const __m128 r = _mm_loadu_ps(right + i);
+    _mm_storeu_ps(dst, _mm_unpacklo_ps(l, r));
+    _mm_storeu_ps(dst + 4, _mm_unpackhi_ps(l, r));
+  }
+  const float* const rest[2] = {left + i, right + i};
+  REFERENCE::Interleave(dst, rest, channels, frames - i);
+}
+
+void Deinterleave(float* const* dst, const float* src, unsigned int channels, size_t frames)
+{
+  if (channels != 2)
+  {
+    REFERENCE::Deinterleave(dst, src, channels, frames);
+    return;
+  }
+
+  float* left = dst[0];
+  float* right = dst[1];
+  size_t i = 0;
+  for (; i + 4 <= frames; i += 4, src += 8)
+  {
+    const __m128 a = _mm_loadu_ps(src);
+    const __m128 b = _mm_loadu_ps(src + 4);
+    _mm_storeu_ps(left + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(right + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+  }
+  float* const rest[2] = {left + i, right + i};
+  REFERENCE::Deinterleave(rest, src, channels, frames - i);
+}
+
+using Kernels = CVectorKernels<SSE2>;
+
+const CAEKernels::Implementation SSE2_KERNELS{.name = "SSE2",
+                                              .mul = Kernels::Mul,
+                                              .mulAdd = Kernels::MulAdd,
+                                              .gainRamp = Kernels::GainRamp,
+                                              .softClamp = Kernels::SoftClamp,
+                                              .interleave = Interleave,
+                                              .deinterleave = Deinterleave,
+                                              .floatToS16 = Kernels::FloatToS16,
+                                              .s16ToFloat = Kernels::S16ToFloat,
+                                              .floatToS32 = Kernels::FloatToS32,
+                                              .s32ToFloat = Kernels::S32ToFloat};
+} // unnamed namespace
+
+const CAEKernels::Implementation* AE_KERNELS::GetSSE2()
+{
+  return &SSE2_KERNELS;
+}
+
+#else
+
+const CAEKernels::Implementation* AE_KERNELS::GetSSE2()
+{
+  return nullptr;
+}
+
+#endif
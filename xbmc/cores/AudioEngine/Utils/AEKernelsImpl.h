@@ -0,0 +1,257 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+// Only to be included by the translation units of the kernels. They are built for different
+// instruction sets, so everything in here has internal linkage: the linker mustn't pick a copy
+// built with instructions the CPU might lack. For the same reason nothing here uses inline
+// functions of the standard library.
+
+#include "AEKernels.h"
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace
+{
+namespace REFERENCE
+{
+constexpr float S16_SCALE = 32767.0f;
+constexpr float S16_INVERSE_SCALE = 1.0f / 32768.0f;
+constexpr float S32_SCALE = 2147483648.0f;
+constexpr float S32_MAX = 2147483520.0f; // the highest float below 2^31
+constexpr float S32_INVERSE_SCALE = 1.0f / 2147483648.0f;
+
+// the semantics of the SSE instructions, which the other implementations follow
+inline float Min(float a, float b)
+{
+  return a < b ? a : b;
+}
+
+inline float Max(float a, float b)
+{
+  return a > b ? a : b;
+}
+
+// a rational function approximating a tanh like soft clipper, based on the pade approximation
+// of tanh with tweaked coefficients, see http://www.musicdsp.org/showone.php?id=238
+inline float SoftClamp(float x)
+{
+  if (x < -3.0f)
+    return -1.0f;
+  else if (x > 3.0f)
+    return 1.0f;
+  const float y = x * x;
+  return x * (27.0f + y) / (27.0f + 9.0f * y);
+}
+
+inline int16_t FloatToS16(float x)
+{
+  return static_cast<int16_t>(lrintf(Max(Min(x, 1.0f), -1.0f) * S16_SCALE));
+}
+
+inline int32_t FloatToS32(float x)
+{
+  return static_cast<int32_t>(lrintf(Max(Min(x * S32_SCALE, S32_MAX), -S32_SCALE)));
+}
+
+inline void Mul(float* data, float gain, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+    data[i] *= gain;
+}
+
+inline float MulAdd(float* dst, const float* src, float gain, size_t count)
+{
+  float peak = 0.0f;
+  for (size_t i = 0; i < count; ++i)
+  {
+    dst[i] += src[i] * gain;
+    peak = Max(fabsf(dst[i]), peak);
+  }
+  return peak;
+}
+
+inline void GainRamp(float* data, float gain, float step, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+    data[i] *= gain + step * static_cast<float>(i);
+}
+
+inline void SoftClamp(float* data, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+    data[i] = SoftClamp(data[i]);
+}
+
+inline void Interleave(float* dst, const float* const* src, unsigned int channels, size_t frames)
+{
+  for (size_t i = 0; i < frames; ++i)
+  {
+    for (unsigned int j = 0; j < channels; ++j)
+      *dst++ = src[j][i];
+  }
+}
+
+inline void Deinterleave(float* const* dst, const float* src, unsigned int channels, size_t frames)
+{
+  for (size_t i = 0; i < frames; ++i)
+  {
+    for (unsigned int j = 0; j < channels; ++j)
+      dst[j][i] = *src++;
+  }
+}
+
+inline void FloatToS16(int16_t* dst, const float* src, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+    dst[i] = FloatToS16(src[i]);
+}
+
+inline void S16ToFloat(float* dst, const int16_t* src, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+    dst[i] = static_cast<float>(src[i]) * S16_INVERSE_SCALE;
+}
+
+inline void FloatToS32(int32_t* dst, const float* src, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+    dst[i] = FloatToS32(src[i]);
+}
+
+inline void S32ToFloat(float* dst, const int32_t* src, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+    dst[i] = static_cast<float>(src[i]) * S32_INVERSE_SCALE;
+}
+} // namespace REFERENCE
+
+/*!
+ The kernels for a vector instruction set, described by a class V providing
+ - Float, Mask and Int, the vector types, and WIDTH, the number of floats in a vector
+ - Load/Store/Set1/Iota and Add/Mul/Div/Min/Max/Abs on Float, with Min and Max following the
+   semantics of REFERENCE::Min and Max
+ - Less/Greater returning a Mask, and Select(mask, a, b) picking a where mask is set
+ - HorizontalMax, the highest value of a vector without NaNs
+ - ToInt (rounding to nearest even), FromInt, LoadInt/StoreInt and LoadS16/StoreS16 (saturating)
+ The samples not filling a whole vector are processed by the reference.
+ */
+template<class V>
+struct CVectorKernels
+{
+  static void Mul(float* data, float gain, size_t count)
+  {
+    const auto g = V::Set1(gain);
+    size_t i = 0;
+    for (; i + V::WIDTH <= count; i += V::WIDTH)
+      V::Store(data + i, V::Mul(V::Load(data + i), g));
+    REFERENCE::Mul(data + i, gain, count - i);
+  }
+
+  static float MulAdd(float* dst, const float* src, float gain, size_t count)
+  {
+    const auto g = V::Set1(gain);
+    auto peaks = V::Set1(0.0f);
+    size_t i = 0;
+    for (; i + V::WIDTH <= count; i += V::WIDTH)
+    {
+      const auto mixed = V::Add(V::Load(dst + i), V::Mul(V::Load(src + i), g));
+      V::Store(dst + i, mixed);
+      peaks = V::Max(V::Abs(mixed), peaks);
+    }
+    const float peak = V::HorizontalMax(peaks);
+    return REFERENCE::Max(REFERENCE::MulAdd(dst + i, src + i, gain, count - i), peak);
+  }
+
+  static void GainRamp(float* data, float gain, float step, size_t count)
+  {
+    const auto g = V::Set1(gain);
+    const auto s = V::Set1(step);
+    const auto width = V::Set1(static_cast<float>(V::WIDTH));
+    auto index = V::Iota();
+    size_t i = 0;
+    for (; i + V::WIDTH <= count; i += V::WIDTH)
+    {
+      V::Store(data + i, V::Mul(V::Load(data + i), V::Add(g, V::Mul(s, index))));
+      index = V::Add(index, width);
+    }
+    for (; i < count; ++i)
+      data[i] *= gain + step * static_cast<float>(i);
+  }
+
+  static void SoftClamp(float* data, size_t count)
+  {
+    const auto c27 = V::Set1(27.0f);
+    const auto c9 = V::Set1(9.0f);
+    const auto c3 = V::Set1(3.0f);
+    const auto minus3 = V::Set1(-3.0f);
+    const auto one = V::Set1(1.0f);
+    const auto minusOne = V::Set1(-1.0f);
+    size_t i = 0;
+    for (; i + V::WIDTH <= count; i += V::WIDTH)
+    {
+      const auto x = V::Load(data + i);
+      const auto y = V::Mul(x, x);
+      auto clamped = V::Div(V::Mul(x, V::Add(c27, y)), V::Add(c27, V::Mul(c9, y)));
+      clamped = V::Select(V::Greater(x, c3), one, clamped);
+      clamped = V::Select(V::Less(x, minus3), minusOne, clamped);
+      V::Store(data + i, clamped);
+    }
+    REFERENCE::SoftClamp(data + i, count - i);
+  }
+
+  static void FloatToS16(int16_t* dst, const float* src, size_t count)
+  {
+    const auto one = V::Set1(1.0f);
+    const auto minusOne = V::Set1(-1.0f);
+    const auto scale = V::Set1(REFERENCE::S16_SCALE);
+    size_t i = 0;
+    for (; i + V::WIDTH <= count; i += V::WIDTH)
+    {
+      const auto x = V::Max(V::Min(V::Load(src + i), one), minusOne);
+      V::StoreS16(dst + i, V::ToInt(V::Mul(x, scale)));
+    }
+    REFERENCE::FloatToS16(dst + i, src + i, count - i);
+  }
+
+  static void S16ToFloat(float* dst, const int16_t* src, size_t count)
+  {
+    const auto scale = V::Set1(REFERENCE::S16_INVERSE_SCALE);
+    size_t i = 0;
+    for (; i + V::WIDTH <= count; i += V::WIDTH)
+      V::Store(dst + i, V::Mul(V::FromInt(V::LoadS16(src + i)), scale));
+    REFERENCE::S16ToFloat(dst + i, src + i, count - i);
+  }
+
+  static void FloatToS32(int32_t* dst, const float* src, size_t count)
+  {
+    const auto scale = V::Set1(REFERENCE::S32_SCALE);
+    const auto max = V::Set1(REFERENCE::S32_MAX);
+    const auto min = V::Set1(-REFERENCE::S32_SCALE);
+    size_t i = 0;
+    for (; i + V::WIDTH <= count; i += V::WIDTH)
+    {
+      const auto x = V::Max(V::Min(V::Mul(V::Load(src + i), scale), max), min);
+      V::StoreInt(dst + i, V::ToInt(x));
+    }
+    REFERENCE::FloatToS32(dst + i, src + i, count - i);
+  }
+
+  static void S32ToFloat(float* dst, const int32_t* src, size_t count)
+  {
+    const auto scale = V::Set1(REFERENCE::S32_INVERSE_SCALE);
+    size_t i = 0;
+    for (; i + V::WIDTH <= count; i += V::WIDTH)
+      V::Store(dst + i, V::Mul(V::FromInt(V::LoadInt(src + i)), scale));
+    REFERENCE::S32ToFloat(dst + i, src + i, count - i);
+  }
+};
+} // unnamed namespace
@@ -0,0 +1,319 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/AudioEngine/Utils/AEKernels.h"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// enough samples to fill the widest vectors a few times and leave some behind
+const std::vector<size_t> COUNTS = {0, 1, 3, 4, 7, 8, 15, 16, 17, 31, 33, 64, 257, 1021};
+
+std::vector<float> RandomSamples(size_t count, float range, std::mt19937& random)
+{
+  std::uniform_real_distribution<float> distribution(-range, range);
+  std::vector<float> samples(count);
+  for (auto& sample : samples)
+    sample = distribution(random);
+  return samples;
+}
+
+// the special values the clamping and the conversions have to treat the same everywhere
+void AddSpecialValues(std::vector<float>& samples)
+{
+  const float values[] = {0.0f,
+                          -0.0f,
+                          1.0f,
+                          -1.0f,
+                          3.0f,
+                          -3.0f,
+                          3.0000002f,
+                          0.5f / 32767.0f,
+                          1.5f / 32767.0f,
+                          std::numeric_limits<float>::infinity(),
+                          -std::numeric_limits<float>::infinity(),
+                          std::numeric_limits<float>::quiet_NaN()};
+  for (size_t i = 0; i < samples.size(); ++i)
+    samples[i] = values[i % std::size(values)];
+}
+
+// compares the bits, so NaNs and the sign of zeros count as well
+template<typename T>
+void ExpectSame(const std::vector<T>& expected,
+                const std::vector<T>& actual,
+                const std::string& what)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  EXPECT_EQ(0, std::memcmp(expected.data(), actual.data(), expected.size() * sizeof(T))) << what;
+}
+
+class TestAEKernels : public ::testing::Test
+{
+protected:
+  const CAEKernels::Implementation& Reference() const { return m_implementations.front(); }
+
+  const std::vector<CAEKernels::Implementation>& m_implementations{
+      CAEKernels::GetImplementations()};
+  std::mt19937 m_random{42};
+};
+} // namespace
+
+TEST_F(TestAEKernels, Implementations)
+{
+  ASSERT_FALSE(m_implementations.empty());
+  EXPECT_STREQ("reference", Reference().name);
+  EXPECT_STREQ(m_implementations.back().name, CAEKernels::Get().name);
+}
+
+TEST_F(TestAEKernels, Mul)
+{
+  for (const auto& implementation : m_implementations)
+  {
+    for (const size_t count : COUNTS)
+    {
+      std::vector<float> expected = RandomSamples(count + 1, 2.0f, m_random);
+      std::vector<float> actual(expected);
+      // start a sample into the buffers, so the vectors aren't aligned
+      Reference().mul(expected.data() + 1, 0.3f, count);
+      implementation.mul(actual.data() + 1, 0.3f, count);
+      ExpectSame(expected, actual, std::string(implementation.name) + " " + std::to_string(count));
+    }
+  }
+}
+
+TEST_F(TestAEKernels, MulAdd)
+{
+  for (const auto& implementation : m_implementations)
+  {
+    for (const size_t count : COUNTS)
+    {
+      const auto src = RandomSamples(count, 1.0f, m_random);
+      std::vector<float> expected = RandomSamples(count, 1.0f, m_random);
+      std::vector<float> actual(expected);
+      const float expectedPeak = Reference().mulAdd(expected.data(), src.data(), 0.7f, count);
+      const float peak = implementation.mulAdd(actual.data(), src.data(), 0.7f, count);
+      const std::string what = std::string(implementation.name) + " " + std::to_string(count);
+      ExpectSame(expected, actual, what);
+      EXPECT_EQ(expectedPeak, peak) << what;
+    }
+  }
+}
+
+TEST_F(TestAEKernels, MulAddPeak)
+{
+  std::vector<float> dst(100, 0.5f);
+  const std::vector<float> src(100, 0.25f);
+  dst[77] = -1.5f;
+  for (const auto& implementation : m_implementations)
+  {
+    std::vector<float> mixed(dst);
+    EXPECT_EQ(1.0f, implementation.mulAdd(mixed.data(), src.data(), 2.0f, mixed.size()))
+        << implementation.name;
+    mixed = dst;
+    EXPECT_EQ(1.25f, implementation.mulAdd(mixed.data(), src.data(), 1.0f, mixed.size()))
+        << implementation.name;
+  }
+}
+
+TEST_F(TestAEKernels, GainRamp)
+{
+  for (const auto& implementation : m_implementations)
+  {
+    for (const size_t count : COUNTS)
+    {
+      std::vector<float> expected = RandomSamples(count, 1.0f, m_random);
+      std::vector<float> actual(expected);
+      Reference().gainRamp(expected.data(), 1.0f, -1.0f / 1000.0f, count);
+      implementation.gainRamp(actual.data(), 1.0f, -1.0f / 1000.0f, count);
+      ExpectSame(expected, actual, std::string(implementation.name) + " " + std::to_string(count));
+    }
+  }
+}
+
+TEST_F(TestAEKernels, SoftClamp)
+{
+  for (const auto& implementation : m_implementations)
+  {
+    for (const size_t count : COUNTS)
+    {
+      std::vector<float> expected = RandomSamples(count, 5.0f, m_random);
+      if (count > 100)
+        AddSpecialValues(expected);
+      std::vector<float> actual(expected);
+      Reference().softClamp(expected.data(), count);
+      implementation.softClamp(actual.data(), count);
+      ExpectSame(expected, actual, std::string(implementation.name) + " " + std::to_string(count));
+    }
+  }
+
+  std::vector<float> samples = {0.0f, 3.0f, -3.0f, 4.0f, -100.0f};
+  CAEKernels::SoftClamp(samples.data(), samples.size());
+  EXPECT_EQ((std::vector<float>{0.0f, 1.0f, -1.0f, 1.0f, -1.0f}), samples);
+}
+
+TEST_F(TestAEKernels, Interleave)
+{
+  for (const auto& implementation : m_implementations)
+  {
+    for (const unsigned int channels : {1u, 2u, 6u, 8u})
+    {
+      for (const size_t frames : COUNTS)
+      {
+        std::vector<std::vector<float>> planes;
+        std::vector<const float*> src;
+        for (unsigned int i = 0; i < channels; ++i)
+          src.emplace_back(planes.emplace_back(RandomSamples(frames, 1.0f, m_random)).data());
+
+        const std::string what = std::string(implementation.name) + " " +
+                                 std::to_string(channels) + " " + std::to_string(frames);
+        std::vector<float> interleaved(frames * channels);
+        implementation.interleave(interleaved.data(), src.data(), channels, frames);
+        for (size_t i = 0; i < interleaved.size(); ++i)
+          ASSERT_EQ(planes[i % channels][i / channels], interleaved[i]) << what;
+
+        std::vector<std::vector<float>> deinterleaved(channels, std::vector<float>(frames));
+        std::vector<float*> dst;
+        for (auto& plane : deinterleaved)
+          dst.emplace_back(plane.data());
+        implementation.deinterleave(dst.data(), interleaved.data(), channels, frames);
+        for (unsigned int i = 0; i < channels; ++i)
+          ExpectSame(planes[i], deinterleaved[i], what);
+      }
+    }
+  }
+}
+
+TEST_F(TestAEKernels, S16)
+{
+  for (const auto& implementation : m_implementations)
+  {
+    for (const size_t count : COUNTS)
+    {
+      std::vector<float> samples = RandomSamples(count, 1.2f, m_random);
+      if (count > 100)
+        AddSpecialValues(samples);
+      const std::string what = std::string(implementation.name) + " " + std::to_string(count);
+
+      std::vector<int16_t> expected(count);
+      std::vector<int16_t> actual(count);
+      Reference().floatToS16(expected.data(), samples.data(), count);
+      implementation.floatToS16(actual.data(), samples.data(), count);
+      ExpectSame(expected, actual, what);
+
+      std::vector<float> expectedFloats(count);
+      std::vector<float> actualFloats(count);
+      Reference().s16ToFloat(expectedFloats.data(), expected.data(), count);
+      implementation.s16ToFloat(actualFloats.data(), expected.data(), count);
+      ExpectSame(expectedFloats, actualFloats, what);
+    }
+  }
+
+  const std::vector<float> samples = {0.0f, 1.0f, -1.0f, 2.0f, -2.0f, 0.5f / 32767.0f,
+                                      1.5f / 32767.0f};
+  std::vector<int16_t> converted(samples.size());
+  CAEKernels::FloatToS16(converted.data(), samples.data(), samples.size());
+  EXPECT_EQ((std::vector<int16_t>{0, 32767, -32767, 32767, -32767, 0, 2}), converted);
+}
+
+TEST_F(TestAEKernels, S32)
+{
+  for (const auto& implementation : m_implementations)
+  {
+    for (const size_t count : COUNTS)
+    {
+      std::vector<float> samples = RandomSamples(count, 1.2f, m_random);
+      if (count > 100)
+        AddSpecialValues(samples);
+      const std::string what = std::string(implementation.name) + " " + std::to_string(count);
+
+      std::vector<int32_t> expected(count);
+      std::vector<int32_t> actual(count);
+      Reference().floatToS32(expected.data(), samples.data(), count);
+      implementation.floatToS32(actual.data(), samples.data(), count);
+      ExpectSame(expected, actual, what);
+
+      std::vector<float> expectedFloats(count);
+      std::vector<float> actualFloats(count);
+      Reference().s32ToFloat(expectedFloats.data(), expected.data(), count);
+      implementation.s32ToFloat(actualFloats.data(), expected.data(), count);
+      ExpectSame(expectedFloats, actualFloats, what);
+    }
+  }
+
+  const std::vector<float> samples = {0.0f, 1.0f, -1.0f, 2.0f};
+  std::vector<int32_t> converted(samples.size());
+  CAEKernels::FloatToS32(converted.data(), samples.data(), samples.size());
+  EXPECT_EQ((std::vector<int32_t>{0, 2147483520, -2147483647 - 1, 2147483520}), converted);
+}
+
+// Run with --gtest_also_run_disabled_tests --gtest_filter=TestAEKernels.DISABLED_Benchmark
+TEST_F(TestAEKernels, DISABLED_Benchmark)
+{
+  // a second of 7.1 at 192 kHz, in periods of 1024 frames
+  constexpr unsigned int CHANNELS = 8;
+  constexpr size_t FRAMES = 1024;
+  constexpr int PERIODS = 192000 / FRAMES;
+
+  std::vector<std::vector<float>> planes;
+  std::vector<const float*> src;
+  std::vector<float*> dst;
+  for (unsigned int i = 0; i < CHANNELS; ++i)
+  {
+    planes.emplace_back(RandomSamples(FRAMES, 1.0f, m_random));
+    src.emplace_back(planes.back().data());
+    dst.emplace_back(planes.back().data());
+  }
+  const auto sound = RandomSamples(FRAMES * CHANNELS, 1.0f, m_random);
+  std::vector<float> mix = RandomSamples(FRAMES * CHANNELS, 1.0f, m_random);
+  std::vector<int16_t> s16(FRAMES * CHANNELS);
+  std::vector<int32_t> s32(FRAMES * CHANNELS);
+
+  const auto measure = [](const char* kernel, const char* name, const auto& run)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < PERIODS; ++i)
+      run();
+    const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+    std::cout << kernel << " " << name << ": " << duration.count() << " us per second of audio"
+              << std::endl;
+  };
+
+  for (const auto& impl : m_implementations)
+  {
+    const size_t count = FRAMES * CHANNELS;
+    measure("mul", impl.name, [&] { impl.mul(mix.data(), 0.99f, count); });
+    measure("mulAdd", impl.name,
+            [&] { impl.mulAdd(mix.data(), sound.data(), 0.01f, count); });
+    measure("gainRamp", impl.name,
+            [&]
+            {
+              for (float* plane : dst)
+                impl.gainRamp(plane, 1.0f, -0.0001f, FRAMES);
+            });
+    measure("softClamp", impl.name, [&] { impl.softClamp(mix.data(), count); });
+    measure("interleave", impl.name,
+            [&] { impl.interleave(mix.data(), src.data(), CHANNELS, FRAMES); });
+    measure("interleave 2.0", impl.name, [&] { impl.interleave(mix.data(), src.data(), 2, FRAMES); });
+    measure("deinterleave 2.0", impl.name,
+            [&] { impl.deinterleave(dst.data(), mix.data(), 2, FRAMES); });
+    measure("floatToS16", impl.name, [&] { impl.floatToS16(s16.data(), mix.data(), count); });
+    measure("s16ToFloat", impl.name, [&] { impl.s16ToFloat(mix.data(), s16.data(), count); });
+    measure("floatToS32", impl.name, [&] { impl.floatToS32(s32.data(), mix.data(), count); });
+    measure("s32ToFloat", impl.name, [&] { impl.s32ToFloat(mix.data(), s32.data(), count); });
+  }
+}
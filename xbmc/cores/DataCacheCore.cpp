@@ -16,7 +16,7 @@
 #include <utility>
 
 CDataCacheCore::CDataCacheCore()
-  : m_playerVideoInfo{}, m_playerAudioInfo{}, m_contentInfo{}, m_stateInfo{}
+  : m_playerVideoInfo{}, m_playerStageInfo{}, m_playerAudioInfo{}, m_contentInfo{}, m_stateInfo{}
 {
 }
 
@@ -38,6 +38,13 @@ void CDataCacheCore::Reset()
     std::unique_lock lock(m_videoPlayerSection);
     m_playerVideoInfo = {};
   }
+  for (auto& timing : m_playerStageInfo.timings)
+  {
+    timing.count = 0;
+    timing.total = 0;
+    timing.max = 0;
+  }
+  m_playerStageInfo.droppedFrames = 0;
   m_hasAVInfoChanges = false;
   {
     std::unique_lock lock(m_renderSection);
@@ -102,6 +109,20 @@ bool CDataCacheCore::IsVideoHwDecoder()
   return m_playerVideoInfo.isHwDecoder;
 }
 
+void CDataCacheCore::SetVideoDecoderThreading(std::string threading)
+{
+  std::unique_lock lock(m_videoPlayerSection);
+
+  m_playerVideoInfo.decoderThreading = std::move(threading);
+}
+
+std::string CDataCacheCore::GetVideoDecoderThreading()
+{
+  std::unique_lock lock(m_videoPlayerSection);
+
+  return m_playerVideoInfo.decoderThreading;
+}
+
 
 void CDataCacheCore::SetVideoDeintMethod(std::string method)
 {
@@ -207,6 +228,49 @@ bool CDataCacheCore::IsVideoInterlaced()
   return m_playerVideoInfo.m_isInterlaced;
 }
 
+void CDataCacheCore::EnablePlayerStageTiming(bool enable)
+{
+  m_playerStageTiming = enable;
+}
+
+bool CDataCacheCore::IsPlayerStageTimingEnabled() const
+{
+  return m_playerStageTiming.load(std::memory_order_relaxed);
+}
+
+void CDataCacheCore::AddPlayerStageTime(PlayerStage stage, std::chrono::nanoseconds duration)
+{
+  auto& timing = m_playerStageInfo.timings[static_cast<size_t>(stage)];
+  const int64_t ns = duration.count();
+
+  timing.count.fetch_add(1, std::memory_order_relaxed);
+  timing.total.fetch_add(ns, std::memory_order_relaxed);
+  int64_t max = timing.max.load(std::memory_order_relaxed);
+  while (ns > max && !timing.max.compare_exchange_weak(max, ns, std::memory_order_relaxed))
+    ;
+}
+
+PlayerStageTiming CDataCacheCore::GetPlayerStageTiming(PlayerStage stage)
+{
+  const auto& timing = m_playerStageInfo.timings[static_cast<size_t>(stage)];
+
+  PlayerStageTiming result;
+  result.count = timing.count;
+  result.total = std::chrono::nanoseconds(timing.total);
+  result.max = std::chrono::nanoseconds(timing.max);
+  return result;
+}
+
+void CDataCacheCore::SetVideoDroppedFrames(int dropped)
+{
+  m_playerStageInfo.droppedFrames.store(dropped, std::memory_order_relaxed);
+}
+
+int CDataCacheCore::GetVideoDroppedFrames()
+{
+  return m_playerStageInfo.droppedFrames;
+}
+
 // player audio info
 void CDataCacheCore::SetAudioDecoderName(std::string name)
 {
@@ -11,11 +11,30 @@
 #include "EdlEdit.h"
 #include "threads/CriticalSection.h"
 
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <string>
 #include <vector>
 
+//! The stages of the player between the demuxer and the renderer
+enum class PlayerStage
+{
+  DEMUX, //!< reading a packet of any stream from the demuxer
+  PACKET_WAIT, //!< the video player waiting for a packet in its queue
+  DECODE, //!< passing a packet to the decoder and getting pictures back
+  RENDER_QUEUE, //!< waiting for a render buffer and adding the picture to it
+  MAX
+};
+
+struct PlayerStageTiming
+{
+  uint64_t count = 0;
+  std::chrono::nanoseconds total{0};
+  std::chrono::nanoseconds max{0};
+};
+
 class CDataCacheCore
 {
 public:
@@ -33,6 +52,8 @@ public:
   void SetVideoDecoderName(std::string name, bool isHw);
   std::string GetVideoDecoderName();
   bool IsVideoHwDecoder();
+  void SetVideoDecoderThreading(std::string threading);
+  std::string GetVideoDecoderThreading();
   void SetVideoDeintMethod(std::string method);
   std::string GetVideoDeintMethod();
   void SetVideoPixelFormat(std::string pixFormat);
@@ -59,6 +80,35 @@ public:
    */
   bool IsVideoInterlaced();
 
+  /*!
+   * @brief Turn the timing of the player stages on or off, it's off unless a benchmark asks for it
+   * @param enable Whether the stages are timed
+   */
+  void EnablePlayerStageTiming(bool enable);
+
+  /*!
+   * @brief Whether the player stages are timed
+   * @return True if the player should time its stages
+   */
+  bool IsPlayerStageTimingEnabled() const;
+
+  /*!
+   * @brief Add the time spent once in a stage of the player
+   * @param stage The stage
+   * @param duration The time spent
+   */
+  void AddPlayerStageTime(PlayerStage stage, std::chrono::nanoseconds duration);
+
+  /*!
+   * @brief Get how often and how long the stage was passed since the player started
+   * @param stage The stage
+   * @return The timing of the stage
+   */
+  PlayerStageTiming GetPlayerStageTiming(PlayerStage stage);
+
+  void SetVideoDroppedFrames(int dropped);
+  int GetVideoDroppedFrames();
+
   // player audio info
   void SetAudioDecoderName(std::string name);
   std::string GetAudioDecoderName();
@@ -204,6 +254,7 @@ protected:
   {
     std::string decoderName;
     bool isHwDecoder;
+    std::string decoderThreading;
     std::string deintMethod;
     std::string pixFormat;
     std::string stereoMode;
@@ -214,6 +265,20 @@ protected:
     bool m_isInterlaced;
   } m_playerVideoInfo;
 
+  // written by the player threads for every packet and picture, so they are kept lock free
+  std::atomic_bool m_playerStageTiming = false;
+  struct SPlayerStageInfo
+  {
+    struct STiming
+    {
+      std::atomic<uint64_t> count;
+      std::atomic<int64_t> total;
+      std::atomic<int64_t> max;
+    };
+    std::array<STiming, static_cast<size_t>(PlayerStage::MAX)> timings;
+    std::atomic_int droppedFrames;
+  } m_playerStageInfo;
+
   CCriticalSection m_audioPlayerSection;
   struct SPlayerAudioInfo
   {
@@ -57,6 +57,48 @@ enum DecoderState
   STATE_SW_MULTI
 };
 
+namespace
+{
+// how costly a pixel of a stream is to decode in software, relative to 8 bit H.264
+double GetDecodingCost(const CDVDStreamInfo& hints)
+{
+  double cost;
+  switch (hints.codec)
+  {
+    case AV_CODEC_ID_MPEG1VIDEO:
+    case AV_CODEC_ID_MPEG2VIDEO:
+      cost = 0.4;
+      break;
+    case AV_CODEC_ID_MPEG4:
+    case AV_CODEC_ID_VC1:
+    case AV_CODEC_ID_WMV3:
+      cost = 0.6;
+      break;
+    case AV_CODEC_ID_VP8:
+      cost = 0.8;
+      break;
+    case AV_CODEC_ID_VP9:
+      cost = 1.3;
+      break;
+    case AV_CODEC_ID_HEVC:
+      cost = 1.6;
+      break;
+    case AV_CODEC_ID_AV1:
+      cost = 2.0;
+      break;
+    default:
+      cost = 1.0;
+      break;
+  }
+
+  // samples of more than 8 bits take the slower paths of the decoders
+  if (hints.bitdepth > 8)
+    cost *= 1.25;
+
+  return cost;
+}
+} // unnamed namespace
+
 enum EFilterFlags {
   FILTER_NONE                =  0x0,
   FILTER_DEINTERLACE_BWDIF   =  0x1,  //< use first deinterlace mode
@@ -384,6 +426,7 @@ bool CDVDVideoCodecFFmpeg::Open(CDVDStreamInfo &hints, CDVDCodecOptions &options
 #endif
 
   // setup threading model
+  std::string threadingInfo;
   if (!(hints.codecOptions & CODEC_FORCE_SOFTWARE))
   {
     if (m_decoderState == STATE_NONE)
@@ -392,17 +435,40 @@ bool CDVDVideoCodecFFmpeg::Open(CDVDStreamInfo &hints, CDVDCodecOptions &options
     }
     else
     {
-      int num_threads = CServiceBroker::GetCPUInfo()->GetCPUCount() * 3 / 2;
-      num_threads = std::max(1, std::min(num_threads, 16));
-      m_pCodecContext->thread_count = num_threads;
+      CDVDVideoThreadingPolicy::Stream stream;
+      stream.sliceThreads = (pCodec->capabilities & AV_CODEC_CAP_SLICE_THREADS) != 0;
+      stream.frameThreads = (pCodec->capabilities & AV_CODEC_CAP_FRAME_THREADS) != 0;
+      const AVCodecDescriptor* descriptor = avcodec_descriptor_get(pCodec->id);
+      stream.intraOnly = descriptor && (descriptor->props & AV_CODEC_PROP_INTRA_ONLY);
+      stream.width = hints.width;
+      stream.height = hints.height;
+      if (hints.fpsrate > 0 && hints.fpsscale > 0)
+        stream.fps = static_cast<double>(hints.fpsrate) / hints.fpsscale;
+      stream.cost = GetDecodingCost(hints);
+
+      CDVDVideoThreadingPolicy::System system;
+      const auto cpuInfo = CServiceBroker::GetCPUInfo();
+      system.cpuCount = cpuInfo->GetCPUCount();
+      if (cpuInfo->SupportsCPUUsage())
+        system.usedPercentage = cpuInfo->GetUsedPercentage();
+
+      const CDVDVideoThreadingPolicy::Decision threading =
+          m_processInfo.ChooseVideoThreading(stream, system);
+      m_pCodecContext->thread_count = threading.threads;
+      if (threading.type == CDVDVideoThreadingPolicy::Type::SLICE)
+        m_pCodecContext->thread_type = FF_THREAD_SLICE;
+      else if (threading.type == CDVDVideoThreadingPolicy::Type::FRAME)
+        m_pCodecContext->thread_type = FF_THREAD_FRAME;
       m_decoderState = STATE_SW_MULTI;
-      CLog::Log(LOGDEBUG, "CDVDVideoCodecFFmpeg - open frame threaded with {} threads",
-                num_threads);
+      threadingInfo = threading.ToString();
+      CLog::Log(LOGDEBUG, "CDVDVideoCodecFFmpeg - open threaded: {}", threadingInfo);
     }
   }
   else
     m_decoderState = STATE_SW_SINGLE;
 
+  m_processInfo.SetVideoDecoderThreading(threadingInfo);
+
   // if we don't do this, then some codecs seem to fail.
   m_pCodecContext->coded_height = hints.height;
   m_pCodecContext->coded_width = hints.width;
@@ -787,6 +853,7 @@ CDVDVideoCodec::VCReturn CDVDVideoCodecFFmpeg::GetPicture(VideoPicture* pVideoPi
   // here we got a frame
   int64_t framePTS = m_pDecodedFrame->best_effort_timestamp;
 
+  int dropped = 0;
   if (m_pCodecContext->skip_frame > AVDISCARD_DEFAULT)
   {
     if (m_dropCtrl.m_state == CDropControl::VALID &&
@@ -794,12 +861,20 @@ CDVDVideoCodec::VCReturn CDVDVideoCodecFFmpeg::GetPicture(VideoPicture* pVideoPi
         framePTS != AV_NOPTS_VALUE &&
         framePTS > (m_dropCtrl.m_lastPTS + m_dropCtrl.m_diffPTS * 1.5))
     {
+      dropped = 1;
       m_droppedFrames++;
       if (m_interlaced)
         m_droppedFrames++;
     }
   }
   m_dropCtrl.Process(framePTS, m_pCodecContext->skip_frame > AVDISCARD_DEFAULT);
+  if (m_decoderState == STATE_SW_MULTI &&
+      m_processInfo.AddVideoThreadingFrames(1 + dropped, dropped))
+  {
+    CLog::Log(LOGINFO, "CDVDVideoCodecFFmpeg::GetPicture - too many frames dropped, reopening "
+                       "with more threads");
+    return VC_REOPEN;
+  }
 
   if (m_pDecodedFrame->flags & AV_FRAME_FLAG_KEY)
   {
@@ -0,0 +1,125 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DVDVideoThreadingPolicy.h"
+
+#include "utils/log.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+// ffmpeg doesn't use more for frame threading
+constexpr int MAX_THREADS = 16;
+// on systems with three up to this many cpus one is left to the gui and the renderer
+constexpr int SMALL_SYSTEM_CPUS = 4;
+// pixels per second a thread is given, a quarter of 1080p at 25 fps
+constexpr double PIXEL_RATE_PER_THREAD = 1920.0 * 1080.0 * 25.0 / 4.0;
+constexpr double DEFAULT_FPS = 25.0;
+
+// the frames needed before dropped frames count, and the share of dropped frames that asks for
+// more threads
+constexpr int MIN_FRAMES = 250;
+constexpr int MAX_DROPPED_PERCENT = 2;
+} // unnamed namespace
+
+std::string CDVDVideoThreadingPolicy::Decision::ToString() const
+{
+  switch (type)
+  {
+    case Type::SLICE:
+      return "slice " + std::to_string(threads);
+    case Type::FRAME:
+      return "frame " + std::to_string(threads);
+    default:
+      return "single";
+  }
+}
+
+const CDVDVideoThreadingPolicy::Decision& CDVDVideoThreadingPolicy::Choose(const Stream& stream,
+                                                                           const System& system)
+{
+  if (m_decided)
+    Retune();
+
+  const int cpus = std::max(1, system.cpuCount);
+  int maxThreads = cpus > 2 && cpus <= SMALL_SYSTEM_CPUS ? cpus - 1 : cpus;
+  if (!m_decided && system.usedPercentage > 0)
+  {
+    const int idle = cpus * (100 - std::min(system.usedPercentage, 100)) / 100;
+    maxThreads = std::min(maxThreads, std::max(2, idle));
+  }
+  maxThreads = std::min(maxThreads, MAX_THREADS);
+
+  int threads = maxThreads;
+  if (stream.width > 0 && stream.height > 0)
+  {
+    const double fps = stream.fps > 0.0 ? stream.fps : DEFAULT_FPS;
+    const double pixelRate = static_cast<double>(stream.width) * stream.height * fps *
+                             (stream.cost > 0.0 ? stream.cost : 1.0);
+    threads = std::max(2, static_cast<int>(std::ceil(pixelRate / PIXEL_RATE_PER_THREAD)));
+  }
+  threads = std::clamp(threads + m_extraThreads, 1, maxThreads);
+
+  m_decision = {};
+  if (threads > 1)
+  {
+    if (stream.sliceThreads && (stream.intraOnly || !stream.frameThreads))
+      m_decision = {Type::SLICE, threads};
+    else if (stream.frameThreads)
+      m_decision = {Type::FRAME, threads};
+  }
+  m_decided = true;
+  m_maxThreads = maxThreads;
+
+  CLog::Log(LOGDEBUG,
+            "CDVDVideoThreadingPolicy::Choose - {} for {}x{} at {:.3f} fps, cost {:.2f}, on {} "
+            "cpus, {}% used",
+            m_decision.ToString(), stream.width, stream.height, stream.fps, stream.cost, cpus,
+            system.usedPercentage);
+  return m_decision;
+}
+
+bool CDVDVideoThreadingPolicy::AddFrames(int frames, int dropped)
+{
+  m_frames += frames;
+  m_dropped += dropped;
+
+  if (TooManyDropped())
+    return m_decision.threads < m_maxThreads;
+
+  // the frames are judged in windows, so drops late in the stream aren't outweighed by the frames
+  // before them
+  if (m_frames >= MIN_FRAMES)
+  {
+    m_frames = 0;
+    m_dropped = 0;
+  }
+  return false;
+}
+
+bool CDVDVideoThreadingPolicy::TooManyDropped() const
+{
+  return m_decision.type != Type::SINGLE && m_frames >= MIN_FRAMES &&
+         m_dropped * 100 > m_frames * MAX_DROPPED_PERCENT;
+}
+
+void CDVDVideoThreadingPolicy::Retune()
+{
+  if (TooManyDropped())
+  {
+    const int extra = std::max(1, m_decision.threads / 2);
+    CLog::Log(LOGINFO,
+              "CDVDVideoThreadingPolicy - {} of {} frames dropped with {}, adding {} threads",
+              m_dropped, m_frames, m_decision.ToString(), extra);
+    m_extraThreads += extra;
+  }
+  m_frames = 0;
+  m_dropped = 0;
+}
@@ -0,0 +1,92 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <string>
+
+/*!
+ \brief Chooses how a software decoder spreads its work over threads
+
+ The number of threads follows the pixel rate of the stream, weighted by how costly its codec is
+ to decode, instead of the number of cpus: every thread of frame threading adds a frame of
+ latency, and threads beyond what the stream needs only compete with the rest of the application.
+ Codecs where every frame is a keyframe are decoded slice threaded when they can, which costs no
+ latency.
+
+ The frames dropped while decoding are counted. When too many are dropped, the decoder is reopened
+ and the next decision gets more threads. The policy outlives the decoder, it's kept by
+ CProcessInfo for the video stream being played.
+ */
+class CDVDVideoThreadingPolicy
+{
+public:
+  enum class Type
+  {
+    SINGLE,
+    SLICE,
+    FRAME,
+  };
+
+  struct Decision
+  {
+    Type type = Type::SINGLE;
+    int threads = 1;
+
+    std::string ToString() const;
+  };
+
+  //! What the codec and the stream allow
+  struct Stream
+  {
+    bool sliceThreads = false; //!< the codec decodes slices of a frame in parallel
+    bool frameThreads = false; //!< the codec decodes several frames in parallel
+    bool intraOnly = false; //!< every frame is a keyframe
+    int width = 0;
+    int height = 0;
+    double fps = 0.0; //!< 0 if unknown
+    double cost = 1.0; //!< decoding cost of a pixel, relative to 8 bit H.264
+  };
+
+  struct System
+  {
+    int cpuCount = 1;
+    int usedPercentage = -1; //!< how busy the cpus are, -1 if unknown
+  };
+
+  /*!
+   \brief Decide for a decoder about to be opened
+
+   The load of the system is only taken into account for the first decision, at a reopen it's
+   mostly the one of the decoder itself. The frames counted since the last decision are evaluated
+   and reset.
+   */
+  const Decision& Choose(const Stream& stream, const System& system);
+
+  /*!
+   \brief Count frames the decoder output
+   \param frames the frames, including the dropped ones
+   \param dropped the frames that were dropped
+   \return true if so many frames were dropped that the decoder should be reopened to get more
+   threads
+   */
+  bool AddFrames(int frames, int dropped);
+
+  const Decision& GetDecision() const { return m_decision; }
+
+private:
+  bool TooManyDropped() const;
+  void Retune();
+
+  Decision m_decision;
+  bool m_decided = false;
+  int m_maxThreads = 1; //!< the most threads the last decision could have given
+  int m_extraThreads = 0; //!< added because of dropped frames
+  int m_frames = 0;
+  int m_dropped = 0;
+};
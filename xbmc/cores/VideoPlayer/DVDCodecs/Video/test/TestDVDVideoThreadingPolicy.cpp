@@ -0,0 +1,145 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/DVDCodecs/Video/DVDVideoThreadingPolicy.h"
+
+#include <gtest/gtest.h>
+
+using Policy = CDVDVideoThreadingPolicy;
+
+namespace
+{
+Policy::Stream MakeStream(int width, int height, double fps)
+{
+  Policy::Stream stream;
+  stream.sliceThreads = true;
+  stream.frameThreads = true;
+  stream.width = width;
+  stream.height = height;
+  stream.fps = fps;
+  return stream;
+}
+
+Policy::System MakeSystem(int cpuCount, int usedPercentage = -1)
+{
+  Policy::System system;
+  system.cpuCount = cpuCount;
+  system.usedPercentage = usedPercentage;
+  return system;
+}
+} // unnamed namespace
+
+TEST(TestDVDVideoThreadingPolicy, ThreadsFollowResolution)
+{
+  Policy policy;
+  EXPECT_EQ(Policy::Type::FRAME, policy.Choose(MakeStream(720, 576, 25.0), MakeSystem(64)).type);
+  EXPECT_EQ(2, policy.GetDecision().threads);
+  EXPECT_EQ(4, policy.Choose(MakeStream(1920, 1080, 25.0), MakeSystem(64)).threads);
+  EXPECT_EQ(8, policy.Choose(MakeStream(1920, 1080, 50.0), MakeSystem(64)).threads);
+  EXPECT_EQ(16, policy.Choose(MakeStream(3840, 2160, 60.0), MakeSystem(64)).threads);
+  EXPECT_EQ("frame 16", policy.GetDecision().ToString());
+
+  // unknown frame rate
+  EXPECT_EQ(4, policy.Choose(MakeStream(1920, 1080, 0.0), MakeSystem(64)).threads);
+  // unknown size
+  EXPECT_EQ(12, policy.Choose(MakeStream(0, 0, 25.0), MakeSystem(12)).threads);
+}
+
+TEST(TestDVDVideoThreadingPolicy, SmallSystems)
+{
+  Policy policy;
+  EXPECT_EQ(Policy::Type::SINGLE, policy.Choose(MakeStream(1920, 1080, 25.0), MakeSystem(1)).type);
+  EXPECT_EQ(1, policy.GetDecision().threads);
+  EXPECT_EQ("single", policy.GetDecision().ToString());
+
+  EXPECT_EQ(2, policy.Choose(MakeStream(1920, 1080, 25.0), MakeSystem(2)).threads);
+  // one cpu is left to the gui
+  EXPECT_EQ(3, policy.Choose(MakeStream(1920, 1080, 25.0), MakeSystem(4)).threads);
+}
+
+TEST(TestDVDVideoThreadingPolicy, Load)
+{
+  Policy policy;
+  EXPECT_EQ(4, policy.Choose(MakeStream(3840, 2160, 25.0), MakeSystem(16, 75)).threads);
+
+  // at a reopen the load is the decoder's own
+  EXPECT_EQ(16, policy.Choose(MakeStream(3840, 2160, 25.0), MakeSystem(16, 75)).threads);
+
+  Policy busy;
+  EXPECT_EQ(2, busy.Choose(MakeStream(3840, 2160, 25.0), MakeSystem(16, 100)).threads);
+}
+
+TEST(TestDVDVideoThreadingPolicy, SliceThreading)
+{
+  Policy policy;
+  Policy::Stream stream = MakeStream(1920, 1080, 25.0);
+  stream.intraOnly = true;
+  EXPECT_EQ(Policy::Type::SLICE, policy.Choose(stream, MakeSystem(8)).type);
+  EXPECT_EQ("slice 4", policy.GetDecision().ToString());
+
+  stream.intraOnly = false;
+  stream.frameThreads = false;
+  EXPECT_EQ(Policy::Type::SLICE, policy.Choose(stream, MakeSystem(8)).type);
+
+  stream.sliceThreads = false;
+  EXPECT_EQ(Policy::Type::SINGLE, policy.Choose(stream, MakeSystem(8)).type);
+  EXPECT_EQ(1, policy.GetDecision().threads);
+}
+
+TEST(TestDVDVideoThreadingPolicy, DroppedFramesAddThreads)
+{
+  Policy policy;
+  const Policy::Stream stream = MakeStream(1920, 1080, 25.0);
+  EXPECT_EQ(4, policy.Choose(stream, MakeSystem(8)).threads);
+
+  // too few frames to tell
+  policy.AddFrames(100, 50);
+  EXPECT_EQ(4, policy.Choose(stream, MakeSystem(8)).threads);
+
+  // few drops
+  policy.AddFrames(1000, 20);
+  EXPECT_EQ(4, policy.Choose(stream, MakeSystem(8)).threads);
+
+  policy.AddFrames(1000, 30);
+  EXPECT_EQ(6, policy.Choose(stream, MakeSystem(8)).threads);
+  policy.AddFrames(1000, 100);
+  EXPECT_EQ(8, policy.Choose(stream, MakeSystem(8)).threads);
+
+  // the counts start over with every decision
+  EXPECT_EQ(8, policy.Choose(stream, MakeSystem(8)).threads);
+}
+
+TEST(TestDVDVideoThreadingPolicy, CodecCost)
+{
+  Policy policy;
+  Policy::Stream stream = MakeStream(1920, 1080, 25.0);
+  stream.cost = 0.4;
+  EXPECT_EQ(2, policy.Choose(stream, MakeSystem(64)).threads);
+  stream.cost = 2.0;
+  EXPECT_EQ(8, policy.Choose(stream, MakeSystem(64)).threads);
+}
+
+TEST(TestDVDVideoThreadingPolicy, DroppedFramesAskForReopen)
+{
+  Policy policy;
+  const Policy::Stream stream = MakeStream(1920, 1080, 25.0);
+  EXPECT_EQ(4, policy.Choose(stream, MakeSystem(8)).threads);
+
+  // the frames are judged in windows
+  EXPECT_FALSE(policy.AddFrames(249, 0));
+  EXPECT_FALSE(policy.AddFrames(1, 0));
+  EXPECT_FALSE(policy.AddFrames(200, 10));
+  EXPECT_TRUE(policy.AddFrames(50, 0));
+  EXPECT_EQ(6, policy.Choose(stream, MakeSystem(8)).threads);
+
+  EXPECT_TRUE(policy.AddFrames(250, 10));
+  EXPECT_EQ(8, policy.Choose(stream, MakeSystem(8)).threads);
+
+  // no more threads to be had
+  EXPECT_FALSE(policy.AddFrames(250, 10));
+}
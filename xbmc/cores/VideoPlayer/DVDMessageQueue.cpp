@@ -118,11 +118,10 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
     if (!front)
       prio++;
 
-    auto it = std::find_if(m_prioMessages.begin(), m_prioMessages.end(),
-                           [prio](const DVDMessageListItem &item){
-                             return prio <= item.priority;
-                           });
-    m_prioMessages.emplace(it, pMsg, priority);
+    size_t pos = 0;
+    while (pos < m_prioMessages.size() && prio > m_prioMessages[pos].priority)
+      pos++;
+    m_prioMessages.emplace(pos, pMsg, priority);
   }
   else
   {
@@ -152,8 +151,9 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
     }
   }
 
-  // inform waiter for new packet
-  m_hEvent.Set();
+  // inform waiter for new packet, the event has its own lock so skip it if nobody is waiting
+  if (m_waiters > 0)
+    m_hEvent.Set();
 
   return MSGQ_OK;
 }
@@ -174,7 +174,8 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
 
   while (!m_bAbortRequest)
   {
-    std::list<DVDMessageListItem> &msgs = (priority > 0 || !m_prioMessages.empty()) ? m_prioMessages : m_messages;
+    CDVDMessageRing& msgs =
+        (priority > 0 || !m_prioMessages.empty()) ? m_prioMessages : m_messages;
 
     if (!msgs.empty() && (msgs.back().priority >= priority || m_drain))
     {
@@ -205,13 +206,17 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
     else
     {
       m_hEvent.Reset();
+      m_waiters++;
       lock.unlock();
 
       // wait for a new message
-      if (!m_hEvent.Wait(timeout))
-        return MSGQ_TIMEOUT;
+      const bool signaled = m_hEvent.Wait(timeout);
 
       lock.lock();
+      m_waiters--;
+
+      if (!signaled)
+        return MSGQ_TIMEOUT;
     }
   }
 
@@ -275,14 +280,14 @@ unsigned CDVDMessageQueue::GetPacketCount(CDVDMsg::Message type)
     return 0;
 
   unsigned count = 0;
-  for (const auto &item : m_messages)
+  for (size_t i = 0; i < m_messages.size(); i++)
   {
-    if(item.message->IsType(type))
+    if (m_messages[i].message->IsType(type))
       count++;
   }
-  for (const auto &item : m_prioMessages)
+  for (size_t i = 0; i < m_prioMessages.size(); i++)
   {
-    if(item.message->IsType(type))
+    if (m_prioMessages[i].message->IsType(type))
       count++;
   }
 
@@ -14,8 +14,8 @@
 
 #include <algorithm>
 #include <atomic>
-#include <list>
 #include <string>
+#include <vector>
 
 struct DVDMessageListItem
 {
@@ -25,14 +25,109 @@ struct DVDMessageListItem
   }
   DVDMessageListItem() { priority = 0; }
   DVDMessageListItem(const DVDMessageListItem&) = delete;
+  DVDMessageListItem(DVDMessageListItem&&) noexcept = default;
   ~DVDMessageListItem() = default;
 
   DVDMessageListItem& operator=(const DVDMessageListItem&) = delete;
+  DVDMessageListItem& operator=(DVDMessageListItem&&) noexcept = default;
 
   std::shared_ptr<CDVDMsg> message;
   int priority;
 };
 
+/*!
+ * \brief Double ended ring of message items backed by a preallocated power of two buffer.
+ *
+ * Unlike std::list it does not allocate a node per message. The buffer only grows when it
+ * runs full and keeps its capacity afterwards, so a queue in steady state never touches the
+ * allocator. Front is the end new messages are put to, back is the end Get() takes from.
+ */
+class CDVDMessageRing
+{
+public:
+  explicit CDVDMessageRing(size_t capacity) { Reserve(capacity); }
+
+  bool empty() const { return m_count == 0; }
+  size_t size() const { return m_count; }
+
+  DVDMessageListItem& operator[](size_t i) { return m_items[(m_head + i) & m_mask]; }
+  const DVDMessageListItem& operator[](size_t i) const { return m_items[(m_head + i) & m_mask]; }
+  DVDMessageListItem& front() { return (*this)[0]; }
+  DVDMessageListItem& back() { return (*this)[m_count - 1]; }
+
+  void emplace_front(std::shared_ptr<CDVDMsg> msg, int priority)
+  {
+    if (m_count == m_items.size())
+      Reserve(m_items.size() * 2);
+    m_head = (m_head - 1) & m_mask;
+    m_items[m_head] = DVDMessageListItem(std::move(msg), priority);
+    m_count++;
+  }
+
+  void emplace_back(std::shared_ptr<CDVDMsg> msg, int priority)
+  {
+    if (m_count == m_items.size())
+      Reserve(m_items.size() * 2);
+    m_items[(m_head + m_count) & m_mask] = DVDMessageListItem(std::move(msg), priority);
+    m_count++;
+  }
+
+  /*!
+   * \brief Insert an item in front of position pos, pos == size() appends at the back.
+   */
+  void emplace(size_t pos, std::shared_ptr<CDVDMsg> msg, int priority)
+  {
+    emplace_back(std::move(msg), priority);
+    for (size_t i = m_count - 1; i > pos; i--)
+      std::swap((*this)[i], (*this)[i - 1]);
+  }
+
+  void pop_back()
+  {
+    back().message.reset();
+    m_count--;
+  }
+
+  template<typename Pred>
+  void remove_if(Pred pred)
+  {
+    size_t keep = 0;
+    for (size_t i = 0; i < m_count; i++)
+    {
+      if (pred((*this)[i]))
+        continue;
+      if (keep != i)
+        (*this)[keep] = std::move((*this)[i]);
+      keep++;
+    }
+    for (size_t i = keep; i < m_count; i++)
+      (*this)[i].message.reset();
+    m_count = keep;
+  }
+
+private:
+  void Reserve(size_t capacity)
+  {
+    size_t size = 1;
+    while (size < capacity)
+      size <<= 1;
+    if (size <= m_items.size())
+      return;
+
+    std::vector<DVDMessageListItem> items(size);
+    for (size_t i = 0; i < m_count; i++)
+      items[i] = std::move((*this)[i]);
+    m_items.swap(items);
+    m_head = 0;
+    m_mask = size - 1;
+  }
+
+  std::vector<DVDMessageListItem> m_items;
+  size_t m_head = 0;
+  size_t m_count = 0;
+  size_t m_mask = 0;
+};
+
 enum MsgQueueReturnCode
 {
   MSGQ_OK = 1,
@@ -110,7 +205,10 @@ private:
   int m_iMaxDataSize;
   std::string m_owner;
 
-  std::list<DVDMessageListItem> m_messages;
-  std::list<DVDMessageListItem> m_prioMessages;
+  // number of Get() calls blocked on m_hEvent, Put() only signals the event if there is one
+  int m_waiters = 0;
+
+  CDVDMessageRing m_messages{256};
+  CDVDMessageRing m_prioMessages{16};
 };
 
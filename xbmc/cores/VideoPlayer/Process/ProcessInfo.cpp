@@ -67,6 +67,8 @@ void CProcessInfo::ResetVideoCodecInfo()
 
   m_videoIsHWDecoder = false;
   m_videoDecoderName = "unknown";
+  m_videoDecoderThreading.clear();
+  m_videoThreadingPolicy = {};
   m_videoDeintMethod = "unknown";
   m_videoPixelFormat = "unknown";
   m_videoStereoMode.clear();
@@ -83,6 +85,7 @@ void CProcessInfo::ResetVideoCodecInfo()
   if (m_dataCache)
   {
     m_dataCache->SetVideoDecoderName(m_videoDecoderName, m_videoIsHWDecoder);
+    m_dataCache->SetVideoDecoderThreading(m_videoDecoderThreading);
     m_dataCache->SetVideoDeintMethod(m_videoDeintMethod);
     m_dataCache->SetVideoPixelFormat(m_videoPixelFormat);
     m_dataCache->SetVideoDimensions(m_videoWidth, m_videoHeight);
@@ -93,6 +96,28 @@ void CProcessInfo::ResetVideoCodecInfo()
   }
 }
 
+CDVDVideoThreadingPolicy::Decision CProcessInfo::ChooseVideoThreading(
+    const CDVDVideoThreadingPolicy::Stream& stream, const CDVDVideoThreadingPolicy::System& system)
+{
+  std::unique_lock lock(m_videoCodecSection);
+
+  return m_videoThreadingPolicy.Choose(stream, system);
+}
+
+bool CProcessInfo::AddVideoThreadingFrames(int frames, int dropped)
+{
+  std::unique_lock lock(m_videoCodecSection);
+
+  return m_videoThreadingPolicy.AddFrames(frames, dropped);
+}
+
+void CProcessInfo::ResetVideoThreadingPolicy()
+{
+  std::unique_lock lock(m_videoCodecSection);
+
+  m_videoThreadingPolicy = {};
+}
+
 void CProcessInfo::SetVideoDecoderName(const std::string &name, bool isHw)
 {
   std::unique_lock lock(m_videoCodecSection);
@@ -118,6 +143,23 @@ bool CProcessInfo::IsVideoHwDecoder()
   return m_videoIsHWDecoder;
 }
 
+void CProcessInfo::SetVideoDecoderThreading(const std::string& threading)
+{
+  std::unique_lock lock(m_videoCodecSection);
+
+  m_videoDecoderThreading = threading;
+
+  if (m_dataCache)
+    m_dataCache->SetVideoDecoderThreading(m_videoDecoderThreading);
+}
+
+std::string CProcessInfo::GetVideoDecoderThreading()
+{
+  std::unique_lock lock(m_videoCodecSection);
+
+  return m_videoDecoderThreading;
+}
+
 void CProcessInfo::SetVideoDeintMethod(const std::string &method)
 {
   std::unique_lock lock(m_videoCodecSection);
@@ -319,6 +361,12 @@ void CProcessInfo::SetPixFormats(std::vector<AVPixelFormat> &formats)
   m_pixFormats = formats;
 }
 
+void CProcessInfo::SetVideoDroppedFrames(int dropped)
+{
+  if (m_dataCache)
+    m_dataCache->SetVideoDroppedFrames(dropped);
+}
+
 //******************************************************************************
 // player audio info
 //******************************************************************************
@@ -676,6 +724,22 @@ int64_t CProcessInfo::GetMaxTime()
   return m_timeMax;
 }
 
+//******************************************************************************
+// player stages
+//******************************************************************************
+std::chrono::steady_clock::time_point CProcessInfo::StartPlayerStage() const
+{
+  if (m_dataCache && m_dataCache->IsPlayerStageTimingEnabled())
+    return std::chrono::steady_clock::now();
+  return {};
+}
+
+void CProcessInfo::EndPlayerStage(PlayerStage stage, std::chrono::steady_clock::time_point start)
+{
+  if (start != std::chrono::steady_clock::time_point{} && m_dataCache)
+    m_dataCache->AddPlayerStageTime(stage, std::chrono::steady_clock::now() - start);
+}
+
 //******************************************************************************
 // settings
 //******************************************************************************
@@ -8,12 +8,15 @@
 
 #pragma once
 
+#include "cores/DataCacheCore.h"
 #include "cores/VideoPlayer/Buffers/VideoBuffer.h"
+#include "cores/VideoPlayer/DVDCodecs/Video/DVDVideoThreadingPolicy.h"
 #include "cores/VideoPlayer/VideoRenderers/RenderInfo.h"
 #include "cores/VideoSettings.h"
 #include "threads/CriticalSection.h"
 
 #include <atomic>
+#include <chrono>
 #include <list>
 #include <map>
 #include <string>
@@ -36,6 +39,19 @@ public:
   void SetVideoDecoderName(const std::string &name, bool isHw);
   std::string GetVideoDecoderName();
   bool IsVideoHwDecoder();
+  void SetVideoDecoderThreading(const std::string& threading);
+  std::string GetVideoDecoderThreading();
+  /*!
+   * @brief The threading policy of the software video decoder, kept across the decoders opened for
+   * the video stream. Decoders are opened on the player thread as well as on the video thread, so
+   * the policy is only accessed through these. Reset for every stream opened.
+   * @sa CDVDVideoThreadingPolicy
+   */
+  CDVDVideoThreadingPolicy::Decision ChooseVideoThreading(
+      const CDVDVideoThreadingPolicy::Stream& stream,
+      const CDVDVideoThreadingPolicy::System& system);
+  bool AddVideoThreadingFrames(int frames, int dropped);
+  void ResetVideoThreadingPolicy();
   void SetVideoDeintMethod(const std::string &method);
   std::string GetVideoDeintMethod();
   void SetVideoPixelFormat(const std::string &pixFormat);
@@ -59,6 +75,7 @@ public:
   CVideoBufferManager& GetVideoBufferManager();
   std::vector<AVPixelFormat> GetPixFormats();
   void SetPixFormats(std::vector<AVPixelFormat> &formats);
+  void SetVideoDroppedFrames(int dropped);
 
   // player audio info
   void ResetAudioCodecInfo();
@@ -114,6 +131,10 @@ public:
   void SetPlayTimes(time_t start, int64_t current, int64_t min, int64_t max);
   int64_t GetMaxTime();
 
+  // player stages, timed only while the data cache has the timing enabled
+  std::chrono::steady_clock::time_point StartPlayerStage() const;
+  void EndPlayerStage(PlayerStage stage, std::chrono::steady_clock::time_point start);
+
   // settings
   CVideoSettings GetVideoSettings();
   void SetVideoSettings(CVideoSettings &settings);
@@ -127,6 +148,8 @@ protected:
   // player video info
   bool m_videoIsHWDecoder;
   std::string m_videoDecoderName;
+  std::string m_videoDecoderThreading;
+  CDVDVideoThreadingPolicy m_videoThreadingPolicy;
   std::string m_videoDeintMethod;
   std::string m_videoPixelFormat;
   std::string m_videoStereoMode;
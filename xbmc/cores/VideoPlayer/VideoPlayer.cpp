@@ -1193,7 +1193,11 @@ bool CVideoPlayer::ReadPacket(DemuxPacket*& packet, CDemuxStream*& stream)
 
   // read a data frame from stream.
   if (m_pDemuxer)
+  {
+    const auto start = m_processInfo->StartPlayerStage();
     packet = m_pDemuxer->Read();
+    m_processInfo->EndPlayerStage(PlayerStage::DEMUX, start);
+  }
 
   if (packet)
   {
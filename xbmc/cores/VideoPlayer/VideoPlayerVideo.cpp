@@ -23,6 +23,7 @@
 #include "windowing/GraphicContext.h"
 #include "windowing/WinSystem.h"
 
+#include <chrono>
 #include <iomanip>
 #include <iterator>
 #include <memory>
@@ -136,6 +137,9 @@ bool CVideoPlayerVideo::OpenStream(CDVDStreamInfo hint)
       hint.codecOptions |= CODEC_ALLOW_FALLBACK;
     }
 
+    // what was learned about the threads of the previous stream doesn't apply to this one
+    m_processInfo.ResetVideoThreadingPolicy();
+
     std::unique_ptr<CDVDVideoCodec> codec = CDVDFactoryCodec::CreateVideoCodec(hint, m_processInfo);
     if (!codec)
     {
@@ -305,8 +309,11 @@ inline MsgQueueReturnCode CVideoPlayerVideo::GetMessage(std::shared_ptr<CDVDMsg>
                                                         std::chrono::milliseconds timeout,
                                                         int& priority)
 {
+  const auto start = m_processInfo.StartPlayerStage();
   MsgQueueReturnCode ret = m_messageQueue.Get(pMsg, timeout, priority);
   m_processInfo.SetLevelVQ(m_messageQueue.GetLevel());
+  if (ret == MSGQ_OK && pMsg->IsType(CDVDMsg::DEMUXER_PACKET))
+    m_processInfo.EndPlayerStage(PlayerStage::PACKET_WAIT, start);
   return ret;
 }
 
@@ -324,6 +331,7 @@ void CVideoPlayerVideo::Process()
   m_videoStats.Start();
   m_droppingStats.Reset();
   m_iDroppedFrames = 0;
+  m_processInfo.SetVideoDroppedFrames(0);
   m_rewindStalled = false;
   m_outputSate = OUTPUT_NORMAL;
 
@@ -559,6 +567,7 @@ void CVideoPlayerVideo::Process()
       if (iDropDirective & DROP_DROPPED)
       {
         m_iDroppedFrames++;
+        m_processInfo.SetVideoDroppedFrames(m_iDroppedFrames);
         m_ptsTracker.Flush();
       }
       if (m_messageQueue.GetDataSize() == 0 ||  m_speed < 0)
@@ -581,7 +590,10 @@ void CVideoPlayerVideo::Process()
         codecControl |= DVD_CODEC_CTRL_ROTATE;
       m_pVideoCodec->SetCodecControl(codecControl);
 
-      if (m_pVideoCodec->AddData(*pPacket))
+      const auto start = m_processInfo.StartPlayerStage();
+      const bool added = m_pVideoCodec->AddData(*pPacket);
+      m_processInfo.EndPlayerStage(PlayerStage::DECODE, start);
+      if (added)
       {
         // buffer packets so we can recover should decoder flush for some reason
         if (m_pVideoCodec->GetConvergeCount() > 0)
@@ -610,7 +622,9 @@ void CVideoPlayerVideo::Process()
 
 bool CVideoPlayerVideo::ProcessDecoderOutput(double &frametime, double &pts)
 {
+  const auto start = m_processInfo.StartPlayerStage();
   CDVDVideoCodec::VCReturn decoderState = m_pVideoCodec->GetPicture(&m_picture);
+  m_processInfo.EndPlayerStage(PlayerStage::DECODE, start);
 
   if (decoderState == CDVDVideoCodec::VC_BUFFER)
   {
@@ -758,6 +772,7 @@ bool CVideoPlayerVideo::ProcessDecoderOutput(double &frametime, double &pts)
     else if ((m_outputSate == OUTPUT_DROPPED) && !(m_picture.iFlags & DVP_FLAG_DROPPED))
     {
       m_iDroppedFrames++;
+      m_processInfo.SetVideoDroppedFrames(m_iDroppedFrames);
       m_ptsTracker.Flush();
     }
 
@@ -928,9 +943,11 @@ CVideoPlayerVideo::EOutputState CVideoPlayerVideo::OutputPicture(const VideoPict
   // don't wait when going ff
   if (m_speed > DVD_PLAYSPEED_NORMAL)
     maxWaitTime = std::max(timeToDisplay, 0ms);
+  const auto queueStart = m_processInfo.StartPlayerStage();
   int buffer = m_renderManager.WaitForBuffer(m_bAbortOutput, maxWaitTime);
   if (buffer < 0)
   {
+    m_processInfo.EndPlayerStage(PlayerStage::RENDER_QUEUE, queueStart);
     if (m_speed != DVD_PLAYSPEED_PAUSE)
       CLog::Log(LOGWARNING, "{} - timeout waiting for buffer", __FUNCTION__);
     return OUTPUT_AGAIN;
@@ -943,7 +960,10 @@ CVideoPlayerVideo::EOutputState CVideoPlayerVideo::OutputPicture(const VideoPict
   if (!m_processInfo.Supports(deintMethod))
     deintMethod = m_processInfo.GetDeinterlacingMethodDefault();
 
-  if (!m_renderManager.AddVideoPicture(*pPicture, m_bAbortOutput, deintMethod, (m_syncState == ESyncState::SYNC_STARTING)))
+  const bool added = m_renderManager.AddVideoPicture(*pPicture, m_bAbortOutput, deintMethod,
+                                                     (m_syncState == ESyncState::SYNC_STARTING));
+  m_processInfo.EndPlayerStage(PlayerStage::RENDER_QUEUE, queueStart);
+  if (!added)
   {
     m_droppingStats.AddOutputDropGain(pPicture->pts, 1);
     return OUTPUT_DROPPED;
@@ -963,6 +983,10 @@ std::string CVideoPlayerVideo::GetPlayerInfo()
   s << ", drop:" << m_iDroppedFrames;
   s << ", skip:" << m_renderManager.GetSkippedFrames();
 
+  const std::string threading = m_processInfo.GetVideoDecoderThreading();
+  if (!threading.empty())
+    s << ", thr:" << threading;
+
   int pc = m_ptsTracker.GetPatternLength();
   if (pc > 0)
     s << ", pc:" << pc;
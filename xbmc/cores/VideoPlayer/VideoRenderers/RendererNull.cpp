@@ -0,0 +1,128 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "RendererNull.h"
+
+#include "RenderFactory.h"
+#include "cores/VideoPlayer/DVDCodecs/Video/DVDVideoCodec.h"
+#include "threads/CriticalSection.h"
+#include "utils/log.h"
+
+#include <mutex>
+
+namespace
+{
+CCriticalSection statsSection;
+CRendererNull::Stats stats;
+} // unnamed namespace
+
+CRendererNull::~CRendererNull()
+{
+  UnInit();
+}
+
+CBaseRenderer* CRendererNull::Create(CVideoBuffer* buffer)
+{
+  return new CRendererNull();
+}
+
+bool CRendererNull::Register()
+{
+  VIDEOPLAYER::CRendererFactory::RegisterRenderer("null", CRendererNull::Create);
+  return true;
+}
+
+CRendererNull::Stats CRendererNull::GetStats()
+{
+  std::unique_lock lock(statsSection);
+  return stats;
+}
+
+void CRendererNull::ResetStats()
+{
+  std::unique_lock lock(statsSection);
+  stats = {};
+}
+
+bool CRendererNull::Configure(const VideoPicture& picture, float fps, unsigned int orientation)
+{
+  m_format = picture.videoBuffer->GetFormat();
+  m_sourceWidth = picture.iWidth;
+  m_sourceHeight = picture.iHeight;
+  m_renderOrientation = orientation;
+  m_fps = fps;
+  m_configured = true;
+
+  CLog::Log(LOGDEBUG, "CRendererNull::Configure - {}x{} at {:.3f} fps", m_sourceWidth,
+            m_sourceHeight, m_fps);
+  return true;
+}
+
+void CRendererNull::AddVideoPicture(const VideoPicture& picture, int index)
+{
+  CVideoBuffer*& buffer = m_buffers[index];
+  if (buffer)
+  {
+    CLog::LogF(LOGERROR, "unreleased video buffer");
+    buffer->Release();
+  }
+  buffer = picture.videoBuffer;
+  buffer->Acquire();
+
+  std::unique_lock lock(statsSection);
+  stats.added++;
+}
+
+void CRendererNull::UnInit()
+{
+  Flush(false);
+  m_configured = false;
+}
+
+bool CRendererNull::Flush(bool saveBuffers)
+{
+  for (int i = 0; i < NUM_BUFFERS; i++)
+    ReleaseBuffer(i);
+  m_presented = -1;
+  return false;
+}
+
+void CRendererNull::ReleaseBuffer(int idx)
+{
+  CVideoBuffer*& buffer = m_buffers[idx];
+  if (buffer)
+  {
+    buffer->Release();
+    buffer = nullptr;
+  }
+}
+
+CRenderInfo CRendererNull::GetRenderInfo()
+{
+  CRenderInfo info;
+  info.max_buffer_size = NUM_BUFFERS;
+  return info;
+}
+
+void CRendererNull::RenderUpdate(
+    int index, int index2, bool clear, unsigned int flags, unsigned int alpha)
+{
+  // a picture stays in its buffer while it's presented, a new index is a new picture
+  if (!m_buffers[index] || index == m_presented)
+    return;
+
+  m_presented = index;
+
+  std::unique_lock lock(statsSection);
+  stats.presented++;
+}
+
+bool CRendererNull::ConfigChanged(const VideoPicture& picture)
+{
+  return picture.videoBuffer->GetFormat() != m_format;
+}
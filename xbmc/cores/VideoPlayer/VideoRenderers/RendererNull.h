@@ -0,0 +1,63 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "BaseRenderer.h"
+
+#include <array>
+#include <stdint.h>
+
+/*!
+ \brief A renderer without a display, for running and benchmarking the video player headless
+
+ It takes the pictures of any decoder and holds their buffers until the render manager releases
+ them, like a renderer uploading them would, but never draws them.
+ */
+class CRendererNull : public CBaseRenderer
+{
+public:
+  //! What the renderers got since the last ResetStats()
+  struct Stats
+  {
+    uint64_t added{0}; //!< the pictures added to the render buffers
+    uint64_t presented{0}; //!< the pictures presented at least once
+  };
+
+  CRendererNull() = default;
+  ~CRendererNull() override;
+
+  static CBaseRenderer* Create(CVideoBuffer* buffer);
+  static bool Register();
+
+  static Stats GetStats();
+  static void ResetStats();
+
+  // Player functions
+  bool Configure(const VideoPicture& picture, float fps, unsigned int orientation) override;
+  bool IsConfigured() override { return m_configured; }
+  void AddVideoPicture(const VideoPicture& picture, int index) override;
+  void UnInit() override;
+  bool Flush(bool saveBuffers) override;
+  void ReleaseBuffer(int idx) override;
+  CRenderInfo GetRenderInfo() override;
+  void Update() override {}
+  void RenderUpdate(
+      int index, int index2, bool clear, unsigned int flags, unsigned int alpha) override;
+  bool RenderCapture(int index, CRenderCapture* capture) override { return false; }
+  bool ConfigChanged(const VideoPicture& picture) override;
+
+  // Feature support
+  bool SupportsMultiPassRendering() override { return false; }
+  bool Supports(ESCALINGMETHOD method) const override { return false; }
+
+private:
+  bool m_configured{false};
+  std::array<CVideoBuffer*, NUM_BUFFERS> m_buffers{};
+  int m_presented{-1};
+};
@@ -0,0 +1,162 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/DVDMessage.h"
+#include "cores/VideoPlayer/DVDMessageQueue.h"
+#include "cores/VideoPlayer/Interface/DemuxPacket.h"
+
+#include <chrono>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+std::shared_ptr<CDVDMsg> IntMsg(int value)
+{
+  return std::make_shared<CDVDMsgInt>(CDVDMsg::GENERAL_PAUSE, value);
+}
+
+std::shared_ptr<CDVDMsg> PacketMsg(int size)
+{
+  auto* packet = new DemuxPacket();
+  packet->iSize = size;
+  return std::make_shared<CDVDMsgDemuxerPacket>(packet);
+}
+
+int Value(const std::shared_ptr<CDVDMsg>& msg)
+{
+  return static_cast<CDVDMsgInt*>(msg.get())->m_value;
+}
+
+// takes the next message and returns its value, -1 if there is none
+int GetValue(CDVDMessageQueue& queue)
+{
+  std::shared_ptr<CDVDMsg> msg;
+  if (queue.Get(msg, 0ms) != MSGQ_OK)
+    return -1;
+  return Value(msg);
+}
+} // namespace
+
+TEST(TestDVDMessageQueue, RingWraparound)
+{
+  CDVDMessageRing ring(4);
+
+  // move the head around the buffer several times without ever growing it
+  int next = 0;
+  for (int i = 0; i < 3; i++)
+    ring.emplace_front(IntMsg(next++), 0);
+  for (int expected = 0; expected < 20; expected++)
+  {
+    ASSERT_EQ(3u, ring.size());
+    EXPECT_EQ(expected, Value(ring.back().message));
+    ring.pop_back();
+    ring.emplace_front(IntMsg(next++), 0);
+  }
+
+  // both ends keep their order across the end of the buffer
+  ring.emplace_back(IntMsg(100), 0);
+  ASSERT_EQ(4u, ring.size());
+  EXPECT_EQ(100, Value(ring.back().message));
+  EXPECT_EQ(next - 1, Value(ring.front().message));
+  ring.pop_back();
+  for (int expected = 20; expected < next; expected++)
+  {
+    EXPECT_EQ(expected, Value(ring.back().message));
+    ring.pop_back();
+  }
+  EXPECT_TRUE(ring.empty());
+}
+
+TEST(TestDVDMessageQueue, PriorityOrdering)
+{
+  CDVDMessageQueue queue("test");
+  queue.Init();
+
+  queue.Put(IntMsg(1));
+  queue.Put(IntMsg(2));
+  queue.Put(IntMsg(10), 1);
+  queue.Put(IntMsg(20), 2);
+  queue.Put(IntMsg(11), 1);
+  // put back ahead of the messages of the same priority
+  queue.PutBack(IntMsg(12), 1);
+
+  // higher priorities first, in the order they were put
+  EXPECT_EQ(20, GetValue(queue));
+  EXPECT_EQ(12, GetValue(queue));
+  EXPECT_EQ(10, GetValue(queue));
+  EXPECT_EQ(11, GetValue(queue));
+  EXPECT_EQ(1, GetValue(queue));
+  EXPECT_EQ(2, GetValue(queue));
+  EXPECT_EQ(-1, GetValue(queue));
+
+  // a minimum priority leaves the lower ones in the queue
+  queue.Put(IntMsg(3));
+  queue.Put(IntMsg(13), 1);
+  std::shared_ptr<CDVDMsg> msg;
+  int priority = 2;
+  EXPECT_EQ(MSGQ_TIMEOUT, queue.Get(msg, 0ms, priority));
+  priority = 1;
+  ASSERT_EQ(MSGQ_OK, queue.Get(msg, 0ms, priority));
+  EXPECT_EQ(13, Value(msg));
+  EXPECT_EQ(3, GetValue(queue));
+}
+
+TEST(TestDVDMessageQueue, GrowBeyondCapacity)
+{
+  CDVDMessageQueue queue("test");
+  queue.Init();
+
+  // far more than the rings are preallocated for
+  constexpr int count = 1000;
+  for (int i = 0; i < count; i++)
+  {
+    ASSERT_EQ(MSGQ_OK, queue.Put(IntMsg(i)));
+    ASSERT_EQ(MSGQ_OK, queue.Put(IntMsg(count + i), 1));
+  }
+  EXPECT_EQ(2u * count, queue.GetPacketCount(CDVDMsg::GENERAL_PAUSE));
+
+  for (int i = 0; i < count; i++)
+    ASSERT_EQ(count + i, GetValue(queue));
+  for (int i = 0; i < count; i++)
+    ASSERT_EQ(i, GetValue(queue));
+  EXPECT_EQ(-1, GetValue(queue));
+}
+
+TEST(TestDVDMessageQueue, FlushWhileFull)
+{
+  CDVDMessageQueue queue("test");
+  queue.Init();
+  queue.SetMaxDataSize(1000);
+
+  // fill the ring of the normal messages exactly, half of them packets
+  constexpr int count = 256;
+  for (int i = 0; i < count / 2; i++)
+  {
+    queue.Put(PacketMsg(100));
+    queue.Put(IntMsg(i));
+  }
+  EXPECT_TRUE(queue.IsFull());
+  EXPECT_EQ(count / 2u, queue.GetPacketCount(CDVDMsg::DEMUXER_PACKET));
+
+  queue.Flush();
+  EXPECT_FALSE(queue.IsFull());
+  EXPECT_EQ(0, queue.GetDataSize());
+  EXPECT_EQ(0u, queue.GetPacketCount(CDVDMsg::DEMUXER_PACKET));
+  EXPECT_EQ(count / 2u, queue.GetPacketCount(CDVDMsg::GENERAL_PAUSE));
+
+  // the ring keeps working after the flush compacted it
+  for (int i = count / 2; i < count * 2; i++)
+    queue.Put(IntMsg(i));
+  for (int i = 0; i < count * 2; i++)
+    ASSERT_EQ(i, GetValue(queue));
+  EXPECT_EQ(-1, GetValue(queue));
+}
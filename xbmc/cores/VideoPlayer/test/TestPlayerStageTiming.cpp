@@ -0,0 +1,77 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/DataCacheCore.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+TEST(TestPlayerStageTiming, DisabledByDefault)
+{
+  CDataCacheCore dataCache;
+  EXPECT_FALSE(dataCache.IsPlayerStageTimingEnabled());
+
+  dataCache.EnablePlayerStageTiming(true);
+  EXPECT_TRUE(dataCache.IsPlayerStageTimingEnabled());
+
+  // a reset between two files keeps the timing on
+  dataCache.Reset();
+  EXPECT_TRUE(dataCache.IsPlayerStageTimingEnabled());
+}
+
+TEST(TestPlayerStageTiming, AddAndReset)
+{
+  CDataCacheCore dataCache;
+  dataCache.AddPlayerStageTime(PlayerStage::DECODE, 3ms);
+  dataCache.AddPlayerStageTime(PlayerStage::DECODE, 7ms);
+  dataCache.AddPlayerStageTime(PlayerStage::DECODE, 2ms);
+  dataCache.SetVideoDroppedFrames(4);
+
+  PlayerStageTiming timing = dataCache.GetPlayerStageTiming(PlayerStage::DECODE);
+  EXPECT_EQ(3u, timing.count);
+  EXPECT_EQ(12ms, timing.total);
+  EXPECT_EQ(7ms, timing.max);
+  EXPECT_EQ(0u, dataCache.GetPlayerStageTiming(PlayerStage::DEMUX).count);
+  EXPECT_EQ(4, dataCache.GetVideoDroppedFrames());
+
+  dataCache.Reset();
+  timing = dataCache.GetPlayerStageTiming(PlayerStage::DECODE);
+  EXPECT_EQ(0u, timing.count);
+  EXPECT_EQ(0ns, timing.total);
+  EXPECT_EQ(0ns, timing.max);
+  EXPECT_EQ(0, dataCache.GetVideoDroppedFrames());
+}
+
+TEST(TestPlayerStageTiming, ConcurrentThreads)
+{
+  CDataCacheCore dataCache;
+
+  // the demuxer and the video player record their stages at the same time
+  std::vector<std::thread> threads;
+  for (int i = 1; i <= 4; ++i)
+  {
+    threads.emplace_back(
+        [&dataCache, i]()
+        {
+          for (int n = 0; n < 10000; ++n)
+            dataCache.AddPlayerStageTime(PlayerStage::RENDER_QUEUE, std::chrono::nanoseconds(i));
+        });
+  }
+  for (auto& thread : threads)
+    thread.join();
+
+  const PlayerStageTiming timing = dataCache.GetPlayerStageTiming(PlayerStage::RENDER_QUEUE);
+  EXPECT_EQ(40000u, timing.count);
+  EXPECT_EQ(std::chrono::nanoseconds(100000), timing.total);
+  EXPECT_EQ(4ns, timing.max);
+}
@@ -0,0 +1,307 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "ServiceBroker.h"
+#include "application/ApplicationComponents.h"
+#include "application/ApplicationPowerHandling.h"
+#include "cores/AudioEngine/AESinkFactory.h"
+#include "cores/AudioEngine/Engines/ActiveAE/ActiveAE.h"
+#include "cores/AudioEngine/Sinks/AESinkNULL.h"
+#include "cores/DataCacheCore.h"
+#include "cores/IPlayerCallback.h"
+#include "cores/VideoPlayer/VideoPlayer.h"
+#include "cores/VideoPlayer/VideoRenderers/RenderFactory.h"
+#include "cores/VideoPlayer/VideoRenderers/RendererNull.h"
+#include "interfaces/AnnouncementManager.h"
+#include "jobs/JobManager.h"
+#include "messaging/ApplicationMessenger.h"
+#include "messaging/IMessageTarget.h"
+#include "messaging/ThreadMessage.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/Settings.h"
+#include "settings/SettingsComponent.h"
+#include "threads/Thread.h"
+#include "utils/CPUInfo.h"
+#include "windowing/GraphicContext.h"
+#include "windowing/WinSystem.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#if defined(TARGET_LINUX)
+#include <fstream>
+#endif
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+//! the tempo of the fast forward run, far above what software decoders keep up with
+constexpr float FAST_TEMPO = 8.0f;
+
+//! the sample to play, e.g. a software decoded H.264, HEVC or AV1 file
+constexpr const char* SAMPLE_VARIABLE = "KODI_VIDEOPLAYER_BENCHMARK_FILE";
+
+//! A window system without a window, it only provides the graphic context and the render loop
+class CWinSystemNull : public CWinSystemBase
+{
+public:
+  bool CreateNewWindow(const std::string& name, bool fullScreen, RESOLUTION_INFO& res) override
+  {
+    return true;
+  }
+  bool ResizeWindow(int newWidth, int newHeight, int newLeft, int newTop) override { return true; }
+  bool SetFullScreen(bool fullScreen, RESOLUTION_INFO& res, bool blankOtherDisplays) override
+  {
+    return true;
+  }
+  void Register(IDispResource* resource) override {}
+  void Unregister(IDispResource* resource) override {}
+};
+
+//! Does what the application does for the renderer when the player asks it to
+class CRendererMessages : public KODI::MESSAGING::IMessageTarget
+{
+public:
+  int GetMessageMask() override { return TMSG_MASK_APPLICATION; }
+  void OnApplicationMessage(KODI::MESSAGING::ThreadMessage* msg) override
+  {
+    IPlayer* player = m_player;
+    if (msg->dwMessage == TMSG_RENDERER_FLUSH && player)
+      player->FlushRenderer();
+  }
+
+  std::atomic<IPlayer*> m_player{nullptr};
+};
+
+class CPlayerCallback : public IPlayerCallback
+{
+public:
+  void OnPlayBackEnded() override { m_done = true; }
+  void OnPlayBackStarted(const CFileItem& file) override {}
+  void OnPlayBackStopped() override { m_done = true; }
+  void OnPlayBackError() override
+  {
+    m_error = true;
+    m_done = true;
+  }
+  void OnQueueNextItem() override {}
+  void OnAVStarted(const CFileItem& file) override { m_started = true; }
+
+  std::atomic_bool m_started{false};
+  std::atomic_bool m_done{false};
+  std::atomic_bool m_error{false};
+};
+
+//! The peak of the resident memory of the process, -1 if unknown
+long GetPeakMemoryKiB()
+{
+#if defined(TARGET_LINUX)
+  std::ifstream status("/proc/self/status");
+  std::string key;
+  while (status >> key)
+  {
+    long value;
+    if (key == "VmHWM:" && status >> value)
+      return value;
+  }
+#endif
+  return -1;
+}
+
+void ResetPeakMemory()
+{
+#if defined(TARGET_LINUX)
+  std::ofstream("/proc/self/clear_refs") << "5";
+#endif
+}
+
+/*!
+ Plays a file with the video player headless, with the null renderer and the null audio sink,
+ and reports the time spent in the stages of the player, the dropped frames and the peak memory.
+
+ The file is taken from the environment variable KODI_VIDEOPLAYER_BENCHMARK_FILE. It's played in
+ real time with audio, and fast forward: without audio at tempo 8.
+
+ The player has no mode without a clock, so the fast forward run doesn't measure the raw
+ throughput of the decoder. It measures how the player copes with a clock the decoder can't keep
+ up with: the pictures presented per second of wall time, the frames dropped to stay in sync, and
+ where the time goes in the stages. Compare its numbers between builds on the same machine and
+ file only.
+
+ Run with --gtest_also_run_disabled_tests --gtest_filter=TestVideoPlayerBenchmark.*
+ */
+class TestVideoPlayerBenchmark : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    const char* path = std::getenv(SAMPLE_VARIABLE);
+    if (!path || !*path)
+      GTEST_SKIP() << SAMPLE_VARIABLE << " is not set";
+    m_path = path;
+
+    if (!CServiceBroker::GetCPUInfo())
+      CServiceBroker::RegisterCPUInfo(CCPUInfo::GetCPUInfo());
+    if (!CServiceBroker::GetJobManager())
+      CServiceBroker::RegisterJobManager(std::make_shared<CJobManager>());
+    if (!CServiceBroker::GetAnnouncementManager())
+    {
+      auto announcementManager = std::make_shared<ANNOUNCEMENT::CAnnouncementManager>();
+      announcementManager->Start();
+      CServiceBroker::RegisterAnnouncementManager(announcementManager);
+    }
+
+    // this thread is the one of the application, it processes the messages and renders
+    const auto messenger = CServiceBroker::GetAppMessenger();
+    messenger->SetProcessThread(CThread::GetCurrentThreadId());
+    messenger->RegisterReceiver(&m_messages);
+
+    CServiceBroker::RegisterWinSystem(&m_winSystem);
+    CServiceBroker::GetAppComponents().GetComponent<CApplicationPowerHandling>()->SetRenderGUI(
+        true);
+
+    VIDEOPLAYER::CRendererFactory::ClearRenderer();
+    CRendererNull::Register();
+
+    AE::CAESinkFactory::ClearSinks();
+    CAESinkNULL::Register();
+  }
+
+  void TearDown() override
+  {
+    if (m_path.empty())
+      return;
+
+    AE::CAESinkFactory::ClearSinks();
+    VIDEOPLAYER::CRendererFactory::ClearRenderer();
+    CServiceBroker::GetAppComponents().GetComponent<CApplicationPowerHandling>()->SetRenderGUI(
+        false);
+    CServiceBroker::UnregisterWinSystem();
+  }
+
+  void Run(float tempo)
+  {
+    const bool fast = tempo != 1.0f;
+
+    const auto settingsComponent = CServiceBroker::GetSettingsComponent();
+    const auto settings = settingsComponent->GetSettings();
+    settings->SetString(CSettings::SETTING_AUDIOOUTPUT_AUDIODEVICE, "NULL:default");
+    settings->SetInt(CSettings::SETTING_AUDIOOUTPUT_STREAMSILENCE, 0);
+    // tempo needs the player to run its own clock
+    settings->SetBool(CSettings::SETTING_VIDEOPLAYER_USEDISPLAYASCLOCK, fast);
+    const float maxTempo = settingsComponent->GetAdvancedSettings()->m_maxTempo;
+    if (fast)
+      settingsComponent->GetAdvancedSettings()->m_maxTempo = tempo + 0.1f;
+
+    auto ae = std::make_unique<ActiveAE::CActiveAE>();
+    CServiceBroker::RegisterAE(ae.get());
+    ae->Start();
+
+    CServiceBroker::GetDataCacheCore().Reset();
+    CServiceBroker::GetDataCacheCore().EnablePlayerStageTiming(true);
+    CRendererNull::ResetStats();
+    ResetPeakMemory();
+
+    CPlayerCallback callback;
+    auto player = std::make_unique<CVideoPlayer>(callback);
+    m_messages.m_player = player.get();
+
+    CFileItem item(m_path, false);
+    CPlayerOptions options;
+    options.fullscreen = true;
+    options.videoOnly = fast;
+
+    const auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(player->OpenFile(item, options));
+
+    const auto messenger = CServiceBroker::GetAppMessenger();
+    bool tempoSet = !fast;
+    while (!callback.m_done && std::chrono::steady_clock::now() - start < 1h)
+    {
+      messenger->ProcessMessages();
+      {
+        std::unique_lock lock(m_winSystem.GetGfxContext());
+        m_winSystem.DriveRenderLoop();
+        player->Render(true, 255);
+      }
+      if (!tempoSet && callback.m_started)
+      {
+        player->SetTempo(tempo);
+        tempoSet = true;
+      }
+      std::this_thread::sleep_for(1ms);
+    }
+    const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+    player->CloseFile();
+    m_messages.m_player = nullptr;
+    player.reset();
+    CServiceBroker::GetDataCacheCore().EnablePlayerStageTiming(false);
+
+    ae->Shutdown();
+    CServiceBroker::UnregisterAE();
+    ae.reset();
+    settingsComponent->GetAdvancedSettings()->m_maxTempo = maxTempo;
+
+    EXPECT_TRUE(callback.m_done);
+    EXPECT_FALSE(callback.m_error);
+
+    const CRendererNull::Stats stats = CRendererNull::GetStats();
+    EXPECT_GT(stats.presented, 0u);
+
+    CDataCacheCore& dataCache = CServiceBroker::GetDataCacheCore();
+    std::cout << m_path << (fast ? " fast forward x8: " : " in real time: ") << std::fixed
+              << std::setprecision(3) << duration.count() << " s, " << stats.added
+              << " pictures queued, " << stats.presented << " presented, "
+              << dataCache.GetVideoDroppedFrames() << " dropped by the player, peak memory "
+              << GetPeakMemoryKiB() << " KiB" << std::endl;
+
+    constexpr std::pair<PlayerStage, const char*> stages[] = {
+        {PlayerStage::DEMUX, "demux read"},
+        {PlayerStage::PACKET_WAIT, "packet queue wait"},
+        {PlayerStage::DECODE, "decode"},
+        {PlayerStage::RENDER_QUEUE, "render queue"},
+    };
+    for (const auto& [stage, name] : stages)
+    {
+      const PlayerStageTiming timing = dataCache.GetPlayerStageTiming(stage);
+      const double total = std::chrono::duration<double, std::milli>(timing.total).count();
+      std::cout << "  " << name << ": " << timing.count << " times, " << total << " ms total, "
+                << (timing.count ? total / timing.count : 0.0) << " ms average, "
+                << std::chrono::duration<double, std::milli>(timing.max).count() << " ms max"
+                << std::endl;
+    }
+  }
+
+  std::string m_path;
+  CWinSystemNull m_winSystem;
+  static inline CRendererMessages m_messages;
+};
+} // unnamed namespace
+
+TEST_F(TestVideoPlayerBenchmark, DISABLED_RealTime)
+{
+  Run(1.0f);
+}
+
+TEST_F(TestVideoPlayerBenchmark, DISABLED_FastForward8x)
+{
+  Run(FAST_TEMPO);
+}
@@ -8,6 +8,7 @@
 
 #include "Database.h"
 
+#include "DatabaseConnectionPool.h"
 #include "DatabaseManager.h"
 #include "DbUrl.h"
 #include "ServiceBroker.h"
@@ -19,6 +20,7 @@
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "sqlitedataset.h"
+#include "utils/DatabaseUtils.h"
 #include "utils/SortUtils.h"
 #include "utils/StringUtils.h"
 #include "utils/log.h"
@@ -37,8 +39,12 @@ using namespace dbiplus;
 namespace
 {
 constexpr int MAX_COMPRESS_COUNT = 20;
+constexpr size_t MAX_KEYSET_CURSORS = 8;
 } // unnamed namespace
 
+std::mutex CDatabase::m_keysetCursorsMutex;
+std::vector<CDatabase::KeysetCursor> CDatabase::m_keysetCursors;
+
 CDatabase::Filter::Filter() = default;
 
 void CDatabase::Filter::AppendField(const std::string& strField)
@@ -543,7 +549,30 @@ bool CDatabase::Open(const DatabaseSettings& settings)
 
   std::string dbName = dbSettings.name;
   dbName += std::to_string(GetSchemaVersion());
-  return Connect(dbName, dbSettings, false) == CDatabase::ConnectionState::STATE_CONNECTED;
+
+  // reuse a connection another instance has closed. Only SQLite connections are pooled, idle
+  // connections to a server might time out.
+  std::string poolKey;
+  if (m_sqlite && CServiceBroker::IsServiceManagerUp())
+  {
+    poolKey = CDatabaseConnectionPool::GetKey(dbSettings.type, dbSettings.host, dbName);
+    m_pDB = CServiceBroker::GetDatabaseManager().GetConnectionPool().Checkout(poolKey);
+    if (m_pDB)
+    {
+      m_pDB->setProfiler(CServiceBroker::GetDatabaseManager().GetQueryProfiler());
+      m_pDS.reset(m_pDB->CreateDataset());
+      m_pDS2.reset(m_pDB->CreateDataset());
+      m_poolKey = std::move(poolKey);
+      m_openCount = 1;
+      return true;
+    }
+  }
+
+  if (Connect(dbName, dbSettings, false) != CDatabase::ConnectionState::STATE_CONNECTED)
+    return false;
+
+  m_poolKey = std::move(poolKey);
+  return true;
 }
 
 void CDatabase::InitSettings(DatabaseSettings& dbSettings)
@@ -609,6 +638,9 @@ CDatabase::ConnectionState CDatabase::Connect(const std::string& dbName,
     return ConnectionState::STATE_ERROR;
   }
 
+  if (CServiceBroker::IsServiceManagerUp())
+    m_pDB->setProfiler(CServiceBroker::GetDatabaseManager().GetQueryProfiler());
+
   // host name is always required
   m_pDB->setHostName(dbSettings.host.c_str());
 
@@ -712,10 +744,19 @@ void CDatabase::Close()
     return;
   if (nullptr != m_pDS)
     m_pDS->close();
-  m_pDB->disconnect();
-  m_pDB.reset();
   m_pDS.reset();
   m_pDS2.reset();
+
+  const std::string poolKey = std::move(m_poolKey);
+  m_poolKey.clear();
+  if (!poolKey.empty() && CServiceBroker::IsServiceManagerUp())
+  {
+    CServiceBroker::GetDatabaseManager().GetConnectionPool().Return(poolKey, std::move(m_pDB));
+    return;
+  }
+
+  m_pDB->disconnect();
+  m_pDB.reset();
 }
 
 bool CDatabase::Compress(bool bForce /* =true */)
@@ -802,6 +843,59 @@ void CDatabase::RollbackTransaction()
   }
 }
 
+bool CDatabase::SetSavepoint(const std::string& name)
+{
+  try
+  {
+    if (nullptr != m_pDB && nullptr != m_pDS)
+    {
+      m_pDS->exec(PrepareSQL("SAVEPOINT %s", name.c_str()));
+      return true;
+    }
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed to set savepoint {}", name);
+  }
+  return false;
+}
+
+bool CDatabase::ReleaseSavepoint(const std::string& name)
+{
+  try
+  {
+    if (nullptr != m_pDB && nullptr != m_pDS)
+    {
+      m_pDS->exec(PrepareSQL("RELEASE SAVEPOINT %s", name.c_str()));
+      return true;
+    }
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed to release savepoint {}", name);
+  }
+  return false;
+}
+
+bool CDatabase::RollbackToSavepoint(const std::string& name)
+{
+  try
+  {
+    if (nullptr != m_pDB && nullptr != m_pDS)
+    {
+      // rolling back keeps the savepoint, it's released as well to be done with it
+      m_pDS->exec(PrepareSQL("ROLLBACK TO SAVEPOINT %s", name.c_str()));
+      m_pDS->exec(PrepareSQL("RELEASE SAVEPOINT %s", name.c_str()));
+      return true;
+    }
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed to roll back to savepoint {}", name);
+  }
+  return false;
+}
+
 bool CDatabase::InTransaction() const
 {
   try
@@ -864,6 +958,186 @@ bool CDatabase::BuildSQL(std::string_view strQuery, const Filter& filter, std::s
   return true;
 }
 
+void CDatabase::SetKeysetPage(const std::string& listing,
+                              const std::vector<std::string>& columns,
+                              bool descending,
+                              int start,
+                              int end,
+                              Filter& filter)
+{
+  filter.order = DatabaseUtils::BuildKeysetOrder(columns, descending);
+
+  m_keysetPage = {};
+  m_keysetPage.listing = std::string(m_pDB->getHostName()) + "/" + m_pDB->getDatabase() + ": " +
+                         listing + " ORDER BY " + filter.order;
+  m_keysetPage.columns = columns;
+  m_keysetPage.start = start;
+  m_keysetPage.end = end;
+  // a write between here and the query makes the page look older than it is, which is harmless
+  m_keysetPage.writes = m_pDB->write_count();
+
+  std::string condition;
+  if (start > 0 && m_sqlite)
+  {
+    std::unique_lock lock(m_keysetCursorsMutex);
+    // a page read before the last write may not end where the listing continues anymore
+    const auto cursor = std::ranges::find_if(m_keysetCursors, [this, start](const auto& entry)
+                                             {
+                                               return entry.end == start &&
+                                                      entry.writes == m_keysetPage.writes &&
+                                                      entry.listing == m_keysetPage.listing;
+                                             });
+    if (cursor != m_keysetCursors.end())
+      condition = DatabaseUtils::BuildKeysetCondition(columns, cursor->values, descending);
+  }
+
+  if (condition.empty())
+  {
+    filter.limit = DatabaseUtils::BuildLimitClauseOnly(end, start);
+    return;
+  }
+
+  CLog::LogFC(LOGDEBUG, LOGDATABASE, "continuing listing after row {}", start);
+  filter.AppendWhere(condition);
+  filter.limit = end > start ? std::to_string(end - start) : "";
+}
+
+void CDatabase::StoreKeysetPage(Dataset& ds)
+{
+  KeysetCursor page = std::move(m_keysetPage);
+  m_keysetPage = {};
+
+  const query_data& rows = ds.get_result_set().records;
+  if (page.listing.empty() || rows.empty() || !m_sqlite)
+    return;
+
+  const sql_record& row = *rows.back();
+  for (const auto& column : page.columns)
+  {
+    // the columns are qualified with their view, the fields of the result aren't
+    const size_t pos = column.rfind('.');
+    const int index =
+        ds.fieldIndex(pos == std::string::npos ? column.c_str() : column.c_str() + pos + 1);
+    if (index < 0 || static_cast<size_t>(index) >= row.size())
+      return;
+
+    const field_value& value = row[index];
+    if (value.get_isNull())
+      page.values.emplace_back("NULL");
+    else if (value.get_fType() == fType::ft_String ||
+             value.get_fType() == fType::ft_WideString)
+      page.values.emplace_back(PrepareSQL("'%s'", value.get_asString().c_str()));
+    else
+      page.values.emplace_back(value.get_asString());
+  }
+
+  page.end = page.start + static_cast<int>(rows.size());
+
+  std::unique_lock lock(m_keysetCursorsMutex);
+  // the page replaces the one it continues and any earlier read of itself
+  std::erase_if(m_keysetCursors,
+                [&page](const auto& entry)
+                {
+                  return (entry.end == page.start || entry.end == page.end) &&
+                         entry.listing == page.listing;
+                });
+  m_keysetCursors.insert(m_keysetCursors.begin(), std::move(page));
+  if (m_keysetCursors.size() > MAX_KEYSET_CURSORS)
+    m_keysetCursors.pop_back();
+}
+
+bool CDatabase::CreateSearchIndex(const std::string& index,
+                                  const std::string& table,
+                                  const std::string& key,
+                                  const std::vector<std::string>& columns,
+                                  const std::string& replaced /* = "" */)
+{
+  if (!m_sqlite || columns.empty() || nullptr == m_pDB || nullptr == m_pDS)
+    return false;
+
+  const std::string fields = StringUtils::Join(columns, ", ");
+  std::vector<std::string> newValues;
+  std::vector<std::string> oldValues;
+  for (const auto& column : columns)
+  {
+    newValues.emplace_back("new." + column);
+    oldValues.emplace_back("old." + column);
+  }
+
+  // external content index, the values are only stored in the table and the triggers keep the
+  // index in sync with them
+  const std::string remove =
+      StringUtils::Format("INSERT INTO {0}({0}, rowid, {1}) VALUES('delete', old.{2}, {3});", index,
+                          fields, key, StringUtils::Join(oldValues, ", "));
+  const std::string insert =
+      StringUtils::Format("INSERT INTO {}(rowid, {}) VALUES(new.{}, {});", index, fields, key,
+                          StringUtils::Join(newValues, ", "));
+
+  try
+  {
+    m_pDS->exec("DROP TABLE IF EXISTS " + index);
+    m_pDS->exec(StringUtils::Format("CREATE VIRTUAL TABLE {} USING fts5({}, content='{}', "
+                                    "content_rowid='{}', tokenize='trigram')",
+                                    index, fields, table, key));
+    m_pDS->exec(StringUtils::Format("INSERT INTO {0}({0}) VALUES('rebuild')", index));
+
+    m_pDS->exec(StringUtils::Format("CREATE TRIGGER {0}_insert AFTER INSERT ON {1} BEGIN {2} END",
+                                    index, table, insert));
+    m_pDS->exec(StringUtils::Format("CREATE TRIGGER {0}_delete AFTER DELETE ON {1} BEGIN {2} END",
+                                    index, table, remove));
+    m_pDS->exec(StringUtils::Format(
+        "CREATE TRIGGER {0}_update AFTER UPDATE OF {1} ON {2} BEGIN {3} {4} END", index, fields,
+        table, remove, insert));
+    if (!replaced.empty())
+    {
+      // rows removed by REPLACE don't fire the delete trigger unless recursive triggers are on
+      m_pDS->exec(StringUtils::Format(
+          "CREATE TRIGGER {0}_replace BEFORE INSERT ON {1} BEGIN "
+          "INSERT INTO {0}({0}, rowid, {2}) SELECT 'delete', {3}, {2} FROM {1} WHERE {4}; END",
+          index, table, fields, key, replaced));
+    }
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGWARNING, "unable to create search index {} on {}, searching without it", index,
+               table);
+    try
+    {
+      m_pDS->exec("DROP TABLE IF EXISTS " + index);
+    }
+    catch (...)
+    {
+    }
+    return false;
+  }
+
+  return true;
+}
+
+bool CDatabase::HasSearchIndex(const std::string& index) const
+{
+  if (!m_sqlite)
+    return false;
+
+  return !GetSingleValue(
+              PrepareSQL("SELECT name FROM sqlite_master WHERE type = 'table' AND name = '%s'",
+                         index.c_str()))
+              .empty();
+}
+
+std::string CDatabase::GetSearchCondition(const std::string& index,
+                                          const std::string& key,
+                                          const std::vector<std::string>& columns,
+                                          const std::string& term) const
+{
+  const std::string match = DatabaseUtils::BuildSearchMatch(term, columns);
+  if (match.empty() || !HasSearchIndex(index))
+    return "";
+
+  return PrepareSQL("%s IN (SELECT rowid FROM %s WHERE %s MATCH '%s')", key.c_str(), index.c_str(),
+                    index.c_str(), match.c_str());
+}
+
 bool CDatabase::BuildSQL(const std::string& strBaseDir,
                          const std::string& strQuery,
                          Filter& filter,
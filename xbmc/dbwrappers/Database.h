@@ -8,7 +8,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -109,6 +111,26 @@ public:
   virtual bool CommitTransaction();
   void RollbackTransaction();
   bool InTransaction() const;
+
+  /*!
+   * @brief Mark a point within the current transaction the changes can be rolled back to.
+   * Savepoints nest, a savepoint is done with once it has been released or rolled back to.
+   * @param name The name of the savepoint.
+   * @return True if the savepoint was set, false otherwise.
+   * @sa ReleaseSavepoint, RollbackToSavepoint
+   */
+  bool SetSavepoint(const std::string& name);
+
+  /*!
+   * @brief Keep the changes made since a savepoint as part of the transaction.
+   */
+  bool ReleaseSavepoint(const std::string& name);
+
+  /*!
+   * @brief Undo the changes made since a savepoint, the rest of the transaction is kept.
+   */
+  bool RollbackToSavepoint(const std::string& name);
+
   void CopyDB(const std::string& latestDb);
   void DropAnalytics();
 
@@ -307,6 +329,68 @@ protected:
 
   bool BuildSQL(std::string_view strQuery, const Filter& filter, std::string& strSQL) const;
 
+  /*!
+   * @brief Set order and limits of a page of a listing in a filter, using keyset pagination.
+   * If the page starts where the last page read of the same listing ended, the rows following the
+   * last row of that page are selected instead of reading and skipping all rows before the page.
+   * That page is forgotten as soon as anything is written to the database, and only SQLite
+   * databases keep pages, as other processes may write to a database on a server.
+   * @param listing The SQL of the listing without order and limits.
+   * @param columns The columns to order the listing by, see DatabaseUtils::GetKeysetColumns().
+   * @param descending Whether to order the listing descending.
+   * @param start The position of the first row of the page.
+   * @param end The position following the last row of the page, -1 for all remaining rows.
+   * @param filter The filter to set the order, condition and limit of the page in.
+   * @sa StoreKeysetPage
+   */
+  void SetKeysetPage(const std::string& listing,
+                     const std::vector<std::string>& columns,
+                     bool descending,
+                     int start,
+                     int end,
+                     Filter& filter);
+
+  /*!
+   * @brief Remember where the page set by SetKeysetPage() ended, after it has been read.
+   * @param ds The dataset the page has been read into.
+   */
+  void StoreKeysetPage(dbiplus::Dataset& ds);
+
+  /*!
+   * @brief Create a full-text search index over columns of a table and the triggers maintaining it.
+   * The index uses the trigram tokenizer, so it finds any part of the columns' values at least
+   * three characters long like a LIKE '%term%' condition does, and is only available with SQLite.
+   * An existing index of the same name is replaced and filled with the current rows of the table.
+   * @param index The name of the index.
+   * @param table The table to index.
+   * @param key The integer primary key of the table.
+   * @param columns The columns to index.
+   * @param replaced Condition matching the rows replaced by a REPLACE INTO the table, with the new
+   * row's values as new.column, if the table is written that way. Empty if it isn't.
+   * @return true if the index was created, false if it is not supported.
+   */
+  bool CreateSearchIndex(const std::string& index,
+                         const std::string& table,
+                         const std::string& key,
+                         const std::vector<std::string>& columns,
+                         const std::string& replaced = "");
+
+  bool HasSearchIndex(const std::string& index) const;
+
+  /*!
+   * @brief Get the condition restricting a search to the rows a search index finds the term in.
+   * The condition only narrows down the rows, the LIKE conditions of the search are still needed.
+   * @param index The name of the index created by CreateSearchIndex().
+   * @param key The key of the indexed table as used in the search's query.
+   * @param columns The indexed columns the term is searched in.
+   * @param term The search term.
+   * @return The condition, or an empty string if the index can't be used to search for the term.
+   */
+  std::string GetSearchCondition(const std::string& index,
+                                 const std::string& key,
+                                 const std::vector<std::string>& columns,
+                                 const std::string& term) const;
+
   bool m_sqlite{true}; ///< \brief whether we use sqlite (defaults to true)
 
   std::unique_ptr<dbiplus::Database> m_pDB;
@@ -328,4 +412,21 @@ private:
 
   bool m_multipleExecute{false};
   std::vector<std::string> m_multipleQueries;
+  std::string m_poolKey; //!< key of the connection in the pool it goes back to when closed
+
+  struct KeysetCursor
+  {
+    std::string listing; //!< SQL of the listing including its order
+    std::vector<std::string> columns;
+    int start{0};
+    int end{-1}; //!< position of the row following the page
+    std::vector<std::string> values; //!< the last row of the page as SQL literals
+    uint64_t writes{0}; //!< write count of the database when the page was read
+  };
+  KeysetCursor m_keysetPage; //!< page set by SetKeysetPage(), not read yet
+
+  // last pages read by any instance, most recent first, as clients like JSON-RPC use a new
+  // instance for every page
+  static std::mutex m_keysetCursorsMutex;
+  static std::vector<KeysetCursor> m_keysetCursors;
 };
@@ -0,0 +1,105 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DatabaseConnectionPool.h"
+
+#include "dataset.h"
+#include "utils/log.h"
+
+#include <mutex>
+#include <utility>
+
+CDatabaseConnectionPool::CDatabaseConnectionPool(size_t maxIdle /* = DEFAULT_MAX_IDLE */)
+  : m_maxIdle(maxIdle)
+{
+}
+
+CDatabaseConnectionPool::~CDatabaseConnectionPool() = default;
+
+std::unique_ptr<dbiplus::Database> CDatabaseConnectionPool::Checkout(const std::string& key)
+{
+  std::unique_lock lock(m_critSection);
+
+  auto it = m_idle.find(key);
+  if (it == m_idle.end() || it->second.empty())
+    return nullptr;
+
+  // the most recently used connection has the most useful cache
+  std::unique_ptr<dbiplus::Database> db = std::move(it->second.back());
+  it->second.pop_back();
+  return db;
+}
+
+void CDatabaseConnectionPool::Return(const std::string& key, std::unique_ptr<dbiplus::Database> db)
+{
+  if (!db)
+    return;
+
+  if (db->in_transaction())
+  {
+    // whoever opened the transaction is gone, so it can neither be committed nor reused
+    CLog::LogF(LOGWARNING, "closing connection to {} with an open transaction", key);
+    try
+    {
+      db->rollback_transaction();
+    }
+    catch (const dbiplus::DbErrors& error)
+    {
+      CLog::LogF(LOGERROR, "rollback failed: {}", error.getMsg());
+    }
+    return;
+  }
+
+  // temporary tables belong to the connection, the next user would find them in its way
+  try
+  {
+    if (db->drop_temp_objects() != dbiplus::DB_COMMAND_OK)
+    {
+      CLog::LogF(LOGWARNING, "closing connection to {}, its temporary tables can't be dropped",
+                 key);
+      return;
+    }
+  }
+  catch (const dbiplus::DbErrors& error)
+  {
+    CLog::LogF(LOGERROR, "dropping temporary tables failed: {}", error.getMsg());
+    return;
+  }
+
+  std::unique_lock lock(m_critSection);
+
+  auto& idle = m_idle[key];
+  if (idle.size() < m_maxIdle)
+    idle.emplace_back(std::move(db));
+  // else the connection is closed when db goes out of scope
+}
+
+void CDatabaseConnectionPool::Clear()
+{
+  decltype(m_idle) idle;
+  {
+    std::unique_lock lock(m_critSection);
+    idle.swap(m_idle);
+  }
+  // the connections are closed outside of the lock
+}
+
+size_t CDatabaseConnectionPool::GetIdleCount(const std::string& key) const
+{
+  std::unique_lock lock(m_critSection);
+
+  const auto it = m_idle.find(key);
+  return it != m_idle.end() ? it->second.size() : 0;
+}
+
+std::string CDatabaseConnectionPool::GetKey(const std::string& type,
+                                            const std::string& host,
+                                            const std::string& name)
+{
+  return type + "://" + host + "/" + name;
+}
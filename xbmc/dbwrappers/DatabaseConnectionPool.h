@@ -0,0 +1,79 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace dbiplus
+{
+class Database;
+} // namespace dbiplus
+
+/*!
+ \ingroup database
+ \brief Keeps connections to databases which are currently not used for reuse
+
+ Opening a connection means opening the database file, reading its schema and setting up the
+ connection, and every CDatabase instance used for a single listing or lookup used to do that
+ again. Closed CDatabase instances hand their connection to the pool instead, and the next
+ instance opening the same database takes it, including the statements it has compiled.
+
+ A connection is only ever used by the CDatabase instance which checked it out, so readers on
+ different threads use different connections and, with SQLite's write-ahead log, don't wait for
+ each other or for a writer.
+ */
+class CDatabaseConnectionPool
+{
+public:
+  static constexpr size_t DEFAULT_MAX_IDLE = 4;
+
+  explicit CDatabaseConnectionPool(size_t maxIdle = DEFAULT_MAX_IDLE);
+  ~CDatabaseConnectionPool();
+
+  CDatabaseConnectionPool(const CDatabaseConnectionPool&) = delete;
+  CDatabaseConnectionPool& operator=(const CDatabaseConnectionPool&) = delete;
+
+  /*!
+   \brief Take an idle connection to a database
+   \param key identifies the database, see GetKey()
+   \return the connection or nullptr if there's no idle one
+   */
+  std::unique_ptr<dbiplus::Database> Checkout(const std::string& key);
+
+  /*!
+   \brief Hand a connection which isn't used anymore back to the pool
+   \details The temporary tables, views and triggers of the connection are dropped. The
+   connection is closed if it's in a transaction, if they can't be dropped or if there are enough
+   idle connections to the database already.
+   \param key identifies the database, see GetKey()
+   \param db the connection
+   */
+  void Return(const std::string& key, std::unique_ptr<dbiplus::Database> db);
+
+  /*!
+   \brief Close all idle connections
+   */
+  void Clear();
+
+  size_t GetIdleCount(const std::string& key) const;
+
+  static std::string GetKey(const std::string& type,
+                            const std::string& host,
+                            const std::string& name);
+
+private:
+  const size_t m_maxIdle;
+  mutable CCriticalSection m_critSection;
+  std::map<std::string, std::vector<std::unique_ptr<dbiplus::Database>>, std::less<>> m_idle;
+};
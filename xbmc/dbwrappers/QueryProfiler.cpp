@@ -0,0 +1,257 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "QueryProfiler.h"
+
+#include "ServiceBroker.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <bit>
+#include <mutex>
+
+namespace
+{
+constexpr std::chrono::minutes LOG_INTERVAL{5};
+constexpr size_t LOG_LIMIT = 20;
+constexpr size_t MAX_STATEMENT_LENGTH = 4096;
+constexpr const char* OTHER_STATEMENTS = "(other statements)";
+
+bool IsIdentifierChar(char c)
+{
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+bool IsDigit(char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+bool IsSpace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// appends a placeholder, unless it continues a list of them
+void AddPlaceholder(std::string& normalized)
+{
+  size_t end = normalized.size();
+  while (end > 0 && normalized[end - 1] == ' ')
+    --end;
+  if (end > 0 && normalized[end - 1] == ',')
+  {
+    size_t previous = end - 1;
+    while (previous > 0 && normalized[previous - 1] == ' ')
+      --previous;
+    if (previous > 0 && normalized[previous - 1] == '?')
+    {
+      normalized.resize(previous);
+      return;
+    }
+  }
+  normalized += '?';
+}
+} // unnamed namespace
+
+bool CQueryProfiler::IsEnabled() const
+{
+  return m_enabled || CServiceBroker::GetLogging().CanLogComponent(LOGDATABASE);
+}
+
+void CQueryProfiler::Record(const std::string& database,
+                            std::string_view sql,
+                            std::chrono::steady_clock::duration duration,
+                            int rows)
+{
+  const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(duration);
+  std::string statement = Normalize(sql);
+
+  bool slow = false;
+  bool log = false;
+  {
+    std::unique_lock lock(m_critSection);
+
+    auto it = m_entries.find(std::make_pair(database, statement));
+    if (it == m_entries.end())
+    {
+      // statements built with their values inlined in ways Normalize() doesn't catch mustn't
+      // grow the statistics without bounds
+      if (m_entries.size() >= MAX_STATEMENTS)
+        statement = OTHER_STATEMENTS;
+      it = m_entries.try_emplace(std::make_pair(database, std::move(statement))).first;
+    }
+
+    Entry& entry = it->second;
+    entry.count++;
+    entry.rows += static_cast<uint64_t>(std::max(rows, 0));
+    entry.total += micros;
+    entry.max = std::max(entry.max, micros);
+    const auto bucket =
+        std::bit_width(static_cast<uint64_t>(std::max<int64_t>(micros.count(), 0)));
+    entry.histogram[std::min<size_t>(bucket, BUCKETS - 1)]++;
+
+    if (m_slowQueryTime.count() > 0 && micros >= m_slowQueryTime)
+    {
+      slow = true;
+      if (m_slowQueries.size() >= MAX_SLOW_QUERIES)
+        m_slowQueries.pop_front();
+      // the literal values may be personal data, like paths or titles
+      m_slowQueries.emplace_back(
+          SlowQuery{std::chrono::system_clock::now(), database, Normalize(sql), micros, rows});
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (now - m_lastLogged >= LOG_INTERVAL &&
+        CServiceBroker::GetLogging().CanLogComponent(LOGDATABASE))
+    {
+      m_lastLogged = now;
+      log = true;
+    }
+  }
+
+  if (slow)
+    CLog::LogFC(LOGDEBUG, LOGDATABASE, "Slow query on {} took {} ms: {}", database,
+                micros.count() / 1000, sql);
+
+  if (log)
+    LogStatistics(LOG_LIMIT);
+}
+
+std::vector<CQueryProfiler::Statistics> CQueryProfiler::GetStatistics(size_t limit /* = 0 */) const
+{
+  std::vector<Statistics> statistics;
+  {
+    std::unique_lock lock(m_critSection);
+
+    statistics.reserve(m_entries.size());
+    for (const auto& [key, entry] : m_entries)
+    {
+      Statistics& statement = statistics.emplace_back();
+      statement.database = key.first;
+      statement.statement = key.second;
+      statement.count = entry.count;
+      statement.rows = entry.rows;
+      statement.total = entry.total;
+      statement.max = entry.max;
+      statement.median = GetPercentile(entry, 0.5);
+      statement.p95 = GetPercentile(entry, 0.95);
+      statement.p99 = GetPercentile(entry, 0.99);
+    }
+  }
+
+  std::sort(statistics.begin(), statistics.end(),
+            [](const Statistics& a, const Statistics& b) { return a.total > b.total; });
+  if (limit > 0 && statistics.size() > limit)
+    statistics.resize(limit);
+
+  return statistics;
+}
+
+std::vector<CQueryProfiler::SlowQuery> CQueryProfiler::GetSlowQueries() const
+{
+  std::unique_lock lock(m_critSection);
+  return {m_slowQueries.begin(), m_slowQueries.end()};
+}
+
+void CQueryProfiler::Reset()
+{
+  std::unique_lock lock(m_critSection);
+  m_entries.clear();
+  m_slowQueries.clear();
+}
+
+void CQueryProfiler::LogStatistics(size_t limit) const
+{
+  const auto statistics = GetStatistics(limit);
+
+  CLog::LogFC(LOGDEBUG, LOGDATABASE, "{} statements taking the longest in total:",
+              statistics.size());
+  for (const auto& statement : statistics)
+  {
+    CLog::LogFC(LOGDEBUG, LOGDATABASE,
+                "{}: {} ms in {} runs ({} rows), median {} us, 95% {} us, max {} us: {}",
+                statement.database, statement.total.count() / 1000, statement.count,
+                statement.rows, statement.median.count(), statement.p95.count(),
+                statement.max.count(), statement.statement);
+  }
+}
+
+std::string CQueryProfiler::Normalize(std::string_view sql)
+{
+  std::string normalized;
+  normalized.reserve(std::min(sql.size(), MAX_STATEMENT_LENGTH));
+
+  for (size_t i = 0; i < sql.size() && normalized.size() < MAX_STATEMENT_LENGTH;)
+  {
+    const char c = sql[i];
+    if (IsSpace(c))
+    {
+      while (i < sql.size() && IsSpace(sql[i]))
+        ++i;
+      if (!normalized.empty())
+        normalized += ' ';
+    }
+    else if (c == '\'')
+    {
+      // string literal, quotes are escaped by doubling them
+      for (++i; i < sql.size(); ++i)
+      {
+        if (sql[i] == '\'')
+        {
+          if (i + 1 < sql.size() && sql[i + 1] == '\'')
+            ++i;
+          else
+            break;
+        }
+      }
+      ++i;
+      AddPlaceholder(normalized);
+    }
+    else if ((IsDigit(c) || c == '?') &&
+             (normalized.empty() || !IsIdentifierChar(normalized.back())))
+    {
+      // numeric literal, or an existing placeholder
+      while (i < sql.size() && (IsDigit(sql[i]) || sql[i] == '.' || sql[i] == '?'))
+        ++i;
+      AddPlaceholder(normalized);
+    }
+    else if (IsIdentifierChar(c))
+    {
+      // copied as a whole so digits in names aren't mistaken for values
+      while (i < sql.size() && IsIdentifierChar(sql[i]))
+        normalized += sql[i++];
+    }
+    else
+    {
+      normalized += c;
+      ++i;
+    }
+  }
+
+  while (!normalized.empty() && normalized.back() == ' ')
+    normalized.pop_back();
+
+  return normalized;
+}
+
+std::chrono::microseconds CQueryProfiler::GetPercentile(const Entry& entry, double percentile)
+{
+  const auto rank = static_cast<uint64_t>(static_cast<double>(entry.count) * percentile);
+  uint64_t seen = 0;
+  for (size_t bucket = 0; bucket < BUCKETS; ++bucket)
+  {
+    seen += entry.histogram[bucket];
+    if (seen > rank || seen == entry.count)
+    {
+      // the upper bound of the bucket, which the slowest statement might not even reach
+      const std::chrono::microseconds bound{bucket == 0 ? 0 : (int64_t{1} << bucket) - 1};
+      return std::min(bound, entry.max);
+    }
+  }
+  return entry.max;
+}
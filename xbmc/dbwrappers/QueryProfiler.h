@@ -0,0 +1,142 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <stdint.h>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/*!
+ \ingroup database
+ \brief Collects how often and how long the statements run on the databases take
+
+ Statements are aggregated by their normalized text, with literal values replaced by
+ placeholders, so the same query for different items counts as one. Statements taking longer
+ than the slow query time are kept in a log of their own, normalized as well.
+
+ Statements are only recorded while the profiler is enabled, either by the queryprofiling
+ advanced setting or by enabling the database log component.
+
+ The statistics are available through JSON-RPC (XBMC.GetQueryStatistics), and are written to the
+ debug log every few minutes while the database log component is enabled.
+ */
+class CQueryProfiler
+{
+public:
+  struct Statistics
+  {
+    std::string database;
+    std::string statement; //!< normalized
+    uint64_t count = 0;
+    uint64_t rows = 0; //!< returned by queries in total
+    std::chrono::microseconds total{0};
+    std::chrono::microseconds max{0};
+    std::chrono::microseconds median{0};
+    std::chrono::microseconds p95{0};
+    std::chrono::microseconds p99{0};
+  };
+
+  struct SlowQuery
+  {
+    std::chrono::system_clock::time_point time;
+    std::string database;
+    std::string statement; //!< normalized
+    std::chrono::microseconds duration{0};
+    int rows = 0;
+  };
+
+  static constexpr size_t MAX_STATEMENTS = 500;
+  static constexpr size_t MAX_SLOW_QUERIES = 50;
+
+  CQueryProfiler() = default;
+  CQueryProfiler(const CQueryProfiler&) = delete;
+  CQueryProfiler& operator=(const CQueryProfiler&) = delete;
+
+  /*!
+   \brief Record statements even while the database log component is disabled
+   */
+  void SetEnabled(bool enabled) { m_enabled = enabled; }
+
+  /*!
+   \brief Whether statements which have been run should be recorded
+   \return true if enabled by SetEnabled() or the database log component
+   */
+  bool IsEnabled() const;
+
+  /*!
+   \brief Statements taking at least this long are logged, 0 to log none
+   */
+  void SetSlowQueryTime(std::chrono::milliseconds time) { m_slowQueryTime = time; }
+
+  /*!
+   \brief Add a statement which has been run
+   \param database the name of the database
+   \param sql the statement
+   \param duration how long it took
+   \param rows the number of rows returned, 0 for statements which don't return any
+   */
+  void Record(const std::string& database,
+              std::string_view sql,
+              std::chrono::steady_clock::duration duration,
+              int rows);
+
+  /*!
+   \brief Get the statistics of the statements, the ones taking the longest in total first
+   \param limit the maximum number of statements, 0 for all
+   */
+  std::vector<Statistics> GetStatistics(size_t limit = 0) const;
+
+  /*!
+   \brief Get the most recent slow statements, oldest first
+   */
+  std::vector<SlowQuery> GetSlowQueries() const;
+
+  void Reset();
+
+  /*!
+   \brief Write the statements taking the longest in total to the database log component
+   */
+  void LogStatistics(size_t limit) const;
+
+  /*!
+   \brief Replace literal values in a statement with placeholders and collapse whitespace
+   \details Lists of values, like the ones of IN (...), become a single placeholder.
+   */
+  static std::string Normalize(std::string_view sql);
+
+private:
+  static constexpr size_t BUCKETS = 32; //!< durations in powers of two microseconds
+
+  struct Entry
+  {
+    uint64_t count = 0;
+    uint64_t rows = 0;
+    std::chrono::microseconds total{0};
+    std::chrono::microseconds max{0};
+    std::array<uint64_t, BUCKETS> histogram{};
+  };
+
+  static std::chrono::microseconds GetPercentile(const Entry& entry, double percentile);
+
+  mutable CCriticalSection m_critSection;
+  std::atomic<bool> m_enabled{false};
+  std::chrono::milliseconds m_slowQueryTime{0};
+  std::map<std::pair<std::string, std::string>, Entry> m_entries;
+  std::deque<SlowQuery> m_slowQueries;
+  std::chrono::steady_clock::time_point m_lastLogged{std::chrono::steady_clock::now()};
+};
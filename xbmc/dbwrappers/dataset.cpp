@@ -12,6 +12,7 @@
 
 #include "dataset.h"
 
+#include "QueryProfiler.h"
 #include "utils/StringUtils.h"
 #include "utils/log.h"
 
@@ -73,6 +74,49 @@ std::string Database::prepare(const char* format, ...)
   return result;
 }
 
+std::string Database::inline_args(std::string_view sql, const BindList& args)
+{
+  std::string result;
+  result.reserve(sql.size());
+
+  size_t arg = 0;
+  char quote = 0;
+  for (const char c : sql)
+  {
+    if (quote)
+    {
+      if (c == quote)
+        quote = 0;
+    }
+    else if (c == '\'' || c == '"')
+      quote = c;
+    else if (c == '?' && arg < args.size())
+    {
+      const field_value& value = args[arg++];
+      if (value.get_isNull())
+        result += "NULL";
+      else if (value.get_fType() == fType::ft_String)
+        result += prepare("'%s'", value.get_asString().c_str());
+      else if (value.get_fType() == fType::ft_Double || value.get_fType() == fType::ft_Float)
+        result += StringUtils::Format("{}", value.get_asDouble());
+      else
+        result += std::to_string(value.get_asInt64());
+      continue;
+    }
+    result += c;
+  }
+
+  return result;
+}
+
+void Database::profile(std::string_view sql,
+                       std::chrono::steady_clock::duration duration,
+                       int rows)
+{
+  if (profiler && profiler->IsEnabled())
+    profiler->Record(db, sql, duration, rows);
+}
+
 //************* Dataset implementation ***************
 
 Dataset::Dataset() = default;
@@ -14,12 +14,21 @@
 
 #include "qry_dat.h"
 
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <list>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
+#include <vector>
+
+class CQueryProfiler;
 
 namespace dbiplus
 {
@@ -41,6 +50,65 @@ constexpr int DB_BAD_RESPONSE = 6;
 constexpr int DB_UNEXPECTED = 7; // This shouldn't ever happen
 constexpr int DB_UNEXPECTED_RESULT = -1; //For integer functions
 
+/* values bound to the ? placeholders of a parameterized statement, in order */
+using BindList = std::vector<field_value>;
+
+constexpr size_t STATEMENT_CACHE_SIZE = 64; // compiled statements kept per connection
+
+/* conversion of the arguments of make_bind_list() */
+inline field_value to_bind_value(const field_value& value)
+{
+  return value;
+}
+inline field_value to_bind_value(const char* value)
+{
+  return field_value(value);
+}
+inline field_value to_bind_value(std::string_view value)
+{
+  return field_value(value.data(), value.size());
+}
+inline field_value to_bind_value(const std::string& value)
+{
+  return field_value(value.c_str(), value.size());
+}
+inline field_value to_bind_value(std::nullptr_t)
+{
+  field_value value;
+  value.set_isNull();
+  return value;
+}
+template<std::integral T>
+field_value to_bind_value(T value)
+{
+  if constexpr (std::same_as<T, bool> || std::same_as<T, int> || sizeof(T) < sizeof(int))
+    return field_value(static_cast<int>(value));
+  else
+    return field_value(static_cast<int64_t>(value));
+}
+template<std::floating_point T>
+field_value to_bind_value(T value)
+{
+  return field_value(static_cast<double>(value));
+}
+template<typename T>
+field_value to_bind_value(const std::optional<T>& value)
+{
+  return value ? to_bind_value(*value) : to_bind_value(nullptr);
+}
+
+/*! \brief Build the values for the ? placeholders of a parameterized statement.
+ Strings and numbers are bound as they are, nullptr and empty optionals as NULL.
+ */
+template<typename... Args>
+BindList make_bind_list(const Args&... args)
+{
+  BindList list;
+  list.reserve(sizeof...(args));
+  (list.emplace_back(to_bind_value(args)), ...);
+  return list;
+}
+
 /******************* Class Database definition ********************
 
    represents  connection with database server;
@@ -64,6 +132,7 @@ protected:
   std::string capath;
   std::string ciphers; // SSL - Encryption info
   unsigned int connect_timeout; // seconds
+  std::shared_ptr<CQueryProfiler> profiler; // Records the statements run, if set
 
 public:
   /* constructor */
@@ -147,6 +216,13 @@ public:
   /* \brief drop all extra analytics from database */
   virtual int drop_analytics() { return -1; }
 
+  /* \brief drop the temporary tables, views and triggers of the connection */
+  virtual int drop_temp_objects() { return DB_COMMAND_OK; }
+
+  /* \brief number of times rows of the database have been changed by this process, as far as
+  other connections can see them. 0 if it isn't known */
+  virtual uint64_t write_count() { return 0; }
+
   virtual bool exists() { return false; }
 
   /* virtual methods for transaction */
@@ -171,7 +247,27 @@ public:
    */
   virtual std::string vprepare(std::string_view format, va_list args) = 0;
 
+  /*! \brief Get a parameterized statement with its values inlined, e.g. for logging.
+   \param sql - statement with ? placeholders
+   \param args - values for the placeholders, in order
+   \return statement as it would be written without placeholders.
+   */
+  std::string inline_args(std::string_view sql, const BindList& args);
+
   virtual bool in_transaction() { return false; }
+
+  /* sets the profiler the statements run on this connection are recorded in */
+  void setProfiler(std::shared_ptr<CQueryProfiler> newProfiler)
+  {
+    profiler = std::move(newProfiler);
+  }
+
+  /*! \brief Record a statement which has been run in the profiler, if there is one enabled.
+   \param sql - statement as run
+   \param duration - time it took, including fetching its rows
+   \param rows - number of rows it returned
+   */
+  void profile(std::string_view sql, std::chrono::steady_clock::duration duration, int rows);
 };
 
 /******************* Class Dataset definition *********************
@@ -201,7 +297,6 @@ enum class sqlType
 
 using StringList = std::list<std::string>;
 using ParamList = std::map<std::string, field_value, std::less<>>;
-
 class Dataset
 {
 protected:
@@ -309,6 +404,20 @@ public:
   virtual const void* getExecRes() = 0;
   /* as open, but with our query exec Sql */
   virtual bool query(const std::string& sql) = 0;
+
+  /*! \brief Execute a parameterized statement without results to return.
+   The statement is compiled once per connection and kept in its statement cache, so repeated
+   executions with different values don't parse the SQL again.
+   \param sql - statement with ? placeholders, must not contain any values itself
+   \param args - values bound to the placeholders, in order
+   */
+  virtual int exec(const std::string& sql, const BindList& args) = 0;
+  /*! \brief Query using a parameterized statement, see exec(sql, args).
+   \param sql - SELECT statement with ? placeholders, must not contain any values itself
+   \param args - values bound to the placeholders, in order
+   */
+  virtual bool query(const std::string& sql, const BindList& args) = 0;
+
   /* Close SQL Query*/
   virtual void close();
   /* Refresh dataset (reopen it and set the same cursor position) */
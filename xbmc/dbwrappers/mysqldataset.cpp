@@ -21,8 +21,10 @@
 #include <charconv>
 #include <chrono>
 #include <cstdlib>
+#include <memory>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 #ifdef HAS_MYSQL
@@ -95,6 +97,53 @@ bool IsValidIdentifier(std::string_view id)
   return std::ranges::all_of(id, [](char c)
                              { return StringUtils::isasciialphanum(c) || c == '_' || c == '$'; });
 }
+/*!
+ * \brief Convert a column of a result row as sent by the server
+ * \param v Value to set
+ * \param field Column of the value
+ * \param value Null terminated value in text form, nullptr if NULL
+ * \param length Length of value
+ */
+void set_field(dbiplus::field_value& v,
+               const MYSQL_FIELD& field,
+               const char* value,
+               unsigned long length)
+{
+  switch (field.type)
+  {
+    case MYSQL_TYPE_LONGLONG:
+      v.set_asInt64(value ? strtoll(value, nullptr, 10) : 0);
+      break;
+    case MYSQL_TYPE_DECIMAL:
+    case MYSQL_TYPE_NEWDECIMAL:
+    case MYSQL_TYPE_TINY:
+    case MYSQL_TYPE_SHORT:
+    case MYSQL_TYPE_INT24:
+    case MYSQL_TYPE_LONG:
+      v.set_asInt(value ? atoi(value) : 0);
+      break;
+    case MYSQL_TYPE_FLOAT:
+    case MYSQL_TYPE_DOUBLE:
+      v.set_asDouble(value ? atof(value) : 0);
+      break;
+    case MYSQL_TYPE_STRING:
+    case MYSQL_TYPE_VAR_STRING:
+    case MYSQL_TYPE_VARCHAR:
+    case MYSQL_TYPE_TINY_BLOB:
+    case MYSQL_TYPE_MEDIUM_BLOB:
+    case MYSQL_TYPE_LONG_BLOB:
+    case MYSQL_TYPE_BLOB:
+      if (value)
+        v.set_asString(value, length);
+      break;
+    case MYSQL_TYPE_NULL:
+    default:
+      CLog::Log(LOGDEBUG, "MYSQL: Unknown field type: {}", field.type);
+      v.set_asString("", 0);
+      v.set_isNull();
+      break;
+  }
+}
 } // unnamed namespace
 
 namespace dbiplus
@@ -354,6 +403,8 @@ void MysqlDatabase::disconnect()
 {
   if (conn)
   {
+    // prepared statements belong to the connection
+    statements.clear();
     mysql_close(conn);
     conn = nullptr;
   }
@@ -611,6 +662,78 @@ int MysqlDatabase::query_with_reconnect(const char* query)
   return result;
 }
 
+void MysqlStatementFinalizer::operator()(MYSQL_STMT* stmt) const
+{
+  mysql_stmt_close(stmt);
+}
+
+MYSQL_STMT* MysqlDatabase::getStatement(const std::string& sql, int& err)
+{
+  if (!active || !conn)
+    throw DbErrors("No Database Connection");
+
+  MYSQL_STMT* stmt = statements.find(sql);
+  if (stmt)
+    return stmt;
+
+  stmt = mysql_stmt_init(conn);
+  if (!stmt)
+  {
+    err = mysql_errno(conn);
+    throw DbErrors("Can't create statement (%d): %s", err, sql.c_str());
+  }
+
+  if (mysql_stmt_prepare(stmt, sql.c_str(), sql.size()) != MYSQL_OK)
+  {
+    // the error is gone once the statement has been closed
+    err = mysql_stmt_errno(stmt);
+    const std::string message = mysql_stmt_error(stmt);
+    mysql_stmt_close(stmt);
+    if (err == CR_SERVER_GONE_ERROR || err == CR_SERVER_LOST)
+      return nullptr;
+
+    setErr(err, sql.c_str());
+    throw DbErrors("Can't prepare statement: %s (%s)", getErrorMsg(), message.c_str());
+  }
+
+  statements.insert(sql, stmt);
+  return stmt;
+}
+
+int MysqlDatabase::execute_with_reconnect(const std::string& sql,
+                                          MYSQL_BIND* params,
+                                          unsigned long count,
+                                          MYSQL_STMT*& stmt)
+{
+  int attempts = 5;
+  int result;
+
+  // try to reconnect if server is gone, the statements have to be prepared again afterwards
+  while (true)
+  {
+    stmt = getStatement(sql, result);
+    if (stmt)
+    {
+      if (mysql_stmt_param_count(stmt) != count)
+        throw DbErrors("%lu values bound to statement with %lu parameters: %s", count,
+                       mysql_stmt_param_count(stmt), sql.c_str());
+
+      if (mysql_stmt_bind_param(stmt, params) == MYSQL_OK && mysql_stmt_execute(stmt) == MYSQL_OK)
+        return MYSQL_OK;
+
+      result = mysql_stmt_errno(stmt);
+    }
+
+    if ((result != CR_SERVER_GONE_ERROR && result != CR_SERVER_LOST) || attempts-- <= 0)
+      return result != MYSQL_OK ? result : CR_UNKNOWN_ERROR;
+
+    CLog::Log(LOGINFO, "MYSQL server has gone. Will try {} more attempt(s) to reconnect.",
+              attempts);
+    active = false;
+    connect(true);
+  }
+}
+
 long MysqlDatabase::nextid(const char* sname)
 {
   CLog::LogFC(LOGDEBUG, LOGDATABASE, "nextid for {}", sname);
@@ -1945,6 +2068,7 @@ int MysqlDataset::exec(const std::string& sql)
   const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
 
   CLog::LogFC(LOGDEBUG, LOGDATABASE, "{} ms for query: {}", duration.count(), qry);
+  db->profile(qry, end - start, 0);
 
   if (res != MYSQL_OK)
   {
@@ -1986,6 +2110,8 @@ bool MysqlDataset::query(const std::string& query)
 
   MYSQL_RES* stmt = nullptr;
 
+  const auto start = std::chrono::steady_clock::now();
+
   if (static_cast<MysqlDatabase*>(db)->setErr(
           static_cast<MysqlDatabase*>(db)->query_with_reconnect(qry.c_str()), qry.c_str()) !=
       MYSQL_OK)
@@ -2007,73 +2133,168 @@ bool MysqlDataset::query(const std::string& query)
   // returned rows
   while ((row = mysql_fetch_row(stmt)))
   { // have a row of data
+    const unsigned long* lengths = mysql_fetch_lengths(stmt);
     auto* res = new sql_record;
     res->resize(numColumns);
     for (unsigned int i = 0; i < numColumns; i++)
+      set_field(res->at(i), fields[i], row[i], lengths[i]);
+    result.records.push_back(res);
+  }
+  mysql_free_result(stmt);
+  db->profile(qry, std::chrono::steady_clock::now() - start,
+              static_cast<int>(result.records.size()));
+  active = true;
+  ds_state = dsSelect;
+  this->first();
+  return true;
+}
+
+void MysqlDataset::execute_statement(const std::string& sql, const BindList& args, bool fetch)
+{
+  if (!handle())
+    throw DbErrors("No Database Connection");
+
+  // the bound values have to stay alive until the statement has been executed
+  std::vector<MYSQL_BIND> params(args.size());
+  std::vector<std::string> strings(args.size());
+  std::vector<long long> integers(args.size());
+  std::vector<double> doubles(args.size());
+  for (size_t i = 0; i < args.size(); i++)
+  {
+    const field_value& value = args[i];
+    MYSQL_BIND& param = params[i];
+    if (value.get_isNull())
+      param.buffer_type = MYSQL_TYPE_NULL;
+    else if (value.get_fType() == fType::ft_String)
     {
-      field_value& v = res->at(i);
-      switch (fields[i].type)
+      strings[i] = value.get_asString();
+      param.buffer_type = MYSQL_TYPE_STRING;
+      param.buffer = strings[i].data();
+      param.buffer_length = strings[i].size();
+    }
+    else if (value.get_fType() == fType::ft_Float || value.get_fType() == fType::ft_Double)
+    {
+      doubles[i] = value.get_asDouble();
+      param.buffer_type = MYSQL_TYPE_DOUBLE;
+      param.buffer = &doubles[i];
+    }
+    else
+    {
+      integers[i] = value.get_asInt64();
+      param.buffer_type = MYSQL_TYPE_LONGLONG;
+      param.buffer = &integers[i];
+    }
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+
+  auto* mysqlDb = static_cast<MysqlDatabase*>(db);
+  MYSQL_STMT* stmt = nullptr;
+  if (mysqlDb->setErr(mysqlDb->execute_with_reconnect(sql, params.data(), params.size(), stmt),
+                      sql.c_str()) != MYSQL_OK)
+  {
+    if (stmt)
+      mysql_stmt_free_result(stmt);
+    throw DbErrors("%s", db->getErrorMsg());
+  }
+
+  MYSQL_RES* meta = mysql_stmt_result_metadata(stmt);
+  if (fetch && meta)
+  {
+    const unsigned int numColumns = mysql_num_fields(meta);
+    MYSQL_FIELD* fields = mysql_fetch_fields(meta);
+    result.record_header.resize(numColumns);
+    for (unsigned int i = 0; i < numColumns; i++)
+      result.record_header[i].name = fields[i].name;
+
+    // all columns are fetched in text form like the ones of query(), values which don't fit
+    // into their buffer are fetched again once their length is known
+    using IsNull = std::remove_pointer_t<decltype(MYSQL_BIND::is_null)>;
+    std::vector<MYSQL_BIND> columns(numColumns);
+    std::vector<std::string> buffers(numColumns, std::string(256, '\0'));
+    std::vector<unsigned long> lengths(numColumns);
+    auto nulls = std::make_unique<IsNull[]>(numColumns);
+    for (unsigned int i = 0; i < numColumns; i++)
+    {
+      columns[i].buffer_type = MYSQL_TYPE_STRING;
+      columns[i].buffer = buffers[i].data();
+      columns[i].buffer_length = buffers[i].size() - 1;
+      columns[i].length = &lengths[i];
+      columns[i].is_null = &nulls[i];
+    }
+
+    if (mysql_stmt_bind_result(stmt, columns.data()) != MYSQL_OK ||
+        mysql_stmt_store_result(stmt) != MYSQL_OK)
+    {
+      db->setErr(mysql_stmt_errno(stmt), sql.c_str());
+      mysql_free_result(meta);
+      mysql_stmt_free_result(stmt);
+      throw DbErrors("%s", db->getErrorMsg());
+    }
+
+    int rc;
+    while ((rc = mysql_stmt_fetch(stmt)) == MYSQL_OK || rc == MYSQL_DATA_TRUNCATED)
+    {
+      bool rebind = false;
+      auto* res = new sql_record;
+      res->resize(numColumns);
+      for (unsigned int i = 0; i < numColumns; i++)
       {
-        case MYSQL_TYPE_LONGLONG:
-          if (row[i])
-          {
-            v.set_asInt64(strtoll(row[i], nullptr, 10));
-          }
-          else
-          {
-            v.set_asInt64(0);
-          }
-          break;
-        case MYSQL_TYPE_DECIMAL:
-        case MYSQL_TYPE_NEWDECIMAL:
-        case MYSQL_TYPE_TINY:
-        case MYSQL_TYPE_SHORT:
-        case MYSQL_TYPE_INT24:
-        case MYSQL_TYPE_LONG:
-          if (row[i])
-          {
-            v.set_asInt(atoi(row[i]));
-          }
-          else
-          {
-            v.set_asInt(0);
-          }
-          break;
-        case MYSQL_TYPE_FLOAT:
-        case MYSQL_TYPE_DOUBLE:
-          if (row[i])
-          {
-            v.set_asDouble(atof(row[i]));
-          }
-          else
-          {
-            v.set_asDouble(0);
-          }
-          break;
-        case MYSQL_TYPE_STRING:
-        case MYSQL_TYPE_VAR_STRING:
-        case MYSQL_TYPE_VARCHAR:
-          if (row[i])
-            v.set_asString((const char*)row[i]);
-          break;
-        case MYSQL_TYPE_TINY_BLOB:
-        case MYSQL_TYPE_MEDIUM_BLOB:
-        case MYSQL_TYPE_LONG_BLOB:
-        case MYSQL_TYPE_BLOB:
-          if (row[i])
-            v.set_asString((const char*)row[i]);
-          break;
-        case MYSQL_TYPE_NULL:
-        default:
-          CLog::Log(LOGDEBUG, "MYSQL: Unknown field type: {}", fields[i].type);
-          v.set_asString("", 0);
-          v.set_isNull();
-          break;
+        if (nulls[i])
+        {
+          set_field(res->at(i), fields[i], nullptr, 0);
+          continue;
+        }
+
+        if (lengths[i] > columns[i].buffer_length)
+        {
+          buffers[i].resize(lengths[i] + 1);
+          columns[i].buffer = buffers[i].data();
+          columns[i].buffer_length = lengths[i];
+          mysql_stmt_fetch_column(stmt, &columns[i], i, 0);
+          rebind = true;
+        }
+        buffers[i][lengths[i]] = '\0';
+        set_field(res->at(i), fields[i], buffers[i].c_str(), lengths[i]);
       }
+      result.records.push_back(res);
+
+      if (rebind)
+        mysql_stmt_bind_result(stmt, columns.data());
+    }
+
+    if (rc != MYSQL_NO_DATA)
+    {
+      db->setErr(mysql_stmt_errno(stmt), sql.c_str());
+      mysql_free_result(meta);
+      mysql_stmt_free_result(stmt);
+      throw DbErrors("%s", db->getErrorMsg());
     }
-    result.records.push_back(res);
   }
-  mysql_free_result(stmt);
+
+  if (meta)
+    mysql_free_result(meta);
+  mysql_stmt_free_result(stmt);
+
+  const auto end = std::chrono::steady_clock::now();
+  const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+  CLog::LogFC(LOGDEBUG, LOGDATABASE, "{} ms for statement: {}", duration.count(), sql);
+  db->profile(sql, end - start, fetch ? static_cast<int>(result.records.size()) : 0);
+}
+
+int MysqlDataset::exec(const std::string& sql, const BindList& args)
+{
+  exec_res.clear();
+  execute_statement(sql, args, false);
+  return MYSQL_OK;
+}
+
+bool MysqlDataset::query(const std::string& sql, const BindList& args)
+{
+  close();
+  execute_statement(sql, args, true);
+
   active = true;
   ds_state = dsSelect;
   this->first();
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "dataset.h"
+#include "statementcache.h"
 
 #include <string>
 
@@ -25,12 +26,19 @@ namespace dbiplus
        class 'MysqlDatabase' connects with MySQL-server
 
 ******************************************************************/
+struct MysqlStatementFinalizer
+{
+  void operator()(MYSQL_STMT* stmt) const;
+};
+
 class MysqlDatabase : public Database
 {
 protected:
   /* connect descriptor */
   MYSQL* conn{nullptr};
   bool _in_transaction{false};
+  /* server-side prepared statements of the connection */
+  StatementCache<MYSQL_STMT, MysqlStatementFinalizer> statements{STATEMENT_CACHE_SIZE};
 
 public:
   /* default constructor */
@@ -78,6 +86,14 @@ public:
 
   bool in_transaction() override { return _in_transaction; }
   int query_with_reconnect(const char* query);
+  /* func. returns the prepared statement for sql, nullptr with err set if the connection was lost
+     while preparing it, throws DbErrors on other errors */
+  MYSQL_STMT* getStatement(const std::string& sql, int& err);
+  /* func. binds the values to the prepared statement for sql and executes it */
+  int execute_with_reconnect(const std::string& sql,
+                             MYSQL_BIND* params,
+                             unsigned long count,
+                             MYSQL_STMT*& stmt);
   void configure_connection();
 
 private:
@@ -111,6 +127,10 @@ protected:
   /* Changing field values during dataset navigation */
   virtual void free_row(); // free the memory allocated for the current row
 
+  /* Binds the values to a prepared statement and executes it, rows are stored in result if
+  fetch is true */
+  void execute_statement(const std::string& sql, const BindList& args, bool fetch);
+
 public:
   /* constructor */
   using Dataset::Dataset;
@@ -131,6 +151,9 @@ or insert() operations default = false) */
   const void* getExecRes() override;
   /* as open, but with our query exec Sql */
   bool query(const std::string& query) override;
+  /* parameterized statements, prepared once per connection */
+  int exec(const std::string& sql, const BindList& args) override;
+  bool query(const std::string& sql, const BindList& args) override;
   /* func. closes a query */
   void close() override;
   /* Cancel changes, made in insert or edit states of dataset */
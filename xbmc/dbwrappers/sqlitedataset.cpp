@@ -19,6 +19,9 @@
 #include "utils/log.h"
 
 #include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -202,11 +205,89 @@ int callback(void* res_ptr, int ncol, char** result, char** cols)
   return 0;
 }
 
+//************* Statement helpers ***************************
+
+int fetch_rows(sqlite3_stmt* stmt, dbiplus::result_set& result)
+{
+  // column headers
+  const unsigned int numColumns = sqlite3_column_count(stmt);
+  result.record_header.resize(numColumns);
+  for (unsigned int i = 0; i < numColumns; i++)
+    result.record_header[i].name = sqlite3_column_name(stmt, i);
+
+  // returned rows
+  int rc;
+  while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+  { // have a row of data
+    auto* res = new dbiplus::sql_record;
+    res->resize(numColumns);
+    for (unsigned int i = 0; i < numColumns; i++)
+    {
+      dbiplus::field_value& v = res->at(i);
+      switch (sqlite3_column_type(stmt, i))
+      {
+        case SQLITE_INTEGER:
+          v.set_asInt64(sqlite3_column_int64(stmt, i));
+          break;
+        case SQLITE_FLOAT:
+          v.set_asDouble(sqlite3_column_double(stmt, i));
+          break;
+        case SQLITE_TEXT:
+          v.set_asString(reinterpret_cast<const char*>(sqlite3_column_text(stmt, i)),
+                         sqlite3_column_bytes(stmt, i));
+          break;
+        case SQLITE_BLOB:
+          v.set_asString(reinterpret_cast<const char*>(sqlite3_column_text(stmt, i)),
+                         sqlite3_column_bytes(stmt, i));
+          break;
+        case SQLITE_NULL:
+        default:
+          v.set_asString("", 0);
+          v.set_isNull();
+          break;
+      }
+    }
+    result.records.push_back(res);
+  }
+  return rc;
+}
+
+int bind_values(sqlite3_stmt* stmt, const dbiplus::BindList& args)
+{
+  using enum dbiplus::fType;
+
+  for (int i = 0; i < static_cast<int>(args.size()); i++)
+  {
+    const dbiplus::field_value& value = args[i];
+    int rc;
+    if (value.get_isNull())
+      rc = sqlite3_bind_null(stmt, i + 1);
+    else if (value.get_fType() == ft_String)
+    {
+      const std::string str = value.get_asString();
+      rc = sqlite3_bind_text(stmt, i + 1, str.c_str(), static_cast<int>(str.size()),
+                             SQLITE_TRANSIENT);
+    }
+    else if (value.get_fType() == ft_Float || value.get_fType() == ft_Double)
+      rc = sqlite3_bind_double(stmt, i + 1, value.get_asDouble());
+    else
+      rc = sqlite3_bind_int64(stmt, i + 1, value.get_asInt64());
+
+    if (rc != SQLITE_OK)
+      return rc;
+  }
+  return SQLITE_OK;
+}
+
 int busy_callback(void*, int /*busyCount*/)
 {
   KODI::TIME::Sleep(100ms);
   return 1;
 }
+
+// writes to the database files by any connection, see SqliteDatabase::write_count()
+std::mutex writeCountsMutex;
+std::map<std::string, uint64_t, std::less<>> writeCounts;
 } // unnamed namespace
 
 namespace dbiplus
@@ -311,6 +392,30 @@ const char* SqliteDatabase::getErrorMsg()
   return error.c_str();
 }
 
+void SqliteStatementFinalizer::operator()(sqlite3_stmt* stmt) const
+{
+  sqlite3_finalize(stmt);
+}
+
+sqlite3_stmt* SqliteDatabase::getStatement(const std::string& sql)
+{
+  if (!active)
+    throw DbErrors("No Database Connection");
+
+  sqlite3_stmt* stmt = statements.find(sql);
+  if (stmt)
+    return stmt;
+
+  if (setErr(sqlite3_prepare_v2(conn, sql.c_str(), static_cast<int>(sql.size()), &stmt, nullptr),
+             sql.c_str()) != SQLITE_OK)
+    throw DbErrors("%s", getErrorMsg());
+  if (!stmt)
+    throw DbErrors("Empty statement: %s", sql.c_str());
+
+  statements.insert(sql, stmt);
+  return stmt;
+}
+
 static int AlphaNumericCollation(
     void* /*not_used*/, int nKey1, const void* pKey1, int nKey2, const void* pKey2)
 {
@@ -401,6 +506,8 @@ void SqliteDatabase::disconnect()
 {
   if (!active)
     return;
+  // the connection can't be closed as long as it has compiled statements
+  statements.clear();
   sqlite3_close(conn);
   active = false;
 }
@@ -417,6 +524,14 @@ int SqliteDatabase::postconnect()
     throw DbErrors("%s", getErrorMsg());
   }
 
+  // With a write-ahead log readers don't wait for a writer to commit and vice versa. The mode is
+  // stored in the database, so this only converts existing databases. It's not available for
+  // databases on file systems without shared memory, which keep their rollback journal.
+  static const char* walcmd{"PRAGMA journal_mode=WAL"};
+  if (sqlite3_exec(getHandle(), walcmd, nullptr, nullptr, nullptr) != SQLITE_OK)
+    CLog::Log(LOGWARNING, "SqliteDatabase: unable to use a write-ahead log for {}: {}", db,
+              sqlite3_errmsg(conn));
+
   return DB_COMMAND_OK;
 }
 
@@ -531,6 +646,37 @@ int SqliteDatabase::drop_analytics()
   return DB_COMMAND_OK;
 }
 
+int SqliteDatabase::drop_temp_objects()
+{
+  // without a connection there's nothing to drop
+  if (active == false)
+    return DB_COMMAND_OK;
+
+  result_set res;
+
+  // views first, they may depend on tables. Indexes and triggers of a table go with it
+  int err = sqlite3_exec(conn,
+                         "SELECT type, name FROM sqlite_temp_master "
+                         "WHERE type IN ('view', 'trigger', 'table') "
+                         "ORDER BY CASE type WHEN 'view' THEN 0 WHEN 'trigger' THEN 1 ELSE 2 END",
+                         &callback, &res, nullptr);
+  if (err != SQLITE_OK)
+    return DB_UNEXPECTED_RESULT;
+
+  std::string sqlcmd;
+  for (const auto& record : res.records)
+  {
+    const std::string type = record->at(0).get_asString();
+    sqlcmd = StringUtils::Format("DROP {} IF EXISTS temp.'{}'", StringUtils::ToUpper(type),
+                                 record->at(1).get_asString());
+    err = sqlite3_exec(conn, sqlcmd.c_str(), nullptr, nullptr, nullptr);
+    if (err != SQLITE_OK)
+      return DB_UNEXPECTED_RESULT;
+  }
+
+  return DB_COMMAND_OK;
+}
+
 int SqliteDatabase::drop()
 {
   if (active == false)
@@ -582,6 +728,27 @@ long SqliteDatabase::nextid(const char* sname)
   return DB_UNEXPECTED_RESULT;
 }
 
+uint64_t SqliteDatabase::write_count()
+{
+  std::unique_lock lock(writeCountsMutex);
+  return writeCounts[URIUtils::AddFileToFolder(host, db)];
+}
+
+void SqliteDatabase::count_changes()
+{
+  // other connections only see the changes of a transaction once it has been committed
+  if (conn == nullptr || !sqlite3_get_autocommit(conn))
+    return;
+
+  const int total = sqlite3_total_changes(conn);
+  if (total == changes)
+    return;
+  changes = total;
+
+  std::unique_lock lock(writeCountsMutex);
+  writeCounts[URIUtils::AddFileToFolder(host, db)]++;
+}
+
 // methods for transactions
 // ---------------------------------------------
 void SqliteDatabase::start_transaction()
@@ -607,6 +774,7 @@ void SqliteDatabase::commit_transaction()
     sqlite3_exec(conn, "commit", nullptr, nullptr, nullptr);
     CLog::LogFC(LOGDEBUG, LOGDATABASE, "Sqlite commit transaction");
     _in_transaction = false;
+    count_changes();
   }
 }
 
@@ -618,6 +786,8 @@ void SqliteDatabase::rollback_transaction()
     sqlite3_exec(conn, "rollback", nullptr, nullptr, nullptr);
     CLog::LogFC(LOGDEBUG, LOGDATABASE, "Sqlite rollback transaction");
     _in_transaction = false;
+    // nothing of the transaction has ever been visible
+    changes = sqlite3_total_changes(conn);
   }
 }
 
@@ -899,6 +1069,8 @@ int SqliteDataset::exec(const std::string& sql)
   const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
 
   CLog::LogFC(LOGDEBUG, LOGDATABASE, "{} ms for query: {}", duration.count(), qry);
+  db->profile(qry, end - start, 0);
+  static_cast<SqliteDatabase*>(db)->count_changes();
 
   if (res == SQLITE_OK)
   {
@@ -939,52 +1111,18 @@ bool SqliteDataset::query(const std::string& query)
 
   close();
 
+  const auto start = std::chrono::steady_clock::now();
+
   sqlite3_stmt* stmt = nullptr;
   if (db->setErr(sqlite3_prepare_v2(handle(), query.c_str(), -1, &stmt, nullptr), query.c_str()) !=
       SQLITE_OK)
     throw DbErrors("%s", db->getErrorMsg());
 
-  // column headers
-  const unsigned int numColumns = sqlite3_column_count(stmt);
-  result.record_header.resize(numColumns);
-  for (unsigned int i = 0; i < numColumns; i++)
-    result.record_header[i].name = sqlite3_column_name(stmt, i);
-
-  // returned rows
-  while (sqlite3_step(stmt) == SQLITE_ROW)
-  { // have a row of data
-    auto* res = new sql_record;
-    res->resize(numColumns);
-    for (unsigned int i = 0; i < numColumns; i++)
-    {
-      field_value& v = res->at(i);
-      switch (sqlite3_column_type(stmt, i))
-      {
-        case SQLITE_INTEGER:
-          v.set_asInt64(sqlite3_column_int64(stmt, i));
-          break;
-        case SQLITE_FLOAT:
-          v.set_asDouble(sqlite3_column_double(stmt, i));
-          break;
-        case SQLITE_TEXT:
-          v.set_asString(reinterpret_cast<const char*>(sqlite3_column_text(stmt, i)),
-                         sqlite3_column_bytes(stmt, i));
-          break;
-        case SQLITE_BLOB:
-          v.set_asString(reinterpret_cast<const char*>(sqlite3_column_text(stmt, i)),
-                         sqlite3_column_bytes(stmt, i));
-          break;
-        case SQLITE_NULL:
-        default:
-          v.set_asString("", 0);
-          v.set_isNull();
-          break;
-      }
-    }
-    result.records.push_back(res);
-  }
+  fetch_rows(stmt, result);
   if (db->setErr(sqlite3_finalize(stmt), query.c_str()) == SQLITE_OK)
   {
+    db->profile(query, std::chrono::steady_clock::now() - start,
+                static_cast<int>(result.records.size()));
     active = true;
     ds_state = dsSelect;
     this->first();
@@ -996,6 +1134,66 @@ bool SqliteDataset::query(const std::string& query)
   }
 }
 
+void SqliteDataset::execute_statement(const std::string& sql, const BindList& args, bool fetch)
+{
+  if (!handle())
+    throw DbErrors("No Database Connection");
+
+  sqlite3_stmt* stmt = static_cast<SqliteDatabase*>(db)->getStatement(sql);
+  if (sqlite3_bind_parameter_count(stmt) != static_cast<int>(args.size()))
+    throw DbErrors("%d values bound to statement with %d parameters: %s",
+                   static_cast<int>(args.size()), sqlite3_bind_parameter_count(stmt), sql.c_str());
+
+  const auto start = std::chrono::steady_clock::now();
+
+  int rc = bind_values(stmt, args);
+  if (rc == SQLITE_OK)
+  {
+    if (fetch)
+      rc = fetch_rows(stmt, result);
+    else
+    {
+      while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+        ;
+    }
+  }
+
+  if (rc != SQLITE_OK && rc != SQLITE_DONE)
+    db->setErr(rc, db->inline_args(sql, args).c_str());
+
+  // keep the statement in the cache, but don't hold on to its values or the read lock
+  sqlite3_reset(stmt);
+  sqlite3_clear_bindings(stmt);
+
+  const auto end = std::chrono::steady_clock::now();
+  const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+  CLog::LogFC(LOGDEBUG, LOGDATABASE, "{} ms for statement: {}", duration.count(), sql);
+  db->profile(sql, end - start, fetch ? static_cast<int>(result.records.size()) : 0);
+
+  if (rc != SQLITE_OK && rc != SQLITE_DONE)
+    throw DbErrors("%s", db->getErrorMsg());
+}
+
+int SqliteDataset::exec(const std::string& sql, const BindList& args)
+{
+  exec_res.clear();
+  execute_statement(sql, args, false);
+  static_cast<SqliteDatabase*>(db)->count_changes();
+  return SQLITE_OK;
+}
+
+bool SqliteDataset::query(const std::string& sql, const BindList& args)
+{
+  close();
+  execute_statement(sql, args, true);
+
+  active = true;
+  ds_state = dsSelect;
+  this->first();
+  return true;
+}
+
 void SqliteDataset::open(const std::string& sql)
 {
   set_select_sql(sql);
@@ -13,10 +13,12 @@
 #pragma once
 
 #include "dataset.h"
+#include "statementcache.h"
 
 #include <string>
 
 struct sqlite3;
+struct sqlite3_stmt;
 
 namespace dbiplus
 {
@@ -25,12 +27,21 @@ namespace dbiplus
        class 'SqliteDatabase' connects with Sqlite-server
 
 ******************************************************************/
+struct SqliteStatementFinalizer
+{
+  void operator()(sqlite3_stmt* stmt) const;
+};
+
 class SqliteDatabase : public Database
 {
 protected:
   /* connect descriptor */
   sqlite3* conn{nullptr};
   bool _in_transaction{false};
+  /* changes of the connection when they were last counted in write_count() */
+  int changes{0};
+  /* compiled parameterized statements of the connection */
+  StatementCache<sqlite3_stmt, SqliteStatementFinalizer> statements{STATEMENT_CACHE_SIZE};
 
 public:
   /* default constructor */
@@ -42,6 +53,8 @@ public:
 
   /* func. returns connection handle with SQLite-server */
   sqlite3* getHandle() { return conn; }
+  /* func. returns the compiled statement for sql, it must be reset after use */
+  sqlite3_stmt* getStatement(const std::string& sql);
   /* func. returns current status about SQLite-server connection */
   int status() override;
   int setErr(int err_code, const char* qry) override;
@@ -71,8 +84,15 @@ public:
   /* \brief drop all extra analytics from database */
   int drop_analytics() override;
 
+  /* \brief drop the temporary tables, views and triggers of the connection */
+  int drop_temp_objects() override;
+
   long nextid(const char* seq_name) override;
 
+  uint64_t write_count() override;
+  /* func. counts the changes made since the last call once they are visible to other connections */
+  void count_changes();
+
   /* virtual methods for transaction */
 
   void start_transaction() override;
@@ -107,6 +127,10 @@ protected:
 
   //static int sqlite_callback(void* res_ptr,int ncol, char** result, char** cols);
 
+  /* Binds the values to a statement from the statement cache and executes it, rows are stored
+  in result if fetch is true */
+  void execute_statement(const std::string& sql, const BindList& args, bool fetch);
+
   /* This function works only with MySQL database
   Filling the fields information from select statement */
   void fill_fields() override;
@@ -133,6 +157,9 @@ or insert() operations default = false) */
   const void* getExecRes() override;
   /* as open, but with our query exec Sql */
   bool query(const std::string& query) override;
+  /* parameterized statements, compiled once per connection */
+  int exec(const std::string& sql, const BindList& args) override;
+  bool query(const std::string& sql, const BindList& args) override;
   /* func. closes a query */
   void close() override;
   /* Cancel changes, made in insert or edit states of dataset */
@@ -0,0 +1,99 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace dbiplus
+{
+/***************** Class StatementCache definition ******************
+
+   keeps the most recently used compiled statements of a connection,
+   so the same SQL isn't parsed and planned again on every execution.
+
+   Finalizer is called with statements evicted from or left in the
+   cache and has to release them.
+
+******************************************************************/
+template<typename Statement, typename Finalizer>
+class StatementCache
+{
+public:
+  explicit StatementCache(size_t capacity) : m_capacity(capacity) {}
+  ~StatementCache() { clear(); }
+
+  StatementCache(const StatementCache&) = delete;
+  StatementCache& operator=(const StatementCache&) = delete;
+
+  /* returns the statement compiled for sql and marks it as most recently used, nullptr if not cached */
+  Statement* find(std::string_view sql)
+  {
+    auto it = m_index.find(sql);
+    if (it == m_index.end())
+      return nullptr;
+
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return it->second->second;
+  }
+
+  /* adds the statement compiled for sql, the least recently used one is released if the cache is full */
+  void insert(std::string_view sql, Statement* stmt)
+  {
+    if (m_capacity == 0)
+    {
+      Finalizer()(stmt);
+      return;
+    }
+
+    auto it = m_index.find(sql);
+    if (it != m_index.end())
+    {
+      Finalizer()(it->second->second);
+      it->second->second = stmt;
+      m_entries.splice(m_entries.begin(), m_entries, it->second);
+      return;
+    }
+
+    if (m_entries.size() >= m_capacity)
+    {
+      auto& last = m_entries.back();
+      m_index.erase(last.first);
+      Finalizer()(last.second);
+      m_entries.pop_back();
+    }
+
+    m_entries.emplace_front(std::string(sql), stmt);
+    // the key refers to the string in the list entry, which never moves
+    m_index.try_emplace(m_entries.front().first, m_entries.begin());
+  }
+
+  /* releases all statements, e.g. before the connection is closed */
+  void clear()
+  {
+    m_index.clear();
+    for (auto& entry : m_entries)
+      Finalizer()(entry.second);
+    m_entries.clear();
+  }
+
+  size_t size() const { return m_entries.size(); }
+  size_t capacity() const { return m_capacity; }
+
+private:
+  using Entry = std::pair<std::string, Statement*>;
+
+  size_t m_capacity;
+  std::list<Entry> m_entries; // most recently used first
+  std::unordered_map<std::string_view, typename std::list<Entry>::iterator> m_index;
+};
+} // namespace dbiplus
@@ -0,0 +1,132 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/DatabaseConnectionPool.h"
+#include "dbwrappers/sqlitedataset.h"
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+TEST(TestDatabaseConnectionPool, CheckoutReturn)
+{
+  CDatabaseConnectionPool pool(2);
+  const std::string key = CDatabaseConnectionPool::GetKey("sqlite3", "/tmp", "MyVideos1");
+  const std::string other = CDatabaseConnectionPool::GetKey("sqlite3", "/tmp", "MyMusic1");
+
+  EXPECT_EQ(nullptr, pool.Checkout(key));
+
+  auto db = std::make_unique<dbiplus::SqliteDatabase>();
+  const dbiplus::Database* const returned = db.get();
+  pool.Return(key, std::move(db));
+  EXPECT_EQ(1u, pool.GetIdleCount(key));
+  EXPECT_EQ(nullptr, pool.Checkout(other));
+
+  std::unique_ptr<dbiplus::Database> checkedOut = pool.Checkout(key);
+  EXPECT_EQ(returned, checkedOut.get());
+  EXPECT_EQ(0u, pool.GetIdleCount(key));
+  EXPECT_EQ(nullptr, pool.Checkout(key));
+}
+
+TEST(TestDatabaseConnectionPool, MaxIdle)
+{
+  CDatabaseConnectionPool pool(2);
+  const std::string key = CDatabaseConnectionPool::GetKey("sqlite3", "/tmp", "MyVideos1");
+
+  for (int i = 0; i < 3; ++i)
+    pool.Return(key, std::make_unique<dbiplus::SqliteDatabase>());
+  EXPECT_EQ(2u, pool.GetIdleCount(key));
+
+  pool.Clear();
+  EXPECT_EQ(0u, pool.GetIdleCount(key));
+}
+
+TEST(TestDatabaseConnectionPool, TemporaryTables)
+{
+  const std::filesystem::path folder = std::filesystem::temp_directory_path();
+  const std::string name = "TestDatabaseConnectionPoolTemp.db";
+  std::filesystem::remove(folder / name);
+
+  CDatabaseConnectionPool pool(2);
+  const std::string key = CDatabaseConnectionPool::GetKey("sqlite3", folder.string(), name);
+
+  auto db = std::make_unique<dbiplus::SqliteDatabase>();
+  db->setHostName(folder.string().c_str());
+  db->setDatabase(name.c_str());
+  ASSERT_EQ(dbiplus::DB_CONNECTION_OK, db->connect(true));
+  {
+    std::unique_ptr<dbiplus::Dataset> ds(db->CreateDataset());
+    ds->exec("CREATE TEMPORARY TABLE songpaths (idPath integer, strPath varchar(512))");
+    ds->exec("CREATE INDEX songpaths_path ON songpaths (strPath)");
+    ds->exec("CREATE TEMPORARY VIEW songpaths_view AS SELECT strPath FROM songpaths");
+  }
+  pool.Return(key, std::move(db));
+  ASSERT_EQ(1u, pool.GetIdleCount(key));
+
+  // whoever gets the connection next can create the same tables again
+  {
+    std::unique_ptr<dbiplus::Database> checkedOut = pool.Checkout(key);
+    ASSERT_NE(nullptr, checkedOut);
+    std::unique_ptr<dbiplus::Dataset> ds(checkedOut->CreateDataset());
+    ASSERT_TRUE(ds->query("SELECT COUNT(1) FROM sqlite_temp_master"));
+    EXPECT_EQ(0, ds->fv(0).get_asInt());
+    ds->close();
+    EXPECT_NO_THROW(ds->exec("CREATE TEMPORARY TABLE songpaths (idPath integer)"));
+  }
+
+  std::filesystem::remove(folder / name);
+}
+
+TEST(TestDatabaseConnectionPool, WriteAheadLog)
+{
+  const std::filesystem::path folder = std::filesystem::temp_directory_path();
+  const std::string name = "TestDatabaseConnectionPool.db";
+  std::filesystem::remove(folder / name);
+
+  auto connect = [&folder, &name]()
+  {
+    auto db = std::make_unique<dbiplus::SqliteDatabase>();
+    db->setHostName(folder.string().c_str());
+    db->setDatabase(name.c_str());
+    EXPECT_EQ(dbiplus::DB_CONNECTION_OK, db->connect(true));
+    db->postconnect();
+    return db;
+  };
+
+  {
+    auto writer = connect();
+    auto reader = connect();
+    std::unique_ptr<dbiplus::Dataset> writes(writer->CreateDataset());
+    std::unique_ptr<dbiplus::Dataset> reads(reader->CreateDataset());
+
+    ASSERT_TRUE(reads->query("SELECT journal_mode FROM pragma_journal_mode"));
+    EXPECT_EQ("wal", reads->fv(0).get_asString());
+    reads->close();
+
+    writes->exec("CREATE TABLE path (idPath INTEGER PRIMARY KEY, strPath TEXT)");
+    writes->exec("INSERT INTO path (strPath) VALUES ('/music/')");
+
+    // a reader neither waits for an open write transaction nor sees its changes
+    writer->start_transaction();
+    writes->exec("INSERT INTO path (strPath) VALUES ('/video/')");
+    ASSERT_TRUE(reads->query("SELECT COUNT(1) FROM path"));
+    EXPECT_EQ(1, reads->fv(0).get_asInt());
+    reads->close();
+    writer->commit_transaction();
+
+    ASSERT_TRUE(reads->query("SELECT COUNT(1) FROM path"));
+    EXPECT_EQ(2, reads->fv(0).get_asInt());
+    reads->close();
+  }
+
+  std::filesystem::remove(folder / name);
+  std::filesystem::remove(folder / (name + "-wal"));
+  std::filesystem::remove(folder / (name + "-shm"));
+}
@@ -0,0 +1,96 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/QueryProfiler.h"
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+TEST(TestQueryProfiler, Normalize)
+{
+  EXPECT_EQ("SELECT * FROM song WHERE idSong = ?",
+            CQueryProfiler::Normalize("SELECT *  FROM song\n WHERE idSong = 42 "));
+  EXPECT_EQ("SELECT idPath FROM path WHERE strPath = ?",
+            CQueryProfiler::Normalize("SELECT idPath FROM path WHERE strPath = 'it''s 1 path/'"));
+  EXPECT_EQ("DELETE FROM art WHERE media_id IN (?) AND type = ?",
+            CQueryProfiler::Normalize(
+                "DELETE FROM art WHERE media_id IN (1, 2,3) AND type = 'thumb'"));
+  EXPECT_EQ("SELECT c00 FROM movie_view WHERE idMovie = ?",
+            CQueryProfiler::Normalize("SELECT c00 FROM movie_view WHERE idMovie = ?"));
+  EXPECT_EQ("SELECT * FROM MyMusic83 WHERE rating > ?",
+            CQueryProfiler::Normalize("SELECT * FROM MyMusic83 WHERE rating > 2.5"));
+}
+
+TEST(TestQueryProfiler, Statistics)
+{
+  CQueryProfiler profiler;
+  for (int i = 0; i < 99; i++)
+    profiler.Record("MyMusic83", "SELECT * FROM song WHERE idSong = " + std::to_string(i), 10us,
+                    1);
+  profiler.Record("MyMusic83", "SELECT * FROM song WHERE idSong = 99", 5ms, 1);
+  profiler.Record("MyMusic83", "DELETE FROM song WHERE idSong = 1", 1ms, 0);
+  profiler.Record("MyVideos131", "DELETE FROM song WHERE idSong = 1", 100us, 0);
+
+  const auto statistics = profiler.GetStatistics();
+  ASSERT_EQ(3u, statistics.size());
+
+  const auto& select = statistics[0];
+  EXPECT_EQ("MyMusic83", select.database);
+  EXPECT_EQ("SELECT * FROM song WHERE idSong = ?", select.statement);
+  EXPECT_EQ(100u, select.count);
+  EXPECT_EQ(100u, select.rows);
+  EXPECT_EQ(99 * 10us + 5ms, select.total);
+  EXPECT_EQ(5ms, select.max);
+  // percentiles are rounded up to powers of two
+  EXPECT_EQ(15us, select.median);
+  EXPECT_EQ(15us, select.p95);
+  EXPECT_EQ(5ms, select.p99);
+
+  EXPECT_EQ("MyMusic83", statistics[1].database);
+  EXPECT_EQ(1ms, statistics[1].total);
+  EXPECT_EQ("MyVideos131", statistics[2].database);
+
+  EXPECT_EQ(1u, profiler.GetStatistics(1).size());
+
+  profiler.Reset();
+  EXPECT_TRUE(profiler.GetStatistics().empty());
+}
+
+TEST(TestQueryProfiler, SlowQueries)
+{
+  CQueryProfiler profiler;
+  profiler.Record("MyMusic83", "SELECT * FROM song WHERE idSong = 1", 200ms, 1);
+  EXPECT_TRUE(profiler.GetSlowQueries().empty());
+
+  profiler.SetSlowQueryTime(100ms);
+  profiler.Record("MyMusic83", "SELECT * FROM song WHERE idSong = 2", 50ms, 1);
+  for (size_t i = 0; i < CQueryProfiler::MAX_SLOW_QUERIES + 1; i++)
+    profiler.Record("MyMusic83", "SELECT * FROM song WHERE idSong = " + std::to_string(i), 100ms,
+                    1);
+
+  const auto slowQueries = profiler.GetSlowQueries();
+  ASSERT_EQ(CQueryProfiler::MAX_SLOW_QUERIES, slowQueries.size());
+  // the literal values are stripped, the oldest query has been dropped
+  EXPECT_EQ("SELECT * FROM song WHERE idSong = ?", slowQueries.front().statement);
+  EXPECT_EQ(100ms, slowQueries.front().duration);
+}
+
+TEST(TestQueryProfiler, MaxStatements)
+{
+  CQueryProfiler profiler;
+  for (size_t i = 0; i < CQueryProfiler::MAX_STATEMENTS + 10; i++)
+    profiler.Record("MyMusic83", "SELECT * FROM song" + std::to_string(i), 10us, 0);
+
+  const auto statistics = profiler.GetStatistics();
+  ASSERT_EQ(CQueryProfiler::MAX_STATEMENTS + 1, statistics.size());
+  EXPECT_EQ("(other statements)", statistics[0].statement);
+  EXPECT_EQ(10u, statistics[0].count);
+}
@@ -0,0 +1,69 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/sqlitedataset.h"
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+TEST(TestSqliteDataset, WriteCount)
+{
+  const std::filesystem::path folder = std::filesystem::temp_directory_path();
+  const std::string name = "TestSqliteDataset.db";
+  std::filesystem::remove(folder / name);
+
+  {
+    dbiplus::SqliteDatabase writer;
+    dbiplus::SqliteDatabase reader;
+    for (auto* db : {&writer, &reader})
+    {
+      db->setHostName(folder.string().c_str());
+      db->setDatabase(name.c_str());
+      ASSERT_EQ(dbiplus::DB_CONNECTION_OK, db->connect(true));
+    }
+    std::unique_ptr<dbiplus::Dataset> writes(writer.CreateDataset());
+    std::unique_ptr<dbiplus::Dataset> reads(reader.CreateDataset());
+
+    writes->exec("CREATE TABLE path (idPath INTEGER PRIMARY KEY, strPath TEXT)");
+    const uint64_t created = reader.write_count();
+
+    // every connection to the file sees the writes of the others
+    writes->exec("INSERT INTO path (strPath) VALUES ('/music/')");
+    const uint64_t inserted = reader.write_count();
+    EXPECT_NE(created, inserted);
+    EXPECT_EQ(inserted, writer.write_count());
+
+    // reading and writing nothing isn't a write
+    ASSERT_TRUE(reads->query("SELECT strPath FROM path"));
+    reads->close();
+    writes->exec("DELETE FROM path WHERE strPath = '/video/'");
+    writes->exec("UPDATE path SET strPath = ? WHERE idPath = ?",
+                 dbiplus::make_bind_list("/video/", 7));
+    EXPECT_EQ(inserted, reader.write_count());
+
+    // a transaction counts once it has been committed
+    writer.start_transaction();
+    writes->exec("UPDATE path SET strPath = ? WHERE idPath = ?",
+                 dbiplus::make_bind_list("/video/", 1));
+    EXPECT_EQ(inserted, reader.write_count());
+    writer.commit_transaction();
+    const uint64_t committed = reader.write_count();
+    EXPECT_NE(inserted, committed);
+
+    writer.start_transaction();
+    writes->exec("DELETE FROM path");
+    writer.rollback_transaction();
+    writes->exec("SELECT 1");
+    EXPECT_EQ(committed, reader.write_count());
+  }
+
+  std::filesystem::remove(folder / name);
+}
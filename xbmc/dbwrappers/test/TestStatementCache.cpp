@@ -0,0 +1,189 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/sqlitedataset.h"
+#include "dbwrappers/statementcache.h"
+
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+struct TestStatement
+{
+  int id;
+};
+
+std::set<int> finalized;
+
+struct TestFinalizer
+{
+  void operator()(TestStatement* stmt) const
+  {
+    finalized.insert(stmt->id);
+    delete stmt;
+  }
+};
+
+using TestCache = dbiplus::StatementCache<TestStatement, TestFinalizer>;
+} // namespace
+
+TEST(TestStatementCache, Find)
+{
+  finalized.clear();
+  TestCache cache(2);
+
+  EXPECT_EQ(nullptr, cache.find("SELECT 1"));
+  cache.insert("SELECT 1", new TestStatement{1});
+  ASSERT_NE(nullptr, cache.find("SELECT 1"));
+  EXPECT_EQ(1, cache.find("SELECT 1")->id);
+  EXPECT_EQ(nullptr, cache.find("SELECT 2"));
+  EXPECT_EQ(1u, cache.size());
+  EXPECT_TRUE(finalized.empty());
+}
+
+TEST(TestStatementCache, EvictLeastRecentlyUsed)
+{
+  finalized.clear();
+  TestCache cache(2);
+
+  cache.insert("SELECT 1", new TestStatement{1});
+  cache.insert("SELECT 2", new TestStatement{2});
+  // using the first one makes the second one the least recently used
+  ASSERT_NE(nullptr, cache.find("SELECT 1"));
+  cache.insert("SELECT 3", new TestStatement{3});
+
+  EXPECT_EQ(2u, cache.size());
+  EXPECT_EQ(std::set<int>{2}, finalized);
+  EXPECT_EQ(nullptr, cache.find("SELECT 2"));
+  ASSERT_NE(nullptr, cache.find("SELECT 1"));
+  ASSERT_NE(nullptr, cache.find("SELECT 3"));
+}
+
+TEST(TestStatementCache, Replace)
+{
+  finalized.clear();
+  TestCache cache(2);
+
+  cache.insert("SELECT 1", new TestStatement{1});
+  cache.insert("SELECT 1", new TestStatement{2});
+
+  EXPECT_EQ(1u, cache.size());
+  EXPECT_EQ(std::set<int>{1}, finalized);
+  ASSERT_NE(nullptr, cache.find("SELECT 1"));
+  EXPECT_EQ(2, cache.find("SELECT 1")->id);
+}
+
+TEST(TestStatementCache, Clear)
+{
+  finalized.clear();
+  {
+    TestCache cache(4);
+    cache.insert("SELECT 1", new TestStatement{1});
+    cache.insert("SELECT 2", new TestStatement{2});
+    cache.clear();
+    EXPECT_EQ(0u, cache.size());
+    EXPECT_EQ((std::set<int>{1, 2}), finalized);
+
+    cache.insert("SELECT 3", new TestStatement{3});
+  }
+  // the remaining statements are released with the cache
+  EXPECT_EQ((std::set<int>{1, 2, 3}), finalized);
+}
+
+TEST(TestStatementCache, BindList)
+{
+  const std::string path = "/music/";
+  const dbiplus::BindList args = dbiplus::make_bind_list(
+      path, "song.flac", 7, int64_t{1} << 40, 2.5f, nullptr, std::optional<int>(), true);
+
+  ASSERT_EQ(8u, args.size());
+  EXPECT_EQ(dbiplus::fType::ft_String, args[0].get_fType());
+  EXPECT_EQ(path, args[0].get_asString());
+  EXPECT_EQ(dbiplus::fType::ft_String, args[1].get_fType());
+  EXPECT_EQ(dbiplus::fType::ft_Int, args[2].get_fType());
+  EXPECT_EQ(dbiplus::fType::ft_Int64, args[3].get_fType());
+  EXPECT_EQ(int64_t{1} << 40, args[3].get_asInt64());
+  EXPECT_EQ(dbiplus::fType::ft_Double, args[4].get_fType());
+  EXPECT_TRUE(args[5].get_isNull());
+  EXPECT_TRUE(args[6].get_isNull());
+  EXPECT_EQ(1, args[7].get_asInt());
+}
+
+TEST(TestStatementCache, InlineArgs)
+{
+  dbiplus::SqliteDatabase db;
+
+  EXPECT_EQ("SELECT idPath FROM path WHERE strPath = 'it''s' AND idParentPath = 3 AND x IS NULL",
+            db.inline_args("SELECT idPath FROM path WHERE strPath = ? AND idParentPath = ? AND "
+                           "x IS ?",
+                           dbiplus::make_bind_list("it's", 3, nullptr)));
+  // placeholders in quotes aren't replaced
+  EXPECT_EQ("SELECT '?', 1", db.inline_args("SELECT '?', ?", dbiplus::make_bind_list(1)));
+}
+
+TEST(TestStatementCache, SqliteBoundStatements)
+{
+  const std::filesystem::path folder = std::filesystem::temp_directory_path();
+  const std::string name = "TestStatementCache.db";
+  std::filesystem::remove(folder / name);
+
+  dbiplus::SqliteDatabase db;
+  db.setHostName(folder.string().c_str());
+  db.setDatabase(name.c_str());
+  ASSERT_EQ(dbiplus::DB_CONNECTION_OK, db.connect(true));
+
+  {
+    std::unique_ptr<dbiplus::Dataset> ds(db.CreateDataset());
+    ds->exec("CREATE TABLE path (idPath INTEGER PRIMARY KEY, strPath TEXT, dateAdded TEXT)");
+
+    const std::string insert = "INSERT INTO path (idPath, strPath, dateAdded) VALUES (NULL, ?, ?)";
+    ds->exec(insert, dbiplus::make_bind_list("/music/", nullptr));
+    EXPECT_EQ(1, ds->lastinsertid());
+    ds->exec(insert, dbiplus::make_bind_list("/music/it's/", "2026-01-01"));
+    EXPECT_EQ(2, ds->lastinsertid());
+
+    const std::string select = "SELECT idPath, dateAdded FROM path WHERE strPath = ?";
+    ASSERT_TRUE(ds->query(select, dbiplus::make_bind_list("/music/it's/")));
+    ASSERT_EQ(1, ds->num_rows());
+    EXPECT_EQ(2, ds->fv("idPath").get_asInt());
+    EXPECT_EQ("2026-01-01", ds->fv("dateAdded").get_asString());
+    ds->close();
+
+    ASSERT_TRUE(ds->query(select, dbiplus::make_bind_list("/music/")));
+    ASSERT_EQ(1, ds->num_rows());
+    EXPECT_EQ(1, ds->fv("idPath").get_asInt());
+    EXPECT_TRUE(ds->fv("dateAdded").get_isNull());
+    ds->close();
+
+    ASSERT_TRUE(ds->query(select, dbiplus::make_bind_list("/video/")));
+    EXPECT_EQ(0, ds->num_rows());
+    ds->close();
+
+    // a wrong number of values is an error and doesn't break the cached statement
+    EXPECT_THROW(ds->query(select, dbiplus::BindList()), dbiplus::DbErrors);
+    ASSERT_TRUE(ds->query(select, dbiplus::make_bind_list("/music/")));
+    EXPECT_EQ(1, ds->num_rows());
+    ds->close();
+
+    // the statements are kept compiled while the schema changes
+    ds->exec("ALTER TABLE path ADD COLUMN strHash TEXT");
+    ds->exec(insert, dbiplus::make_bind_list("/video/", nullptr));
+    ASSERT_TRUE(ds->query(select, dbiplus::make_bind_list("/video/")));
+    EXPECT_EQ(3, ds->fv("idPath").get_asInt());
+    ds->close();
+  }
+
+  db.disconnect();
+  std::filesystem::remove(folder / name);
+}
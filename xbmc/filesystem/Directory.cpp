@@ -9,6 +9,7 @@
 #include "Directory.h"
 
 #include "DirectoryCache.h"
+#include "DirectoryDiskCache.h"
 #include "DirectoryFactory.h"
 #include "FileDirectoryFactory.h"
 #include "FileItem.h"
@@ -188,6 +189,26 @@ bool CDirectory::GetDirectory(const CURL& url,
       bool result = false;
       CURL authUrl = realURL;
 
+      // check the persisted listing, a single stat is a lot cheaper than listing the directory.
+      // The directory mtime doesn't change when a file is rewritten in place, so the persisted
+      // listing is only shown while browsing and refreshed right away. Everybody else, like the
+      // library scanners, gets the listing from the backend and doesn't persist it either.
+      const bool persist = !(hints.flags & DIR_FLAG_BYPASS_CACHE) &&
+                           (hints.flags & DIR_FLAG_ALLOW_PROMPT) &&
+                           CDirectoryDiskCache::IsCacheable(realURL);
+      int64_t mtime = -1;
+      if (persist)
+      {
+        mtime = CDirectoryDiskCache::GetModificationTime(URIUtils::AddCredentials(realURL));
+        if (CDirectoryDiskCache::Load(realURL, mtime, items))
+        {
+          items.SetURL(url);
+          result = true;
+          CDirectoryDiskCache::Revalidate(realURL, url.Get());
+        }
+      }
+      const bool loadedFromDisk = result;
+
       while (!result)
       {
         // don't change auth if it's set explicitly
@@ -252,6 +273,9 @@ bool CDirectory::GetDirectory(const CURL& url,
       // cache the directory, if necessary
       if (!(hints.flags & DIR_FLAG_BYPASS_CACHE))
         g_directoryCache.SetDirectory(realURL, items, pDirectory->GetCacheType(url));
+
+      if (persist && !loadedFromDisk)
+        CDirectoryDiskCache::Save(realURL, mtime, items);
     }
 
     // now filter for allowed files
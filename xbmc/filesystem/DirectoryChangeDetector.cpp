@@ -0,0 +1,658 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DirectoryChangeDetector.h"
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "URL.h"
+#include "XBDateTime.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "filesystem/SpecialProtocol.h"
+#include "utils/Digest.h"
+#include "utils/JSONVariantParser.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+#include "utils/Variant.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <utility>
+
+#if defined(HAVE_INOTIFY)
+#include "threads/Thread.h"
+
+#include <unordered_map>
+
+#include <errno.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+using namespace XFILE;
+using KODI::UTILITY::CDigest;
+
+namespace
+{
+constexpr int STORE_VERSION = 2;
+
+/*! Folders and files modified this many seconds before they were listed might be modified again
+ within the resolution of their timestamp without it changing, so their listing isn't trusted */
+constexpr int64_t RACY_SECONDS = 2;
+
+bool IsInFolder(const std::string& path, const std::string& folder)
+{
+  return path.size() >= folder.size() && path.compare(0, folder.size(), folder) == 0;
+}
+} // unnamed namespace
+
+#if defined(HAVE_INOTIFY)
+/*!
+ * \brief Collects the local folders changed since they have been watched
+ */
+class CDirectoryChangeDetector::CJournal : private CThread
+{
+public:
+  CJournal() : CThread("DirectoryJournal") {}
+  ~CJournal() override
+  {
+    StopThread();
+    Close();
+  }
+
+  static bool IsWatchable(const std::string& folder)
+  {
+    return URIUtils::IsHD(folder) &&
+           CURL(CSpecialProtocol::TranslatePath(folder)).GetProtocol().empty();
+  }
+
+  /*!
+   \brief Watch all local folders of the store
+   \details Folders which are watched for the first time are reported as changed if they have
+   been modified since their time was stored, so nothing is lost between listing and watching.
+   */
+  void Watch(const FolderMap& folders)
+  {
+    std::unique_lock lock(m_critSection);
+
+    if (!m_complete)
+      Close();
+
+    if (m_fd < 0)
+    {
+      m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+      if (m_fd < 0)
+      {
+        CLog::LogF(LOGWARNING, "unable to initialize inotify ({})", errno);
+        return;
+      }
+      m_complete = true;
+    }
+
+    for (const auto& [folder, entry] : folders)
+    {
+      if (m_watches.contains(folder) || !IsWatchable(folder))
+        continue;
+
+      const int wd = inotify_add_watch(m_fd, CSpecialProtocol::TranslatePath(folder).c_str(),
+                                       IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO |
+                                           IN_CLOSE_WRITE | IN_ATTRIB | IN_DELETE_SELF |
+                                           IN_MOVE_SELF | IN_ONLYDIR);
+      if (wd < 0)
+      {
+        if (errno == ENOENT || errno == ENOTDIR)
+        {
+          // removed since it was listed, its parent reports the change
+          continue;
+        }
+        // most likely ENOSPC, which means fs.inotify.max_user_watches is exhausted
+        CLog::LogF(LOGWARNING, "unable to watch {} ({}), falling back to scanning all folders",
+                   folder, errno);
+        Close();
+        return;
+      }
+
+      m_watches[folder] = wd;
+      m_folders[wd] = folder;
+      if (entry.time == 0 || GetFolderTime(folder) != entry.time)
+        m_changed.insert(folder);
+    }
+
+    if (!IsRunning())
+      Create();
+  }
+
+  /*!
+   \brief Check whether all changes of a folder and its subfolders are known
+   */
+  bool Covers(const std::string& root) const
+  {
+    std::unique_lock lock(m_critSection);
+    return m_complete && m_watches.contains(root);
+  }
+
+  /*!
+   \brief Take the changed folders of a root
+   */
+  void TakeChanges(const std::string& root, std::set<std::string>& changed)
+  {
+    std::unique_lock lock(m_critSection);
+    for (auto it = m_changed.lower_bound(root); it != m_changed.end() && IsInFolder(*it, root);)
+    {
+      changed.insert(*it);
+      it = m_changed.erase(it);
+    }
+  }
+
+  /*!
+   \brief Give back changes which have been taken but not committed
+   */
+  void RestoreChanges(const std::set<std::string>& changed)
+  {
+    std::unique_lock lock(m_critSection);
+    m_changed.insert(changed.begin(), changed.end());
+  }
+
+  void Close()
+  {
+    std::unique_lock lock(m_critSection);
+    if (m_fd >= 0)
+      close(m_fd);
+    m_fd = -1;
+    m_complete = false;
+    m_watches.clear();
+    m_folders.clear();
+    m_changed.clear();
+  }
+
+protected:
+  void Process() override
+  {
+    alignas(inotify_event) char buffer[16 * 1024];
+
+    while (!m_bStop)
+    {
+      int fd;
+      {
+        std::unique_lock lock(m_critSection);
+        fd = m_fd;
+      }
+      if (fd < 0)
+      {
+        // the watches have been dropped, wait for the next commit to set them up again
+        CThread::Sleep(std::chrono::milliseconds(500));
+        continue;
+      }
+
+      pollfd pfd = {fd, POLLIN, 0};
+      if (poll(&pfd, 1, 500) <= 0 || !(pfd.revents & POLLIN))
+        continue;
+
+      std::unique_lock lock(m_critSection);
+      if (m_fd != fd)
+        continue;
+
+      ssize_t length;
+      while ((length = read(m_fd, buffer, sizeof(buffer))) > 0)
+      {
+        for (char* ptr = buffer; ptr < buffer + length;)
+        {
+          const auto* event = reinterpret_cast<const inotify_event*>(ptr);
+          ptr += sizeof(inotify_event) + event->len;
+          OnEvent(*event);
+        }
+      }
+    }
+  }
+
+private:
+  void OnEvent(const inotify_event& event)
+  {
+    if (event.mask & IN_Q_OVERFLOW)
+    {
+      CLog::LogF(LOGDEBUG, "events have been lost, falling back to scanning all folders");
+      m_complete = false;
+      return;
+    }
+
+    const auto it = m_folders.find(event.wd);
+    if (it == m_folders.end())
+      return;
+    const std::string folder = it->second;
+
+    if (event.mask & IN_IGNORED)
+    {
+      m_watches.erase(folder);
+      m_folders.erase(it);
+      return;
+    }
+
+    m_changed.insert(folder);
+
+    if (event.mask & IN_MOVE_SELF)
+    {
+      // the watches of the subtree follow it to wherever it has been moved to
+      for (auto watch = m_watches.lower_bound(folder);
+           watch != m_watches.end() && IsInFolder(watch->first, folder);)
+      {
+        inotify_rm_watch(m_fd, watch->second);
+        m_folders.erase(watch->second);
+        watch = m_watches.erase(watch);
+      }
+    }
+  }
+
+  mutable CCriticalSection m_critSection;
+  int m_fd = -1;
+  bool m_complete = false; //!< whether no event has been lost
+  std::map<std::string, int, std::less<>> m_watches;
+  std::unordered_map<int, std::string> m_folders;
+  std::set<std::string> m_changed;
+};
+#else
+class CDirectoryChangeDetector::CJournal
+{
+};
+#endif
+
+CDirectoryChangeDetector::CDirectoryChangeDetector(std::string storeFile,
+                                                   bool watchLocalFolders /* = true */)
+  : m_storeFile(std::move(storeFile))
+{
+#if defined(HAVE_INOTIFY)
+  if (watchLocalFolders)
+    m_journal = std::make_unique<CJournal>();
+#endif
+}
+
+CDirectoryChangeDetector::~CDirectoryChangeDetector() = default;
+
+bool CDirectoryChangeDetector::GetChangedFolders(const std::set<std::string, std::less<>>& roots,
+                                                 std::set<std::string>& changed,
+                                                 const std::atomic<bool>& stop)
+{
+  std::unique_lock lock(m_critSection);
+
+  Load();
+  DiscardChanges();
+
+  std::set<std::string> visited;
+  for (const auto& root : roots)
+  {
+    if (stop)
+      return false;
+
+#if defined(HAVE_INOTIFY)
+    if (m_journal && !visited.contains(root) && m_folders.contains(root) &&
+        m_journal->Covers(root))
+    {
+      std::set<std::string> journalChanges;
+      m_journal->TakeChanges(root, journalChanges);
+      m_journalChanges.insert(journalChanges.begin(), journalChanges.end());
+
+      for (const auto& folder : journalChanges)
+      {
+        if (!visited.insert(folder).second)
+          continue;
+
+        const int64_t time = GetFolderTime(folder);
+        if (time < 0)
+          continue; // removed, its parent reports the change
+
+        changed.insert(folder);
+        if (!ListFolder(folder, time))
+          continue;
+
+        // walk the folders which have been added
+        for (const auto& subFolder : m_pending[folder].subFolders)
+        {
+          if (!m_folders.contains(subFolder) && !Walk(subFolder, changed, visited, stop))
+            return false;
+        }
+      }
+
+      // the subtree is known now
+      visited.insert(root);
+      continue;
+    }
+#endif
+
+    if (!Walk(root, changed, visited, stop))
+      return false;
+  }
+
+  return true;
+}
+
+bool CDirectoryChangeDetector::GetSubFolders(const std::string& folder,
+                                             std::vector<std::string>& subFolders) const
+{
+  std::unique_lock lock(m_critSection);
+
+  const Folder* entry = FindFolder(folder);
+  if (!entry)
+    return false;
+
+  subFolders = entry->subFolders;
+  return true;
+}
+
+void CDirectoryChangeDetector::CommitChanges()
+{
+  std::unique_lock lock(m_critSection);
+
+  for (auto& [folder, entry] : m_pending)
+  {
+    auto it = m_folders.find(folder);
+    if (it != m_folders.end())
+    {
+      // drop the subfolders which are gone, including their own subfolders
+      for (const auto& subFolder : it->second.subFolders)
+      {
+        if (std::find(entry.subFolders.begin(), entry.subFolders.end(), subFolder) ==
+            entry.subFolders.end())
+          RemoveFolder(subFolder);
+      }
+    }
+    m_folders[folder] = std::move(entry);
+  }
+  m_pending.clear();
+  m_journalChanges.clear();
+
+  Save();
+
+#if defined(HAVE_INOTIFY)
+  if (m_journal)
+    m_journal->Watch(m_folders);
+#endif
+}
+
+void CDirectoryChangeDetector::DiscardChanges()
+{
+  std::unique_lock lock(m_critSection);
+
+  m_pending.clear();
+#if defined(HAVE_INOTIFY)
+  if (m_journal)
+    m_journal->RestoreChanges(m_journalChanges);
+#endif
+  m_journalChanges.clear();
+}
+
+void CDirectoryChangeDetector::ForgetFolder(const std::string& folder)
+{
+  std::unique_lock lock(m_critSection);
+
+  CLog::LogF(LOGDEBUG, "{} will be looked into again", CURL::GetRedacted(folder));
+
+  // a folder unknown to the store is reported as new
+  m_pending.erase(folder);
+  m_folders.erase(folder);
+#if defined(HAVE_INOTIFY)
+  if (m_journal)
+    m_journal->RestoreChanges({folder});
+#endif
+}
+
+void CDirectoryChangeDetector::Reset()
+{
+  std::unique_lock lock(m_critSection);
+
+  CLog::LogF(LOGDEBUG, "forgetting all folders of {}", m_storeFile);
+
+#if defined(HAVE_INOTIFY)
+  if (m_journal)
+    m_journal->Close();
+#endif
+  m_folders.clear();
+  m_pending.clear();
+  m_journalChanges.clear();
+  m_loadedFile = CSpecialProtocol::TranslatePath(m_storeFile);
+  CFile::Delete(m_loadedFile);
+}
+
+bool CDirectoryChangeDetector::Walk(const std::string& folder,
+                                    std::set<std::string>& changed,
+                                    std::set<std::string>& visited,
+                                    const std::atomic<bool>& stop)
+{
+  if (!visited.insert(folder).second)
+    return true;
+
+  if (stop)
+    return false;
+
+  const int64_t time = GetFolderTime(folder);
+  if (time < 0)
+  {
+    // an offline root is left alone, including the roots below it, and a removed folder is
+    // reported by its parent
+    for (auto it = m_folders.lower_bound(folder);
+         it != m_folders.end() && IsInFolder(it->first, folder); ++it)
+      visited.insert(it->first);
+    return true;
+  }
+
+  if (!ListFolder(folder, time))
+  {
+    changed.insert(folder);
+    return true;
+  }
+
+  const Folder& entry = m_pending[folder];
+  const auto it = m_folders.find(folder);
+  if (it == m_folders.end() || entry.fingerprint.empty() ||
+      it->second.fingerprint != entry.fingerprint)
+    changed.insert(folder);
+
+  const std::vector<std::string> subFolders = entry.subFolders;
+  for (const auto& subFolder : subFolders)
+  {
+    if (!Walk(subFolder, changed, visited, stop))
+      return false;
+  }
+
+  return true;
+}
+
+bool CDirectoryChangeDetector::ListFolder(const std::string& folder, int64_t time)
+{
+  CFileItemList items;
+  if (!CDirectory::GetDirectory(folder, items, "",
+                                DIR_FLAG_NO_FILE_DIRS | DIR_FLAG_GET_HIDDEN |
+                                    DIR_FLAG_BYPASS_CACHE))
+    return false;
+
+  const int64_t now = std::chrono::duration_cast<std::chrono::seconds>(
+                          std::chrono::system_clock::now().time_since_epoch())
+                          .count();
+  const CDateTime racyTime =
+      CDateTime::GetCurrentDateTime() - CDateTimeSpan(0, 0, 0, static_cast<int>(RACY_SECONDS));
+
+  Folder entry;
+  bool racy = time > now - RACY_SECONDS;
+  std::vector<std::string> files;
+  for (const auto& item : items)
+  {
+    if (!item->IsFolder())
+    {
+      // the scanners skip folders holding a .nomedia file, including their subfolders
+      if (URIUtils::GetFileName(item->GetPath()) == ".nomedia")
+      {
+        entry.subFolders.clear();
+        files.clear();
+        break;
+      }
+
+      // a file rewritten in place keeps its name and its folder's time, but not its own
+      const CDateTime& dateTime = item->GetDateTime();
+      if (dateTime.IsValid() && dateTime > racyTime)
+        racy = true;
+      files.emplace_back(StringUtils::Format("{}:{}:{}", URIUtils::GetFileName(item->GetPath()),
+                                             item->GetSize(),
+                                             dateTime.IsValid() ? dateTime.GetAsDBDateTime()
+                                                                : ""));
+    }
+    else if (!item->IsParentFolder())
+    {
+      std::string path = item->GetPath();
+      URIUtils::RemoveSlashAtEnd(path);
+      // hidden folders aren't listed to the scanners either
+      if (StringUtils::StartsWith(URIUtils::GetFileName(path), "."))
+        continue;
+      URIUtils::AddSlashAtEnd(path);
+      entry.subFolders.emplace_back(std::move(path));
+    }
+  }
+  std::sort(entry.subFolders.begin(), entry.subFolders.end());
+  std::sort(files.begin(), files.end());
+
+  if (!racy)
+  {
+    entry.time = time;
+
+    CDigest digest{CDigest::Type::MD5};
+    for (const auto& file : files)
+      digest.Update(file + "\n");
+    for (const auto& subFolder : entry.subFolders)
+      digest.Update(subFolder + "\n");
+    entry.fingerprint = digest.Finalize();
+  }
+
+  m_pending[folder] = std::move(entry);
+  return true;
+}
+
+const CDirectoryChangeDetector::Folder* CDirectoryChangeDetector::FindFolder(
+    const std::string& folder) const
+{
+  auto it = m_pending.find(folder);
+  if (it != m_pending.end())
+    return &it->second;
+
+  it = m_folders.find(folder);
+  if (it != m_folders.end())
+    return &it->second;
+
+  return nullptr;
+}
+
+void CDirectoryChangeDetector::RemoveFolder(const std::string& folder)
+{
+  auto it = m_folders.lower_bound(folder);
+  while (it != m_folders.end() && IsInFolder(it->first, folder))
+    it = m_folders.erase(it);
+}
+
+void CDirectoryChangeDetector::Load()
+{
+  // every profile has a store of its own in its database folder
+  const std::string storeFile = CSpecialProtocol::TranslatePath(m_storeFile);
+  if (storeFile == m_loadedFile)
+    return;
+
+#if defined(HAVE_INOTIFY)
+  if (m_journal)
+    m_journal->Close();
+#endif
+  m_folders.clear();
+  m_pending.clear();
+  m_journalChanges.clear();
+  m_loadedFile = storeFile;
+
+  if (!CFile::Exists(m_loadedFile))
+    return;
+
+  std::vector<uint8_t> buffer;
+  CFile file;
+  if (file.LoadFile(m_loadedFile, buffer) <= 0)
+    return;
+
+  CVariant store;
+  if (!CJSONVariantParser::Parse(std::string(buffer.begin(), buffer.end()), store) ||
+      !store.isObject())
+  {
+    CLog::LogF(LOGWARNING, "ignoring invalid store {}", m_loadedFile);
+    return;
+  }
+  if (store["version"].asInteger() != STORE_VERSION)
+  {
+    CLog::LogF(LOGDEBUG, "ignoring store {} of version {}", m_loadedFile,
+               store["version"].asInteger());
+    return;
+  }
+
+  const CVariant& folders = store["folders"];
+  for (auto it = folders.begin_map(); it != folders.end_map(); ++it)
+  {
+    Folder& entry = m_folders[it->first];
+    entry.time = it->second["time"].asInteger();
+    entry.fingerprint = it->second["fingerprint"].asString();
+    const CVariant& subFolders = it->second["subfolders"];
+    for (auto subFolder = subFolders.begin_array(); subFolder != subFolders.end_array();
+         ++subFolder)
+      entry.subFolders.emplace_back(subFolder->asString());
+  }
+
+  CLog::LogF(LOGDEBUG, "loaded {} folders from {}", m_folders.size(), m_loadedFile);
+}
+
+void CDirectoryChangeDetector::Save() const
+{
+  CVariant folders(CVariant::VariantTypeObject);
+  for (const auto& [folder, entry] : m_folders)
+  {
+    CVariant value(CVariant::VariantTypeObject);
+    value["time"] = entry.time;
+    value["fingerprint"] = entry.fingerprint;
+    value["subfolders"] = CVariant(CVariant::VariantTypeArray);
+    for (const auto& subFolder : entry.subFolders)
+      value["subfolders"].push_back(subFolder);
+    folders[folder] = std::move(value);
+  }
+
+  CVariant store(CVariant::VariantTypeObject);
+  store["version"] = STORE_VERSION;
+  store["folders"] = std::move(folders);
+
+  std::string json;
+  if (!CJSONVariantWriter::Write(store, json, true))
+    return;
+
+  // write to a temporary file first so a crash doesn't leave a truncated store
+  const std::string tempFile = m_loadedFile + ".tmp";
+  CFile file;
+  if (!file.OpenForWrite(tempFile, true) ||
+      file.Write(json.data(), json.size()) != static_cast<ssize_t>(json.size()))
+  {
+    CLog::LogF(LOGERROR, "unable to write {}", tempFile);
+    return;
+  }
+  file.Close();
+
+  CFile::Delete(m_loadedFile);
+  if (!CFile::Rename(tempFile, m_loadedFile))
+    CLog::LogF(LOGERROR, "unable to write {}", m_loadedFile);
+}
+
+int64_t CDirectoryChangeDetector::GetFolderTime(const std::string& folder)
+{
+  struct __stat64 st = {};
+  if (CFile::Stat(folder, &st) != 0)
+    return -1;
+
+  // some backends only fill in the creation or status change time
+  if (st.st_mtime != 0)
+    return static_cast<int64_t>(st.st_mtime);
+  return static_cast<int64_t>(st.st_ctime);
+}
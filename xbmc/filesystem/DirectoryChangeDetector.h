@@ -0,0 +1,137 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <set>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace XFILE
+{
+/*!
+ * \brief Finds the folders of a library whose contents changed since the last scan.
+ *
+ * A fingerprint of the names, sizes and modification times of the files and the subfolders of
+ * every folder below the scanned roots is kept in a store which is persisted between runs. A
+ * folder whose listing still has the stored fingerprint hasn't had files added, removed, renamed
+ * or rewritten, so the scanner doesn't need to look into it again. This costs a listing per
+ * folder, but none of the scanner's hashing, tag reading or database lookups. The modification
+ * time of a folder alone isn't relied on, as it doesn't change when a file is rewritten in place
+ * and isn't kept up to date by all network filesystems.
+ *
+ * Where inotify is available, local folders are watched after a scan has been committed, and the
+ * next scan gets the changed folders without touching the disk at all. The watches are dropped
+ * if the kernel loses events or runs out of watches, and the folders are listed instead.
+ *
+ * Folders holding a .nomedia file are skipped by the scanners, so they are not walked into, and
+ * neither are hidden folders.
+ *
+ * The store is kept in the database folder of the profile, and is loaded again when the profile
+ * changes. It has to be reset whenever the library stops matching the folders it has been built
+ * from, e.g. when its database has been emptied, the content of a source has been changed or the
+ * library has been cleaned.
+ */
+class CDirectoryChangeDetector
+{
+public:
+  /*!
+   * \param storeFile the file the folders are persisted in
+   * \param watchLocalFolders whether to watch local folders between scans where supported
+   */
+  explicit CDirectoryChangeDetector(std::string storeFile, bool watchLocalFolders = true);
+  ~CDirectoryChangeDetector();
+
+  CDirectoryChangeDetector(const CDirectoryChangeDetector&) = delete;
+  CDirectoryChangeDetector& operator=(const CDirectoryChangeDetector&) = delete;
+
+  /*!
+   * \brief Find the folders which changed since the last committed scan
+   * \details Roots which can't be reached are skipped, so an offline source isn't reported as
+   * changed. Folders which are new to the store are always reported.
+   * \param roots the folders to look into, including their subfolders
+   * \param changed the folders whose listing changed
+   * \param stop checked between folders, the search is abandoned if it gets set
+   * \return false if the search was stopped
+   */
+  bool GetChangedFolders(const std::set<std::string, std::less<>>& roots,
+                         std::set<std::string>& changed,
+                         const std::atomic<bool>& stop);
+
+  /*!
+   * \brief Get the subfolders of a folder as found by the last call to GetChangedFolders()
+   * \param folder the folder
+   * \param subFolders the subfolders
+   * \return false if the folder is unknown
+   */
+  bool GetSubFolders(const std::string& folder, std::vector<std::string>& subFolders) const;
+
+  /*!
+   * \brief Make the folders found by the last call to GetChangedFolders() the new baseline
+   * \details Call once the changed folders have been scanned.
+   */
+  void CommitChanges();
+
+  /*!
+   * \brief Forget the folders found by the last call to GetChangedFolders()
+   * \details Call if the scan didn't complete, so the next one reports them again.
+   */
+  void DiscardChanges();
+
+  /*!
+   * \brief Report a folder as changed again by the next scan
+   * \details Call if the folder couldn't be scanned completely, e.g. because scraping one of its
+   * items failed, so the next scan retries it.
+   * \param folder the folder
+   */
+  void ForgetFolder(const std::string& folder);
+
+  /*!
+   * \brief Forget everything, the next scan walks all folders
+   */
+  void Reset();
+
+private:
+  struct Folder
+  {
+    int64_t time = 0; //!< modification time, 0 if unknown
+    std::string fingerprint; //!< of the listing, empty if it might still change unnoticed
+    std::vector<std::string> subFolders;
+  };
+  using FolderMap = std::map<std::string, Folder, std::less<>>;
+
+  bool Walk(const std::string& folder,
+            std::set<std::string>& changed,
+            std::set<std::string>& visited,
+            const std::atomic<bool>& stop);
+  bool ListFolder(const std::string& folder, int64_t time);
+  const Folder* FindFolder(const std::string& folder) const;
+  void RemoveFolder(const std::string& folder);
+
+  void Load();
+  void Save() const;
+
+  static int64_t GetFolderTime(const std::string& folder);
+
+  const std::string m_storeFile;
+  mutable CCriticalSection m_critSection;
+  std::string m_loadedFile; //!< the store file of the current profile, as loaded
+  FolderMap m_folders; //!< as of the last committed scan
+  FolderMap m_pending; //!< listed by the current scan
+
+  class CJournal;
+  std::unique_ptr<CJournal> m_journal;
+  std::set<std::string> m_journalChanges; //!< taken from the journal by the current scan
+};
+} // namespace XFILE
@@ -0,0 +1,249 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DirectoryDiskCache.h"
+
+#include "Directory.h"
+#include "DirectoryCache.h"
+#include "File.h"
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "GUIUserMessages.h"
+#include "ServiceBroker.h"
+#include "URL.h"
+#include "guilib/GUIComponent.h"
+#include "guilib/GUIMessage.h"
+#include "guilib/GUIWindowManager.h"
+#include "jobs/JobManager.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
+#include "utils/Archive.h"
+#include "utils/Crc32.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+
+using namespace XFILE;
+
+namespace
+{
+constexpr const char* DIRECTORY_CACHE_PATH = "special://temp/directory_cache/";
+constexpr int DIRECTORY_CACHE_VERSION = 1;
+
+// Maximum number of listings to keep on disk
+constexpr int MAX_PERSISTED_DIRS = 5000;
+// Number of saves after which the number of listings is checked
+constexpr unsigned int PRUNE_INTERVAL = 100;
+
+std::atomic<unsigned int> saveCounter{0};
+
+std::mutex revalidateLock;
+std::set<std::string> revalidating;
+
+std::string getKey(const CURL& url)
+{
+  // the key is stored in the cache file, so it mustn't contain any credentials
+  std::string path = CURL(url.GetWithoutOptions()).GetRedacted();
+  URIUtils::RemoveSlashAtEnd(path);
+  return path;
+}
+} // unnamed namespace
+
+bool CDirectoryDiskCache::IsCacheable(const CURL& url)
+{
+  const auto settingsComponent = CServiceBroker::GetSettingsComponent();
+  if (!settingsComponent || !settingsComponent->GetAdvancedSettings() ||
+      !settingsComponent->GetAdvancedSettings()->m_persistentDirectoryCache)
+    return false;
+
+  // listings of a directory with explicit credentials keep them in the paths of their items
+  if (!url.GetUserName().empty() || !url.GetPassWord().empty())
+    return false;
+
+  return URIUtils::IsNetworkFilesystem(url.Get());
+}
+
+int64_t CDirectoryDiskCache::GetModificationTime(const CURL& url)
+{
+  struct __stat64 st = {};
+  if (CFile::Stat(url, &st) != 0)
+    return -1;
+
+  return static_cast<int64_t>(st.st_mtime);
+}
+
+std::string CDirectoryDiskCache::GetCacheFile(const CURL& url)
+{
+  return StringUtils::Format("{}{:08x}.fi", DIRECTORY_CACHE_PATH,
+                             Crc32::ComputeFromLowerCase(getKey(url)));
+}
+
+bool CDirectoryDiskCache::Load(const CURL& url, int64_t mtime, CFileItemList& items)
+{
+  // a directory which can't be reached is not served from the disk
+  if (mtime < 0)
+    return false;
+
+  const std::string cacheFile = GetCacheFile(url);
+
+  CFile file;
+  if (!file.Open(cacheFile))
+    return false;
+
+  try
+  {
+    CArchive ar(&file, CArchive::load);
+
+    int version = 0;
+    std::string key;
+    long long storedMtime = 0;
+    ar >> version;
+    ar >> key;
+    ar >> storedMtime;
+
+    // the crc of the key may collide, so the key itself has to match as well
+    if (version != DIRECTORY_CACHE_VERSION || key != getKey(url))
+      return false;
+
+    if (mtime != 0 && mtime != storedMtime)
+    {
+      CLog::Log(LOGDEBUG, "CDirectoryDiskCache::{} - <{}> modified, refetching", __FUNCTION__,
+                url.GetRedacted());
+      return false;
+    }
+
+    ar >> items;
+  }
+  catch (const std::out_of_range&)
+  {
+    CLog::Log(LOGERROR, "CDirectoryDiskCache::{} - corrupt archive {}", __FUNCTION__, cacheFile);
+    file.Close();
+    CFile::Delete(cacheFile);
+    items.Clear();
+    return false;
+  }
+
+  return true;
+}
+
+void CDirectoryDiskCache::Save(const CURL& url, int64_t mtime, const CFileItemList& items)
+{
+  if (mtime < 0)
+    return;
+
+  if (!CDirectory::Exists(DIRECTORY_CACHE_PATH) && !CDirectory::Create(DIRECTORY_CACHE_PATH))
+    return;
+
+  CFile file;
+  if (!file.OpenForWrite(GetCacheFile(url), true))
+    return;
+
+  // archiving needs a non const list, but doesn't alter it when storing
+  CFileItemList& list = const_cast<CFileItemList&>(items);
+
+  CArchive ar(&file, CArchive::store);
+  ar << DIRECTORY_CACHE_VERSION;
+  ar << getKey(url);
+  ar << static_cast<long long>(mtime);
+  ar << list;
+  ar.Close();
+  file.Close();
+
+  if (++saveCounter % PRUNE_INTERVAL == 0)
+    Prune();
+}
+
+void CDirectoryDiskCache::Revalidate(const CURL& url, const std::string& path)
+{
+  const std::string key = getKey(url);
+  {
+    std::unique_lock lock(revalidateLock);
+    if (!revalidating.insert(key).second)
+      return;
+  }
+
+  CServiceBroker::GetJobManager()->Submit(
+      [url, path, key]
+      {
+        // fetch the raw listing, bypassing both caches so it ends up here unfiltered
+        const int64_t mtime = GetModificationTime(URIUtils::AddCredentials(url));
+        CFileItemList items;
+        if (mtime >= 0 && CDirectory::GetDirectory(url, items, "",
+                                                   DIR_FLAG_BYPASS_CACHE | DIR_FLAG_NO_FILE_DIRS |
+                                                       DIR_FLAG_GET_HIDDEN))
+        {
+          CFileItemList stored;
+          const bool changed = !Load(url, 0, stored) || HasChanged(stored, items);
+          Save(url, mtime, items);
+
+          if (changed)
+          {
+            CLog::Log(LOGDEBUG, "CDirectoryDiskCache::{} - <{}> changed, updating", __FUNCTION__,
+                      url.GetRedacted());
+            g_directoryCache.ClearDirectory(url);
+
+            auto gui = CServiceBroker::GetGUI();
+            if (gui)
+            {
+              CGUIMessage message(GUI_MSG_NOTIFY_ALL, 0, 0, GUI_MSG_UPDATE_PATH);
+              message.SetStringParam(path);
+              gui->GetWindowManager().SendThreadMessage(message);
+            }
+          }
+        }
+
+        std::unique_lock lock(revalidateLock);
+        revalidating.erase(key);
+      });
+}
+
+bool CDirectoryDiskCache::HasChanged(const CFileItemList& stored, const CFileItemList& current)
+{
+  if (stored.Size() != current.Size())
+    return true;
+
+  std::map<std::string, const CFileItem*, std::less<>> entries;
+  for (const auto& item : stored)
+    entries.emplace(item->GetPath(), item.get());
+
+  for (const auto& item : current)
+  {
+    const auto it = entries.find(item->GetPath());
+    if (it == entries.end())
+      return true;
+
+    const CFileItem& entry = *it->second;
+    if (entry.IsFolder() != item->IsFolder() || entry.GetSize() != item->GetSize() ||
+        entry.GetDateTime() != item->GetDateTime())
+      return true;
+  }
+
+  return false;
+}
+
+void CDirectoryDiskCache::Prune()
+{
+  CFileItemList items;
+  if (!CDirectory::GetDirectory(DIRECTORY_CACHE_PATH, items, ".fi",
+                                DIR_FLAG_NO_FILE_DIRS | DIR_FLAG_BYPASS_CACHE))
+    return;
+
+  if (items.Size() <= MAX_PERSISTED_DIRS)
+    return;
+
+  items.Sort(SortBy::DATE, SortOrder::ASCENDING);
+  for (int i = 0; i < items.Size() - MAX_PERSISTED_DIRS; i++)
+    CFile::Delete(items[i]->GetPath());
+}
@@ -0,0 +1,83 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+
+class CFileItemList;
+class CURL;
+
+namespace XFILE
+{
+/*!
+ * \brief Persistent cache of network directory listings.
+ *
+ * Listings are archived to special://temp/directory_cache/ and survive restarts as well as
+ * CDirectoryCache::Clear(). A listing is stored together with the modification time of the
+ * directory and is only used while it matches. That doesn't catch files rewritten in place, so a
+ * persisted listing is only shown while browsing and is refreshed in the background right away.
+ */
+class CDirectoryDiskCache
+{
+public:
+  /*!
+   * \brief Check whether listings of a directory are persisted
+   * \param url the directory
+   * \return true for directories on network filesystems which aren't accessed with explicit
+   * credentials, false if the cache is disabled (advancedsettings.xml
+   * network/persistentdirectorycache)
+   */
+  static bool IsCacheable(const CURL& url);
+
+  /*!
+   * \brief Get the modification time of a directory from its backend
+   * \param url the directory, including credentials if needed
+   * \return the modification time, 0 if the backend can't supply one, -1 if the stat failed
+   */
+  static int64_t GetModificationTime(const CURL& url);
+
+  /*!
+   * \brief Load a persisted listing
+   * \param url the directory
+   * \param mtime the current modification time of the directory, 0 to skip validation
+   * \param items the list to load the listing into
+   * \return true if a (valid) listing was loaded
+   */
+  static bool Load(const CURL& url, int64_t mtime, CFileItemList& items);
+
+  /*!
+   * \brief Persist a listing
+   * \param url the directory
+   * \param mtime the modification time of the directory the listing was fetched at
+   * \param items the listing
+   */
+  static void Save(const CURL& url, int64_t mtime, const CFileItemList& items);
+
+  /*!
+   * \brief Refresh a persisted listing in the background, the GUI is told to update the path if
+   * the listing changed
+   * \param url the directory
+   * \param path the path the directory was browsed as
+   */
+  static void Revalidate(const CURL& url, const std::string& path);
+
+  /*!
+   * \brief Check whether entries were added, removed or changed in size, date or type
+   * \param stored the persisted listing
+   * \param current the listing just fetched
+   * \return true if the listings differ
+   */
+  static bool HasChanged(const CFileItemList& stored, const CFileItemList& current);
+
+private:
+  static std::string GetCacheFile(const CURL& url);
+  static void Prune();
+};
+} // namespace XFILE
@@ -14,6 +14,7 @@
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "threads/Thread.h"
+#include "utils/URIUtils.h"
 #include "utils/log.h"
 
 #include <mutex>
@@ -135,6 +136,23 @@ bool CFileCache::Open(const CURL& url)
 
   m_fileSize = m_source.GetLength();
 
+  // keep what we read from network sources for the next time the same file is opened
+  m_segmentCacheBudget =
+      static_cast<int64_t>(settings->GetInt(CSettings::SETTING_FILECACHE_PERSISTENTSIZE)) * 1024 *
+      1024;
+  if (m_segmentCacheBudget > 0 && m_seekPossible > 0 && m_fileSize > 0 &&
+      !URIUtils::IsHD(url.Get()))
+  {
+    struct __stat64 st = {};
+    if (CFile::Stat(url, &st) == 0 && st.st_mtime != 0)
+    {
+      m_segmentCache = std::make_unique<CSegmentCache>();
+      if (!m_segmentCache->Open(url.Get(), m_fileSize, st.st_mtime))
+        m_segmentCache.reset();
+    }
+  }
+  m_sourcePos = 0;
+
   if (!m_pCache)
   {
     if (cacheMemSize == 0)
@@ -259,9 +277,15 @@ void CFileCache::Process()
       const bool cacheReachEOF = (cacheMaxPos == m_fileSize);
 
       bool sourceSeekFailed = false;
-      if (!cacheReachEOF)
+      if (!cacheReachEOF && m_segmentCache && m_segmentCache->GetCachedSize(cacheMaxPos) > 0)
+      {
+        // data is served from the segment cache, the source is seeked once a gap is reached
+        m_nSeekResult = cacheMaxPos;
+      }
+      else if (!cacheReachEOF)
       {
         m_nSeekResult = m_source.Seek(cacheMaxPos, SEEK_SET);
+        m_sourcePos = m_nSeekResult;
         if (m_nSeekResult != cacheMaxPos)
         {
           CLog::Log(LOGERROR, "CFileCache::{} - <{}> error {} seeking. Seek returned {}",
@@ -338,7 +362,7 @@ void CFileCache::Process()
 
     ssize_t iRead = 0;
     if (maxSourceRead > 0)
-      iRead = m_source.Read(buffer.get(), maxSourceRead);
+      iRead = ReadSource(buffer.get(), maxSourceRead);
     if (iRead <= 0)
     {
       // Check for actual EOF and retry as long as we still have data in our cache
@@ -444,6 +468,53 @@ void CFileCache::Process()
   }
 }
 
+ssize_t CFileCache::ReadSource(char* buffer, size_t size)
+{
+  if (!m_segmentCache)
+    return m_source.Read(buffer, size);
+
+  const int64_t cached = m_segmentCache->GetCachedSize(m_writePos);
+  if (cached > 0)
+  {
+    const ssize_t iRead = m_segmentCache->Read(m_writePos, buffer, size);
+    if (iRead > 0)
+      return iRead;
+
+    CLog::Log(LOGWARNING, "CFileCache::{} - <{}> segment cache read failed, disabling it",
+              __FUNCTION__, m_sourcePath);
+    m_segmentCache.reset();
+  }
+
+  if (m_sourcePos != m_writePos)
+  {
+    m_sourcePos = m_source.Seek(m_writePos, SEEK_SET);
+    if (m_sourcePos != m_writePos)
+    {
+      CLog::Log(LOGERROR, "CFileCache::{} - <{}> error seeking source to {}", __FUNCTION__,
+                m_sourcePath, m_writePos);
+      return -1;
+    }
+  }
+
+  // only fetch the gap up to the next stored range
+  if (m_segmentCache)
+  {
+    const int64_t next = m_segmentCache->GetNextCachedPosition(m_writePos);
+    if (next > m_writePos)
+      size = static_cast<size_t>(std::min<int64_t>(size, next - m_writePos));
+  }
+
+  const ssize_t iRead = m_source.Read(buffer, size);
+  if (iRead > 0)
+  {
+    if (m_segmentCache)
+      m_segmentCache->Write(m_sourcePos, buffer, iRead);
+    m_sourcePos += iRead;
+  }
+
+  return iRead;
+}
+
 void CFileCache::OnExit()
 {
   m_bStop = true;
@@ -584,6 +655,13 @@ void CFileCache::Close()
     m_pCache->Close();
 
   m_source.Close();
+
+  if (m_segmentCache)
+  {
+    m_segmentCache->Close();
+    m_segmentCache.reset();
+    CSegmentCache::Evict(m_segmentCacheBudget);
+  }
 }
 
 int64_t CFileCache::GetPosition()
@@ -11,6 +11,7 @@
 #include "CacheStrategy.h"
 #include "File.h"
 #include "IFile.h"
+#include "SegmentCache.h"
 #include "threads/CriticalSection.h"
 #include "threads/Thread.h"
 
@@ -58,7 +59,16 @@ namespace XFILE
     }
 
   private:
+    /*!
+     * \brief Read the data at the current write position, from the persistent segment cache
+     * when it is stored there, from the source otherwise
+     */
+    ssize_t ReadSource(char* buffer, size_t size);
+
     std::unique_ptr<CCacheStrategy> m_pCache;
+    std::unique_ptr<CSegmentCache> m_segmentCache;
+    int64_t m_segmentCacheBudget = 0;
+    int64_t m_sourcePos = 0;
     int m_seekPossible = 0;
     CFile m_source;
     std::string m_sourcePath;
@@ -0,0 +1,450 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "SegmentCache.h"
+
+#include "Directory.h"
+#include "File.h"
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "IFile.h"
+#include "SpecialProtocol.h"
+#include "URL.h"
+#include "utils/Digest.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+#if defined(TARGET_POSIX)
+#include "platform/posix/filesystem/PosixFile.h"
+#define CacheLocalFile CPosixFile
+#elif defined(TARGET_WINDOWS)
+#include "platform/win32/filesystem/Win32File.h"
+#define CacheLocalFile CWin32File
+#endif // TARGET_WINDOWS
+
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <mutex>
+#include <set>
+#include <vector>
+
+using namespace XFILE;
+using KODI::UTILITY::CDigest;
+
+namespace
+{
+constexpr const char* SEGMENT_CACHE_PATH = "special://temp/segmentcache/";
+constexpr uint32_t SEGMENT_CACHE_MAGIC = 0x4B534331; // "KSC1"
+
+// save the index at the latest after this many new bytes, so a crash or a second reader of the
+// store doesn't lose what was fetched
+constexpr int64_t INDEX_SAVE_INTERVAL = 8 * 1024 * 1024;
+
+// data files of stores currently opened with the number of users, these are never evicted or
+// truncated. The lock also serialises all access to the index files.
+std::mutex openStoresLock;
+std::map<std::string, int> openStores;
+
+template<typename T>
+void Append(std::string& buffer, T value)
+{
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template<typename T>
+bool Extract(const std::vector<uint8_t>& buffer, size_t& pos, T& value)
+{
+  if (pos + sizeof(value) > buffer.size())
+    return false;
+  std::memcpy(&value, buffer.data() + pos, sizeof(value));
+  pos += sizeof(value);
+  return true;
+}
+
+struct IndexHeader
+{
+  std::string url;
+  int64_t size = 0;
+  int64_t mtime = 0;
+  int64_t lastUsed = 0;
+  std::vector<std::pair<int64_t, int64_t>> ranges;
+};
+
+bool ReadIndex(const std::string& path, IndexHeader& header)
+{
+  std::vector<uint8_t> buffer;
+  CFile file;
+  if (file.LoadFile(path, buffer) <= 0)
+    return false;
+
+  size_t pos = 0;
+  uint32_t magic = 0;
+  uint32_t urlLength = 0;
+  if (!Extract(buffer, pos, magic) || magic != SEGMENT_CACHE_MAGIC ||
+      !Extract(buffer, pos, header.size) || !Extract(buffer, pos, header.mtime) ||
+      !Extract(buffer, pos, header.lastUsed) || !Extract(buffer, pos, urlLength) ||
+      pos + urlLength > buffer.size())
+    return false;
+
+  header.url.assign(reinterpret_cast<const char*>(buffer.data() + pos), urlLength);
+  pos += urlLength;
+
+  uint32_t count = 0;
+  if (!Extract(buffer, pos, count))
+    return false;
+
+  header.ranges.reserve(count);
+  for (uint32_t i = 0; i < count; i++)
+  {
+    int64_t start = 0;
+    int64_t end = 0;
+    if (!Extract(buffer, pos, start) || !Extract(buffer, pos, end) || end <= start)
+      return false;
+    header.ranges.emplace_back(start, end);
+  }
+
+  return true;
+}
+} // unnamed namespace
+
+CSegmentCache::CSegmentCache() = default;
+
+CSegmentCache::~CSegmentCache()
+{
+  Close();
+}
+
+bool CSegmentCache::Open(const std::string& url, int64_t size, int64_t mtime)
+{
+  Close();
+
+  if (!CDirectory::Exists(SEGMENT_CACHE_PATH) && !CDirectory::Create(SEGMENT_CACHE_PATH))
+  {
+    CLog::Log(LOGERROR, "CSegmentCache::{} - failed to create {}", __FUNCTION__,
+              SEGMENT_CACHE_PATH);
+    return false;
+  }
+
+  // only the redacted url is stored, the full one is part of the file name hash
+  m_url = CURL::GetRedacted(url);
+  m_size = size;
+  m_mtime = mtime;
+
+  const std::string name = CDigest::Calculate(CDigest::Type::MD5, url);
+  m_indexPath = URIUtils::AddFileToFolder(SEGMENT_CACHE_PATH, name + ".idx");
+  m_dataPath = CSpecialProtocol::TranslatePath(
+      URIUtils::AddFileToFolder(SEGMENT_CACHE_PATH, name + ".dat"));
+
+  std::unique_lock lock(openStoresLock);
+
+  // a store which doesn't match the current source is discarded, unless someone else reads it
+  const bool inUse = openStores.contains(m_dataPath);
+  const bool valid = LoadIndex() && CFile::Exists(m_dataPath, false);
+  if (!valid)
+  {
+    m_ranges.clear();
+    if (inUse)
+    {
+      CLog::Log(LOGDEBUG, "CSegmentCache::{} - <{}> store is in use for another version",
+                __FUNCTION__, m_url);
+      m_indexPath.clear();
+      m_dataPath.clear();
+      return false;
+    }
+
+    // the old index must not describe the truncated data
+    if (CFile::Exists(m_indexPath, false) && !CFile::Delete(m_indexPath))
+    {
+      CLog::Log(LOGERROR, "CSegmentCache::{} - failed to delete {}", __FUNCTION__, m_indexPath);
+      m_indexPath.clear();
+      m_dataPath.clear();
+      return false;
+    }
+  }
+
+  m_data = std::make_unique<CacheLocalFile>();
+  if (!m_data->OpenForWrite(CURL(m_dataPath), !valid))
+  {
+    CLog::Log(LOGERROR, "CSegmentCache::{} - failed to open {}", __FUNCTION__, m_dataPath);
+    m_data.reset();
+    m_ranges.clear();
+    m_indexPath.clear();
+    m_dataPath.clear();
+    return false;
+  }
+
+  openStores[m_dataPath]++;
+
+  // the index exists as long as the store is open and the store counts as recently used
+  SaveIndex();
+
+  if (!m_ranges.empty())
+    CLog::Log(LOGDEBUG, "CSegmentCache::{} - <{}> {} stored range(s) found", __FUNCTION__, m_url,
+              m_ranges.size());
+
+  return true;
+}
+
+void CSegmentCache::Close()
+{
+  if (m_data)
+  {
+    std::unique_lock lock(openStoresLock);
+
+    if (m_indexDirty)
+      SaveIndex();
+
+    m_data->Close();
+    m_data.reset();
+
+    const auto it = openStores.find(m_dataPath);
+    if (it != openStores.end() && --it->second == 0)
+      openStores.erase(it);
+  }
+
+  m_ranges.clear();
+  m_indexDirty = false;
+  m_unsavedBytes = 0;
+  m_indexPath.clear();
+  m_dataPath.clear();
+}
+
+int64_t CSegmentCache::GetCachedSize(int64_t position) const
+{
+  auto it = m_ranges.upper_bound(position);
+  if (it == m_ranges.begin())
+    return 0;
+
+  --it;
+  if (position >= it->second)
+    return 0;
+
+  return it->second - position;
+}
+
+int64_t CSegmentCache::GetNextCachedPosition(int64_t position) const
+{
+  const auto it = m_ranges.upper_bound(position);
+  if (it == m_ranges.end())
+    return -1;
+
+  return it->first;
+}
+
+ssize_t CSegmentCache::Read(int64_t position, char* buffer, size_t size)
+{
+  if (!m_data)
+    return -1;
+
+  size = static_cast<size_t>(std::min<int64_t>(size, GetCachedSize(position)));
+  if (size == 0)
+    return 0;
+
+  if (m_data->Seek(position, SEEK_SET) != position)
+    return -1;
+
+  return m_data->Read(buffer, size);
+}
+
+bool CSegmentCache::Write(int64_t position, const char* buffer, size_t size)
+{
+  if (!m_data)
+    return false;
+
+  if (m_data->Seek(position, SEEK_SET) != position)
+    return false;
+
+  size_t written = 0;
+  while (written < size)
+  {
+    const ssize_t lastWritten = m_data->Write(buffer + written, size - written);
+    if (lastWritten <= 0)
+    {
+      CLog::Log(LOGWARNING, "CSegmentCache::{} - failed to write to {}", __FUNCTION__,
+                m_dataPath);
+      break;
+    }
+    written += lastWritten;
+  }
+
+  if (written > 0)
+  {
+    // a write filling the gap between two ranges completes a segment
+    const size_t ranges = m_ranges.size();
+    AddRange(position, position + written);
+    m_unsavedBytes += written;
+
+    if (m_ranges.size() < ranges || m_unsavedBytes >= INDEX_SAVE_INTERVAL)
+    {
+      std::unique_lock lock(openStoresLock);
+      SaveIndex();
+    }
+  }
+
+  return written == size;
+}
+
+void CSegmentCache::AddRange(int64_t start, int64_t end)
+{
+  // merge with a range overlapping or touching the start
+  auto it = m_ranges.upper_bound(start);
+  if (it != m_ranges.begin())
+  {
+    auto prev = std::prev(it);
+    if (prev->second >= start)
+    {
+      start = prev->first;
+      end = std::max(end, prev->second);
+      m_ranges.erase(prev);
+    }
+  }
+
+  // swallow all ranges starting before the new end
+  it = m_ranges.lower_bound(start);
+  while (it != m_ranges.end() && it->first <= end)
+  {
+    end = std::max(end, it->second);
+    it = m_ranges.erase(it);
+  }
+
+  m_ranges.emplace(start, end);
+  m_indexDirty = true;
+}
+
+bool CSegmentCache::LoadIndex()
+{
+  m_ranges.clear();
+
+  IndexHeader header;
+  if (!ReadIndex(m_indexPath, header))
+    return false;
+
+  if (header.url != m_url || header.size != m_size || header.mtime != m_mtime)
+  {
+    CLog::Log(LOGDEBUG, "CSegmentCache::{} - <{}> source changed, discarding stored data",
+              __FUNCTION__, m_url);
+    return false;
+  }
+
+  for (const auto& [start, end] : header.ranges)
+    AddRange(start, end);
+
+  return true;
+}
+
+bool CSegmentCache::SaveIndex()
+{
+  // other users of the store may have saved ranges which this one doesn't know yet
+  IndexHeader header;
+  if (ReadIndex(m_indexPath, header) && header.url == m_url && header.size == m_size &&
+      header.mtime == m_mtime)
+  {
+    for (const auto& [start, end] : header.ranges)
+      AddRange(start, end);
+  }
+
+  // the index must never claim data which isn't on disk yet
+  if (m_data)
+    m_data->Flush();
+
+  std::string buffer;
+  buffer.reserve(64 + m_url.size() + m_ranges.size() * 2 * sizeof(int64_t));
+
+  Append(buffer, SEGMENT_CACHE_MAGIC);
+  Append(buffer, m_size);
+  Append(buffer, m_mtime);
+  Append(buffer, static_cast<int64_t>(std::time(nullptr)));
+  Append(buffer, static_cast<uint32_t>(m_url.size()));
+  buffer.append(m_url);
+  Append(buffer, static_cast<uint32_t>(m_ranges.size()));
+  for (const auto& [start, end] : m_ranges)
+  {
+    Append(buffer, start);
+    Append(buffer, end);
+  }
+
+  CFile file;
+  if (!file.OpenForWrite(m_indexPath, true) ||
+      file.Write(buffer.data(), buffer.size()) != static_cast<ssize_t>(buffer.size()))
+  {
+    CLog::Log(LOGWARNING, "CSegmentCache::{} - failed to write {}", __FUNCTION__, m_indexPath);
+    return false;
+  }
+
+  m_indexDirty = false;
+  m_unsavedBytes = 0;
+  return true;
+}
+
+void CSegmentCache::Evict(int64_t budget)
+{
+  CFileItemList items;
+  if (!CDirectory::GetDirectory(SEGMENT_CACHE_PATH, items, ".idx|.dat", DIR_FLAG_NO_FILE_DIRS))
+    return;
+
+  struct Store
+  {
+    std::string index;
+    std::string data;
+    int64_t lastUsed;
+    int64_t stored;
+  };
+  std::vector<Store> stores;
+  std::set<std::string> indexedData;
+
+  for (const auto& item : items)
+  {
+    if (!URIUtils::HasExtension(item->GetPath(), ".idx"))
+      continue;
+
+    Store store{item->GetPath(), URIUtils::ReplaceExtension(item->GetPath(), ".dat"), 0, 0};
+    IndexHeader header;
+    if (ReadIndex(store.index, header))
+    {
+      store.lastUsed = header.lastUsed;
+      for (const auto& [start, end] : header.ranges)
+        store.stored += end - start;
+    }
+    indexedData.insert(store.data);
+    stores.emplace_back(std::move(store));
+  }
+
+  std::unique_lock lock(openStoresLock);
+
+  // data files without index are left overs of an unclean shutdown
+  for (const auto& item : items)
+  {
+    const std::string& path = item->GetPath();
+    if (URIUtils::HasExtension(path, ".dat") && !indexedData.contains(path) &&
+        !openStores.contains(CSpecialProtocol::TranslatePath(path)))
+      CFile::Delete(path);
+  }
+
+  int64_t total = 0;
+  for (const auto& store : stores)
+    total += store.stored;
+
+  std::sort(stores.begin(), stores.end(),
+            [](const Store& a, const Store& b) { return a.lastUsed < b.lastUsed; });
+
+  for (const auto& store : stores)
+  {
+    if (total <= budget)
+      break;
+
+    if (openStores.contains(CSpecialProtocol::TranslatePath(store.data)))
+      continue;
+
+    CLog::Log(LOGDEBUG, "CSegmentCache::{} - evicting {} ({} bytes)", __FUNCTION__, store.index,
+              store.stored);
+    CFile::Delete(store.index);
+    CFile::Delete(store.data);
+    total -= store.stored;
+  }
+}
@@ -0,0 +1,97 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <sys/types.h>
+
+namespace XFILE
+{
+class IFile;
+
+/*!
+ * \brief Persistent on-disk store for byte ranges read from a (network) source.
+ *
+ * Stores live in special://temp/segmentcache/ and survive closing the source, so resuming,
+ * rewinding or replaying a file only has to fetch the ranges that were never read before.
+ * A store consists of a sparse data file holding the bytes at their source offsets and an
+ * index file recording which ranges are valid. The index is keyed by the source url and
+ * invalidated when the source size or modification time changes.
+ *
+ * Several readers of the same source share its store. The index is saved while ranges are
+ * written and merged with the ranges saved by the other readers.
+ */
+class CSegmentCache
+{
+public:
+  CSegmentCache();
+  ~CSegmentCache();
+
+  /*!
+   * \brief Open the store of a source, creating an empty one if needed
+   * \param url the url of the source, the store is looked up by its hash
+   * \param size the current size of the source in bytes
+   * \param mtime the current modification time of the source
+   * \return true on success, false if the store could not be created or is in use for another
+   * size or modification time of the source
+   */
+  bool Open(const std::string& url, int64_t size, int64_t mtime);
+
+  /*!
+   * \brief Write the index and close the store
+   */
+  void Close();
+
+  bool IsOpen() const { return m_data != nullptr; }
+
+  /*!
+   * \brief Get the number of bytes stored contiguously from a position
+   * \param position the source position
+   * \return the number of bytes which can be read from the store, 0 if position is not stored
+   */
+  int64_t GetCachedSize(int64_t position) const;
+
+  /*!
+   * \brief Get the start of the next stored range after a position
+   * \param position the source position
+   * \return the start of the next stored range, -1 if there is none
+   */
+  int64_t GetNextCachedPosition(int64_t position) const;
+
+  ssize_t Read(int64_t position, char* buffer, size_t size);
+  bool Write(int64_t position, const char* buffer, size_t size);
+
+  /*!
+   * \brief Delete least recently used stores until the stored data fits in a budget
+   * \param budget the maximum number of bytes to keep on disk
+   */
+  static void Evict(int64_t budget);
+
+private:
+  bool LoadIndex();
+  //! must be called with the lock of the open stores held
+  bool SaveIndex();
+  void AddRange(int64_t start, int64_t end);
+
+  std::string m_url;
+  int64_t m_size = 0;
+  int64_t m_mtime = 0;
+  std::string m_indexPath;
+  std::string m_dataPath;
+  std::unique_ptr<IFile> m_data;
+  bool m_indexDirty = false;
+  int64_t m_unsavedBytes = 0;
+
+  // stored ranges as start -> end (exclusive), never overlapping or adjacent
+  std::map<int64_t, int64_t> m_ranges;
+};
+} // namespace XFILE
@@ -0,0 +1,231 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/DirectoryChangeDetector.h"
+#include "filesystem/SpecialProtocol.h"
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+
+namespace
+{
+class TestDirectoryChangeDetector : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    const std::filesystem::path temp = CSpecialProtocol::TranslatePath("special://temp/");
+    m_root = (temp / "TestDirectoryChangeDetector").string() + "/";
+    m_store = (temp / "TestDirectoryChangeDetector.json").string();
+    std::filesystem::remove_all(m_root);
+    std::filesystem::remove(m_store);
+    std::filesystem::create_directories(m_root);
+  }
+
+  void TearDown() override
+  {
+    std::filesystem::remove_all(m_root);
+    std::filesystem::remove(m_store);
+  }
+
+  static std::string AddFolder(const std::string& parent, const std::string& name)
+  {
+    const std::string folder = parent + name + "/";
+    std::filesystem::create_directory(folder);
+    return folder;
+  }
+
+  // folders and files modified just before they are looked into are reported until they are older
+  static void Age(const std::vector<std::string>& paths, int hours = 1)
+  {
+    for (const auto& path : paths)
+      std::filesystem::last_write_time(
+          path, std::filesystem::file_time_type::clock::now() - std::chrono::hours(hours));
+  }
+
+  std::set<std::string> GetChangedFolders(CDirectoryChangeDetector& detector) const
+  {
+    std::set<std::string> changed;
+    std::atomic<bool> stop{false};
+    EXPECT_TRUE(detector.GetChangedFolders({m_root}, changed, stop));
+    return changed;
+  }
+
+  std::string m_root;
+  std::string m_store;
+};
+} // namespace
+
+TEST_F(TestDirectoryChangeDetector, FirstScan)
+{
+  const std::string a = AddFolder(m_root, "a");
+  const std::string b = AddFolder(m_root, "b");
+  const std::string c = AddFolder(a, "c");
+  Age({m_root, a, b, c});
+
+  CDirectoryChangeDetector detector(m_store, false);
+  EXPECT_EQ((std::set<std::string>{m_root, a, b, c}), GetChangedFolders(detector));
+  detector.CommitChanges();
+
+  EXPECT_TRUE(GetChangedFolders(detector).empty());
+
+  std::vector<std::string> subFolders;
+  ASSERT_TRUE(detector.GetSubFolders(m_root, subFolders));
+  EXPECT_EQ((std::vector<std::string>{a, b}), subFolders);
+  ASSERT_TRUE(detector.GetSubFolders(c, subFolders));
+  EXPECT_TRUE(subFolders.empty());
+  EXPECT_FALSE(detector.GetSubFolders(m_root + "d/", subFolders));
+}
+
+TEST_F(TestDirectoryChangeDetector, Persisted)
+{
+  const std::string a = AddFolder(m_root, "a");
+  Age({m_root, a});
+
+  {
+    CDirectoryChangeDetector detector(m_store, false);
+    EXPECT_EQ(2u, GetChangedFolders(detector).size());
+    detector.CommitChanges();
+  }
+
+  CDirectoryChangeDetector detector(m_store, false);
+  EXPECT_TRUE(GetChangedFolders(detector).empty());
+}
+
+TEST_F(TestDirectoryChangeDetector, AddedAndRemoved)
+{
+  const std::string a = AddFolder(m_root, "a");
+  const std::string b = AddFolder(m_root, "b");
+  const std::string c = AddFolder(b, "c");
+  Age({m_root, a, b, c});
+
+  CDirectoryChangeDetector detector(m_store, false);
+  GetChangedFolders(detector);
+  detector.CommitChanges();
+
+  // a file added to a, b removed
+  std::ofstream(a + "song.flac").close();
+  std::filesystem::remove_all(b);
+  const std::string d = AddFolder(a, "d");
+  Age({m_root, a, d, a + "song.flac"}, 2);
+
+  EXPECT_EQ((std::set<std::string>{m_root, a, d}), GetChangedFolders(detector));
+  detector.CommitChanges();
+
+  std::vector<std::string> subFolders;
+  ASSERT_TRUE(detector.GetSubFolders(m_root, subFolders));
+  EXPECT_EQ(std::vector<std::string>{a}, subFolders);
+  EXPECT_FALSE(detector.GetSubFolders(b, subFolders));
+  EXPECT_FALSE(detector.GetSubFolders(c, subFolders));
+  EXPECT_TRUE(GetChangedFolders(detector).empty());
+}
+
+TEST_F(TestDirectoryChangeDetector, DiscardChanges)
+{
+  const std::string a = AddFolder(m_root, "a");
+  Age({m_root, a});
+
+  CDirectoryChangeDetector detector(m_store, false);
+  EXPECT_EQ(2u, GetChangedFolders(detector).size());
+  detector.DiscardChanges();
+
+  // the scan didn't complete, so everything is reported again
+  EXPECT_EQ(2u, GetChangedFolders(detector).size());
+}
+
+TEST_F(TestDirectoryChangeDetector, RecentlyModified)
+{
+  const std::string a = AddFolder(m_root, "a");
+  Age({m_root});
+
+  CDirectoryChangeDetector detector(m_store, false);
+  GetChangedFolders(detector);
+  detector.CommitChanges();
+
+  // a might change again within the resolution of its modification time
+  EXPECT_EQ(std::set<std::string>{a}, GetChangedFolders(detector));
+}
+
+TEST_F(TestDirectoryChangeDetector, Offline)
+{
+  const std::string a = AddFolder(m_root, "a");
+  Age({m_root, a});
+
+  CDirectoryChangeDetector detector(m_store, false);
+  GetChangedFolders(detector);
+  detector.CommitChanges();
+
+  std::filesystem::remove_all(m_root);
+  EXPECT_TRUE(GetChangedFolders(detector).empty());
+  detector.CommitChanges();
+
+  // the folders are still known once the source is back
+  std::vector<std::string> subFolders;
+  ASSERT_TRUE(detector.GetSubFolders(m_root, subFolders));
+  EXPECT_EQ(std::vector<std::string>{a}, subFolders);
+}
+
+TEST_F(TestDirectoryChangeDetector, NoMedia)
+{
+  const std::string a = AddFolder(m_root, "a");
+  const std::string b = AddFolder(a, "b");
+  const std::string hidden = AddFolder(m_root, ".hidden");
+  std::ofstream(a + ".nomedia").close();
+  Age({m_root, a, b, hidden});
+
+  CDirectoryChangeDetector detector(m_store, false);
+  EXPECT_EQ((std::set<std::string>{m_root, a}), GetChangedFolders(detector));
+}
+
+TEST_F(TestDirectoryChangeDetector, RewrittenInPlace)
+{
+  const std::string a = AddFolder(m_root, "a");
+  const std::string file = a + "song.flac";
+  std::ofstream(file) << "tags";
+  Age({m_root, a, file});
+
+  CDirectoryChangeDetector detector(m_store, false);
+  GetChangedFolders(detector);
+  detector.CommitChanges();
+
+  // the time of the folder doesn't change when one of its files is rewritten
+  const auto folderTime = std::filesystem::last_write_time(a);
+  std::ofstream(file) << "new tags";
+  Age({file}, 2);
+  std::filesystem::last_write_time(a, folderTime);
+
+  EXPECT_EQ(std::set<std::string>{a}, GetChangedFolders(detector));
+}
+
+TEST_F(TestDirectoryChangeDetector, ForgetFolder)
+{
+  const std::string a = AddFolder(m_root, "a");
+  Age({m_root, a});
+
+  CDirectoryChangeDetector detector(m_store, false);
+  GetChangedFolders(detector);
+  detector.ForgetFolder(a);
+  detector.CommitChanges();
+
+  // a couldn't be scanned, so it's retried
+  EXPECT_EQ(std::set<std::string>{a}, GetChangedFolders(detector));
+  detector.CommitChanges();
+  EXPECT_TRUE(GetChangedFolders(detector).empty());
+
+  detector.Reset();
+  EXPECT_EQ((std::set<std::string>{m_root, a}), GetChangedFolders(detector));
+}
@@ -0,0 +1,104 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "URL.h"
+#include "XBDateTime.h"
+#include "filesystem/DirectoryDiskCache.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+
+namespace
+{
+void AddListing(CFileItemList& items)
+{
+  auto file = std::make_shared<CFileItem>("smb://server/share/movies/movie.mkv", false);
+  file->SetSize(1000);
+  file->SetDateTime(CDateTime(2026, 1, 1, 12, 0, 0));
+  items.Add(file);
+
+  auto folder = std::make_shared<CFileItem>("smb://server/share/movies/extras/", true);
+  folder->SetDateTime(CDateTime(2026, 1, 1, 12, 0, 0));
+  items.Add(folder);
+}
+} // unnamed namespace
+
+TEST(TestDirectoryDiskCache, Modified)
+{
+  const CURL url("smb://server/share/movies/");
+  CFileItemList listing;
+  AddListing(listing);
+  CDirectoryDiskCache::Save(url, 100, listing);
+
+  CFileItemList items;
+  EXPECT_TRUE(CDirectoryDiskCache::Load(url, 100, items));
+  EXPECT_EQ(2, items.Size());
+
+  items.Clear();
+  EXPECT_FALSE(CDirectoryDiskCache::Load(url, 101, items));
+}
+
+TEST(TestDirectoryDiskCache, StatFailed)
+{
+  const CURL url("smb://server/share/movies/");
+  CFileItemList listing;
+  AddListing(listing);
+  CDirectoryDiskCache::Save(url, 100, listing);
+
+  // the share is offline, the persisted listing must not pass as the directory
+  CFileItemList items;
+  EXPECT_FALSE(CDirectoryDiskCache::Load(url, -1, items));
+  EXPECT_EQ(0, items.Size());
+
+  // nothing is persisted for a directory which couldn't be stat'ed
+  const CURL offline("smb://server/offline/");
+  CDirectoryDiskCache::Save(offline, -1, listing);
+  EXPECT_FALSE(CDirectoryDiskCache::Load(offline, 0, items));
+}
+
+TEST(TestDirectoryDiskCache, HasChanged)
+{
+  CFileItemList stored;
+  AddListing(stored);
+  {
+    CFileItemList current;
+    AddListing(current);
+    EXPECT_FALSE(CDirectoryDiskCache::HasChanged(stored, current));
+  }
+
+  // a file rewritten in place doesn't change the mtime of its directory
+  {
+    CFileItemList current;
+    AddListing(current);
+    current[0]->SetSize(2000);
+    EXPECT_TRUE(CDirectoryDiskCache::HasChanged(stored, current));
+  }
+  {
+    CFileItemList current;
+    AddListing(current);
+    current[0]->SetDateTime(CDateTime(2026, 1, 2, 12, 0, 0));
+    EXPECT_TRUE(CDirectoryDiskCache::HasChanged(stored, current));
+  }
+  {
+    CFileItemList current;
+    AddListing(current);
+    current.Add(std::make_shared<CFileItem>("smb://server/share/movies/other.mkv", false));
+    EXPECT_TRUE(CDirectoryDiskCache::HasChanged(stored, current));
+  }
+  {
+    CFileItemList current;
+    AddListing(current);
+    current[1]->SetPath("smb://server/share/movies/renamed/");
+    EXPECT_TRUE(CDirectoryDiskCache::HasChanged(stored, current));
+  }
+}
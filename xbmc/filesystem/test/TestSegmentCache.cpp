@@ -0,0 +1,125 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/SegmentCache.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+
+namespace
+{
+const std::string TEST_URL = "smb://server/share/TestSegmentCache.mkv";
+}
+
+TEST(TestSegmentCache, Ranges)
+{
+  CSegmentCache cache;
+  ASSERT_TRUE(cache.Open(TEST_URL, 1000, 1));
+
+  const std::string data(100, 'a');
+  EXPECT_TRUE(cache.Write(100, data.data(), data.size()));
+  EXPECT_TRUE(cache.Write(300, data.data(), data.size()));
+
+  EXPECT_EQ(0, cache.GetCachedSize(0));
+  EXPECT_EQ(100, cache.GetCachedSize(100));
+  EXPECT_EQ(50, cache.GetCachedSize(150));
+  EXPECT_EQ(0, cache.GetCachedSize(200));
+  EXPECT_EQ(100, cache.GetNextCachedPosition(0));
+  EXPECT_EQ(300, cache.GetNextCachedPosition(150));
+  EXPECT_EQ(-1, cache.GetNextCachedPosition(300));
+
+  // filling the gap merges both ranges
+  EXPECT_TRUE(cache.Write(200, data.data(), data.size()));
+  EXPECT_EQ(300, cache.GetCachedSize(100));
+
+  char buffer[100] = {};
+  EXPECT_EQ(50, cache.Read(350, buffer, sizeof(buffer)));
+  EXPECT_EQ('a', buffer[0]);
+  EXPECT_EQ(0, cache.Read(0, buffer, sizeof(buffer)));
+
+  cache.Close();
+  CSegmentCache::Evict(0);
+}
+
+TEST(TestSegmentCache, Persistence)
+{
+  const std::string data(64, 'b');
+  {
+    CSegmentCache cache;
+    ASSERT_TRUE(cache.Open(TEST_URL, 1000, 1));
+    EXPECT_TRUE(cache.Write(0, data.data(), data.size()));
+  }
+
+  {
+    CSegmentCache cache;
+    ASSERT_TRUE(cache.Open(TEST_URL, 1000, 1));
+    EXPECT_EQ(64, cache.GetCachedSize(0));
+
+    char buffer[64] = {};
+    EXPECT_EQ(64, cache.Read(0, buffer, sizeof(buffer)));
+    EXPECT_EQ(data, std::string(buffer, sizeof(buffer)));
+  }
+
+  // a modified source invalidates the stored data
+  {
+    CSegmentCache cache;
+    ASSERT_TRUE(cache.Open(TEST_URL, 1000, 2));
+    EXPECT_EQ(0, cache.GetCachedSize(0));
+  }
+
+  CSegmentCache::Evict(0);
+
+  CSegmentCache cache;
+  ASSERT_TRUE(cache.Open(TEST_URL, 1000, 2));
+  EXPECT_EQ(0, cache.GetCachedSize(0));
+  cache.Close();
+  CSegmentCache::Evict(0);
+}
+
+TEST(TestSegmentCache, SharedStore)
+{
+  const std::string data(100, 'c');
+  {
+    CSegmentCache first;
+    ASSERT_TRUE(first.Open(TEST_URL, 1000, 3));
+    EXPECT_TRUE(first.Write(0, data.data(), data.size()));
+    EXPECT_TRUE(first.Write(200, data.data(), data.size()));
+
+    // filling the gap completes the segment, so it's indexed before the store is closed
+    EXPECT_TRUE(first.Write(100, data.data(), data.size()));
+
+    CSegmentCache second;
+    ASSERT_TRUE(second.Open(TEST_URL, 1000, 3));
+    EXPECT_EQ(300, second.GetCachedSize(0));
+
+    // another version of the source doesn't truncate the store in use
+    CSegmentCache changed;
+    EXPECT_FALSE(changed.Open(TEST_URL, 1000, 4));
+
+    // closing one user keeps the store of the other
+    second.Close();
+    CSegmentCache::Evict(0);
+
+    char buffer[100] = {};
+    EXPECT_EQ(100, first.Read(200, buffer, sizeof(buffer)));
+    EXPECT_EQ(data, std::string(buffer, sizeof(buffer)));
+    EXPECT_TRUE(first.Write(300, data.data(), data.size()));
+  }
+
+  // the ranges of both users are kept
+  {
+    CSegmentCache cache;
+    ASSERT_TRUE(cache.Open(TEST_URL, 1000, 3));
+    EXPECT_EQ(400, cache.GetCachedSize(0));
+  }
+
+  CSegmentCache::Evict(0);
+}
@@ -300,3 +300,16 @@ bool CAddonsGUIInfo::GetBool(bool& value,
 
   return false;
 }
+
+const std::atomic<unsigned int>* CAddonsGUIInfo::GetBoolChangeCounter(const CGUIInfo& info) const
+{
+  switch (info.GetInfo())
+  {
+    // add-on settings have no change notification, only installed and disabled add-ons do
+    case SYSTEM_HAS_ADDON:
+    case SYSTEM_ADDON_IS_ENABLED:
+      return &CServiceBroker::GetAddonMgr().GetStateChangeCounter();
+    default:
+      return nullptr;
+  }
+}
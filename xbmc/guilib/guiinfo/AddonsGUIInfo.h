@@ -36,6 +36,7 @@ public:
                const CGUIListItem* item,
                int contextWindow,
                const CGUIInfo& info) const override;
+  const std::atomic<unsigned int>* GetBoolChangeCounter(const CGUIInfo& info) const override;
 };
 
 } // namespace KODI::GUILIB::GUIINFO
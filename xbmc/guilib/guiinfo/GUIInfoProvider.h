@@ -31,6 +31,11 @@ public:
     return false;
   }
 
+  const std::atomic<unsigned int>* GetBoolChangeCounter(const CGUIInfo& info) const override
+  {
+    return nullptr;
+  }
+
   void UpdateAVInfo(const AudioStreamInfo& audioInfo,
                     const VideoStreamInfo& videoInfo,
                     const SubtitleStreamInfo& subtitleInfo) override
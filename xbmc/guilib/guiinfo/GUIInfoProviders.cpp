@@ -124,6 +124,18 @@ bool CGUIInfoProviders::GetBool(bool& value,
   return false;
 }
 
+const std::atomic<unsigned int>* CGUIInfoProviders::GetBoolChangeCounter(
+    const CGUIInfo& info) const
+{
+  for (const auto& provider : m_providers)
+  {
+    const std::atomic<unsigned int>* counter = provider->GetBoolChangeCounter(info);
+    if (counter)
+      return counter;
+  }
+  return nullptr;
+}
+
 void CGUIInfoProviders::UpdateAVInfo(const AudioStreamInfo& audioInfo,
                                      const VideoStreamInfo& videoInfo,
                                      const SubtitleStreamInfo& subtitleInfo) const
@@ -21,6 +21,7 @@
 #include "guilib/guiinfo/VisualisationGUIInfo.h"
 #include "guilib/guiinfo/WeatherGUIInfo.h"
 
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -100,6 +101,14 @@ public:
                int contextWindow,
                const CGUIInfo& info) const;
 
+  /*!
+   * @brief Get the change counter of a GUIInfoManager bool value from the registered providers.
+   * @param info The GUI info (label id + additional data).
+   * @return The change counter, or nullptr if none of the providers can signal changes of the
+   * value.
+   */
+  const std::atomic<unsigned int>* GetBoolChangeCounter(const CGUIInfo& info) const;
+
   /*!
    * @brief Set new audio/video/subtitle stream info data at all registered providers.
    * @param audioInfo New audio stream info.
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <string>
 
 class CFileItem;
@@ -90,6 +91,16 @@ public:
                        int contextWindow,
                        const CGUIInfo& info) const = 0;
 
+  /*!
+   * @brief Get the change counter of a GUIInfoManager bool value.
+   * @param info The GUI info (label id + additional data).
+   * @return A counter which is increased whenever the value may have changed, or nullptr if the
+   * value may change at any time and has to be evaluated every frame.
+   * @note Values whose evaluation has side effects, like the weather info starting a refresh,
+   * must return nullptr as they wouldn't be evaluated while the counter is unchanged.
+   */
+  virtual const std::atomic<unsigned int>* GetBoolChangeCounter(const CGUIInfo& info) const = 0;
+
   /*!
    * @brief Set new audio/video stream info data.
    * @param audioInfo New audio stream info.
@@ -15,6 +15,7 @@
 #include "filesystem/Directory.h"
 #include "guilib/guiinfo/GUIInfo.h"
 #include "guilib/guiinfo/GUIInfoLabels.h"
+#include "media/MediaType.h"
 #include "music/MusicDatabase.h"
 #include "music/MusicLibraryQueue.h"
 #include "profiles/ProfileManager.h"
@@ -25,6 +26,8 @@
 #include "video/VideoDatabase.h"
 #include "video/VideoLibraryQueue.h"
 
+#include <map>
+
 using namespace KODI::GUILIB::GUIINFO;
 
 CLibraryGUIInfo::CLibraryGUIInfo()
@@ -68,8 +71,9 @@ void CLibraryGUIInfo::SetLibraryBool(int condition, bool value)
       m_libraryHasBoxsets = value ? 1 : 0;
       break;
     default:
-      break;
+      return;
   }
+  ++m_libraryBoolsChanged;
 }
 
 void CLibraryGUIInfo::ResetLibraryBools()
@@ -83,6 +87,63 @@ void CLibraryGUIInfo::ResetLibraryBools()
   m_libraryHasCompilations = -1;
   m_libraryHasBoxsets = -1;
   m_libraryRoleCounts.clear();
+  ++m_libraryBoolsChanged;
+}
+
+void CLibraryGUIInfo::FetchMusicLibraryBools() const
+{
+  // all of them at once, from the counts kept by the database
+  CMusicDatabase db;
+  if (db.Open())
+  {
+    CMusicDatabase::LibraryStats stats;
+    if (db.GetLibraryStats(stats))
+    {
+      m_libraryHasMusic = (stats.songs > 0) ? 1 : 0;
+      m_libraryHasSingles = (stats.singles > 0) ? 1 : 0;
+      m_libraryHasCompilations = (stats.compilations > 0) ? 1 : 0;
+      m_libraryHasBoxsets = (stats.boxsets > 0) ? 1 : 0;
+    }
+    db.Close();
+  }
+}
+
+void CLibraryGUIInfo::FetchVideoLibraryBools() const
+{
+  // all of them at once, from the counts kept by the database
+  CVideoDatabase db;
+  if (db.Open())
+  {
+    std::map<std::string, CVideoDatabase::LibraryStats, std::less<>> stats;
+    if (db.GetLibraryStats(stats))
+    {
+      m_libraryHasMovies = (stats[MediaTypeMovie].total > 0) ? 1 : 0;
+      m_libraryHasTVShows = (stats[MediaTypeTvShow].total > 0) ? 1 : 0;
+      m_libraryHasMusicVideos = (stats[MediaTypeMusicVideo].total > 0) ? 1 : 0;
+    }
+    db.Close();
+  }
+}
+
+const std::atomic<unsigned int>* CLibraryGUIInfo::GetBoolChangeCounter(const CGUIInfo& info) const
+{
+  switch (info.GetInfo())
+  {
+    // values cached by this provider, changed via SetLibraryBool and ResetLibraryBools only
+    case LIBRARY_HAS_MUSIC:
+    case LIBRARY_HAS_MOVIES:
+    case LIBRARY_HAS_MOVIE_SETS:
+    case LIBRARY_HAS_TVSHOWS:
+    case LIBRARY_HAS_MUSICVIDEOS:
+    case LIBRARY_HAS_SINGLES:
+    case LIBRARY_HAS_COMPILATIONS:
+    case LIBRARY_HAS_BOXSETS:
+    case LIBRARY_HAS_VIDEO:
+    case LIBRARY_HAS_ROLE:
+      return &m_libraryBoolsChanged;
+    default:
+      return nullptr;
+  }
 }
 
 bool CLibraryGUIInfo::InitCurrentItem(CFileItem* item)
@@ -120,28 +181,18 @@ bool CLibraryGUIInfo::GetBool(bool& value,
     case LIBRARY_HAS_MUSIC:
     {
       if (m_libraryHasMusic < 0)
-      { // query
-        CMusicDatabase db;
-        if (db.Open())
-        {
-          m_libraryHasMusic = (db.GetSongsCount() > 0) ? 1 : 0;
-          db.Close();
-        }
-      }
+        FetchMusicLibraryBools();
+      if (m_libraryHasMusic < 0)
+        ++m_libraryBoolsChanged; // query failed, retry next frame
       value = m_libraryHasMusic > 0;
       return true;
     }
     case LIBRARY_HAS_MOVIES:
     {
       if (m_libraryHasMovies < 0)
-      {
-        CVideoDatabase db;
-        if (db.Open())
-        {
-          m_libraryHasMovies = db.HasContent(VideoDbContentType::MOVIES) ? 1 : 0;
-          db.Close();
-        }
-      }
+        FetchVideoLibraryBools();
+      if (m_libraryHasMovies < 0)
+        ++m_libraryBoolsChanged; // query failed, retry next frame
       value = m_libraryHasMovies > 0;
       return true;
     }
@@ -156,76 +207,53 @@ bool CLibraryGUIInfo::GetBool(bool& value,
           db.Close();
         }
       }
+      if (m_libraryHasMovieSets < 0)
+        ++m_libraryBoolsChanged; // query failed, retry next frame
       value = m_libraryHasMovieSets > 0;
       return true;
     }
     case LIBRARY_HAS_TVSHOWS:
     {
       if (m_libraryHasTVShows < 0)
-      {
-        CVideoDatabase db;
-        if (db.Open())
-        {
-          m_libraryHasTVShows = db.HasContent(VideoDbContentType::TVSHOWS) ? 1 : 0;
-          db.Close();
-        }
-      }
+        FetchVideoLibraryBools();
+      if (m_libraryHasTVShows < 0)
+        ++m_libraryBoolsChanged; // query failed, retry next frame
       value = m_libraryHasTVShows > 0;
       return true;
     }
     case LIBRARY_HAS_MUSICVIDEOS:
     {
       if (m_libraryHasMusicVideos < 0)
-      {
-        CVideoDatabase db;
-        if (db.Open())
-        {
-          m_libraryHasMusicVideos = db.HasContent(VideoDbContentType::MUSICVIDEOS) ? 1 : 0;
-          db.Close();
-        }
-      }
+        FetchVideoLibraryBools();
+      if (m_libraryHasMusicVideos < 0)
+        ++m_libraryBoolsChanged; // query failed, retry next frame
       value = m_libraryHasMusicVideos > 0;
       return true;
     }
     case LIBRARY_HAS_SINGLES:
     {
       if (m_libraryHasSingles < 0)
-      {
-        CMusicDatabase db;
-        if (db.Open())
-        {
-          m_libraryHasSingles = (db.GetSinglesCount() > 0) ? 1 : 0;
-          db.Close();
-        }
-      }
+        FetchMusicLibraryBools();
+      if (m_libraryHasSingles < 0)
+        ++m_libraryBoolsChanged; // query failed, retry next frame
       value = m_libraryHasSingles > 0;
       return true;
     }
     case LIBRARY_HAS_COMPILATIONS:
     {
       if (m_libraryHasCompilations < 0)
-      {
-        CMusicDatabase db;
-        if (db.Open())
-        {
-          m_libraryHasCompilations = (db.GetCompilationAlbumsCount() > 0) ? 1 : 0;
-          db.Close();
-        }
-      }
+        FetchMusicLibraryBools();
+      if (m_libraryHasCompilations < 0)
+        ++m_libraryBoolsChanged; // query failed, retry next frame
       value = m_libraryHasCompilations > 0;
       return true;
     }
     case LIBRARY_HAS_BOXSETS:
     {
       if (m_libraryHasBoxsets < 0)
-      {
-        CMusicDatabase db;
-        if (db.Open())
-        {
-          m_libraryHasBoxsets = (db.GetBoxsetsCount() > 0) ? 1 : 0;
-          db.Close();
-        }
-      }
+        FetchMusicLibraryBools();
+      if (m_libraryHasBoxsets < 0)
+        ++m_libraryBoolsChanged; // query failed, retry next frame
       value = m_libraryHasBoxsets > 0;
       return true;
     }
@@ -259,6 +287,8 @@ bool CLibraryGUIInfo::GetBool(bool& value,
           m_libraryRoleCounts.emplace_back(strRole, artistcount);
         }
       }
+      if (artistcount < 0)
+        ++m_libraryBoolsChanged; // query failed, retry next frame
       value = artistcount > 0;
       return true;
     }
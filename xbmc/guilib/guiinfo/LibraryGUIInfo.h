@@ -10,6 +10,7 @@
 
 #include "guilib/guiinfo/GUIInfoProvider.h"
 
+#include <atomic>
 #include <string>
 #include <utility>
 #include <vector>
@@ -40,12 +41,16 @@ public:
                const CGUIListItem* item,
                int contextWindow,
                const CGUIInfo& info) const override;
+  const std::atomic<unsigned int>* GetBoolChangeCounter(const CGUIInfo& info) const override;
 
   bool GetLibraryBool(int condition) const;
   void SetLibraryBool(int condition, bool value);
   void ResetLibraryBools();
 
 private:
+  void FetchMusicLibraryBools() const;
+  void FetchVideoLibraryBools() const;
+
   mutable int m_libraryHasMusic;
   mutable int m_libraryHasMovies;
   mutable int m_libraryHasTVShows;
@@ -58,6 +63,9 @@ private:
   //Count of artists in music library contributing to song by role e.g. composers, conductors etc.
   //For checking visibility of custom nodes for a role.
   mutable std::vector<std::pair<std::string, int>> m_libraryRoleCounts;
+
+  // Increased whenever one of the values above changes
+  mutable std::atomic<unsigned int> m_libraryBoolsChanged{0};
 };
 
 } // namespace KODI::GUILIB::GUIINFO
@@ -711,3 +711,25 @@ bool CSystemGUIInfo::GetBool(bool& value,
 
   return false;
 }
+
+const std::atomic<unsigned int>* CSystemGUIInfo::GetBoolChangeCounter(const CGUIInfo& info) const
+{
+  switch (info.GetInfo())
+  {
+    case SYSTEM_ALWAYS_TRUE:
+    case SYSTEM_ALWAYS_FALSE:
+    case SYSTEM_ETHERNET_LINK_ACTIVE:
+    case SYSTEM_PLATFORM_LINUX:
+    case SYSTEM_PLATFORM_WINDOWS:
+    case SYSTEM_PLATFORM_UWP:
+    case SYSTEM_PLATFORM_DARWIN:
+    case SYSTEM_PLATFORM_DARWIN_OSX:
+    case SYSTEM_PLATFORM_DARWIN_IOS:
+    case SYSTEM_PLATFORM_DARWIN_TVOS:
+    case SYSTEM_PLATFORM_ANDROID:
+    case SYSTEM_PLATFORM_WEBOS:
+      return &m_constant;
+    default:
+      return nullptr;
+  }
+}
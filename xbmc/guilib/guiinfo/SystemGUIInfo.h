@@ -12,6 +12,7 @@
 #include "utils/GpuInfo.h"
 #include "utils/Temperature.h"
 
+#include <atomic>
 #include <memory>
 
 namespace KODI::GUILIB::GUIINFO
@@ -40,6 +41,7 @@ public:
                const CGUIListItem* item,
                int contextWindow,
                const CGUIInfo& info) const override;
+  const std::atomic<unsigned int>* GetBoolChangeCounter(const CGUIInfo& info) const override;
 
   float GetFPS() const { return m_fps; }
   void UpdateFPS();
@@ -58,6 +60,9 @@ private:
   float m_fps = 0.0;
   unsigned int m_frameCounter = 0;
   unsigned int m_lastFPSTime = 0;
+
+  // Change counter of values which never change
+  const std::atomic<unsigned int> m_constant{0};
 };
 
 } // namespace KODI::GUILIB::GUIINFO
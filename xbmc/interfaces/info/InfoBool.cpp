@@ -17,4 +17,51 @@ InfoBool::InfoBool(const std::string& expression, int context, unsigned int& ref
 {
   StringUtils::ToLower(m_expression);
 }
+
+void InfoBool::AddDependency(const std::atomic<unsigned int>* counter)
+{
+  if (!counter)
+  {
+    m_untracked = true;
+    m_tracked = false;
+    m_dependencies.clear();
+    return;
+  }
+  if (m_untracked)
+    return;
+
+  for (const auto& dependency : m_dependencies)
+  {
+    if (dependency.counter == counter)
+      return;
+  }
+  m_dependencies.push_back({counter, counter->load()});
+  m_tracked = true;
+}
+
+void InfoBool::AddDependencies(const InfoBool& info)
+{
+  if (!info.m_tracked)
+  {
+    AddDependency(nullptr);
+    return;
+  }
+  for (const auto& dependency : info.m_dependencies)
+    AddDependency(dependency.counter);
+}
+
+bool InfoBool::DependenciesChanged()
+{
+  bool changed = false;
+  for (auto& dependency : m_dependencies)
+  {
+    const unsigned int current = dependency.counter->load();
+    if (current != dependency.seen)
+    {
+      dependency.seen = current;
+      changed = true;
+    }
+  }
+  return changed;
+}
 }
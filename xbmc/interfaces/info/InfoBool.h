@@ -8,8 +8,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
+#include <vector>
 
 class CGUIListItem;
 class CGUIInfoManager;
@@ -39,7 +41,8 @@ public:
       Update(contextWindow, item);
     else if (m_refreshCounter != m_parentRefreshCounter || m_refreshCounter == 0)
     {
-      Update(contextWindow, nullptr);
+      if (!m_tracked || DependenciesChanged() || m_refreshCounter == 0)
+        Update(contextWindow, nullptr);
       m_refreshCounter = m_parentRefreshCounter;
     }
     return m_value;
@@ -68,16 +71,44 @@ public:
 
   const std::string &GetExpression() const { return m_expression; }
   bool ListItemDependent() const { return m_listItemDependent; }
+
+  /*! \brief Check whether the value is only re-evaluated when a dependency signals a change
+   If false, the value is re-evaluated every frame.
+   */
+  bool IsTracked() const { return m_tracked; }
+
 protected:
+  /*! \brief Change counter of an info provider the value depends on
+   */
+  struct Dependency
+  {
+    const std::atomic<unsigned int>* counter;
+    unsigned int seen;
+  };
+
+  /*! \brief Make the value depend on the given change counter
+   \param counter the change counter, nullptr if the value may change at any time
+   */
+  void AddDependency(const std::atomic<unsigned int>* counter);
+
+  /*! \brief Make the value depend on everything the given info bool depends on
+   */
+  void AddDependencies(const InfoBool& info);
+
   bool m_value = false; ///< current value
   int m_context;               ///< contextual information to go with the condition
   bool m_listItemDependent = false; ///< do not cache if a listitem pointer is given
+  bool m_tracked = false; ///< only re-evaluate if one of m_dependencies changed
   std::string  m_expression;   ///< original expression
   CGUIInfoManager* m_infoMgr;
 
 private:
+  bool DependenciesChanged();
+
   unsigned int m_refreshCounter = 0;
   unsigned int &m_parentRefreshCounter;
+  std::vector<Dependency> m_dependencies;
+  bool m_untracked = false; ///< depends on something which can't signal changes
 };
 
 typedef std::shared_ptr<InfoBool> InfoPtr;
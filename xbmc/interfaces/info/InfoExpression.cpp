@@ -11,9 +11,11 @@
 #include "GUIInfoManager.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <list>
 #include <memory>
 #include <stack>
+#include <vector>
 
 using namespace INFO;
 
@@ -21,6 +23,7 @@ void InfoSingle::Initialize(CGUIInfoManager* infoMgr)
 {
   InfoBool::Initialize(infoMgr);
   m_condition = m_infoMgr->TranslateSingleString(m_expression, m_listItemDependent);
+  AddDependency(m_listItemDependent ? nullptr : m_infoMgr->GetBoolChangeCounter(m_condition));
 }
 
 void InfoSingle::Update(int contextWindow, const CGUIListItem* item)
@@ -37,7 +40,10 @@ void InfoExpression::Initialize(CGUIInfoManager* infoMgr)
   if (!Parse(m_expression))
   {
     CLog::Log(LOGERROR, "Error parsing boolean expression {}", m_expression);
-    m_expression_tree = std::make_shared<InfoLeaf>(m_infoMgr->Register("false", 0), false);
+    std::stack<InfoSubexpressionPtr> nodes;
+    m_leaves.clear();
+    AddLeaf(m_infoMgr->Register("false", 0), false, nodes);
+    Compile(nodes.top());
   }
 }
 
@@ -46,17 +52,34 @@ void InfoExpression::Update(int contextWindow, const CGUIListItem* item)
   // use propagated context in case this info expression has the default context (i.e. if not tied to a specific window)
   // its value might depend on the context in which the evaluation was called
   int context = m_context == DEFAULT_CONTEXT ? contextWindow : m_context;
-  m_value = m_expression_tree->Evaluate(context, item);
+
+  bool result = false;
+  const size_t size = m_program.size();
+  for (size_t pc = 0; pc < size;)
+  {
+    const Instruction& instruction = m_program[pc];
+    if (instruction.info)
+    {
+      result = instruction.value ^ instruction.info->Get(context, item);
+      pc++;
+    }
+    else if (result == instruction.value)
+      pc = instruction.target;
+    else
+      pc++;
+  }
+  m_value = result;
 }
 
 /* Expressions are rewritten at parse time into a form which favours the
- * formation of groups of associative nodes. These groups are then reordered at
- * evaluation time such that nodes whose value renders the evaluation of the
- * remainder of the group unnecessary tend to be evaluated first (these are
- * true nodes for OR subexpressions, or false nodes for AND subexpressions).
- * The end effect is to minimise the number of leaf nodes that need to be
- * evaluated in order to determine the value of the expression. The runtime
- * adaptability has the advantage of not being customised for any particular skin.
+ * formation of groups of associative nodes. The resulting tree is compiled into
+ * a flat program of leaf evaluations and conditional jumps, where each group
+ * stops evaluating its children as soon as one of them renders the evaluation
+ * of the remainder unnecessary (a true node for OR subexpressions, or a false
+ * node for AND subexpressions). Within a group, children which only change when
+ * an info provider signals it are evaluated first, as their values are cached
+ * across frames. The end effect is to minimise the number of leaf nodes that
+ * need to be evaluated in order to determine the value of the expression.
  *
  * The modifications to the expression at parse time fall into two groups:
  * 1) Moving logical NOTs so that they are only applied to leaf nodes.
@@ -67,9 +90,9 @@ void InfoExpression::Update(int contextWindow, const CGUIListItem* item)
  *    operations. So [A|B]|[C|D+[[E|F]|G] becomes A|B|C|[D+[E|F|G]].
  */
 
-bool InfoExpression::InfoLeaf::Evaluate(int contextWindow, const CGUIListItem* item)
+void InfoExpression::InfoLeaf::Compile(std::vector<Instruction>& program) const
 {
-  return m_invert ^ m_info->Get(contextWindow, item);
+  program.push_back({m_info.get(), m_invert, 0});
 }
 
 InfoExpression::InfoAssociativeGroup::InfoAssociativeGroup(
@@ -92,27 +115,67 @@ void InfoExpression::InfoAssociativeGroup::Merge(const std::shared_ptr<InfoAssoc
   m_children.splice(m_children.end(), other->m_children);
 }
 
-bool InfoExpression::InfoAssociativeGroup::Evaluate(int contextWindow, const CGUIListItem* item)
+bool InfoExpression::InfoAssociativeGroup::IsTracked() const
+{
+  return std::all_of(m_children.begin(), m_children.end(),
+                     [](const InfoSubexpressionPtr& child) { return child->IsTracked(); });
+}
+
+void InfoExpression::InfoAssociativeGroup::Compile(std::vector<Instruction>& program) const
+{
+  /* Each child but the last is followed by a jump to the end of the group, taken
+   * if its value decides the group: true for OR, false for AND.
+   */
+  std::vector<InfoSubexpressionPtr> children(m_children.begin(), m_children.end());
+  std::stable_partition(children.begin(), children.end(),
+                        [](const InfoSubexpressionPtr& child) { return child->IsTracked(); });
+
+  const bool decisive = (m_type == NODE_OR);
+  std::vector<size_t> jumps;
+  for (size_t i = 0; i + 1 < children.size(); i++)
+  {
+    children[i]->Compile(program);
+    jumps.push_back(program.size());
+    program.push_back({nullptr, decisive, 0});
+  }
+  children.back()->Compile(program);
+
+  for (const size_t jump : jumps)
+    program[jump].target = static_cast<unsigned int>(program.size());
+}
+
+void InfoExpression::Compile(const InfoSubexpressionPtr& tree)
 {
-  /* Handle either AND or OR by using the relation
-   * A AND B == !(!A OR !B)
-   * to convert ANDs into ORs
+  m_program.clear();
+  tree->Compile(m_program);
+
+  /* Thread jumps landing on another jump: the result register is unchanged at the
+   * target, so a jump on the same value is always taken and one on the other value
+   * never is.
    */
-  std::list<InfoSubexpressionPtr>::iterator last = m_children.end();
-  std::list<InfoSubexpressionPtr>::iterator it = m_children.begin();
-  bool use_and = (m_type == NODE_AND);
-  bool result = use_and ^ (*it)->Evaluate(contextWindow, item);
-  while (!result && ++it != last)
+  for (auto& instruction : m_program)
   {
-    result = use_and ^ (*it)->Evaluate(contextWindow, item);
-    if (result)
+    if (instruction.info)
+      continue;
+    while (instruction.target < m_program.size() && !m_program[instruction.target].info)
     {
-      /* Move this child to the head of the list so we evaluate faster next time */
-      m_children.push_front(*it);
-      m_children.erase(it);
+      const Instruction& next = m_program[instruction.target];
+      instruction.target = next.value == instruction.value ? next.target : instruction.target + 1;
     }
   }
-  return use_and ^ result;
+
+  for (const auto& leaf : m_leaves)
+    AddDependencies(*leaf);
+}
+
+void InfoExpression::AddLeaf(const InfoPtr& info,
+                             bool invert,
+                             std::stack<InfoSubexpressionPtr>& nodes)
+{
+  /* Propagate any listItem dependency from the operand to the expression */
+  m_listItemDependent |= info->ListItemDependent();
+  m_leaves.push_back(info);
+  nodes.push(std::make_shared<InfoLeaf>(info, invert));
 }
 
 /* Expressions are parsed using the shunting-yard algorithm. Binary operators
@@ -245,9 +308,7 @@ bool InfoExpression::Parse(const std::string &expression)
           CLog::Log(LOGERROR, "Bad operand '{}'", operand);
           return false;
         }
-        /* Propagate any listItem dependency from the operand to the expression */
-        m_listItemDependent |= info->ListItemDependent();
-        nodes.push(std::make_shared<InfoLeaf>(info, invert));
+        AddLeaf(info, invert, nodes);
         /* Reuse operand string for next operand */
         operand.clear();
       }
@@ -296,13 +357,11 @@ bool InfoExpression::Parse(const std::string &expression)
       CLog::Log(LOGERROR, "Bad operand '{}'", operand);
       return false;
     }
-    /* Propagate any listItem dependency from the operand to the expression */
-    m_listItemDependent |= info->ListItemDependent();
-    nodes.push(std::make_shared<InfoLeaf>(info, invert));
+    AddLeaf(info, invert, nodes);
   }
   while (!operator_stack.empty())
     OperatorPop(operator_stack, invert, nodes);
 
-  m_expression_tree = nodes.top();
+  Compile(nodes.top());
   return true;
 }
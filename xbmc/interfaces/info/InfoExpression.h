@@ -69,12 +69,22 @@ private:
     NODE_OR,
   } node_type_t;
 
+  // An instruction of the compiled expression. Either evaluates a leaf into the result
+  // register, or jumps to target if the result register equals value.
+  struct Instruction
+  {
+    InfoBool* info; ///< leaf to evaluate, nullptr for a jump
+    bool value; ///< inverts the leaf, or the result value which triggers the jump
+    unsigned int target; ///< jump target
+  };
+
   // An abstract base class for nodes in the expression tree
   class InfoSubexpression
   {
   public:
     virtual ~InfoSubexpression(void) = default; // so we can destruct derived classes using a pointer to their base class
-    virtual bool Evaluate(int contextWindow, const CGUIListItem* item) = 0;
+    virtual void Compile(std::vector<Instruction>& program) const = 0;
+    virtual bool IsTracked() const = 0;
     virtual node_type_t Type() const=0;
   };
 
@@ -85,7 +95,8 @@ private:
   {
   public:
     InfoLeaf(InfoPtr info, bool invert) : m_info(std::move(info)), m_invert(invert) {}
-    bool Evaluate(int contextWindow, const CGUIListItem* item) override;
+    void Compile(std::vector<Instruction>& program) const override;
+    bool IsTracked() const override { return m_info->IsTracked(); }
     node_type_t Type() const override { return NODE_LEAF; }
 
   private:
@@ -100,7 +111,8 @@ private:
     InfoAssociativeGroup(node_type_t type, const InfoSubexpressionPtr &left, const InfoSubexpressionPtr &right);
     void AddChild(const InfoSubexpressionPtr &child);
     void Merge(const std::shared_ptr<InfoAssociativeGroup>& other);
-    bool Evaluate(int contextWindow, const CGUIListItem* item) override;
+    void Compile(std::vector<Instruction>& program) const override;
+    bool IsTracked() const override;
     node_type_t Type() const override { return m_type; }
 
   private:
@@ -111,7 +123,11 @@ private:
   static operator_t GetOperator(char ch);
   static void OperatorPop(std::stack<operator_t> &operator_stack, bool &invert, std::stack<InfoSubexpressionPtr> &nodes);
   bool Parse(const std::string &expression);
-  InfoSubexpressionPtr m_expression_tree;
+  void AddLeaf(const InfoPtr& info, bool invert, std::stack<InfoSubexpressionPtr>& nodes);
+  void Compile(const InfoSubexpressionPtr& tree);
+
+  std::vector<Instruction> m_program; ///< compiled expression
+  std::vector<InfoPtr> m_leaves; ///< keeps the infos referenced by m_program alive
 };
 
 };
@@ -10,6 +10,7 @@
 
 #include "FileItem.h"
 #include "FileItemList.h"
+#include "ResponseStream.h"
 #include "ServiceBroker.h"
 #include "Util.h"
 #include "filesystem/Directory.h"
@@ -31,6 +32,7 @@
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
 
+#include <functional>
 #include <memory>
 
 using namespace MUSIC_INFO;
@@ -412,76 +414,100 @@ JSONRPC_STATUS CAudioLibrary::GetSongs(const std::string &method, ITransportLaye
       fields.insert(field->asString());
   }
 
-  if (!musicdatabase.GetSongsByWhereJSON(fields, musicUrl.ToString(), result, total, sorting))
-    return InternalError;
+  bool bFetchArt = fields.contains("art");
+  bool bFetchFanart = fields.contains("fanart");
+  bool bFetchThumb = fields.contains("thumbnail");
+  std::unique_ptr<CThumbLoader> thumbLoader;
+  if (bFetchArt || bFetchFanart || bFetchThumb)
+  {
+    thumbLoader = std::make_unique<CMusicThumbLoader>();
+    thumbLoader->OnLoaderStart();
+  }
 
-  if (!result.isNull())
+  const auto fillArt = [&](CVariant& song)
   {
-    bool bFetchArt = fields.contains("art");
-    bool bFetchFanart = fields.contains("fanart");
-    bool bFetchThumb = fields.contains("thumbnail");
-    if (bFetchArt || bFetchFanart || bFetchThumb)
+    CFileItem item;
+    // Only needs song and album id (if we have it) set to get art
+    // Getting art is quicker if "albumid" has been fetched
+    item.GetMusicInfoTag()->SetDatabaseId(song["songid"].asInteger32(), MediaTypeSong);
+    if (song.isMember("albumid"))
+      item.GetMusicInfoTag()->SetAlbumId(song["albumid"].asInteger32());
+    else
+      item.GetMusicInfoTag()->SetAlbumId(-1);
+
+    // Could use FillDetails, but it does unnecessary serialization of empty MusiInfoTag
+    // CFileItemPtr itemptr(new CFileItem(item));
+    // FillDetails(item.GetMusicInfoTag(), itemptr, artfields, song, thumbLoader);
+
+    thumbLoader->FillLibraryArt(item);
+
+    if (bFetchThumb)
     {
-      CThumbLoader* thumbLoader = new CMusicThumbLoader();
-      thumbLoader->OnLoaderStart();
+      if (item.HasArt("thumb"))
+        song["thumbnail"] = IMAGE_FILES::URLFromFile(item.GetArt("thumb"));
+      else
+        song["thumbnail"] = "";
+    }
+    if (bFetchFanart)
+    {
+      if (item.HasArt("fanart"))
+        song["fanart"] = IMAGE_FILES::URLFromFile(item.GetArt("fanart"));
+      else
+        song["fanart"] = "";
+    }
+    if (bFetchArt)
+    {
+      const KODI::ART::Artwork& artMap = item.GetArt();
+      CVariant artObj(CVariant::VariantTypeObject);
+      for (const auto& artIt : artMap)
+      {
+        if (!artIt.second.empty())
+          artObj[artIt.first] = IMAGE_FILES::URLFromFile(artIt.second);
+      }
+      song["art"] = artObj;
+    }
+  };
 
-      std::set<std::string> artfields;
-      if (bFetchArt)
-        artfields.insert("art");
-      if (bFetchFanart)
-        artfields.insert("fanart");
-      if (bFetchThumb)
-        artfields.insert("thumbnail");
+  int start, end;
 
-      for (unsigned int index = 0; index < result["songs"].size(); index++)
+  // songs are written to the client as soon as they have been read if possible
+  std::function<bool(CVariant&)> onSong;
+  CResponseStream* stream = CResponseStream::Get(transport, result);
+  if (stream != nullptr)
+  {
+    onSong = [&](CVariant& song)
+    {
+      // the total is known once the first song has been read
+      if (!stream->IsStarted())
       {
-        CFileItem item;
-        // Only needs song and album id (if we have it) set to get art
-        // Getting art is quicker if "albumid" has been fetched
-        item.GetMusicInfoTag()->SetDatabaseId(result["songs"][index]["songid"].asInteger32(), MediaTypeSong);
-        if (result["songs"][index].isMember("albumid"))
-          item.GetMusicInfoTag()->SetAlbumId(result["songs"][index]["albumid"].asInteger32());
-        else
-          item.GetMusicInfoTag()->SetAlbumId(-1);
+        HandleLimits(parameterObject, result, total, start, end);
+        stream->BeginList("songs");
+      }
 
-        // Could use FillDetails, but it does unnecessary serialization of empty MusiInfoTag
-        // CFileItemPtr itemptr(new CFileItem(item));
-        // FillDetails(item.GetMusicInfoTag(), itemptr, artfields, result["songs"][index], thumbLoader);
+      if (thumbLoader)
+        fillArt(song);
+      stream->AddItem(song);
 
-        thumbLoader->FillLibraryArt(item);
+      return !stream->HasFailed();
+    };
+  }
 
-        if (bFetchThumb)
-        {
-          if (item.HasArt("thumb"))
-            result["songs"][index]["thumbnail"] = IMAGE_FILES::URLFromFile(item.GetArt("thumb"));
-          else
-            result["songs"][index]["thumbnail"] = "";
-        }
-        if (bFetchFanart)
-        {
-          if (item.HasArt("fanart"))
-            result["songs"][index]["fanart"] = IMAGE_FILES::URLFromFile(item.GetArt("fanart"));
-          else
-            result["songs"][index]["fanart"] = "";
-        }
-        if (bFetchArt)
-        {
-          const KODI::ART::Artwork& artMap = item.GetArt();
-          CVariant artObj(CVariant::VariantTypeObject);
-          for (const auto& artIt : artMap)
-          {
-            if (!artIt.second.empty())
-              artObj[artIt.first] = IMAGE_FILES::URLFromFile(artIt.second);
-          }
-          result["songs"][index]["art"] = artObj;
-        }
-      }
+  if (!musicdatabase.GetSongsByWhereJSON(fields, musicUrl.ToString(), result, total, sorting,
+                                         onSong))
+    return InternalError;
 
-      delete thumbLoader;
-    }
+  if (stream != nullptr && stream->IsStarted())
+  {
+    stream->EndList();
+    return OK;
+  }
+
+  if (thumbLoader && result.isMember("songs"))
+  {
+    for (auto it = result["songs"].begin_array(); it != result["songs"].end_array(); ++it)
+      fillArt(*it);
   }
 
-  int start, end;
   HandleLimits(parameterObject, result, total, start, end);
 
   return OK;
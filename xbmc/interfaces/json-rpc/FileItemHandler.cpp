@@ -11,6 +11,7 @@
 #include "AudioLibrary.h"
 #include "FileItemList.h"
 #include "FileOperations.h"
+#include "ResponseStream.h"
 #include "ServiceBroker.h"
 #include "Util.h"
 #include "VideoLibrary.h"
@@ -41,6 +42,7 @@
 #include <map>
 #include <memory>
 #include <string.h>
+#include <utility>
 
 using namespace MUSIC_INFO;
 using namespace JSONRPC;
@@ -291,7 +293,15 @@ void CFileItemHandler::HandleFileItemList(const char *ID, bool allowFile, const
   HandleFileItemList(ID, allowFile, resultname, items, parameterObject, result, items.Size(), sortLimit);
 }
 
-void CFileItemHandler::HandleFileItemList(const char *ID, bool allowFile, const char *resultname, CFileItemList &items, const CVariant &parameterObject, CVariant &result, int size, bool sortLimit /* = true */)
+void CFileItemHandler::HandleFileItemList(const char* ID,
+                                          bool allowFile,
+                                          const char* resultname,
+                                          CFileItemList& items,
+                                          const CVariant& parameterObject,
+                                          CVariant& result,
+                                          int size,
+                                          bool sortLimit /* = true */,
+                                          CResponseStream* stream /* = nullptr */)
 {
   int start, end;
   HandleLimits(parameterObject, result, size, start, end);
@@ -324,11 +334,28 @@ void CFileItemHandler::HandleFileItemList(const char *ID, bool allowFile, const
       fields.insert(field->asString());
   }
 
-  result[resultname].reserve(static_cast<size_t>(end - start));
-  for (int i = start; i < end; i++)
+  if (stream != nullptr)
   {
-    CFileItemPtr item = items.Get(i);
-    HandleFileItem(ID, allowFile, resultname, item, parameterObject, fields, result, true, thumbLoader);
+    // every item is written as soon as it is complete and released right away
+    stream->BeginList(resultname);
+    for (int i = start; i < end && !stream->HasFailed(); i++)
+    {
+      CVariant itemResult;
+      HandleFileItem(ID, allowFile, resultname, items.Get(i), parameterObject, fields, itemResult,
+                     false, thumbLoader);
+      stream->AddItem(itemResult[resultname]);
+    }
+    stream->EndList();
+  }
+  else
+  {
+    result[resultname].reserve(static_cast<size_t>(end - start));
+    for (int i = start; i < end; i++)
+    {
+      CFileItemPtr item = items.Get(i);
+      HandleFileItem(ID, allowFile, resultname, item, parameterObject, fields, result, true,
+                     thumbLoader);
+    }
   }
 
   delete thumbLoader;
@@ -365,7 +392,8 @@ void CFileItemHandler::HandleFileItem(const char* ID,
                                       bool append /* = true */,
                                       CThumbLoader* thumbLoader /* = NULL */)
 {
-  CVariant object;
+  // built in the resource of the result, so it can be moved in without copying its members
+  CVariant object(std::allocator_arg, result.get_allocator());
   std::set<std::string> fields(validFields.begin(), validFields.end());
 
   if (item.get())
@@ -498,9 +526,9 @@ void CFileItemHandler::HandleFileItem(const char* ID,
   if (resultname)
   {
     if (append)
-      result[resultname].append(object);
+      result[resultname].append(std::move(object));
     else
-      result[resultname] = object;
+      result[resultname] = std::move(object);
   }
 }
 
@@ -22,6 +22,8 @@ class ISerializable;
 
 namespace JSONRPC
 {
+  class CResponseStream;
+
   class CFileItemHandler : public CJSONUtils
   {
   protected:
@@ -31,7 +33,20 @@ namespace JSONRPC
                             CVariant& result,
                             CThumbLoader* thumbLoader = nullptr);
     static void HandleFileItemList(const char *ID, bool allowFile, const char *resultname, CFileItemList &items, const CVariant &parameterObject, CVariant &result, bool sortLimit = true);
-    static void HandleFileItemList(const char *ID, bool allowFile, const char *resultname, CFileItemList &items, const CVariant &parameterObject, CVariant &result, int size, bool sortLimit = true);
+    /*!
+     \brief Add the items of a list to a result
+     \param size the total number of items for the limits of the result
+     \param stream if set, the items are written to the stream instead of being added to result
+     */
+    static void HandleFileItemList(const char* ID,
+                                   bool allowFile,
+                                   const char* resultname,
+                                   CFileItemList& items,
+                                   const CVariant& parameterObject,
+                                   CVariant& result,
+                                   int size,
+                                   bool sortLimit = true,
+                                   CResponseStream* stream = nullptr);
     static void HandleFileItem(const char* ID,
                                bool allowFile,
                                const char* resultname,
@@ -14,6 +14,8 @@ class CVariant;
 
 namespace JSONRPC
 {
+  class CResponseStream;
+
   enum TransportLayerCapability
   {
     Response = 0x1,
@@ -31,5 +33,11 @@ namespace JSONRPC
     virtual bool PrepareDownload(const char *path, CVariant &details, std::string &protocol) = 0;
     virtual bool Download(const char *path, CVariant &result) = 0;
     virtual int GetCapabilities() = 0;
+
+    /*!
+     \brief Get the stream the response to the current method call is written to
+     \return nullptr if the response is sent as a whole
+     */
+    virtual CResponseStream* GetResponseStream() { return nullptr; }
   };
 }
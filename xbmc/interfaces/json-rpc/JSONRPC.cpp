@@ -10,6 +10,7 @@
 
 #include "FileItem.h"
 #include "GUIUserMessages.h"
+#include "ResponseStream.h"
 #include "ServiceBroker.h"
 #include "ServiceDescription.h"
 #include "TextureDatabase.h"
@@ -27,15 +28,67 @@
 #include "playlists/SmartPlayList.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
+#include "utils/JSONStreamWriter.h"
 #include "utils/StringUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 
+#include <memory>
+#include <memory_resource>
+#include <set>
 #include <string.h>
+#include <utility>
 
 using namespace KODI;
 using namespace JSONRPC;
 
+namespace
+{
+// initial size of the arena a response is built in, it grows as needed
+constexpr size_t RESPONSE_ARENA_SIZE = 64 * 1024;
+
+// methods handing the items of their list to CResponseStream, in lower case
+const std::set<std::string, std::less<>> streamableMethods = {
+    "audiolibrary.getsongs",
+    "videolibrary.getepisodes",
+    "videolibrary.getinprogresstvshows",
+    "videolibrary.getmovies",
+    "videolibrary.getmusicvideos",
+    "videolibrary.getrecentlyaddedepisodes",
+    "videolibrary.getrecentlyaddedmovies",
+    "videolibrary.getrecentlyaddedmusicvideos",
+    "videolibrary.gettvshows",
+};
+
+// hands the response stream of a single method call to the method
+class CStreamingTransportLayer : public ITransportLayer
+{
+public:
+  CStreamingTransportLayer(ITransportLayer* transport, CResponseStream& stream)
+    : m_transport(transport), m_stream(stream)
+  {
+  }
+
+  bool PrepareDownload(const char* path, CVariant& details, std::string& protocol) override
+  {
+    return m_transport != nullptr && m_transport->PrepareDownload(path, details, protocol);
+  }
+  bool Download(const char* path, CVariant& result) override
+  {
+    return m_transport != nullptr && m_transport->Download(path, result);
+  }
+  int GetCapabilities() override
+  {
+    return m_transport != nullptr ? m_transport->GetCapabilities() : 0;
+  }
+  CResponseStream* GetResponseStream() override { return &m_stream; }
+
+private:
+  ITransportLayer* m_transport;
+  CResponseStream& m_stream;
+};
+} // unnamed namespace
+
 bool CJSONRPC::m_initialized = false;
 
 void CJSONRPC::Initialize()
@@ -241,8 +294,32 @@ JSONRPC_STATUS CJSONRPC::NotifyAll(const std::string &method, ITransportLayer *t
 
 std::string CJSONRPC::MethodCall(const std::string &inputString, ITransportLayer *transport, IClient *client)
 {
-  CVariant inputroot, outputroot, result;
+  std::string str;
+  MethodCall(inputString, transport, client,
+             [&str](const char* data, size_t size)
+             {
+               str.append(data, size);
+               return true;
+             });
+
+  return str;
+}
+
+bool CJSONRPC::MethodCall(const std::string& inputString,
+                          ITransportLayer* transport,
+                          IClient* client,
+                          const CJSONStreamWriter::Sink& sink)
+{
+  // the response tree is released as a whole once it has been written, so all of its nodes are
+  // taken from one arena instead of being allocated and freed one by one
+  std::pmr::monotonic_buffer_resource arena(RESPONSE_ARENA_SIZE);
+  CVariant inputroot;
+  CVariant outputroot(std::allocator_arg, &arena);
   bool hasResponse = false;
+  bool streamFailed = false;
+
+  CJSONStreamWriter writer(
+      sink, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
 
   CLog::Log(LOGDEBUG, LOGJSONRPC, "JSONRPC: Incoming request: {}", inputString);
 
@@ -261,17 +338,19 @@ std::string CJSONRPC::MethodCall(const std::string &inputString, ITransportLayer
         for (CVariant::const_iterator_array itr = inputroot.begin_array();
              itr != inputroot.end_array(); ++itr)
         {
-          CVariant response;
+          CVariant response(std::allocator_arg, outputroot.get_allocator());
           if (HandleMethodCall(*itr, response, transport, client))
           {
-            outputroot.append(response);
+            outputroot.append(std::move(response));
             hasResponse = true;
           }
         }
       }
     }
     else
-      hasResponse = HandleMethodCall(inputroot, outputroot, transport, client);
+      // only single calls are streamed, the responses of a batch are sent together
+      hasResponse =
+          HandleMethodCall(inputroot, outputroot, transport, client, &writer, &streamFailed);
   }
   else
   {
@@ -280,17 +359,35 @@ std::string CJSONRPC::MethodCall(const std::string &inputString, ITransportLayer
     hasResponse = true;
   }
 
-  std::string str;
   if (hasResponse)
-    CJSONVariantWriter::Write(outputroot, str, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
+    writer.Value(outputroot);
+  writer.Flush();
 
-  return str;
+  return !streamFailed;
+}
+
+bool CJSONRPC::IsStreamable(const std::string& inputString)
+{
+  CVariant inputroot;
+  if (!CJSONVariantParser::Parse(inputString, inputroot) || !IsProperJSONRPC(inputroot) ||
+      !inputroot.isMember("id"))
+    return false;
+
+  std::string methodName = inputroot["method"].asString();
+  StringUtils::ToLower(methodName);
+
+  return streamableMethods.contains(methodName);
 }
 
-bool CJSONRPC::HandleMethodCall(const CVariant& request, CVariant& response, ITransportLayer *transport, IClient *client)
+bool CJSONRPC::HandleMethodCall(const CVariant& request,
+                                CVariant& response,
+                                ITransportLayer* transport,
+                                IClient* client,
+                                CJSONStreamWriter* writer /* = nullptr */,
+                                bool* streamFailed /* = nullptr */)
 {
   JSONRPC_STATUS errorCode = OK;
-  CVariant result;
+  CVariant result(std::allocator_arg, response.get_allocator());
   bool isNotification = false;
 
   if (IsProperJSONRPC(request))
@@ -304,7 +401,30 @@ bool CJSONRPC::HandleMethodCall(const CVariant& request, CVariant& response, ITr
     CVariant params;
 
     if ((errorCode = CJSONServiceDescription::CheckCall(methodName.c_str(), request["params"], transport, client, isNotification, method, params)) == OK)
-      errorCode = method(methodName, transport, client, params, result);
+    {
+      if (writer != nullptr && !isNotification)
+      {
+        CResponseStream stream(*writer, request["id"], result);
+        CStreamingTransportLayer streamingTransport(transport, stream);
+        errorCode = method(methodName, &streamingTransport, client, params, result);
+
+        if (stream.IsStarted())
+        {
+          if (errorCode != OK)
+          {
+            CLog::Log(LOGERROR, "JSONRPC: {} failed after its response has been started",
+                      methodName);
+            if (streamFailed != nullptr)
+              *streamFailed = true;
+          }
+
+          stream.Finish();
+          return false;
+        }
+      }
+      else
+        errorCode = method(methodName, transport, client, params, result);
+    }
     else
       result = params;
   }
@@ -317,7 +437,7 @@ bool CJSONRPC::HandleMethodCall(const CVariant& request, CVariant& response, ITr
     errorCode = InvalidRequest;
   }
 
-  BuildResponse(request, errorCode, result, response);
+  BuildResponse(request, errorCode, std::move(result), response);
 
   return !isNotification;
 }
@@ -327,7 +447,7 @@ inline bool CJSONRPC::IsProperJSONRPC(const CVariant& inputroot)
   return inputroot.isMember("jsonrpc") && inputroot["jsonrpc"].isString() && inputroot["jsonrpc"] == CVariant("2.0") && inputroot.isMember("method") && inputroot["method"].isString() && (!inputroot.isMember("params") || inputroot["params"].isArray() || inputroot["params"].isObject());
 }
 
-inline void CJSONRPC::BuildResponse(const CVariant& request, JSONRPC_STATUS code, const CVariant& result, CVariant& response)
+inline void CJSONRPC::BuildResponse(const CVariant& request, JSONRPC_STATUS code, CVariant&& result, CVariant& response)
 {
   response["jsonrpc"] = "2.0";
   response["id"] = request.isMember("id") ? request["id"] : CVariant();
@@ -335,7 +455,7 @@ inline void CJSONRPC::BuildResponse(const CVariant& request, JSONRPC_STATUS code
   switch (code)
   {
     case OK:
-      response["result"] = result;
+      response["result"] = std::move(result);
       break;
     case ACK:
       response["result"] = "OK";
@@ -348,7 +468,7 @@ inline void CJSONRPC::BuildResponse(const CVariant& request, JSONRPC_STATUS code
       response["error"]["code"] = InvalidParams;
       response["error"]["message"] = "Invalid params.";
       if (!result.isNull())
-        response["error"]["data"] = result;
+        response["error"]["data"] = std::move(result);
       break;
     case MethodNotFound:
       response["error"]["code"] = MethodNotFound;
@@ -10,6 +10,7 @@
 
 #include "JSONRPCUtils.h"
 #include "JSONServiceDescription.h"
+#include "utils/JSONStreamWriter.h"
 
 #include <iostream>
 #include <map>
@@ -53,6 +54,34 @@ namespace JSONRPC
      */
     static std::string MethodCall(const std::string &inputString, ITransportLayer *transport, IClient *client);
 
+    /*!
+     \brief Handles an incoming JSON-RPC request and writes the response while it is produced
+     \param inputString received JSON-RPC request
+     \param transport Transport protocol on which the request arrived
+     \param client Client which sent the request
+     \param sink Receiver of the JSON-RPC response, which is handed over in chunks
+
+     Methods returning long lists write their items as soon as they are available
+     instead of building the whole response first. Nothing is written for
+     notifications.
+
+     \return false if the method failed after its response has been started. The
+     response is still complete JSON then, but lacks part of the result.
+     */
+    static bool MethodCall(const std::string& inputString,
+                           ITransportLayer* transport,
+                           IClient* client,
+                           const CJSONStreamWriter::Sink& sink);
+
+    /*!
+     \brief Whether the response to a request may be written while it is produced
+     \param inputString received JSON-RPC request
+     \return true for a single call of a method returning a potentially long list
+
+     Any other response is small enough to be built as a whole before it is sent.
+     */
+    static bool IsStreamable(const std::string& inputString);
+
     static JSONRPC_STATUS Introspect(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
     static JSONRPC_STATUS Version(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
     static JSONRPC_STATUS Permission(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
@@ -62,10 +91,22 @@ namespace JSONRPC
     static JSONRPC_STATUS NotifyAll(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
 
   private:
-    static bool HandleMethodCall(const CVariant& request, CVariant& response, ITransportLayer *transport, IClient *client);
+    /*!
+     \brief Handles a single method call
+     \param writer Writer to stream the response to, nullptr to always build it in response
+     \param streamFailed Set to true if the method failed after its response has been written
+     \return true if there is a response in response, false for notifications and responses
+     which have already been written to writer
+     */
+    static bool HandleMethodCall(const CVariant& request,
+                                 CVariant& response,
+                                 ITransportLayer* transport,
+                                 IClient* client,
+                                 CJSONStreamWriter* writer = nullptr,
+                                 bool* streamFailed = nullptr);
     static inline bool IsProperJSONRPC(const CVariant& inputroot);
 
-    inline static void BuildResponse(const CVariant& request, JSONRPC_STATUS code, const CVariant& result, CVariant& response);
+    inline static void BuildResponse(const CVariant& request, JSONRPC_STATUS code, CVariant&& result, CVariant& response);
 
     static bool m_initialized;
   };
@@ -258,7 +258,9 @@ JsonRpcMethodMap CJSONServiceDescription::m_methodMaps[] = {
 
 // XBMC operations
   { "XBMC.GetInfoLabels",                           CXBMCOperations::GetInfoLabels },
-  { "XBMC.GetInfoBooleans",                         CXBMCOperations::GetInfoBooleans }
+  { "XBMC.GetInfoBooleans",                         CXBMCOperations::GetInfoBooleans },
+  { "XBMC.GetQueryStatistics",                      CXBMCOperations::GetQueryStatistics },
+  { "XBMC.ResetQueryStatistics",                    CXBMCOperations::ResetQueryStatistics }
 };
 
 // clang-format on
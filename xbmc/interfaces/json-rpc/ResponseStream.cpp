@@ -0,0 +1,108 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ResponseStream.h"
+
+#include "ITransportLayer.h"
+#include "utils/JSONStreamWriter.h"
+#include "utils/Variant.h"
+
+using namespace JSONRPC;
+
+CResponseStream::CResponseStream(CJSONStreamWriter& writer,
+                                 const CVariant& id,
+                                 const CVariant& result)
+  : m_writer(writer), m_id(id), m_result(result)
+{
+}
+
+CResponseStream* CResponseStream::Get(ITransportLayer* transport, const CVariant& result)
+{
+  if (transport == nullptr)
+    return nullptr;
+
+  CResponseStream* stream = transport->GetResponseStream();
+  if (stream == nullptr || !stream->CanStream(result))
+    return nullptr;
+
+  return stream;
+}
+
+bool CResponseStream::CanStream(const CVariant& result) const
+{
+  return &result == &m_result && !m_started && (result.isObject() || result.isNull());
+}
+
+void CResponseStream::BeginList(const std::string& name)
+{
+  m_started = true;
+  m_inList = true;
+
+  // same layout as CJSONRPC::BuildResponse() produces for a successful call
+  m_writer.BeginObject();
+  m_writer.Key("id");
+  m_writer.Value(m_id);
+  m_writer.Key("jsonrpc");
+  m_writer.Value(CVariant("2.0"));
+  m_writer.Key("result");
+  m_writer.BeginObject();
+
+  for (auto it = m_result.begin_map(); it != m_result.end_map(); ++it)
+  {
+    if (it->first == name)
+      continue;
+
+    m_writer.Key(it->first);
+    m_writer.Value(it->second);
+    m_written.insert(it->first);
+  }
+
+  m_writer.Key(name);
+  m_writer.BeginArray();
+  m_written.insert(name);
+}
+
+void CResponseStream::AddItem(const CVariant& item)
+{
+  if (m_inList)
+    m_writer.Value(item);
+}
+
+void CResponseStream::EndList()
+{
+  if (!m_inList)
+    return;
+
+  m_writer.EndArray();
+  m_inList = false;
+}
+
+bool CResponseStream::HasFailed() const
+{
+  return m_writer.HasFailed();
+}
+
+void CResponseStream::Finish()
+{
+  if (!m_started)
+    return;
+
+  EndList();
+
+  for (auto it = m_result.begin_map(); it != m_result.end_map(); ++it)
+  {
+    if (m_written.contains(it->first))
+      continue;
+
+    m_writer.Key(it->first);
+    m_writer.Value(it->second);
+  }
+
+  m_writer.EndObject();
+  m_writer.EndObject();
+}
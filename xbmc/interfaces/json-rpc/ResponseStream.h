@@ -0,0 +1,84 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <set>
+#include <string>
+
+class CJSONStreamWriter;
+class CVariant;
+
+namespace JSONRPC
+{
+  class ITransportLayer;
+
+  /*!
+   \ingroup jsonrpc
+   \brief Response to a method call which is written while the method is still running
+
+   A method returning a potentially long list can hand the items of that list to the stream one
+   by one instead of collecting them in its result, so neither the list nor the serialized
+   response ever exist as a whole. The members the method has set in its result when starting
+   the list are written before the list, the ones set afterwards once the method returned.
+
+   Once the list has been started the response can't be turned into an error anymore.
+   */
+  class CResponseStream
+  {
+  public:
+    CResponseStream(CJSONStreamWriter& writer, const CVariant& id, const CVariant& result);
+
+    /*!
+     \brief Get the stream a list of a result can be written to
+     \param transport the transport layer the method was called with
+     \param result the result the list belongs to
+     \return the stream or nullptr if the response is sent as a whole
+     */
+    static CResponseStream* Get(ITransportLayer* transport, const CVariant& result);
+
+    /*!
+     \brief Check whether a list of a result can be streamed
+     \param result the result the list belongs to
+     \return true if result is the top level result of the current method call and no list has
+     been streamed yet
+     */
+    bool CanStream(const CVariant& result) const;
+
+    /*!
+     \brief Start writing the response with the list as member of the result
+     \param name the name of the list in the result
+     */
+    void BeginList(const std::string& name);
+    void AddItem(const CVariant& item);
+    void EndList();
+
+    /*!
+     \brief Whether the response has been started
+     */
+    bool IsStarted() const { return m_started; }
+
+    /*!
+     \brief Whether the client has gone away, so producing further items is pointless
+     */
+    bool HasFailed() const;
+
+    /*!
+     \brief Write the remaining members of the result and complete the response
+     */
+    void Finish();
+
+  private:
+    CJSONStreamWriter& m_writer;
+    const CVariant& m_id;
+    const CVariant& m_result;
+    std::set<std::string> m_written;
+    bool m_started = false;
+    bool m_inList = false;
+  };
+}
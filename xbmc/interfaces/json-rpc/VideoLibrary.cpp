@@ -11,6 +11,7 @@
 #include "FileItem.h"
 #include "FileItemList.h"
 #include "PVROperations.h"
+#include "ResponseStream.h"
 #include "ServiceBroker.h"
 #include "Util.h"
 #include "imagefiles/ImageFileURL.h"
@@ -81,7 +82,8 @@ JSONRPC_STATUS CVideoLibrary::GetMovies(const std::string &method, ITransportLay
   if (!videodatabase.GetMoviesNav(videoUrl.ToString(), items, genreID, year, -1, -1, -1, -1, setID, -1, sorting, RequiresAdditionalDetails(MediaTypeMovie, parameterObject)))
     return InvalidParams;
 
-  return HandleItems("movieid", "movies", items, parameterObject, result, false);
+  return HandleItems("movieid", "movies", items, parameterObject, result, false,
+                     CResponseStream::Get(transport, result));
 }
 
 JSONRPC_STATUS CVideoLibrary::GetMovieDetails(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
@@ -183,7 +185,8 @@ JSONRPC_STATUS CVideoLibrary::GetTVShows(const std::string &method, ITransportLa
   if (!videodatabase.GetTvShowsByWhere(videoUrl.ToString(), nofilter, items, sorting, RequiresAdditionalDetails(MediaTypeTvShow, parameterObject)))
     return InvalidParams;
 
-  return HandleItems("tvshowid", "tvshows", items, parameterObject, result, false);
+  return HandleItems("tvshowid", "tvshows", items, parameterObject, result, false,
+                     CResponseStream::Get(transport, result));
 }
 
 JSONRPC_STATUS CVideoLibrary::GetTVShowDetails(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
@@ -293,7 +296,8 @@ JSONRPC_STATUS CVideoLibrary::GetEpisodes(const std::string &method, ITransportL
   if (!videodatabase.GetEpisodesByWhere(videoUrl.ToString(), CDatabase::Filter(), items, false, sorting, RequiresAdditionalDetails(MediaTypeEpisode, parameterObject)))
     return InvalidParams;
 
-  return HandleItems("episodeid", "episodes", items, parameterObject, result, false);
+  return HandleItems("episodeid", "episodes", items, parameterObject, result, false,
+                     CResponseStream::Get(transport, result));
 }
 
 JSONRPC_STATUS CVideoLibrary::GetEpisodeDetails(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
@@ -366,7 +370,8 @@ JSONRPC_STATUS CVideoLibrary::GetMusicVideos(const std::string &method, ITranspo
   if (!videodatabase.GetMusicVideosNav(videoUrl.ToString(), items, genreID, year, -1, -1, -1, -1, -1, sorting, RequiresAdditionalDetails(MediaTypeMusicVideo, parameterObject)))
     return InternalError;
 
-  return HandleItems("musicvideoid", "musicvideos", items, parameterObject, result, false);
+  return HandleItems("musicvideoid", "musicvideos", items, parameterObject, result, false,
+                     CResponseStream::Get(transport, result));
 }
 
 JSONRPC_STATUS CVideoLibrary::GetMusicVideoDetails(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
@@ -396,7 +401,8 @@ JSONRPC_STATUS CVideoLibrary::GetRecentlyAddedMovies(const std::string &method,
   if (!videodatabase.GetRecentlyAddedMoviesNav("videodb://recentlyaddedmovies/", items, 0, RequiresAdditionalDetails(MediaTypeMovie, parameterObject)))
     return InternalError;
 
-  return HandleItems("movieid", "movies", items, parameterObject, result, true);
+  return HandleItems("movieid", "movies", items, parameterObject, result, true,
+                     CResponseStream::Get(transport, result));
 }
 
 JSONRPC_STATUS CVideoLibrary::GetRecentlyAddedEpisodes(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
@@ -409,7 +415,8 @@ JSONRPC_STATUS CVideoLibrary::GetRecentlyAddedEpisodes(const std::string &method
   if (!videodatabase.GetRecentlyAddedEpisodesNav("videodb://recentlyaddedepisodes/", items, 0, RequiresAdditionalDetails(MediaTypeEpisode, parameterObject)))
     return InternalError;
 
-  return HandleItems("episodeid", "episodes", items, parameterObject, result, true);
+  return HandleItems("episodeid", "episodes", items, parameterObject, result, true,
+                     CResponseStream::Get(transport, result));
 }
 
 JSONRPC_STATUS CVideoLibrary::GetRecentlyAddedMusicVideos(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
@@ -422,7 +429,8 @@ JSONRPC_STATUS CVideoLibrary::GetRecentlyAddedMusicVideos(const std::string &met
   if (!videodatabase.GetRecentlyAddedMusicVideosNav("videodb://recentlyaddedmusicvideos/", items, 0, RequiresAdditionalDetails(MediaTypeMusicVideo, parameterObject)))
     return InternalError;
 
-  return HandleItems("musicvideoid", "musicvideos", items, parameterObject, result, true);
+  return HandleItems("musicvideoid", "musicvideos", items, parameterObject, result, true,
+                     CResponseStream::Get(transport, result));
 }
 
 JSONRPC_STATUS CVideoLibrary::GetInProgressTVShows(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
@@ -437,7 +445,8 @@ JSONRPC_STATUS CVideoLibrary::GetInProgressTVShows(const std::string &method, IT
           RequiresAdditionalDetails(MediaTypeTvShow, parameterObject)))
     return InternalError;
 
-  return HandleItems("tvshowid", "tvshows", items, parameterObject, result, false);
+  return HandleItems("tvshowid", "tvshows", items, parameterObject, result, false,
+                     CResponseStream::Get(transport, result));
 }
 
 JSONRPC_STATUS CVideoLibrary::GetGenres(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
@@ -1147,12 +1156,19 @@ int CVideoLibrary::GetDetailsFromJsonParameters(const CVariant& parameterObject)
   return details;
 }
 
-JSONRPC_STATUS CVideoLibrary::HandleItems(const char *idProperty, const char *resultName, CFileItemList &items, const CVariant &parameterObject, CVariant &result, bool limit /* = true */)
+JSONRPC_STATUS CVideoLibrary::HandleItems(const char* idProperty,
+                                          const char* resultName,
+                                          CFileItemList& items,
+                                          const CVariant& parameterObject,
+                                          CVariant& result,
+                                          bool limit /* = true */,
+                                          CResponseStream* stream /* = nullptr */)
 {
   int size = items.Size();
   if (!limit && items.HasProperty("total") && items.GetProperty("total").asInteger() > size)
     size = (int)items.GetProperty("total").asInteger();
-  HandleFileItemList(idProperty, true, resultName, items, parameterObject, result, size, limit);
+  HandleFileItemList(idProperty, true, resultName, items, parameterObject, result, size, limit,
+                     stream);
 
   return OK;
 }
@@ -88,7 +88,13 @@ namespace JSONRPC
 
   private:
     static int RequiresAdditionalDetails(const MediaType& mediaType, const CVariant &parameterObject);
-    static JSONRPC_STATUS HandleItems(const char *idProperty, const char *resultName, CFileItemList &items, const CVariant &parameterObject, CVariant &result, bool limit = true);
+    static JSONRPC_STATUS HandleItems(const char* idProperty,
+                                      const char* resultName,
+                                      CFileItemList& items,
+                                      const CVariant& parameterObject,
+                                      CVariant& result,
+                                      bool limit = true,
+                                      CResponseStream* stream = nullptr);
     static JSONRPC_STATUS RemoveVideo(const CVariant &parameterObject);
     static void UpdateVideoTag(const CVariant& parameterObject,
                                CVideoInfoTag& details,
@@ -8,13 +8,24 @@
 
 #include "XBMCOperations.h"
 
+#include "DatabaseManager.h"
 #include "ServiceBroker.h"
+#include "XBDateTime.h"
+#include "dbwrappers/QueryProfiler.h"
 #include "messaging/ApplicationMessenger.h"
 #include "powermanagement/PowerManager.h"
 #include "utils/Variant.h"
 
 using namespace JSONRPC;
 
+namespace
+{
+double ToMilliseconds(std::chrono::microseconds duration)
+{
+  return static_cast<double>(duration.count()) / 1000.0;
+}
+} // unnamed namespace
+
 JSONRPC_STATUS CXBMCOperations::GetInfoLabels(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
 {
   std::vector<std::string> info;
@@ -86,3 +97,53 @@ JSONRPC_STATUS CXBMCOperations::GetInfoBooleans(const std::string &method, ITran
 
   return OK;
 }
+
+JSONRPC_STATUS CXBMCOperations::GetQueryStatistics(const std::string& method,
+                                                   ITransportLayer* transport,
+                                                   IClient* client,
+                                                   const CVariant& parameterObject,
+                                                   CVariant& result)
+{
+  CQueryProfiler& profiler = *CServiceBroker::GetDatabaseManager().GetQueryProfiler();
+
+  result["statements"] = CVariant(CVariant::VariantTypeArray);
+  for (const auto& statement :
+       profiler.GetStatistics(static_cast<size_t>(parameterObject["limit"].asUnsignedInteger())))
+  {
+    CVariant item(CVariant::VariantTypeObject);
+    item["database"] = statement.database;
+    item["statement"] = statement.statement;
+    item["count"] = statement.count;
+    item["rows"] = statement.rows;
+    item["totaltime"] = ToMilliseconds(statement.total);
+    item["maxtime"] = ToMilliseconds(statement.max);
+    item["mediantime"] = ToMilliseconds(statement.median);
+    item["p95time"] = ToMilliseconds(statement.p95);
+    item["p99time"] = ToMilliseconds(statement.p99);
+    result["statements"].push_back(item);
+  }
+
+  result["slowqueries"] = CVariant(CVariant::VariantTypeArray);
+  for (const auto& query : profiler.GetSlowQueries())
+  {
+    CVariant item(CVariant::VariantTypeObject);
+    item["time"] = CDateTime(std::chrono::system_clock::to_time_t(query.time)).GetAsDBDateTime();
+    item["database"] = query.database;
+    item["statement"] = query.statement;
+    item["duration"] = ToMilliseconds(query.duration);
+    item["rows"] = query.rows;
+    result["slowqueries"].push_back(item);
+  }
+
+  return OK;
+}
+
+JSONRPC_STATUS CXBMCOperations::ResetQueryStatistics(const std::string& method,
+                                                     ITransportLayer* transport,
+                                                     IClient* client,
+                                                     const CVariant& parameterObject,
+                                                     CVariant& result)
+{
+  CServiceBroker::GetDatabaseManager().GetQueryProfiler()->Reset();
+  return ACK;
+}
@@ -8,13 +8,16 @@
 
 #include "JobManager.h"
 
+#include "ServiceBroker.h"
 #include "jobs/IJobCallback.h"
 #include "threads/Thread.h"
+#include "utils/CPUInfo.h"
 #include "utils/log.h"
 
 #include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <stdexcept>
@@ -214,8 +217,8 @@ void CJobManager::StartWorkers(CJob::PRIORITY priority)
 {
   std::unique_lock lock(m_section);
 
-  // check how many free threads we have
-  if (m_processing.size() >= GetMaxWorkers(priority))
+  // check whether the lane of this priority has a free slot
+  if (!CanStart(priority))
     return;
 
   // do we have any sleeping threads?
@@ -238,15 +241,23 @@ CJob* CJobManager::PopJob()
     if (priority == CJob::PRIORITY_LOW_PAUSABLE && m_pauseJobs)
       continue;
 
-    if (!m_jobQueue[priority].empty() &&
-        m_processing.size() < GetMaxWorkers(CJob::PRIORITY(priority)))
+    if (!m_jobQueue[priority].empty() && CanStart(CJob::PRIORITY(priority)))
     {
       // pop the job off the queue
-      const CWorkItem job{m_jobQueue[priority].front()};
+      CWorkItem job{m_jobQueue[priority].front()};
       m_jobQueue[priority].pop_front();
 
+      job.SetStartTime(std::chrono::steady_clock::now());
+      const auto waitTime = std::chrono::duration_cast<std::chrono::microseconds>(
+          job.GetStartTime() - job.GetQueueTime());
+      JobStatistics& stats = m_statistics[job.GetJob()->GetType()];
+      stats.started++;
+      stats.totalWaitTime += waitTime;
+      stats.maxWaitTime = std::max(stats.maxWaitTime, waitTime);
+
       // add to the processing vector
       m_processing.emplace_back(job);
+      m_processingCount[priority]++;
       job.GetJob()->SetProgressCallback(this);
       return job.GetJob();
     }
@@ -343,6 +354,14 @@ void CJobManager::OnJobComplete(bool success, CJob* job)
       // when another thread modifies m_processing during callback execution
       item.emplace(std::move(*i));
       m_processing.erase(i);
+      m_processingCount[item->GetPriority()]--;
+
+      const auto runTime = std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - item->GetStartTime());
+      JobStatistics& stats = m_statistics[job->GetType()];
+      stats.completed++;
+      stats.totalRunTime += runTime;
+      stats.maxRunTime = std::max(stats.maxRunTime, runTime);
     }
     return item;
   }();
@@ -404,6 +423,77 @@ void CJobManager::RemoveWorker(const CJobWorker* worker)
     m_workers.erase(i); // workers auto-delete
 }
 
+std::vector<CJobManager::JobStatistics> CJobManager::GetStatistics() const
+{
+  std::unique_lock lock(m_section);
+
+  // jobs of the same type may return different pointers to equal strings, merge them here
+  std::unordered_map<std::string, JobStatistics> statistics;
+  for (const auto& [type, stats] : m_statistics)
+  {
+    JobStatistics& merged = statistics[type];
+    merged.started += stats.started;
+    merged.completed += stats.completed;
+    merged.totalWaitTime += stats.totalWaitTime;
+    merged.maxWaitTime = std::max(merged.maxWaitTime, stats.maxWaitTime);
+    merged.totalRunTime += stats.totalRunTime;
+    merged.maxRunTime = std::max(merged.maxRunTime, stats.maxRunTime);
+  }
+  for (const auto& queue : m_jobQueue)
+  {
+    for (const auto& wi : queue)
+      statistics[wi.GetJob()->GetType()].queued++;
+  }
+  for (const auto& wi : m_processing)
+    statistics[wi.GetJob()->GetType()].processing++;
+
+  std::vector<JobStatistics> result;
+  result.reserve(statistics.size());
+  for (auto& [type, stats] : statistics)
+  {
+    stats.type = type;
+    result.emplace_back(std::move(stats));
+  }
+  return result;
+}
+
+bool CJobManager::CanStart(CJob::PRIORITY priority) const
+{
+  if (priority == CJob::PRIORITY_DEDICATED)
+    return true;
+
+  unsigned int processing = 0;
+  for (unsigned int p = CJob::PRIORITY_LOW_PAUSABLE; p < CJob::PRIORITY_DEDICATED; ++p)
+    processing += m_processingCount[p];
+
+  // never more workers than the global cap, whatever the mix of priorities
+  if (processing >= GetMaxConcurrentWorkers())
+    return false;
+
+  // high priority jobs only count themselves, the lower lanes can't hold them back
+  if (priority == CJob::PRIORITY_HIGH)
+    return m_processingCount[CJob::PRIORITY_HIGH] < GetMaxWorkers(priority);
+
+  // the lower lanes share their budget and leave room for the higher ones
+  return processing < GetMaxWorkers(priority);
+}
+
+unsigned int CJobManager::GetMaxConcurrentWorkers()
+{
+  static const unsigned int maxConcurrentWorkers = []
+  {
+    const std::shared_ptr<CCPUInfo> cpuInfo = CServiceBroker::GetCPUInfo();
+    const unsigned int cpuCount = cpuInfo ? static_cast<unsigned int>(cpuInfo->GetCPUCount())
+                                          : std::thread::hardware_concurrency();
+
+    // one worker per core, but always room for a high priority job on top of the full lower
+    // lanes, and no more than all lanes together could use anyway
+    const unsigned int lowerLanes = GetMaxWorkers(CJob::PRIORITY_NORMAL);
+    return std::clamp(cpuCount, lowerLanes + 1, lowerLanes + GetMaxWorkers(CJob::PRIORITY_HIGH));
+  }();
+  return maxConcurrentWorkers;
+}
+
 unsigned int CJobManager::GetMaxWorkers(CJob::PRIORITY priority)
 {
   static const unsigned int max_workers = 5;
@@ -16,7 +16,9 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <queue>
+#include <stdint.h>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -30,13 +32,33 @@ class IJobCallback;
  Controls asynchronous job execution, by allowing clients to add and cancel jobs.
  Should be accessed via CServiceBroker::GetJobManager().  Jobs are allocated based
  on priority levels.  Lower priority jobs are executed only if there are sufficient
- spare worker threads free to allow for higher priority jobs that may arise.
+ spare worker threads free to allow for higher priority jobs that may arise.  High priority
+ jobs have a lane of their own, which only counts high priority jobs, so the lower priority
+ jobs never hold them back.  All lanes together stay below a global cap of concurrently
+ processing jobs; dedicated jobs run on their own threads and are not counted.
 
  \sa CJob and IJobCallback
  */
 class CJobManager final
 {
 public:
+  /*!
+   \brief Live statistics of the jobs of one type.
+   \sa GetStatistics()
+   */
+  struct JobStatistics
+  {
+    std::string type; //!< type of the jobs as returned by CJob::GetType()
+    size_t queued{0}; //!< number of jobs currently waiting in the queue
+    size_t processing{0}; //!< number of jobs currently processing
+    uint64_t started{0}; //!< number of jobs taken from the queue since start
+    uint64_t completed{0}; //!< number of jobs completed since start
+    std::chrono::microseconds totalWaitTime{0}; //!< time spent in the queue by all started jobs
+    std::chrono::microseconds maxWaitTime{0}; //!< longest time a job spent in the queue
+    std::chrono::microseconds totalRunTime{0}; //!< time spent processing by all completed jobs
+    std::chrono::microseconds maxRunTime{0}; //!< longest time a job spent processing
+  };
+
   CJobManager() = default;
 
   /*!
@@ -170,6 +192,19 @@ public:
    */
   size_t GetPendingCallbackCount(const CJob* job) const;
 
+  /*!
+   \brief Get the statistics of all job types seen so far.
+   \return the statistics, one entry per job type
+   \sa JobStatistics
+   */
+  std::vector<JobStatistics> GetStatistics() const;
+
+  /*!
+   \brief Get the maximum number of workers processing non-dedicated jobs at the same time.
+   \return the number of CPU cores, bounded by the worker budgets of the priority lanes
+   */
+  static unsigned int GetMaxConcurrentWorkers();
+
 private:
   CJobManager(const CJobManager&) = delete;
   CJobManager const& operator=(CJobManager const&) = delete;
@@ -183,7 +218,8 @@ private:
     CWorkItem(CJob* job, unsigned int id, CJob::PRIORITY priority, IJobCallback* callback)
       : m_job(job),
         m_id(id),
-        m_priority(priority)
+        m_priority(priority),
+        m_queued(std::chrono::steady_clock::now())
     {
       if (callback)
         m_callbacks.push_back(callback);
@@ -213,12 +249,17 @@ private:
       return callback;
     }
     CJob::PRIORITY GetPriority() const { return m_priority; }
+    std::chrono::steady_clock::time_point GetQueueTime() const { return m_queued; }
+    std::chrono::steady_clock::time_point GetStartTime() const { return m_started; }
+    void SetStartTime(std::chrono::steady_clock::time_point started) { m_started = started; }
 
   private:
     CJob* m_job{nullptr};
     unsigned int m_id{0};
     std::vector<IJobCallback*> m_callbacks;
     CJob::PRIORITY m_priority{CJob::PRIORITY::PRIORITY_LOW};
+    std::chrono::steady_clock::time_point m_queued;
+    std::chrono::steady_clock::time_point m_started;
   };
 
   /*! \brief Pop a job off the job queue and add to the processing queue ready to process
@@ -230,6 +271,12 @@ private:
   void RemoveWorker(const CJobWorker* worker);
   static unsigned int GetMaxWorkers(CJob::PRIORITY priority);
 
+  /*! \brief Check whether the lane of a priority has a free worker slot
+   \param priority the priority of the job to start
+   \return true if both the lane of the priority and the global cap have a free slot
+   */
+  bool CanStart(CJob::PRIORITY priority) const;
+
   unsigned int m_jobCounter{0};
 
   using JobQueue = std::deque<CWorkItem>;
@@ -239,7 +286,10 @@ private:
   std::array<JobQueue, CJob::PRIORITY_DEDICATED + 1> m_jobQueue;
   bool m_pauseJobs{false};
   Processing m_processing;
+  std::array<unsigned int, CJob::PRIORITY_DEDICATED + 1> m_processingCount{};
   Workers m_workers;
+  // keyed by the pointer returned by CJob::GetType() to keep hashing strings off the hot path
+  std::unordered_map<const char*, JobStatistics> m_statistics;
 
   mutable CCriticalSection m_section;
   CEvent m_jobEvent;
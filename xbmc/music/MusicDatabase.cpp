@@ -68,9 +68,11 @@
 
 #include <array>
 #include <chrono>
+#include <cmath>
 #include <inttypes.h>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -252,6 +254,10 @@ void CMusicDatabase::CreateTables()
 
   CLog::Log(LOGINFO, "create removed_link table");
   m_pDS->exec("CREATE TABLE removed_link (idArtist INTEGER, idMedia INTEGER, idRole INTEGER)");
+
+  CLog::Log(LOGINFO, "create librarystats table");
+  m_pDS->exec("CREATE TABLE librarystats (strType VARCHAR(20) PRIMARY KEY, "
+              "iCount INTEGER NOT NULL DEFAULT 0)");
 }
 
 void CMusicDatabase::CreateAnalytics()
@@ -304,23 +310,39 @@ void CMusicDatabase::CreateAnalytics()
   m_pDS->exec("CREATE INDEX ix_art ON art(media_id, media_type(20), type(20))");
 
   CLog::Log(LOGINFO, "create triggers");
-  m_pDS->exec("CREATE TRIGGER tgrDeleteAlbum AFTER delete ON album FOR EACH ROW BEGIN"
-              "  DELETE FROM song WHERE song.idAlbum = old.idAlbum;"
-              "  DELETE FROM album_artist WHERE album_artist.idAlbum = old.idAlbum;"
-              "  DELETE FROM album_source WHERE album_source.idAlbum = old.idAlbum;"
-              "  DELETE FROM art WHERE media_id=old.idAlbum AND media_type='album';"
-              " END");
+  const std::string single = CAlbum::ReleaseTypeToString(ReleaseType::Single);
+
+  // the counts of the librarystats table are updated before the songs of the album are removed
+  m_pDS->exec(PrepareSQL(
+      "CREATE TRIGGER tgrDeleteAlbum AFTER delete ON album FOR EACH ROW BEGIN"
+      "  UPDATE librarystats SET iCount = iCount - CASE strType WHEN 'album' THEN 1"
+      "  WHEN 'compilation' THEN (old.bCompilation = 1) WHEN 'boxset' THEN (old.bBoxedSet = 1)"
+      "  ELSE (CASE WHEN old.strReleaseType = '%s' THEN 1 ELSE 0 END) *"
+      "  (SELECT COUNT(1) FROM song WHERE song.idAlbum = old.idAlbum) END"
+      "  WHERE strType IN ('album', 'compilation', 'boxset', 'single');"
+      "  DELETE FROM song WHERE song.idAlbum = old.idAlbum;"
+      "  DELETE FROM album_artist WHERE album_artist.idAlbum = old.idAlbum;"
+      "  DELETE FROM album_source WHERE album_source.idAlbum = old.idAlbum;"
+      "  DELETE FROM art WHERE media_id=old.idAlbum AND media_type='album';"
+      " END",
+      single.c_str()));
   m_pDS->exec("CREATE TRIGGER tgrDeleteArtist AFTER delete ON artist FOR EACH ROW BEGIN"
               "  DELETE FROM album_artist WHERE album_artist.idArtist = old.idArtist;"
               "  DELETE FROM song_artist WHERE song_artist.idArtist = old.idArtist;"
               "  DELETE FROM discography WHERE discography.idArtist = old.idArtist;"
               "  DELETE FROM art WHERE media_id=old.idArtist AND media_type='artist';"
               " END");
-  m_pDS->exec("CREATE TRIGGER tgrDeleteSong AFTER delete ON song FOR EACH ROW BEGIN"
-              "  DELETE FROM song_artist WHERE song_artist.idSong = old.idSong;"
-              "  DELETE FROM song_genre WHERE song_genre.idSong = old.idSong;"
-              "  DELETE FROM art WHERE media_id=old.idSong AND media_type='song';"
-              " END");
+  m_pDS->exec(PrepareSQL(
+      "CREATE TRIGGER tgrDeleteSong AFTER delete ON song FOR EACH ROW BEGIN"
+      "  UPDATE librarystats SET iCount = iCount - CASE strType WHEN 'song' THEN 1"
+      "  ELSE (SELECT COUNT(1) FROM album WHERE album.idAlbum = old.idAlbum"
+      "  AND album.strReleaseType = '%s') END"
+      "  WHERE strType IN ('song', 'single');"
+      "  DELETE FROM song_artist WHERE song_artist.idSong = old.idSong;"
+      "  DELETE FROM song_genre WHERE song_genre.idSong = old.idSong;"
+      "  DELETE FROM art WHERE media_id=old.idSong AND media_type='song';"
+      " END",
+      single.c_str()));
   m_pDS->exec("CREATE TRIGGER tgrDeleteSource AFTER delete ON source FOR EACH ROW BEGIN"
               "  DELETE FROM source_path WHERE source_path.idSource = old.idSource;"
               "  DELETE FROM album_source WHERE album_source.idSource = old.idSource;"
@@ -408,6 +430,48 @@ void CMusicDatabase::CreateAnalytics()
               "END");
   CreateRemovedLinkTriggers(); // DELETE ON song_artist and album_artist tables
 
+  // Triggers to maintain the counts of the librarystats table, see UpdateLibraryStats()
+  m_pDS->exec(PrepareSQL(
+      "CREATE TRIGGER tgrStatsInsertSong AFTER INSERT ON song FOR EACH ROW BEGIN"
+      "  UPDATE librarystats SET iCount = iCount + CASE strType WHEN 'song' THEN 1"
+      "  ELSE (SELECT COUNT(1) FROM album WHERE album.idAlbum = NEW.idAlbum"
+      "  AND album.strReleaseType = '%s') END"
+      "  WHERE strType IN ('song', 'single');"
+      " END",
+      single.c_str()));
+  m_pDS->exec(PrepareSQL(
+      "CREATE TRIGGER tgrStatsUpdateSong AFTER UPDATE ON song FOR EACH ROW BEGIN"
+      "  UPDATE librarystats SET iCount = iCount"
+      "  + (SELECT COUNT(1) FROM album WHERE album.idAlbum = NEW.idAlbum"
+      "  AND album.strReleaseType = '%s')"
+      "  - (SELECT COUNT(1) FROM album WHERE album.idAlbum = OLD.idAlbum"
+      "  AND album.strReleaseType = '%s')"
+      "  WHERE strType = 'single' AND NEW.idAlbum <> OLD.idAlbum;"
+      " END",
+      single.c_str(), single.c_str()));
+  m_pDS->exec("CREATE TRIGGER tgrStatsInsertAlbum AFTER INSERT ON album FOR EACH ROW BEGIN"
+              "  UPDATE librarystats SET iCount = iCount + CASE strType WHEN 'album' THEN 1"
+              "  WHEN 'compilation' THEN (NEW.bCompilation = 1) ELSE (NEW.bBoxedSet = 1) END"
+              "  WHERE strType IN ('album', 'compilation', 'boxset');"
+              " END");
+  m_pDS->exec(PrepareSQL(
+      "CREATE TRIGGER tgrStatsUpdateAlbum AFTER UPDATE ON album FOR EACH ROW BEGIN"
+      "  UPDATE librarystats SET iCount = iCount + CASE strType"
+      "  WHEN 'compilation' THEN (NEW.bCompilation = 1) - (OLD.bCompilation = 1)"
+      "  WHEN 'boxset' THEN (NEW.bBoxedSet = 1) - (OLD.bBoxedSet = 1)"
+      "  ELSE ((CASE WHEN NEW.strReleaseType = '%s' THEN 1 ELSE 0 END)"
+      "  - (CASE WHEN OLD.strReleaseType = '%s' THEN 1 ELSE 0 END))"
+      "  * (SELECT COUNT(1) FROM song WHERE song.idAlbum = NEW.idAlbum) END"
+      "  WHERE strType IN ('compilation', 'boxset', 'single');"
+      " END",
+      single.c_str(), single.c_str()));
+  UpdateLibraryStats();
+
+  // Full-text search indexes (SQLite only, searches fall back to LIKE scans without them)
+  CreateSearchIndex("songsearch", "song", "idSong", {"strTitle"});
+  CreateSearchIndex("albumsearch", "album", "idAlbum", {"strAlbum"});
+  CreateSearchIndex("artistsearch", "artist", "idArtist", {"strArtist"});
+
   // Create native functions stored in DB (MySQL/MariaDB only)
   CreateNativeDBFunctions();
 
@@ -722,7 +786,10 @@ void CMusicDatabase::SplitPath(const std::string& strFileNameAndPath,
 
 bool CMusicDatabase::AddAlbum(CAlbum& album, int idSource)
 {
-  BeginTransaction();
+  // the scanner adds albums in batches sharing a transaction
+  const bool ownTransaction = !InTransaction();
+  if (ownTransaction)
+    BeginTransaction();
   SetLibraryLastUpdated();
 
   album.idAlbum = AddAlbum(album.strAlbum, //
@@ -902,7 +969,8 @@ bool CMusicDatabase::AddAlbum(CAlbum& album, int idSource)
                       albumdateadded.c_str(), strIDs.c_str(), albumdateadded.c_str());
   m_pDS->exec(strSQL);
 
-  CommitTransaction();
+  if (ownTransaction)
+    CommitTransaction();
   return true;
 }
 
@@ -1089,17 +1157,24 @@ int CMusicDatabase::AddSong(const int idSong,
 
     if (idSong <= 1)
     {
+      bool result;
       if (!strMusicBrainzTrackID.empty())
-        strSQL = PrepareSQL("SELECT idSong FROM song WHERE "
-                            "idAlbum = %i AND iTrack=%i AND strMusicBrainzTrackID = '%s'",
-                            idAlbum, iTrack, strMusicBrainzTrackID.c_str());
+      {
+        strSQL = "SELECT idSong FROM song WHERE "
+                 "idAlbum = ? AND iTrack = ? AND strMusicBrainzTrackID = ?";
+        result = m_pDS->query(strSQL,
+                              dbiplus::make_bind_list(idAlbum, iTrack, strMusicBrainzTrackID));
+      }
       else
-        strSQL = PrepareSQL("SELECT idSong FROM song WHERE "
-                            "idAlbum=%i AND strFileName='%s' AND strTitle='%s' AND iTrack=%i "
-                            "AND strMusicBrainzTrackID IS NULL",
-                            idAlbum, strFileName.c_str(), strTitle.c_str(), iTrack);
+      {
+        strSQL = "SELECT idSong FROM song WHERE "
+                 "idAlbum = ? AND strFileName = ? AND strTitle = ? AND iTrack = ? "
+                 "AND strMusicBrainzTrackID IS NULL";
+        result =
+            m_pDS->query(strSQL, dbiplus::make_bind_list(idAlbum, strFileName, strTitle, iTrack));
+      }
 
-      if (!m_pDS->query(strSQL))
+      if (!result)
         return -1;
     }
     if (m_pDS->num_rows() == 0)
@@ -1123,6 +1198,8 @@ int CMusicDatabase::AddSong(const int idSong,
       // Get dateAdded from music file timestamp
       std::string strDateMedia = GetMediaDateFromFile(strPathAndFileName);
 
+      // Song ID is autoincremented and dateNew set by trigger unless the Id and the original date
+      // when the Id was added are reused
       strSQL = "INSERT INTO song ("
                "idSong, dateNew, idAlbum, idPath, strArtistDisp, "
                "strTitle, iTrack, iDuration, "
@@ -1131,42 +1208,33 @@ int CMusicDatabase::AddSong(const int idSong,
                "strDiscSubtitle, strFileName, dateAdded,  "
                "strMusicBrainzTrackID, strArtistSort, "
                "iTimesPlayed, iStartOffset, iEndOffset, "
-               "lastplayed, rating, userrating, votes, comment, mood, strReplayGain) ";
-
-      if (idSong <= 0)
-        // Song ID is autoincremented and dateNew set by trigger
-        strSQL += PrepareSQL("VALUES (NULL, NULL, ");
-      else
-        //Reuse song Id and original date when the Id added
-        strSQL += PrepareSQL("VALUES (%i, '%s', ", idSong, dtDateNew.GetAsDBDateTime().c_str());
-
-      strSQL +=
-          PrepareSQL("%i, %i, '%s', '%s', %i, %i, '%s', '%s', %i, %i, %i, %i,'%s', '%s', '%s' ",
-                     idAlbum, idPath, artistDisp.c_str(), strTitle.c_str(), iTrack, iDuration,
-                     strRelease.c_str(), strOriginal.c_str(), iBPM, iBitRate, iSampleRate,
-                     iChannels, strDiscSubtitle.c_str(), strFileName.c_str(), strDateMedia.c_str());
-
-      if (strMusicBrainzTrackID.empty())
-        strSQL += PrepareSQL(",NULL");
-      else
-        strSQL += PrepareSQL(",'%s'", strMusicBrainzTrackID.c_str());
-      if (artistSort.empty() || artistSort.compare(artistDisp) == 0)
-        strSQL += PrepareSQL(",NULL");
-      else
-        strSQL += PrepareSQL(",'%s'", artistSort.c_str());
-
-      if (dtLastPlayed.IsValid())
-        strSQL += PrepareSQL(",%i,%i,%i,'%s', %.1f, %i, %i, '%s','%s', '%s')", //
-                             iTimesPlayed, iStartOffset, iEndOffset,
-                             dtLastPlayed.GetAsDBDateTime().c_str(), //
-                             static_cast<double>(rating), userrating, votes, //
-                             strComment.c_str(), strMood.c_str(), replayGain.Get().c_str());
-      else
-        strSQL += PrepareSQL(",%i,%i,%i,NULL, %.1f, %i, %i,'%s', '%s', '%s')", //
-                             iTimesPlayed, iStartOffset, iEndOffset, //
-                             static_cast<double>(rating), userrating, votes, //
-                             strComment.c_str(), strMood.c_str(), replayGain.Get().c_str());
-      m_pDS->exec(strSQL);
+               "lastplayed, rating, userrating, votes, comment, mood, strReplayGain) "
+               "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, "
+               "?, ?, ?, ?)";
+
+      const std::optional<int> id = idSong > 0 ? std::optional(idSong) : std::nullopt;
+      const std::optional<std::string> dateNew =
+          idSong > 0 ? std::optional(dtDateNew.GetAsDBDateTime()) : std::nullopt;
+      const std::optional<std::string> musicBrainzTrackID =
+          strMusicBrainzTrackID.empty() ? std::nullopt : std::optional(strMusicBrainzTrackID);
+      const std::optional<std::string> artistSortNew =
+          artistSort.empty() || artistSort == artistDisp ? std::nullopt
+                                                         : std::optional(artistSort);
+      const std::optional<std::string> lastPlayed =
+          dtLastPlayed.IsValid() ? std::optional(dtLastPlayed.GetAsDBDateTime()) : std::nullopt;
+      // rating is stored with one decimal
+      const double ratingNew = std::round(static_cast<double>(rating) * 10) / 10;
+
+      m_pDS->exec(strSQL,
+                  dbiplus::make_bind_list(id, dateNew, idAlbum, idPath, artistDisp, //
+                                          strTitle, iTrack, iDuration, //
+                                          strRelease, strOriginal, iBPM, //
+                                          iBitRate, iSampleRate, iChannels, //
+                                          strDiscSubtitle, strFileName, strDateMedia, //
+                                          musicBrainzTrackID, artistSortNew, //
+                                          iTimesPlayed, iStartOffset, iEndOffset, //
+                                          lastPlayed, ratingNew, userrating, votes, //
+                                          strComment, strMood, replayGain.Get()));
       if (idSong <= 0)
         idNew = static_cast<int>(m_pDS->lastinsertid());
       else
@@ -3077,16 +3145,14 @@ int CMusicDatabase::AddPath(const std::string& strPath1)
     if (it != m_pathCache.end())
       return it->second;
 
-    strSQL = PrepareSQL("SELECT * FROM path WHERE strPath='%s'", strPath.c_str());
-    m_pDS->query(strSQL);
+    strSQL = "SELECT idPath FROM path WHERE strPath = ?";
+    m_pDS->query(strSQL, dbiplus::make_bind_list(strPath));
     if (m_pDS->num_rows() == 0)
     {
       m_pDS->close();
       // doesn't exists, add it
-      strSQL = PrepareSQL("INSERT INTO path (idPath, strPath) "
-                          "VALUES(NULL, '%s')",
-                          strPath.c_str());
-      m_pDS->exec(strSQL);
+      strSQL = "INSERT INTO path (idPath, strPath) VALUES(NULL, ?)";
+      m_pDS->exec(strSQL, dbiplus::make_bind_list(strPath));
 
       const auto idPath = static_cast<int>(m_pDS->lastinsertid());
       m_pathCache.try_emplace(strPath, idPath);
@@ -3533,6 +3599,11 @@ bool CMusicDatabase::SearchArtists(const std::string& search, CFileItemList& art
                           "WHERE strArtist LIKE '%s%%' AND strArtist <> '%s' ",
                           search.c_str(), strVariousArtists.c_str());
 
+    const std::string indexed =
+        GetSearchCondition("artistsearch", "artist.idArtist", {"strArtist"}, search);
+    if (!indexed.empty())
+      strSQL += "AND " + indexed;
+
     if (!m_pDS->query(strSQL))
       return false;
     if (m_pDS->num_rows() == 0)
@@ -4171,7 +4242,17 @@ bool CMusicDatabase::SearchSongs(const std::string& search, CFileItemList& items
       return false;
 
     std::string strSQL;
-    if (search.size() >= MIN_FULL_SEARCH_LENGTH)
+    const std::string match = DatabaseUtils::BuildSearchMatch(search, {"strTitle"});
+    if (!match.empty() && HasSearchIndex("songsearch"))
+      // the index narrows the songs down and ranks them, so the limit keeps the best matches
+      strSQL = PrepareSQL("SELECT songview.* FROM songview "
+                          "JOIN (SELECT rowid AS idFound, rank FROM songsearch "
+                          "WHERE songsearch MATCH '%s') AS found "
+                          "ON found.idFound = songview.idSong "
+                          "WHERE strTitle LIKE '%s%%' or strTitle LIKE '%% %s%%' "
+                          "ORDER BY found.rank LIMIT 1000",
+                          match.c_str(), search.c_str(), search.c_str());
+    else if (search.size() >= MIN_FULL_SEARCH_LENGTH)
       strSQL = PrepareSQL("SELECT * FROM songview "
                           "WHERE strTitle LIKE '%s%%' or strTitle LIKE '%% %s%%' LIMIT 1000",
                           search.c_str(), search.c_str());
@@ -4216,13 +4297,18 @@ bool CMusicDatabase::SearchAlbums(const std::string& search, CFileItemList& albu
     std::string strSQL;
     if (search.size() >= MIN_FULL_SEARCH_LENGTH)
       strSQL = PrepareSQL("SELECT * FROM albumview "
-                          "WHERE strAlbum LIKE '%s%%' OR strAlbum LIKE '%% %s%%'",
+                          "WHERE (strAlbum LIKE '%s%%' OR strAlbum LIKE '%% %s%%') ",
                           search.c_str(), search.c_str());
     else
       strSQL = PrepareSQL("SELECT * FROM albumview "
-                          "WHERE strAlbum LIKE '%s%%'",
+                          "WHERE strAlbum LIKE '%s%%' ",
                           search.c_str());
 
+    const std::string indexed =
+        GetSearchCondition("albumsearch", "albumview.idAlbum", {"strAlbum"}, search);
+    if (!indexed.empty())
+      strSQL += "AND " + indexed;
+
     if (!m_pDS->query(strSQL))
       return false;
 
@@ -5827,6 +5913,7 @@ bool CMusicDatabase::GetAlbumsByWhere(const std::string& baseDir,
     std::string strSQLExtra;
     if (!BuildSQL(strSQLExtra, extFilter, strSQLExtra))
       return false;
+    const std::string listing = "SELECT albumview.* FROM albumview " + strSQLExtra;
 
     // Count number of albums that satisfy selection criteria (no limit built)
     // Count done in full query fetch when unlimited
@@ -5876,6 +5963,14 @@ bool CMusicDatabase::GetAlbumsByWhere(const std::string& baseDir,
       StringUtils::Replace(extFilter.order, "iYear", "CAST(strReleaseDate AS INTEGER)");
     else
       StringUtils::Replace(extFilter.order, "iYear", "CAST(strOrigReleaseDate AS INTEGER)");
+    // Read pages of a listing ordered by plain columns with keyset pagination
+    std::vector<std::string> keysetColumns;
+    const bool pagedInSQL =
+        limitedInSQL &&
+        DatabaseUtils::GetKeysetColumns(MediaTypeAlbum, sorting.sortBy, keysetColumns);
+    if (pagedInSQL)
+      SetKeysetPage(listing, keysetColumns, sorting.sortOrder == SortOrder::DESCENDING,
+                    sorting.limitStart, sorting.limitEnd, extFilter);
 
     strSQLExtra.clear();
     if (!BuildSQL(strSQLExtra, extFilter, strSQLExtra))
@@ -5892,6 +5987,8 @@ bool CMusicDatabase::GetAlbumsByWhere(const std::string& baseDir,
     auto querytime = std::chrono::steady_clock::now();
     if (!m_pDS->query(strSQL))
       return false;
+    if (pagedInSQL)
+      StoreKeysetPage(*m_pDS);
     int iRowsFound = m_pDS->num_rows();
     if (iRowsFound == 0)
     {
@@ -6226,6 +6323,7 @@ bool CMusicDatabase::GetSongsFullByWhere(const std::string& baseDir,
     std::string strSQLExtra;
     if (!BuildSQL(strSQLExtra, extFilter, strSQLExtra))
       return false;
+    const std::string listing = "SELECT songview.* FROM songview " + strSQLExtra;
 
     // Count (without group by) number of songs that satisfy selection criteria
     // Much quicker to use song table, not songview, when filtering only on song fields
@@ -6265,6 +6363,15 @@ bool CMusicDatabase::GetSongsFullByWhere(const std::string& baseDir,
       StringUtils::Replace(extFilter.order, "iYear", "CAST(strReleaseDate AS INTEGER)");
     else
       StringUtils::Replace(extFilter.order, "iYear", "CAST(strOrigReleaseDate AS INTEGER)");
+    // Read pages of a listing ordered by plain columns with keyset pagination, unless there are
+    // several rows per song with artist data
+    std::vector<std::string> keysetColumns;
+    const bool pagedInSQL =
+        limitedInSQL && !artistData &&
+        DatabaseUtils::GetKeysetColumns(MediaTypeSong, sorting.sortBy, keysetColumns);
+    if (pagedInSQL)
+      SetKeysetPage(listing, keysetColumns, sorting.sortOrder == SortOrder::DESCENDING,
+                    sorting.limitStart, sorting.limitEnd, extFilter);
 
     std::string strFields = "songview.*";
     if (!artistData || limitedInSQL)
@@ -6326,6 +6433,8 @@ bool CMusicDatabase::GetSongsFullByWhere(const std::string& baseDir,
     // run query
     if (!m_pDS->query(strSQL))
       return false;
+    if (pagedInSQL)
+      StoreKeysetPage(*m_pDS);
 
     int iRowsFound = m_pDS->num_rows();
     if (iRowsFound == 0)
@@ -7703,7 +7812,8 @@ bool CMusicDatabase::GetSongsByWhereJSON(
     const std::string& baseDir,
     CVariant& result,
     int& total,
-    const SortDescription& sortDescription /* = SortDescription() */)
+    const SortDescription& sortDescription /* = SortDescription() */,
+    const std::function<bool(CVariant& song)>& onSong /* = nullptr */)
 {
 
   if (nullptr == m_pDB)
@@ -8066,6 +8176,10 @@ bool CMusicDatabase::GetSongsByWhereJSON(
       return true;
     }
 
+    // Songs sorted to process multi-value joins have to be shuffled as a whole in the end
+    const bool bShuffle = sortDescription.sortBy == SortBy::RANDOM && joinLayout.HasFilterFields();
+    const bool bCollect = !onSong || bShuffle;
+
     // Get song from returned rows. Joins mean there can be many rows per song
     int songId = -1;
     int albumartistId = -1;
@@ -8075,7 +8189,8 @@ bool CMusicDatabase::GetSongsByWhereJSON(
     bool bSongArtistDone(false);
     bool bHaveSong(false);
     CVariant songObj;
-    result["songs"].reserve(resultcount);
+    if (bCollect)
+      result["songs"].reserve(resultcount);
     while (!m_pDS->eof() || bHaveSong)
     {
       const dbiplus::sql_record* const record = m_pDS->get_sql_record();
@@ -8114,7 +8229,10 @@ bool CMusicDatabase::GetSongsByWhereJSON(
                 songObj[displayXXX] = "";
             }
           }
-          result["songs"].append(songObj);
+          if (bCollect)
+            result["songs"].append(std::move(songObj));
+          else if (!onSong(songObj))
+            break;
           bHaveSong = false;
           songObj.clear();
         }
@@ -8275,8 +8393,19 @@ bool CMusicDatabase::GetSongsByWhereJSON(
     m_pDS->close(); // cleanup recordset data
 
     // Ensure random order of output when results set is sorted to process multi-value joins
-    if (sortDescription.sortBy == SortBy::RANDOM && joinLayout.HasFilterFields())
+    if (bShuffle)
+    {
       KODI::UTILS::RandomShuffle(result["songs"].begin_array(), result["songs"].end_array());
+      if (onSong)
+      {
+        for (auto it = result["songs"].begin_array(); it != result["songs"].end_array(); ++it)
+        {
+          if (!onSong(*it))
+            break;
+        }
+        result.erase("songs");
+      }
+    }
 
     return true;
   }
@@ -9361,6 +9490,13 @@ void CMusicDatabase::UpdateTables(int version)
   if (version < 83)
     m_pDS->exec("ALTER TABLE song ADD strVideoURL TEXT");
 
+  if (version < 86)
+  {
+    // filled when the analytics are created
+    m_pDS->exec("CREATE TABLE librarystats (strType VARCHAR(20) PRIMARY KEY, "
+                "iCount INTEGER NOT NULL DEFAULT 0)");
+  }
+
   // Set the version of tag scanning required.
   // Not every schema change requires the tags to be rescanned, set to the highest schema version
   // that needs this. Forced rescanning (of music files that have not changed since they were
@@ -9381,7 +9517,7 @@ void CMusicDatabase::UpdateTables(int version)
 
 int CMusicDatabase::GetSchemaVersion() const
 {
-  return 84;
+  return 86;
 }
 
 int CMusicDatabase::GetMusicNeedsTagScan()
@@ -11116,7 +11252,7 @@ std::string CMusicDatabase::GetAlbumDiscTitle(int idAlbum, int idDisc) const
 
 int CMusicDatabase::GetBoxsetsCount() const
 {
-  return GetSingleValueInt("album", "count(idAlbum)", "bBoxedSet = 1");
+  return GetSingleValueInt("librarystats", "iCount", "strType = 'boxset'");
 }
 
 int CMusicDatabase::GetAlbumDiscsCount(int idAlbum) const
@@ -11127,15 +11263,85 @@ int CMusicDatabase::GetAlbumDiscsCount(int idAlbum) const
 
 int CMusicDatabase::GetCompilationAlbumsCount() const
 {
-  return GetSingleValueInt("album", "count(idAlbum)", "bCompilation = 1");
+  return GetSingleValueInt("librarystats", "iCount", "strType = 'compilation'");
 }
 
 int CMusicDatabase::GetSinglesCount()
 {
-  CDatabase::Filter filter(
-      PrepareSQL("songview.idAlbum IN (SELECT idAlbum FROM album WHERE strReleaseType = '%s')",
-                 CAlbum::ReleaseTypeToString(ReleaseType::Single).c_str()));
-  return GetSongsCount(filter);
+  return GetSingleValueInt("librarystats", "iCount", "strType = 'single'");
+}
+
+bool CMusicDatabase::GetLibraryStats(LibraryStats& stats) const
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    m_pDS->query("SELECT strType, iCount FROM librarystats");
+    while (!m_pDS->eof())
+    {
+      const std::string type = m_pDS->fv(0).get_asString();
+      const int count = m_pDS->fv(1).get_asInt();
+      if (type == "song")
+        stats.songs = count;
+      else if (type == "album")
+        stats.albums = count;
+      else if (type == "single")
+        stats.singles = count;
+      else if (type == "compilation")
+        stats.compilations = count;
+      else if (type == "boxset")
+        stats.boxsets = count;
+      m_pDS->next();
+    }
+    m_pDS->close();
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed");
+  }
+  return false;
+}
+
+void CMusicDatabase::UpdateLibraryStats()
+{
+  if (nullptr == m_pDB)
+    return;
+  if (nullptr == m_pDS)
+    return;
+
+  const bool transaction = !InTransaction();
+  try
+  {
+    if (transaction)
+      BeginTransaction();
+
+    m_pDS->exec("DELETE FROM librarystats");
+    m_pDS->exec("INSERT INTO librarystats (strType, iCount) SELECT 'song', COUNT(1) FROM song");
+    m_pDS->exec("INSERT INTO librarystats (strType, iCount) SELECT 'album', COUNT(1) FROM album");
+    m_pDS->exec(PrepareSQL("INSERT INTO librarystats (strType, iCount) "
+                           "SELECT 'single', COUNT(1) FROM song "
+                           "JOIN album ON album.idAlbum = song.idAlbum "
+                           "WHERE album.strReleaseType = '%s'",
+                           CAlbum::ReleaseTypeToString(ReleaseType::Single).c_str()));
+    m_pDS->exec("INSERT INTO librarystats (strType, iCount) "
+                "SELECT 'compilation', COUNT(1) FROM album WHERE bCompilation = 1");
+    m_pDS->exec("INSERT INTO librarystats (strType, iCount) "
+                "SELECT 'boxset', COUNT(1) FROM album WHERE bBoxedSet = 1");
+
+    if (transaction)
+      CommitTransaction();
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed");
+    if (transaction)
+      RollbackTransaction();
+  }
 }
 
 int CMusicDatabase::GetArtistCountForRole(int role) const
@@ -11510,8 +11716,10 @@ bool CMusicDatabase::CommitTransaction()
     CGUIComponent* gui = CServiceBroker::GetGUI();
     if (gui)
     {
+      LibraryStats stats;
+      GetLibraryStats(stats);
       gui->GetInfoManager().GetInfoProviders().GetLibraryInfoProvider().SetLibraryBool(
-          LIBRARY_HAS_MUSIC, GetSongsCount() > 0);
+          LIBRARY_HAS_MUSIC, stats.songs > 0);
       return true;
     }
   }
@@ -20,6 +20,7 @@
 #include "utils/SortUtils.h"
 
 #include <cctype>
+#include <functional>
 #include <map>
 #include <set>
 #include <string>
@@ -259,6 +260,7 @@ public:
   // Album
   /////////////////////////////////////////////////
   /*! \brief Add an album and all its songs to the database
+  An open transaction is used, otherwise the album is added in a transaction of its own.
   \param album the album to add
   \param idSource the music source id
   \return the id of the album
@@ -539,6 +541,29 @@ public:
 
   int GetSinglesCount();
 
+  struct LibraryStats
+  {
+    int songs{0};
+    int albums{0};
+    int singles{0}; //!< songs on albums of the single release type
+    int compilations{0};
+    int boxsets{0};
+  };
+
+  /*!
+   \brief Get the number of songs and albums in the library
+   \details The counts are kept up to date by triggers in the librarystats table, so they are
+   read without going through the song and album tables.
+   \param stats [out] the counts
+   \return true on success, false otherwise
+   */
+  bool GetLibraryStats(LibraryStats& stats) const;
+
+  /*!
+   \brief Count the songs and albums of the library statistics again
+   */
+  void UpdateLibraryStats();
+
   int GetArtistCountForRole(int role) const;
   int GetArtistCountForRole(const std::string& strRole) const;
 
@@ -664,11 +689,16 @@ public:
                             CVariant& result,
                             int& total,
                             const SortDescription& sortDescription);
+  /*! \brief Get the songs matching a filter as JSON-RPC objects
+  \param onSong if set, it is called for every song as soon as it has been read, instead of
+  adding the song to result["songs"]. Reading stops when it returns false.
+  */
   bool GetSongsByWhereJSON(const std::set<std::string, std::less<>>& fields,
                            const std::string& baseDir,
                            CVariant& result,
                            int& total,
-                           const SortDescription& sortDescription);
+                           const SortDescription& sortDescription,
+                           const std::function<bool(CVariant& song)>& onSong = nullptr);
 
   /////////////////////////////////////////////////
   // Scraper
@@ -12,6 +12,7 @@
 #include "ServiceBroker.h"
 #include "Util.h"
 #include "dialogs/GUIDialogProgress.h"
+#include "filesystem/DirectoryChangeDetector.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIWindowManager.h"
 #include "music/infoscanner/MusicInfoScanner.h"
@@ -29,7 +30,9 @@
 
 CMusicLibraryQueue::CMusicLibraryQueue()
   : CJobQueue(false, 1, CJob::PRIORITY_LOW),
-    m_jobs()
+    m_jobs(),
+    m_changeDetector(std::make_unique<XFILE::CDirectoryChangeDetector>(
+        "special://database/MusicFolders.json"))
 { }
 
 CMusicLibraryQueue::~CMusicLibraryQueue()
@@ -191,6 +194,9 @@ void CMusicLibraryQueue::StopLibraryScanning()
 
 void CMusicLibraryQueue::CleanLibrary(bool showDialog /* = false */)
 {
+  // cleaning may remove songs of folders which haven't changed
+  m_changeDetector->Reset();
+
   CGUIDialogProgress* progress = NULL;
   if (showDialog)
   {
@@ -13,12 +13,18 @@
 #include "threads/CriticalSection.h"
 
 #include <map>
+#include <memory>
 #include <set>
 
 class CGUIDialogProgressBarHandle;
 class CMusicLibraryJob;
 class CGUIDialogProgress;
 
+namespace XFILE
+{
+class CDirectoryChangeDetector;
+}
+
 /*!
  \brief Queue for music library jobs.
 
@@ -110,6 +116,11 @@ public:
    */
   bool IsRunning() const;
 
+  /*!
+   \brief Gets the detector of the folders changed since the last library update.
+   */
+  XFILE::CDirectoryChangeDetector& GetChangeDetector() { return *m_changeDetector; }
+
 protected:
   // implementation of IJobCallback
   void OnJobComplete(unsigned int jobID, bool success, CJob *job) override;
@@ -131,4 +142,6 @@ private:
 
   bool m_modal = false;
   bool m_cleaning = false;
+
+  std::unique_ptr<XFILE::CDirectoryChangeDetector> m_changeDetector;
 };
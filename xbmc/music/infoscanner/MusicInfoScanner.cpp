@@ -29,6 +29,7 @@
 #include "events/EventLog.h"
 #include "events/MediaLibraryEvent.h"
 #include "filesystem/Directory.h"
+#include "filesystem/DirectoryChangeDetector.h"
 #include "filesystem/MusicDatabaseDirectory.h"
 #include "filesystem/MusicDatabaseDirectory/DirectoryNode.h"
 #include "filesystem/MusicDatabaseDirectory/QueryParams.h"
@@ -38,6 +39,7 @@
 #include "guilib/GUIWindowManager.h"
 #include "imagefiles/ImageFileURL.h"
 #include "interfaces/AnnouncementManager.h"
+#include "jobs/JobQueue.h"
 #include "music/MusicFileItemClassify.h"
 #include "music/MusicLibraryQueue.h"
 #include "music/MusicThumbLoader.h"
@@ -50,6 +52,7 @@
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "threads/Event.h"
 #include "utils/Digest.h"
 #include "utils/FileExtensionProvider.h"
 #include "utils/FileUtils.h"
@@ -59,6 +62,8 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <string_view>
 #include <utility>
 
@@ -69,6 +74,33 @@ using namespace MUSICDATABASEDIRECTORY;
 using namespace MUSIC_GRABBER;
 using namespace ADDON;
 using KODI::UTILITY::CDigest;
+using namespace std::chrono_literals;
+
+namespace
+{
+// folders read ahead of the one added to the library next
+constexpr size_t MAX_FOLDERS_READ_AHEAD = 8;
+// songs added to the library in a transaction
+constexpr int SONGS_PER_TRANSACTION = 500;
+
+bool HasTags(const CFileItem& item, const std::vector<std::string>& excludeRegExps)
+{
+  if (CUtil::ExcludeFileOrFolder(item.GetPath(), excludeRegExps))
+    return false;
+
+  return !item.IsFolder() && !PLAYLIST::IsPlayList(item) && !item.IsPicture() &&
+         !MUSIC::IsLyrics(item);
+}
+} // unnamed namespace
+
+struct CMusicInfoScanner::ScannedFolder
+{
+  std::string strDirectory;
+  std::string hash;
+  CFileItemList items;
+  std::atomic<int> unread{0}; //!< files whose tags are still being read
+  CEvent read{true};
+};
 
 CMusicInfoScanner::CMusicInfoScanner()
 : m_fileCountReader(this, "MusicFileCounter")
@@ -121,8 +153,9 @@ void CMusicInfoScanner::Process()
       m_currentItem=0;
       m_itemCount=-1;
 
-      // Create the thread to count all files to be scanned
-      if (m_handle)
+      // Create the thread to count all files to be scanned, unless only changed folders are
+      // looked into as counting would walk all of them
+      if (m_handle && !m_changeDetector)
         m_fileCountReader.Create();
 
       // Database operations should not be canceled
@@ -131,10 +164,32 @@ void CMusicInfoScanner::Process()
       m_bCanInterrupt = false;
       m_needsCleanup = false;
 
+      const int tagReaders =
+          CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_iMusicLibraryTagReaders;
+      m_tagReaders =
+          std::make_unique<CJobQueue>(false, static_cast<unsigned int>(tagReaders),
+                                      CJob::PRIORITY_DEDICATED);
+
+      if (m_changeDetector)
+      {
+        m_changedFolders.clear();
+        m_changeDetector->GetChangedFolders(m_pathsToScan, m_changedFolders, m_bStop);
+        CLog::Log(LOGDEBUG, "{} - {} folders changed since the last update", __FUNCTION__,
+                  m_changedFolders.size());
+      }
+
       bool commit = true;
       for (const auto& it : m_pathsToScan)
       {
-        if (!CDirectory::Exists(it) && !m_bClean)
+        if (m_bStop)
+        {
+          commit = false;
+          break;
+        }
+
+        // unchanged folders are known to exist, or are offline and left alone
+        if ((!m_changeDetector || m_changedFolders.contains(it)) && !CDirectory::Exists(it) &&
+            !m_bClean)
         {
           /*
            * Note that this will skip scanning (if m_bClean is disabled) if the directory really
@@ -151,6 +206,8 @@ void CMusicInfoScanner::Process()
         // Clear list of albums added by this scan
         m_albumsAdded.clear();
         bool scancomplete = DoScan(it);
+        // add the folders still being read, or drop them if the scan has been stopped
+        scancomplete = WriteScannedFolders(true) && scancomplete;
         if (scancomplete)
         {
           if (!m_albumsAdded.empty())
@@ -199,7 +256,18 @@ void CMusicInfoScanner::Process()
         }
       }
 
+      if (m_changeDetector)
+      {
+        if (commit)
+          m_changeDetector->CommitChanges();
+        else
+          m_changeDetector->DiscardChanges();
+        m_changeDetector = nullptr;
+        m_changedFolders.clear();
+      }
+
       m_fileCountReader.StopThread();
+      m_tagReaders.reset();
 
       m_musicDatabase.EmptyCache();
 
@@ -315,6 +383,13 @@ void CMusicInfoScanner::Start(const std::string& strDirectory, int flags)
     // db, and crossing them off the list as we go.
     m_musicDatabase.GetPaths(m_pathsToScan);
     m_idSourcePath = -1;
+
+    // the folders of an emptied library have to be looked into again
+    if (CServiceBroker::GetSettingsComponent()
+            ->GetAdvancedSettings()
+            ->m_bMusicLibraryIncrementalUpdate &&
+        m_musicDatabase.GetSongsCount() == 0)
+      CMusicLibraryQueue::GetInstance().GetChangeDetector().Reset();
   }
   else
   {
@@ -323,7 +398,15 @@ void CMusicInfoScanner::Start(const std::string& strDirectory, int flags)
   }
   m_musicDatabase.Close();
 
-  m_bClean = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_bMusicLibraryCleanOnUpdate;
+  const auto advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+  m_bClean = advancedSettings->m_bMusicLibraryCleanOnUpdate;
+
+  // an update of the whole library only needs to look into the folders which changed since the
+  // last one, a rescan looks into everything
+  m_changeDetector = nullptr;
+  if (strDirectory.empty() && !(flags & SCAN_RESCAN) &&
+      advancedSettings->m_bMusicLibraryIncrementalUpdate)
+    m_changeDetector = &CMusicLibraryQueue::GetInstance().GetChangeDetector();
 
   m_scanType = 0;
   m_bRunning = true;
@@ -500,6 +583,22 @@ bool CMusicInfoScanner::DoScan(const std::string& strDirectory)
   if (CUtil::ExcludeFileOrFolder(strDirectory, regexps))
     return true;
 
+  std::vector<std::string> subFolders;
+  if (m_changeDetector && !m_changedFolders.contains(strDirectory) &&
+      m_changeDetector->GetSubFolders(strDirectory, subFolders))
+  {
+    // nothing has been added to or removed from this folder since the last update, so only its
+    // subfolders need to be looked into
+    for (const auto& subFolder : subFolders)
+    {
+      if (m_bStop)
+        break;
+      if (!DoScan(subFolder))
+        m_bStop = true;
+    }
+    return !m_bStop;
+  }
+
   if (HasNoMedia(strDirectory))
     return true;
 
@@ -533,15 +632,10 @@ bool CMusicInfoScanner::DoScan(const std::string& strDirectory)
     items.FilterCueItems();
     items.Sort(SortBy::LABEL, SortOrder::ASCENDING);
 
-    // and then scan in the new information from tags
-    if (RetrieveMusicInfo(strDirectory, items) > 0)
-    {
-      if (m_handle)
-        OnDirectoryScanned(strDirectory);
-    }
-
-    // save information about this folder
-    m_musicDatabase.SetPathHash(strDirectory, hash);
+    // and then scan in the new information from tags, while going on with the next folders
+    ReadTags(strDirectory, items, hash);
+    if (!WriteScannedFolders(false))
+      return false;
   }
   else
   { // path is the same - no need to rescan
@@ -590,22 +684,12 @@ CInfoScanner::InfoRet CMusicInfoScanner::ScanTags(const CFileItemList& items,
 
     CFileItemPtr pItem = items[i];
 
-    if (CUtil::ExcludeFileOrFolder(pItem->GetPath(), regexps))
-      continue;
-
-    if (pItem->IsFolder() || PLAYLIST::IsPlayList(*pItem) || pItem->IsPicture() ||
-        MUSIC::IsLyrics(*pItem))
+    if (!HasTags(*pItem, regexps))
       continue;
 
     m_currentItem++;
 
-    CMusicInfoTag& tag = *pItem->GetMusicInfoTag();
-    if (!tag.Loaded())
-    {
-      std::unique_ptr<IMusicInfoTagLoader> pLoader (CMusicInfoTagLoaderFactory::CreateLoader(*pItem));
-      if (nullptr != pLoader)
-        pLoader->Load(pItem->GetPath(), tag);
-    }
+    const CMusicInfoTag& tag = *pItem->GetMusicInfoTag();
 
     if (m_handle && m_itemCount>0)
       m_handle->SetPercentage(static_cast<float>(m_currentItem * 100) / static_cast<float>(m_itemCount));
@@ -629,6 +713,97 @@ CInfoScanner::InfoRet CMusicInfoScanner::ScanTags(const CFileItemList& items,
   return InfoRet::ADDED;
 }
 
+void CMusicInfoScanner::ReadTags(const std::string& strDirectory,
+                                 const CFileItemList& items,
+                                 const std::string& hash)
+{
+  const std::vector<std::string>& regexps =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_audioExcludeFromScanRegExps;
+
+  auto folder = std::make_shared<ScannedFolder>();
+  folder->strDirectory = strDirectory;
+  folder->hash = hash;
+  // the scan goes on with the subfolders of the given items while the copies are read
+  folder->items.Copy(items);
+
+  std::vector<CFileItemPtr> unread;
+  for (const auto& item : folder->items)
+  {
+    if (HasTags(*item, regexps) && !item->GetMusicInfoTag()->Loaded())
+      unread.emplace_back(item);
+  }
+
+  folder->unread = static_cast<int>(unread.size());
+  if (unread.empty())
+    folder->read.Set();
+
+  for (auto& item : unread)
+  {
+    m_tagReaders->Submit(
+        [folder, item = std::move(item)]
+        {
+          std::unique_ptr<IMusicInfoTagLoader> pLoader(
+              CMusicInfoTagLoaderFactory::CreateLoader(*item));
+          if (nullptr != pLoader)
+            pLoader->Load(item->GetPath(), *item->GetMusicInfoTag());
+
+          if (--folder->unread == 0)
+            folder->read.Set();
+        });
+  }
+
+  m_scannedFolders.emplace_back(std::move(folder));
+}
+
+bool CMusicInfoScanner::WriteScannedFolders(bool all)
+{
+  while (!m_bStop && !m_scannedFolders.empty() &&
+         (all || m_scannedFolders.size() > MAX_FOLDERS_READ_AHEAD))
+  {
+    const std::shared_ptr<ScannedFolder> folder = m_scannedFolders.front();
+    while (!folder->read.Wait(100ms))
+    {
+      if (m_bStop)
+        break;
+    }
+    if (m_bStop)
+      break;
+    m_scannedFolders.pop_front();
+
+    if (!m_musicDatabase.InTransaction())
+      m_musicDatabase.BeginTransaction();
+
+    const int numAdded = RetrieveMusicInfo(folder->strDirectory, folder->items);
+    if (numAdded > 0 && m_handle)
+      OnDirectoryScanned(folder->strDirectory);
+
+    // save information about this folder
+    m_musicDatabase.SetPathHash(folder->strDirectory, folder->hash);
+
+    m_songsInTransaction += numAdded;
+    if (m_songsInTransaction >= SONGS_PER_TRANSACTION)
+    {
+      m_musicDatabase.CommitTransaction();
+      m_songsInTransaction = 0;
+    }
+  }
+
+  if (m_bStop)
+  {
+    // the folders not added yet are scanned again by the next scan
+    m_tagReaders->CancelJobs();
+    m_scannedFolders.clear();
+  }
+
+  if ((all || m_bStop) && m_musicDatabase.InTransaction())
+  {
+    m_musicDatabase.CommitTransaction();
+    m_songsInTransaction = 0;
+  }
+
+  return !m_bStop;
+}
+
 static bool SortSongsByTrack(const CSong& song, const CSong& song2)
 {
   return song.iTrack < song2.iTrack;
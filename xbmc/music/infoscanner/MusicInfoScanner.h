@@ -13,12 +13,16 @@
 #include "threads/IRunnable.h"
 #include "threads/Thread.h"
 
+#include <atomic>
+#include <deque>
+#include <memory>
 #include <string>
 
 class CAlbum;
 class CArtist;
 class CFileItemList;
 class CGUIDialogProgressBarHandle;
+class CJobQueue;
 class CScraperUrl;
 
 namespace MUSIC_GRABBER
@@ -26,6 +30,11 @@ namespace MUSIC_GRABBER
 class CMusicAlbumInfo;
 }
 
+namespace XFILE
+{
+class CDirectoryChangeDetector;
+}
+
 namespace MUSIC_INFO
 {
 
@@ -251,14 +260,33 @@ protected:
   void RetrieveLocalArt();
   void ScrapeInfoAddedAlbums();
 
-  /*! \brief Scan in the ID3/Ogg/FLAC tags for a bunch of FileItems
-    Given a list of FileItems, scan in the tags for those FileItems
-   and populate a new FileItemList with the files that were successfully scanned.
+  /*! \brief Collect the FileItems whose ID3/Ogg/FLAC tags have been read
+   Given a list of FileItems whose tags have been read by ReadTags(), populate a new FileItemList
+   with the files that were successfully scanned.
    Any files which couldn't be scanned (no/bad tags) are discarded in the process.
    \param items [in] list of FileItems to scan
    \param scannedItems [in] list to populate with the scannedItems
    */
   InfoRet ScanTags(const CFileItemList& items, CFileItemList& scannedItems);
+
+  /*! \brief Start reading the tags of the files of a changed folder
+   The tags are read by a pool of readers while the scan goes on with the next folders, which mostly
+   wait for I/O on network shares. The folder is added to the library once all of its tags are read.
+   \param strDirectory [in] the folder
+   \param items [in] the files of the folder
+   \param hash [in] the hash of the folder, stored once the folder is added to the library
+   \sa WriteScannedFolders
+   */
+  void ReadTags(const std::string& strDirectory,
+                const CFileItemList& items,
+                const std::string& hash);
+
+  /*! \brief Add folders whose tags have been read to the library, in the order they were scanned
+   The folders are added in batches sharing a transaction.
+   \param all [in] add all folders, otherwise only as many as needed to bound the folders read ahead
+   \return false if the scan has been stopped, true otherwise
+   */
+  bool WriteScannedFolders(bool all);
   int GetPathHash(const CFileItemList &items, std::string &hash);
 
   void Run() override;
@@ -278,7 +306,7 @@ protected:
 
   int m_currentItem;
   int m_itemCount;
-  bool m_bStop;
+  std::atomic<bool> m_bStop;
   bool m_needsCleanup = false;
   int m_scanType = 0; // 0 - load from files, 1 - albums, 2 - artists
   int m_idSourcePath;
@@ -287,6 +315,15 @@ protected:
   std::set<int> m_albumsAdded;
 
   std::set<std::string> m_seenPaths;
+
+  struct ScannedFolder;
+  std::unique_ptr<CJobQueue> m_tagReaders;
+  std::deque<std::shared_ptr<ScannedFolder>> m_scannedFolders; //!< oldest first
+  int m_songsInTransaction = 0;
+
+  XFILE::CDirectoryChangeDetector* m_changeDetector = nullptr; //!< set for incremental updates
+  std::set<std::string> m_changedFolders; //!< folders changed since the last update
+
   int m_flags;
   CThread m_fileCountReader;
 };
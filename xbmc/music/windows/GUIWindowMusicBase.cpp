@@ -35,6 +35,7 @@
 #include "dialogs/GUIDialogSmartPlaylistEditor.h"
 #include "dialogs/GUIDialogYesNo.h"
 #include "filesystem/Directory.h"
+#include "filesystem/DirectoryChangeDetector.h"
 #include "filesystem/MusicDatabaseDirectory.h"
 #include "filesystem/MusicDatabaseDirectory/DirectoryNode.h"
 #include "filesystem/MusicDatabaseDirectory/QueryParams.h"
@@ -1047,6 +1048,7 @@ void CGUIWindowMusicBase::OnRemoveSource(int iItem)
   {
     std::map<std::string, std::vector<CSong>> songs;
     database.RemoveSongsFromPath(m_vecItems->Get(iItem)->GetPath(), songs, false);
+    CMusicLibraryQueue::GetInstance().GetChangeDetector().Reset();
     database.CleanupOrphanedItems();
     database.CheckArtistLinksChanged();
     CServiceBroker::GetGUI()->GetInfoManager().GetInfoProviders().GetLibraryInfoProvider().ResetLibraryBools();
@@ -1074,6 +1076,7 @@ void CGUIWindowMusicBase::OnAssignContent(const std::string& oldName, const CMed
   database.Open();
   database.UpdateSource(oldName, source.strName, source.strPath, source.vecPaths);
   database.Close();
+  CMusicLibraryQueue::GetInstance().GetChangeDetector().Reset();
 
   // "Add to library" yes/no dialog with additional "settings" custom button
   // "Do you want to add the media from this source to your library?"
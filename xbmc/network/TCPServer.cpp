@@ -250,7 +250,7 @@ void CTCPServer::Announce(ANNOUNCEMENT::AnnouncementFlag flag,
         continue;
     }
 
-    m_connections[i]->Send(str.c_str(), str.size());
+    m_connections[i]->SendAnnouncement(str);
   }
 }
 
@@ -542,14 +542,27 @@ bool CTCPServer::CTCPClient::SetAnnouncementFlags(int flags)
 
 void CTCPServer::CTCPClient::Send(const char *data, unsigned int size)
 {
+  std::unique_lock lock(m_critSection);
   unsigned int sent = 0;
   do
   {
-    std::unique_lock lock(m_critSection);
     sent += send(m_socket, data + sent, size - sent, 0);
   } while (sent < size);
 }
 
+void CTCPServer::CTCPClient::SendAnnouncement(const std::string& announcement)
+{
+  std::unique_lock lock(m_critSection);
+  // an announcement must not end up between the parts of a response
+  if (m_responding)
+  {
+    m_announcements.push_back(announcement);
+    return;
+  }
+
+  Send(announcement.c_str(), static_cast<unsigned int>(announcement.size()));
+}
+
 void CTCPServer::CTCPClient::PushBuffer(CTCPServer *host, const char *buffer, int length)
 {
   m_new = false;
@@ -613,8 +626,24 @@ void CTCPServer::CTCPClient::PushBuffer(CTCPServer *host, const char *buffer, in
       }
       if (m_beginBrackets > 0 && m_endBrackets > 0 && m_beginBrackets == m_endBrackets)
       {
-        std::string line = CJSONRPC::MethodCall(m_buffer, host, this);
-        Send(line.c_str(), line.size());
+        {
+          std::unique_lock lock(m_critSection);
+          m_responding = true;
+        }
+        CJSONRPC::MethodCall(m_buffer, host, this,
+                             [this](const char* data, size_t size)
+                             {
+                               SendResponsePart(data, static_cast<unsigned int>(size));
+                               return m_socket != INVALID_SOCKET;
+                             });
+        EndResponse();
+        {
+          std::unique_lock lock(m_critSection);
+          m_responding = false;
+          for (const std::string& announcement : m_announcements)
+            Send(announcement.c_str(), static_cast<unsigned int>(announcement.size()));
+          m_announcements.clear();
+        }
         m_beginChar = m_beginBrackets = m_endBrackets = 0;
         m_buffer.clear();
       }
@@ -645,6 +674,8 @@ void CTCPServer::CTCPClient::Copy(const CTCPClient& client)
   m_beginChar         = client.m_beginChar;
   m_endChar           = client.m_endChar;
   m_buffer            = client.m_buffer;
+  m_responding        = client.m_responding;
+  m_announcements     = client.m_announcements;
 }
 
 CTCPServer::CWebSocketClient::CWebSocketClient(CWebSocket *websocket)
@@ -694,6 +725,41 @@ void CTCPServer::CWebSocketClient::Send(const char *data, unsigned int size)
     CTCPClient::Send(frames.at(index)->GetFrameData(), (unsigned int)frames.at(index)->GetFrameLength());
 }
 
+void CTCPServer::CWebSocketClient::SendResponsePart(const char* data, unsigned int size)
+{
+  if (!m_pendingPart.empty())
+    SendFragment(false);
+
+  m_pendingPart.assign(data, size);
+}
+
+void CTCPServer::CWebSocketClient::EndResponse()
+{
+  if (!m_responseStarted)
+  {
+    // the response fits into a single frame
+    Send(m_pendingPart.c_str(), static_cast<unsigned int>(m_pendingPart.size()));
+    m_pendingPart.clear();
+    return;
+  }
+
+  SendFragment(true);
+  m_responseStarted = false;
+}
+
+void CTCPServer::CWebSocketClient::SendFragment(bool final)
+{
+  std::unique_ptr<const CWebSocketFrame> frame =
+      m_websocket->SendFragment(WebSocketTextFrame, m_pendingPart.c_str(),
+                                static_cast<uint32_t>(m_pendingPart.size()), !m_responseStarted,
+                                final);
+  m_pendingPart.clear();
+  m_responseStarted = true;
+
+  if (frame != nullptr)
+    CTCPClient::Send(frame->GetFrameData(), static_cast<unsigned int>(frame->GetFrameLength()));
+}
+
 void CTCPServer::CWebSocketClient::PushBuffer(CTCPServer *host, const char *buffer, int length)
 {
   bool send;
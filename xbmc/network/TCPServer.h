@@ -15,6 +15,7 @@
 #include "threads/Thread.h"
 #include "websocket/WebSocket.h"
 
+#include <string>
 #include <vector>
 
 #include <sys/socket.h>
@@ -65,6 +66,7 @@ namespace JSONRPC
       bool SetAnnouncementFlags(int flags) override;
 
       virtual void Send(const char *data, unsigned int size);
+      void SendAnnouncement(const std::string& announcement);
       virtual void PushBuffer(CTCPServer *host, const char *buffer, int length);
       virtual void Disconnect();
 
@@ -78,12 +80,27 @@ namespace JSONRPC
 
     protected:
       void Copy(const CTCPClient& client);
+
+      /*!
+       \brief Send the next part of a response while it is still being produced
+       */
+      virtual void SendResponsePart(const char* data, unsigned int size) { Send(data, size); }
+
+      /*!
+       \brief Complete a response sent with SendResponsePart()
+       */
+      virtual void EndResponse() {}
+
     private:
       bool m_new;
       int m_announcementflags;
       int m_beginBrackets, m_endBrackets;
       char m_beginChar, m_endChar;
       std::string m_buffer;
+
+      // announcements held back while a response is sent in parts
+      bool m_responding = false;
+      std::vector<std::string> m_announcements;
     };
 
     class CWebSocketClient : public CTCPClient
@@ -102,9 +119,19 @@ namespace JSONRPC
       bool IsNew() const override { return m_websocket == NULL; }
       bool Closing() const override { return m_websocket != NULL && m_websocket->GetState() == WebSocketStateClosed; }
 
+    protected:
+      void SendResponsePart(const char* data, unsigned int size) override;
+      void EndResponse() override;
+
     private:
+      void SendFragment(bool final);
+
       CWebSocket *m_websocket;
       std::string m_buffer;
+
+      // a response is sent as one message, so its last part is held back to be able to mark it
+      std::string m_pendingPart;
+      bool m_responseStarted = false;
     };
 
     std::vector<CTCPClient*> m_connections;
@@ -349,6 +349,10 @@ MHD_RESULT CWebServer::HandleRequest(const std::shared_ptr<IHTTPRequestHandler>&
       ret = CreateFileDownloadResponse(handler, response);
       break;
 
+    case HTTPStreamDownload:
+      ret = CreateStreamDownloadResponse(handler, response);
+      break;
+
     case HTTPMemoryDownloadNoFreeNoCopy:
     case HTTPMemoryDownloadNoFreeCopy:
     case HTTPMemoryDownloadFreeNoCopy:
@@ -913,6 +917,31 @@ MHD_RESULT CWebServer::CreateFileDownloadResponse(
   return MHD_YES;
 }
 
+MHD_RESULT CWebServer::CreateStreamDownloadResponse(
+    const std::shared_ptr<IHTTPRequestHandler>& handler, struct MHD_Response*& response) const
+{
+  if (handler == nullptr)
+    return MHD_NO;
+
+  // the handler has to outlive the connection handler as it keeps producing the response until
+  // mhd has sent all of it
+  auto context = std::make_unique<std::shared_ptr<IHTTPRequestHandler>>(handler);
+
+  response = MHD_create_response_from_callback(MHD_SIZE_UNKNOWN, 16 * 1024,
+                                               &CWebServer::StreamReaderCallback, context.get(),
+                                               &CWebServer::StreamReaderFreeCallback);
+  if (response == nullptr)
+  {
+    m_logger->error("failed to create a streamed HTTP response for {}",
+                    handler->GetRequest().pathUrl);
+    return MHD_NO;
+  }
+
+  context.release(); // ownership was passed to mhd
+
+  return MHD_YES;
+}
+
 MHD_RESULT CWebServer::CreateErrorResponse(struct MHD_Connection* connection,
                                            int responseType,
                                            HTTPMethod method,
@@ -1114,6 +1143,32 @@ void CWebServer::ContentReaderFreeCallback(void* cls)
     GetLogger()->debug("[OUT] done");
 }
 
+ssize_t CWebServer::StreamReaderCallback(void* cls, uint64_t pos, char* buf, size_t max)
+{
+  auto handler = static_cast<std::shared_ptr<IHTTPRequestHandler>*>(cls);
+  if (handler == nullptr || *handler == nullptr)
+    return MHD_CONTENT_READER_END_WITH_ERROR;
+
+  ssize_t read = (*handler)->ReadResponseData(buf, max);
+  if (read < 0)
+    return MHD_CONTENT_READER_END_WITH_ERROR;
+  if (read == 0)
+    return MHD_CONTENT_READER_END_OF_STREAM;
+
+  if (CServiceBroker::GetLogging().CanLogComponent(LOGWEBSERVER))
+    GetLogger()->debug("[OUT] wrote {} bytes from {}", read, pos);
+
+  return read;
+}
+
+void CWebServer::StreamReaderFreeCallback(void* cls)
+{
+  delete static_cast<std::shared_ptr<IHTTPRequestHandler>*>(cls);
+
+  if (CServiceBroker::GetLogging().CanLogComponent(LOGWEBSERVER))
+    GetLogger()->debug("[OUT] done");
+}
+
 static Logger GetMhdLogger()
 {
   return CServiceBroker::GetLogging().GetLogger("libmicrohttpd");
@@ -12,14 +12,36 @@
 #include "URL.h"
 #include "interfaces/json-rpc/JSONRPC.h"
 #include "interfaces/json-rpc/JSONServiceDescription.h"
+#include "jobs/JobManager.h"
 #include "network/httprequesthandler/HTTPRequestHandlerUtils.h"
 #include "utils/FileUtils.h"
 #include "utils/JSONVariantWriter.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+
 #define MAX_HTTP_POST_SIZE 65536
 
+using namespace std::chrono_literals;
+
+namespace
+{
+// number of response parts produced ahead of the client
+constexpr size_t MAX_PENDING_PARTS = 4;
+// time the client may take to read a part before the response is given up
+constexpr auto PUSH_TIMEOUT = 30s;
+} // unnamed namespace
+
+CHTTPJsonRpcHandler::~CHTTPJsonRpcHandler()
+{
+  if (m_producer != nullptr)
+    m_producer->Abort();
+}
+
 bool CHTTPJsonRpcHandler::CanHandleRequest(const HTTPRequest &request) const
 {
   return (request.pathUrl.compare("/jsonrpc") == 0);
@@ -70,7 +92,22 @@ MHD_RESULT CHTTPJsonRpcHandler::HandleRequest()
       jsonpCallback = argument->second;
   }
 
-  if (isRequest)
+  // long lists are sent while they are produced, HEAD requests need the length of the response
+  if (isRequest && m_request.method != HEAD && JSONRPC::CJSONRPC::IsStreamable(m_requestData))
+  {
+    m_producer = std::make_shared<CResponseProducer>(std::move(m_requestData), jsonpCallback,
+                                                     m_request.method);
+    // the producer waits for the client, so it mustn't hold up one of the shared workers
+    CServiceBroker::GetJobManager()->Submit([producer = m_producer] { producer->Produce(); },
+                                            CJob::PRIORITY_DEDICATED);
+
+    m_response.type = HTTPStreamDownload;
+    m_response.status = MHD_HTTP_OK;
+    m_response.contentType = "application/json";
+
+    return MHD_YES;
+  }
+  else if (isRequest)
   {
     m_responseData = JSONRPC::CJSONRPC::MethodCall(m_requestData, &m_transportLayer, &client);
 
@@ -118,6 +155,14 @@ HttpResponseRanges CHTTPJsonRpcHandler::GetResponseData() const
   return ranges;
 }
 
+ssize_t CHTTPJsonRpcHandler::ReadResponseData(char* buffer, size_t size)
+{
+  if (m_producer == nullptr)
+    return -1;
+
+  return m_producer->Read(buffer, size);
+}
+
 bool CHTTPJsonRpcHandler::appendPostData(const char *data, size_t size)
 {
   if (m_requestData.size() + size > MAX_HTTP_POST_SIZE)
@@ -163,6 +208,86 @@ int CHTTPJsonRpcHandler::CHTTPTransportLayer::GetCapabilities()
   return JSONRPC::Response | JSONRPC::FileDownloadRedirect;
 }
 
+CHTTPJsonRpcHandler::CResponseProducer::CResponseProducer(std::string request,
+                                                          std::string jsonpCallback,
+                                                          HTTPMethod method)
+  : m_request(std::move(request)), m_jsonpCallback(std::move(jsonpCallback)), m_method(method)
+{
+}
+
+void CHTTPJsonRpcHandler::CResponseProducer::Abort()
+{
+  std::unique_lock lock(m_critSection);
+  m_aborted = true;
+  m_condition.notifyAll();
+}
+
+ssize_t CHTTPJsonRpcHandler::CResponseProducer::Read(char* buffer, size_t size)
+{
+  std::unique_lock lock(m_critSection);
+  m_condition.wait(lock, [this] { return !m_parts.empty() || m_finished || m_aborted; });
+
+  // a failed response ends with an error, so the client can't take it for a complete one
+  if (m_parts.empty())
+    return m_aborted || m_failed ? -1 : 0;
+
+  const std::string& part = m_parts.front();
+  const size_t read = std::min(size, part.size() - m_offset);
+  std::memcpy(buffer, part.data() + m_offset, read);
+
+  m_offset += read;
+  if (m_offset >= part.size())
+  {
+    m_parts.pop_front();
+    m_offset = 0;
+    m_condition.notifyAll();
+  }
+
+  return static_cast<ssize_t>(read);
+}
+
+void CHTTPJsonRpcHandler::CResponseProducer::Produce()
+{
+  CHTTPClient client(m_method);
+  const auto sink = [this](const char* data, size_t size) { return Push(data, size); };
+
+  bool succeeded = false;
+  if (m_jsonpCallback.empty())
+    succeeded = JSONRPC::CJSONRPC::MethodCall(m_request, &m_transport, &client, sink);
+  else if (Push(m_jsonpCallback.c_str(), m_jsonpCallback.size()) && Push("(", 1))
+  {
+    succeeded = JSONRPC::CJSONRPC::MethodCall(m_request, &m_transport, &client, sink);
+    Push(");", 2);
+  }
+
+  std::unique_lock lock(m_critSection);
+  m_finished = true;
+  m_failed = !succeeded;
+  m_condition.notifyAll();
+}
+
+bool CHTTPJsonRpcHandler::CResponseProducer::Push(const char* data, size_t size)
+{
+  if (size == 0)
+    return true;
+
+  std::unique_lock lock(m_critSection);
+  if (!m_condition.wait(lock, PUSH_TIMEOUT,
+                        [this] { return m_parts.size() < MAX_PENDING_PARTS || m_aborted; }))
+  {
+    CLog::Log(LOGWARNING, "JSONRPC: client stopped reading the response, giving up");
+    m_aborted = true;
+    m_condition.notifyAll();
+  }
+  if (m_aborted)
+    return false;
+
+  m_parts.emplace_back(data, size);
+  m_condition.notifyAll();
+
+  return true;
+}
+
 CHTTPJsonRpcHandler::CHTTPClient::CHTTPClient(HTTPMethod method)
   : m_permissionFlags(JSONRPC::ReadData)
 {
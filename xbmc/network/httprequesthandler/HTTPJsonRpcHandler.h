@@ -11,14 +11,18 @@
 #include "interfaces/json-rpc/IClient.h"
 #include "interfaces/json-rpc/ITransportLayer.h"
 #include "network/httprequesthandler/IHTTPRequestHandler.h"
+#include "threads/Condition.h"
+#include "threads/CriticalSection.h"
 
+#include <deque>
+#include <memory>
 #include <string>
 
 class CHTTPJsonRpcHandler : public IHTTPRequestHandler
 {
 public:
   CHTTPJsonRpcHandler() = default;
-  ~CHTTPJsonRpcHandler() override = default;
+  ~CHTTPJsonRpcHandler() override;
 
   // implementations of IHTTPRequestHandler
   IHTTPRequestHandler* Create(const HTTPRequest &request) const override { return new CHTTPJsonRpcHandler(request); }
@@ -27,6 +31,7 @@ public:
   MHD_RESULT HandleRequest() override;
 
   HttpResponseRanges GetResponseData() const override;
+  ssize_t ReadResponseData(char* buffer, size_t size) override;
 
   int GetPriority() const override { return 5; }
 
@@ -55,6 +60,41 @@ private:
   };
   CHTTPTransportLayer m_transportLayer;
 
+  /*!
+   * \brief Runs a method call and keeps the parts of its response until they have been sent.
+   *
+   * The response is sent while the method is still running. Only a few parts are kept at a time,
+   * so a method producing its response faster than it can be sent is held up until the client
+   * caught up. A client not reading for a while or closing the connection aborts the method. The
+   * method runs as a dedicated job, which keeps the producer alive until it's done.
+   */
+  class CResponseProducer
+  {
+  public:
+    CResponseProducer(std::string request, std::string jsonpCallback, HTTPMethod method);
+
+    void Produce();
+    ssize_t Read(char* buffer, size_t size);
+    void Abort();
+
+  private:
+    bool Push(const char* data, size_t size);
+
+    const std::string m_request;
+    const std::string m_jsonpCallback;
+    const HTTPMethod m_method;
+    CHTTPTransportLayer m_transport;
+
+    CCriticalSection m_critSection;
+    XbmcThreads::ConditionVariable m_condition;
+    std::deque<std::string> m_parts;
+    size_t m_offset = 0;
+    bool m_finished = false;
+    bool m_failed = false;
+    bool m_aborted = false;
+  };
+  std::shared_ptr<CResponseProducer> m_producer;
+
   class CHTTPClient : public JSONRPC::IClient
   {
   public:
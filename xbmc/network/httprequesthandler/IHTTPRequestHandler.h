@@ -60,7 +60,10 @@ typedef enum HTTPResponseType
   HTTPMemoryDownloadFreeNoCopy,
   // creates a HTTP response from a buffer by copying followed by freeing the buffer
   // the buffer must have been malloc'ed and not new'ed
-  HTTPMemoryDownloadFreeCopy
+  HTTPMemoryDownloadFreeCopy,
+  // creates a HTTP response of unknown length whose content is read in parts from the request
+  // handler while it is being produced
+  HTTPStreamDownload
 } HTTPResponseType;
 
 typedef struct HTTPRequest
@@ -167,6 +170,18 @@ public:
   */
   virtual std::string GetResponseFile() const { return ""; }
 
+  /*!
+  * \brief Reads the next part of the response.
+  *
+  * \details This is only used if the response type is HTTPStreamDownload. It is called from the
+  * thread of the connection and may block until more data is available.
+  *
+  * \param buffer Buffer to copy the data to
+  * \param size Maximum number of bytes to copy
+  * \return Number of bytes copied, 0 at the end of the response or -1 if it failed
+  */
+  virtual ssize_t ReadResponseData(char* buffer, size_t size) { return -1; }
+
   /*!
   * \brief Returns the HTTP request handled by the HTTP request handler.
   */
@@ -432,3 +432,20 @@ const CWebSocketMessage* CWebSocket::Send(WebSocketFrameOpcode opcode, const cha
 
   return NULL;
 }
+
+std::unique_ptr<const CWebSocketFrame> CWebSocket::SendFragment(WebSocketFrameOpcode opcode,
+                                                                const char* data,
+                                                                uint32_t length,
+                                                                bool first,
+                                                                bool final)
+{
+  std::unique_ptr<const CWebSocketFrame> frame(
+      GetFrame(first ? opcode : WebSocketContinuationFrame, data, length, final));
+  if (frame == nullptr || !frame->IsValid())
+  {
+    CLog::Log(LOGINFO, "WebSocket: Trying to send an invalid frame");
+    return nullptr;
+  }
+
+  return frame;
+}
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <memory>
 #include <stdint.h>
 #include <string>
 #include <vector>
@@ -120,6 +121,18 @@ public:
   virtual bool Handshake(const char* data, size_t length, std::string &response) = 0;
   virtual const CWebSocketMessage* Handle(const char* &buffer, size_t &length, bool &send);
   virtual const CWebSocketMessage* Send(WebSocketFrameOpcode opcode, const char* data = NULL, uint32_t length = 0);
+  /*!
+   \brief Create one frame of a message which is sent in several parts
+   \param opcode type of the message, only used for its first frame
+   \param first whether the frame is the first one of the message
+   \param final whether the frame is the last one of the message
+   \return the frame which is owned by the caller or nullptr
+   */
+  virtual std::unique_ptr<const CWebSocketFrame> SendFragment(WebSocketFrameOpcode opcode,
+                                                              const char* data,
+                                                              uint32_t length,
+                                                              bool first,
+                                                              bool final);
   virtual const CWebSocketFrame* Ping(const char* data = NULL) const = 0;
   virtual const CWebSocketFrame* Pong(const char* data, uint32_t length) const = 0;
   virtual const CWebSocketFrame* Close(WebSocketCloseReason reason = WebSocketCloseNormal, const std::string &message = "") = 0;
@@ -10,6 +10,7 @@
 
 #include "ServiceBroker.h"
 #include "application/AppParams.h"
+#include "cores/AudioEngine/Sinks/AESinkNULL.h"
 #include "filesystem/SpecialProtocol.h"
 
 #if defined(HAS_ALSA)
@@ -116,6 +117,10 @@ bool CPlatformLinux::InitStageOne()
     OPTIONALS::ALSARegister();
     OPTIONALS::PulseAudioRegister(true);
   }
+  else if (sink == "null")
+  {
+    CAESinkNULL::Register();
+  }
   else
   {
     if (!OPTIONALS::PulseAudioRegister(false))
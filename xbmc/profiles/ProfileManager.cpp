@@ -50,6 +50,7 @@
 #endif
 #include "threads/SingleLock.h"
 #include "utils/FileUtils.h"
+#include "utils/SaveFileStateQueue.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
@@ -442,6 +443,8 @@ void CProfileManager::LogOff()
   CNetworkBase &networkManager = CServiceBroker::GetNetwork();
 
   g_application.StopPlaying();
+  // the states of the files played belong to the databases of this profile
+  CServiceBroker::GetAppComponents().GetComponent<CSaveFileStateQueue>()->Flush();
 
   if (CMusicLibraryQueue::GetInstance().IsScanningLibrary())
     CMusicLibraryQueue::GetInstance().StopLibraryScanning();
@@ -351,16 +351,20 @@ bool CPVREpg::QueuePersistQuery(const std::shared_ptr<CPVREpgDatabase>& database
     }
   }
 
+  bool bReturn = true;
   if (m_tags.NeedsSave())
-    m_tags.QueuePersistQuery();
+    bReturn = m_tags.Persist();
 
-  if (m_bUpdateLastScanTime)
+  // the scan only counts once the tags it brought in have been stored
+  if (bReturn && m_bUpdateLastScanTime)
+  {
     database->QueuePersistLastEpgScanTimeQuery(m_iEpgID, m_lastScanTime);
+    m_bUpdateLastScanTime = false;
+  }
 
   m_bChanged = false;
-  m_bUpdateLastScanTime = false;
 
-  return true;
+  return bReturn;
 }
 
 bool CPVREpg::QueueDeleteQueries(const std::shared_ptr<CPVREpgDatabase>& database)
@@ -225,7 +225,7 @@ public:
                                                            const CDateTime& maxEventStart) const;
 
   /*!
-   * @brief Write the query to persist data into given database's queue
+   * @brief Write the tags to the given database and the query to persist the table into its queue
    * @param database The database.
    * @return True on success, false otherwise.
    */
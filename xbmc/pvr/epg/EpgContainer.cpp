@@ -28,6 +28,7 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <numeric>
@@ -272,15 +273,25 @@ bool CPVREpgContainer::PersistAll(unsigned int iMaxTimeslice) const
     // Note: We must lock the db the whole time, otherwise races may occur.
     database->Lock();
 
+    const auto start = std::chrono::steady_clock::now();
+    size_t persistedEpgs = 0;
+
     XbmcThreads::EndTime<> processTimeslice{std::chrono::milliseconds(iMaxTimeslice)};
     for (const auto& epg : changedEpgs)
     {
       if (!processTimeslice.IsTimePast())
       {
+        persistedEpgs++;
         CLog::LogFC(LOGDEBUG, LOGEPG, "EPG Container: Persisting events for channel '{}'...",
                     epg->GetChannelData()->ChannelName());
 
-        bReturn &= epg->QueuePersistQuery(database);
+        // a channel which failed keeps its changes for the next pass, the others are committed
+        if (!epg->QueuePersistQuery(database))
+        {
+          CLog::LogF(LOGERROR, "Failed to persist events for channel '{}'",
+                     epg->GetChannelData()->ChannelName());
+          bReturn = false;
+        }
 
         size_t queryCount = database->GetInsertQueriesCount() + database->GetDeleteQueriesCount();
         if (queryCount > EPG_COMMIT_QUERY_COUNT_LIMIT)
@@ -296,11 +307,14 @@ bool CPVREpgContainer::PersistAll(unsigned int iMaxTimeslice) const
       epg->Unlock();
     }
 
-    if (bReturn)
-    {
-      database->CommitDeleteQueries();
-      database->CommitInsertQueries();
-    }
+    database->CommitDeleteQueries();
+    database->CommitInsertQueries();
+
+    CLog::LogFC(LOGDEBUG, LOGEPG, "EPG Container: Persisted {} of {} changed tables in {} ms",
+                persistedEpgs, changedEpgs.size(),
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - start)
+                    .count());
 
     database->Unlock();
   }
@@ -774,6 +788,8 @@ bool CPVREpgContainer::UpdateEPG(bool bOnlyPending /* = false */)
         CServiceBroker::GetResourcesComponent().GetLocalizeStrings().Get(
             19004)); // Loading programme guide
 
+  const auto updateStart = std::chrono::steady_clock::now();
+
   size_t counter = 0;
   for (const auto& [_, epg] : epgsToUpdate)
   {
@@ -808,6 +824,12 @@ bool CPVREpgContainer::UpdateEPG(bool bOnlyPending /* = false */)
 
   progressHandler.reset();
 
+  CLog::LogFC(LOGDEBUG, LOGEPG, "EPG Container: Updated {} of {} tables in {} ms", iUpdatedTables,
+              epgsToUpdate.size(),
+              std::chrono::duration_cast<std::chrono::milliseconds>(
+                  std::chrono::steady_clock::now() - updateStart)
+                  .count());
+
   QueueDeleteEpgs(invalidTables);
 
   if (bInterrupted)
@@ -16,12 +16,14 @@
 #include "pvr/epg/EpgSearchFilter.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
+#include "utils/DatabaseUtils.h"
 #include "utils/StringUtils.h"
 #include "utils/log.h"
 
 #include <chrono>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -144,6 +146,12 @@ void CPVREpgDatabase::CreateAnalytics()
   std::unique_lock lock(m_critSection);
   m_pDS->exec("CREATE UNIQUE INDEX idx_epg_idEpg_iStartTime on epgtags(idEpg, iStartTime desc);");
   m_pDS->exec("CREATE INDEX idx_epg_iEndTime on epgtags(iEndTime);");
+
+  // Full-text search index (SQLite only, searches fall back to LIKE scans without it). Tags are
+  // written with REPLACE INTO, which removes the tag with the same start time in the same EPG.
+  CreateSearchIndex("epgtagsearch", "epgtags", "idBroadcast", {"sTitle", "sPlotOutline", "sPlot"},
+                    "idBroadcast = new.idBroadcast OR "
+                    "(idEpg = new.idEpg AND iStartTime = new.iStartTime)");
 }
 
 void CPVREpgDatabase::UpdateTables(int iVersion)
@@ -384,22 +392,6 @@ bool CPVREpgDatabase::QueueDeleteEpgQuery(const CPVREpg& table)
   return false;
 }
 
-bool CPVREpgDatabase::QueueDeleteTagQuery(const CPVREpgInfoTag& tag)
-{
-  /* tag without a database ID was not persisted */
-  if (tag.DatabaseID() <= 0)
-    return false;
-
-  Filter filter;
-
-  std::unique_lock lock(m_critSection);
-  filter.AppendWhere(PrepareSQL("idBroadcast = %u", tag.DatabaseID()));
-
-  std::string strQuery;
-  BuildSQL(PrepareSQL("DELETE FROM %s ", "epgtags"), filter, strQuery);
-  return QueueDeleteQuery(strQuery);
-}
-
 std::vector<std::shared_ptr<CPVREpg>> CPVREpgDatabase::GetAll()
 {
   std::vector<std::shared_ptr<CPVREpg>> result;
@@ -571,33 +563,80 @@ class CSearchTermConverter
 public:
   explicit CSearchTermConverter(const std::string& strSearchTerm) { Parse(strSearchTerm); }
 
-  bool HasSearchTerm() const { return !m_fragments.empty(); }
+  bool HasSearchTerm() const { return !m_terms.empty() || !m_strTrailingOperators.empty(); }
 
   std::string ToSQL(std::string_view strFieldName) const
   {
     std::string result = "(";
 
-    for (auto it = m_fragments.cbegin(); it != m_fragments.cend();)
+    for (const auto& term : m_terms)
     {
-      result += (*it);
-
-      ++it;
-      if (it != m_fragments.cend())
-        result += strFieldName;
+      result += term.strOperators;
+      result += "(UPPER(";
+      result += strFieldName;
+      result += ") LIKE UPPER('%";
+      result += term.strEscapedTerm;
+      result += "%')) ";
     }
+    result += m_strTrailingOperators;
 
     StringUtils::TrimRight(result);
     result += ")";
     return result;
   }
 
+  /*!
+   * @brief Get a full-text query for the search index which finds at least all tags ToSQL() finds
+   * in any of the given fields. Negated terms can't narrow the result down and are left out.
+   * @param fieldNames The fields searched in.
+   * @return The query or an empty string if the search index can't narrow the result down.
+   */
+  std::string ToMatch(const std::vector<std::string>& fieldNames) const
+  {
+    // AND binds stronger than OR, so the terms form alternatives of terms which all must match
+    std::vector<std::string> alternatives;
+    std::vector<std::string> required;
+    for (auto it = m_terms.cbegin(); it != m_terms.cend(); ++it)
+    {
+      if (it != m_terms.cbegin() && it->bOr)
+      {
+        if (required.empty())
+          return {};
+        alternatives.emplace_back("(" + StringUtils::Join(required, " AND ") + ")");
+        required.clear();
+      }
+
+      if (it->bNot)
+        continue;
+
+      const std::string match = DatabaseUtils::BuildSearchMatch(it->strTerm, fieldNames);
+      if (!match.empty())
+        required.emplace_back(match);
+    }
+
+    if (required.empty())
+      return {};
+    alternatives.emplace_back("(" + StringUtils::Join(required, " AND ") + ")");
+
+    return StringUtils::Join(alternatives, " OR ");
+  }
+
 private:
+  struct Term
+  {
+    std::string strOperators; // SQL operators preceding the term
+    bool bOr{false};
+    bool bNot{false};
+    std::string strTerm;
+    std::string strEscapedTerm;
+  };
+
   void Parse(const std::string& strSearchTerm)
   {
     std::string strParsedSearchTerm(strSearchTerm);
     StringUtils::Trim(strParsedSearchTerm);
 
-    std::string strFragment;
+    Term next;
 
     bool bNextOR = false;
     while (!strParsedSearchTerm.empty())
@@ -609,7 +648,8 @@ private:
       {
         std::string strDummy;
         GetAndCutNextTerm(strParsedSearchTerm, strDummy);
-        strFragment += " NOT ";
+        next.strOperators += " NOT ";
+        next.bNot = true;
         bNextOR = false;
       }
       else if (StringUtils::StartsWith(strParsedSearchTerm, "+") ||
@@ -617,7 +657,7 @@ private:
       {
         std::string strDummy;
         GetAndCutNextTerm(strParsedSearchTerm, strDummy);
-        strFragment += " AND ";
+        next.strOperators += " AND ";
         bNextOR = false;
       }
       else if (StringUtils::StartsWith(strParsedSearchTerm, "|") ||
@@ -625,7 +665,8 @@ private:
       {
         std::string strDummy;
         GetAndCutNextTerm(strParsedSearchTerm, strDummy);
-        strFragment += " OR ";
+        next.strOperators += " OR ";
+        next.bOr = true;
         bNextOR = false;
       }
       else
@@ -634,18 +675,17 @@ private:
         GetAndCutNextTerm(strParsedSearchTerm, strTerm);
         if (!strTerm.empty())
         {
-          if (bNextOR && !m_fragments.empty())
-            strFragment += " OR "; // default operator
+          if (bNextOR && !m_terms.empty())
+          {
+            next.strOperators += " OR "; // default operator
+            next.bOr = true;
+          }
 
-          strFragment += "(UPPER(";
-
-          m_fragments.emplace_back(strFragment);
-          strFragment.clear();
-
-          strFragment += ") LIKE UPPER('%";
+          next.strTerm = strTerm;
           StringUtils::Replace(strTerm, "'", "''"); // escape '
-          strFragment += strTerm;
-          strFragment += "%')) ";
+          next.strEscapedTerm = strTerm;
+          m_terms.emplace_back(std::move(next));
+          next = {};
 
           bNextOR = true;
         }
@@ -658,8 +698,7 @@ private:
       StringUtils::TrimLeft(strParsedSearchTerm);
     }
 
-    if (!strFragment.empty())
-      m_fragments.emplace_back(strFragment);
+    m_strTrailingOperators = next.strOperators;
   }
 
   static void GetAndCutNextTerm(std::string& strSearchTerm, std::string& strNextTerm)
@@ -685,7 +724,8 @@ private:
     }
   }
 
-  std::vector<std::string> m_fragments;
+  std::vector<Term> m_terms;
+  std::string m_strTrailingOperators;
 };
 
 } // unnamed namespace
@@ -803,14 +843,24 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetEpgTags(
     strWhere += " OR ";
     strWhere += conv.ToSQL("sPlotOutline");
 
+    std::vector<std::string> fields{"sTitle", "sPlotOutline"};
+
     if (searchData.m_bSearchInDescription)
     {
       // plot
       strWhere += " OR ";
       strWhere += conv.ToSQL("sPlot");
+      fields.emplace_back("sPlot");
     }
 
     filter.AppendWhere(strWhere);
+
+    // let the search index find the candidates instead of matching every tag's texts
+    const std::string match = conv.ToMatch(fields);
+    if (!match.empty() && HasSearchIndex("epgtagsearch"))
+      filter.AppendWhere(PrepareSQL(
+          "idBroadcast IN (SELECT rowid FROM epgtagsearch WHERE epgtagsearch MATCH '%s')",
+          match.c_str()));
   }
 
   if (BuildSQL(strQuery, filter, strQuery))
@@ -1064,30 +1114,6 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetEpgTagsByMinEnd
   return {};
 }
 
-bool CPVREpgDatabase::QueueDeleteEpgTagsByMinEndMaxStartTimeQuery(int iEpgID,
-                                                                  const CDateTime& minEndTime,
-                                                                  const CDateTime& maxStartTime)
-{
-  time_t minEnd;
-  minEndTime.GetAsTime(minEnd);
-
-  time_t maxStart;
-  maxStartTime.GetAsTime(maxStart);
-
-  Filter filter;
-
-  std::unique_lock lock(m_critSection);
-  filter.AppendWhere(PrepareSQL("idEpg = %u AND iEndTime >= %u AND iStartTime <= %u", iEpgID,
-                                static_cast<unsigned int>(minEnd),
-                                static_cast<unsigned int>(maxStart)));
-
-  std::string strQuery;
-  if (BuildSQL("DELETE FROM epgtags", filter, strQuery))
-    return QueueDeleteQuery(strQuery);
-
-  return false;
-}
-
 std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetAllEpgTags(int iEpgID) const
 {
   std::unique_lock lock(m_critSection);
@@ -1278,80 +1304,88 @@ bool CPVREpgDatabase::QueueDeleteEpgTags(int iEpgId)
   return QueueDeleteQuery(strQuery);
 }
 
-bool CPVREpgDatabase::QueuePersistQuery(const CPVREpgInfoTag& tag)
+bool CPVREpgDatabase::PersistTags(int iEpgID,
+                                  const std::vector<std::shared_ptr<CPVREpgInfoTag>>& changedTags,
+                                  const std::vector<std::shared_ptr<CPVREpgInfoTag>>& deletedTags)
 {
-  if (tag.EpgID() <= 0)
+  if (iEpgID <= 0)
   {
-    CLog::LogF(LOGERROR, "Tag '{}' does not have a valid table", tag.Title());
+    CLog::LogF(LOGERROR, "Invalid EPG id {}", iEpgID);
     return false;
   }
 
-  time_t iStartTime{0};
-  tag.StartAsUTC().GetAsTime(iStartTime);
+  if (!m_pDB || !m_pDS)
+    return false;
 
-  time_t iEndTime{0};
-  tag.EndAsUTC().GetAsTime(iEndTime);
+  std::unique_lock lock(m_critSection);
 
-  std::string sFirstAired;
-  if (tag.FirstAired().IsValid())
-    sFirstAired = tag.FirstAired().GetAsW3CDate();
+  const bool bOwnTransaction = !InTransaction();
+  if (bOwnTransaction)
+    BeginTransaction();
 
-  int iBroadcastId = tag.DatabaseID();
-  std::string strQuery;
+  try
+  {
+    for (const auto& tag : deletedTags)
+    {
+      // tag without a database ID was not persisted
+      if (tag->DatabaseID() > 0)
+        m_pDS->exec("DELETE FROM epgtags WHERE idBroadcast = ?",
+                    make_bind_list(tag->DatabaseID()));
+    }
 
-  std::unique_lock lock(m_critSection);
+    for (const auto& tag : changedTags)
+    {
+      time_t iStartTime{0};
+      tag->StartAsUTC().GetAsTime(iStartTime);
 
-  if (iBroadcastId < 0)
-  {
-    strQuery = PrepareSQL(
-        "REPLACE INTO epgtags (idEpg, iStartTime, "
-        "iEndTime, sTitle, sPlotOutline, sPlot, sOriginalTitle, sCast, sDirector, sWriter, iYear, "
-        "sIMDBNumber, "
-        "sIconPath, iGenreType, iGenreSubType, sGenre, sFirstAired, iParentalRating, iStarRating, "
-        "iSeriesId, "
-        "iEpisodeId, iEpisodePart, sEpisodeName, iFlags, sSeriesLink, sParentalRatingCode, "
-        "iBroadcastUid, sParentalRatingIcon, sParentalRatingSource, sTitleExtraInfo) "
-        "VALUES (%u, %u, %u, '%s', '%s', '%s', '%s', '%s', '%s', '%s', %i, '%s', '%s', %i, %i, "
-        "'%s', '%s', %i, %i, %i, %i, %i, '%s', %i, '%s', '%s', %i, '%s', '%s', '%s');",
-        tag.EpgID(), static_cast<unsigned int>(iStartTime), static_cast<unsigned int>(iEndTime),
-        tag.Title().c_str(), tag.PlotOutline().c_str(), tag.Plot().c_str(),
-        tag.OriginalTitle().c_str(), CPVREpgInfoTag::DeTokenize(tag.Cast()).c_str(),
-        CPVREpgInfoTag::DeTokenize(tag.Directors()).c_str(),
-        CPVREpgInfoTag::DeTokenize(tag.Writers()).c_str(), tag.Year(), tag.IMDBNumber().c_str(),
-        tag.ClientIconPath().c_str(), tag.GenreType(), tag.GenreSubType(),
-        tag.GenreDescription().c_str(), sFirstAired.c_str(), tag.ParentalRating(), tag.StarRating(),
-        tag.SeriesNumber(), tag.EpisodeNumber(), tag.EpisodePart(), tag.EpisodeName().c_str(),
-        tag.Flags(), tag.SeriesLink().c_str(), tag.ParentalRatingCode().c_str(),
-        tag.UniqueBroadcastID(), tag.ClientParentalRatingIconPath().c_str(),
-        tag.ParentalRatingSource().c_str(), tag.TitleExtraInfo().c_str());
+      time_t iEndTime{0};
+      tag->EndAsUTC().GetAsTime(iEndTime);
+
+      // remove any conflicting events before persisting the new event
+      m_pDS->exec("DELETE FROM epgtags WHERE idEpg = ? AND iEndTime >= ? AND iStartTime <= ?",
+                  make_bind_list(iEpgID, iStartTime + 1, iEndTime - 1));
+
+      std::string sFirstAired;
+      if (tag->FirstAired().IsValid())
+        sFirstAired = tag->FirstAired().GetAsW3CDate();
+
+      const int iBroadcastId = tag->DatabaseID();
+
+      m_pDS->exec(
+          "REPLACE INTO epgtags (idBroadcast, idEpg, iStartTime, iEndTime, sTitle, sPlotOutline, "
+          "sPlot, sOriginalTitle, sCast, sDirector, sWriter, iYear, sIMDBNumber, sIconPath, "
+          "iGenreType, iGenreSubType, sGenre, sFirstAired, iParentalRating, iStarRating, "
+          "iSeriesId, iEpisodeId, iEpisodePart, sEpisodeName, iFlags, sSeriesLink, "
+          "sParentalRatingCode, iBroadcastUid, sParentalRatingIcon, sParentalRatingSource, "
+          "sTitleExtraInfo) "
+          "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, "
+          "?, ?, ?, ?)",
+          make_bind_list(iBroadcastId < 0 ? std::nullopt : std::optional(iBroadcastId), iEpgID,
+                         iStartTime, iEndTime, tag->Title(), tag->PlotOutline(), tag->Plot(),
+                         tag->OriginalTitle(), CPVREpgInfoTag::DeTokenize(tag->Cast()),
+                         CPVREpgInfoTag::DeTokenize(tag->Directors()),
+                         CPVREpgInfoTag::DeTokenize(tag->Writers()), tag->Year(),
+                         tag->IMDBNumber(), tag->ClientIconPath(), tag->GenreType(),
+                         tag->GenreSubType(), tag->GenreDescription(), sFirstAired,
+                         tag->ParentalRating(), tag->StarRating(), tag->SeriesNumber(),
+                         tag->EpisodeNumber(), tag->EpisodePart(), tag->EpisodeName(),
+                         tag->Flags(), tag->SeriesLink(), tag->ParentalRatingCode(),
+                         tag->UniqueBroadcastID(), tag->ClientParentalRatingIconPath(),
+                         tag->ParentalRatingSource(), tag->TitleExtraInfo()));
+    }
+
+    if (bOwnTransaction)
+      return CommitTransaction();
+
+    return true;
   }
-  else
+  catch (...)
   {
-    strQuery = PrepareSQL(
-        "REPLACE INTO epgtags (idEpg, iStartTime, "
-        "iEndTime, sTitle, sPlotOutline, sPlot, sOriginalTitle, sCast, sDirector, sWriter, iYear, "
-        "sIMDBNumber, "
-        "sIconPath, iGenreType, iGenreSubType, sGenre, sFirstAired, iParentalRating, iStarRating, "
-        "iSeriesId, "
-        "iEpisodeId, iEpisodePart, sEpisodeName, iFlags, sSeriesLink, sParentalRatingCode, "
-        "iBroadcastUid, idBroadcast, sParentalRatingIcon, sParentalRatingSource, sTitleExtraInfo) "
-        "VALUES (%u, %u, %u, '%s', '%s', '%s', '%s', '%s', '%s', '%s', %i, '%s', '%s', %i, %i, "
-        "'%s', '%s', %i, %i, %i, %i, %i, '%s', %i, '%s', '%s', %i, %i, '%s', '%s', '%s');",
-        tag.EpgID(), static_cast<unsigned int>(iStartTime), static_cast<unsigned int>(iEndTime),
-        tag.Title().c_str(), tag.PlotOutline().c_str(), tag.Plot().c_str(),
-        tag.OriginalTitle().c_str(), CPVREpgInfoTag::DeTokenize(tag.Cast()).c_str(),
-        CPVREpgInfoTag::DeTokenize(tag.Directors()).c_str(),
-        CPVREpgInfoTag::DeTokenize(tag.Writers()).c_str(), tag.Year(), tag.IMDBNumber().c_str(),
-        tag.ClientIconPath().c_str(), tag.GenreType(), tag.GenreSubType(),
-        tag.GenreDescription().c_str(), sFirstAired.c_str(), tag.ParentalRating(), tag.StarRating(),
-        tag.SeriesNumber(), tag.EpisodeNumber(), tag.EpisodePart(), tag.EpisodeName().c_str(),
-        tag.Flags(), tag.SeriesLink().c_str(), tag.ParentalRatingCode().c_str(),
-        tag.UniqueBroadcastID(), iBroadcastId, tag.ClientParentalRatingIconPath().c_str(),
-        tag.ParentalRatingSource().c_str(), tag.TitleExtraInfo().c_str());
+    CLog::LogF(LOGERROR, "Failed to persist the tags of EPG {}", iEpgID);
+    if (bOwnTransaction)
+      RollbackTransaction();
   }
-
-  QueueInsertQuery(strQuery);
-  return true;
+  return false;
 }
 
 int CPVREpgDatabase::GetLastEPGId() const
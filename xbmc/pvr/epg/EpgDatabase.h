@@ -66,7 +66,7 @@ public:
    * @brief Get the minimal database version that is required to operate correctly.
    * @return The minimal database version.
    */
-  int GetSchemaVersion() const override { return 21; }
+  int GetSchemaVersion() const override { return 22; }
 
   /*!
    * @brief Get the default sqlite database filename.
@@ -90,13 +90,6 @@ public:
    */
   bool QueueDeleteEpgQuery(const CPVREpg& table);
 
-  /*!
-   * @brief Write the query to delete the given EPG tag to db query queue.
-   * @param tag The EPG tag to remove.
-   * @return True on success, false otherwise.
-   */
-  bool QueueDeleteTagQuery(const CPVREpgInfoTag& tag);
-
   /*!
    * @brief Get all EPG tables from the database. Does not get the EPG tables' entries.
    * @return The entries.
@@ -233,18 +226,6 @@ public:
   std::vector<std::shared_ptr<CPVREpgInfoTag>> GetEpgTagsByMinEndMaxStartTime(
       int iEpgID, const CDateTime& minEndTime, const CDateTime& maxStartTime) const;
 
-  /*!
-   * @brief Write the query to delete all EPG tags in range of given EPG id, min end time and max
-   * start time to db query queue. .
-   * @param iEpgID The ID of the EPG for the tags to delete.
-   * @param minEndTime The min end time for the tags to delete.
-   * @param maxStartTime The max start time for the tags to delete.
-   * @return True if it was removed or queued successfully, false otherwise.
-   */
-  bool QueueDeleteEpgTagsByMinEndMaxStartTimeQuery(int iEpgID,
-                                                   const CDateTime& minEndTime,
-                                                   const CDateTime& maxStartTime);
-
   /*!
    * @brief Get the last stored EPG scan time.
    * @param iEpgId The table to update the time for. Use 0 for a global value.
@@ -299,11 +280,17 @@ public:
   bool QueueDeleteEpgTags(int iEpgId);
 
   /*!
-   * @brief Write the query to persist the given EPG tag to db query queue.
-   * @param tag The tag to persist.
+   * @brief Write the changed and deleted tags of an EPG to the database in a single transaction.
+   * @details Stored tags overlapping a changed tag are deleted before the changed tag is written.
+   * The statements are compiled once and only get the values of each tag bound.
+   * @param iEpgID The ID of the EPG.
+   * @param changedTags The new and changed tags.
+   * @param deletedTags The tags to delete.
    * @return True on success, false otherwise.
    */
-  bool QueuePersistQuery(const CPVREpgInfoTag& tag);
+  bool PersistTags(int iEpgID,
+                   const std::vector<std::shared_ptr<CPVREpgInfoTag>>& changedTags,
+                   const std::vector<std::shared_ptr<CPVREpgInfoTag>>& deletedTags);
 
   /*!
    * @return Last EPG id in the database
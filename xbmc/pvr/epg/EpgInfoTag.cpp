@@ -15,7 +15,6 @@
 #include "pvr/addons/PVRClient.h"
 #include "pvr/epg/Epg.h"
 #include "pvr/epg/EpgChannelData.h"
-#include "pvr/epg/EpgDatabase.h"
 #include "pvr/epg/EpgGuidePath.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
@@ -545,17 +544,6 @@ bool CPVREpgInfoTag::Update(const CPVREpgInfoTag& tag, bool bUpdateBroadcastId /
   return bChanged;
 }
 
-bool CPVREpgInfoTag::QueuePersistQuery(const std::shared_ptr<CPVREpgDatabase>& database) const
-{
-  if (!database)
-  {
-    CLog::LogF(LOGERROR, "Could not open the EPG database");
-    return false;
-  }
-
-  return database->QueuePersistQuery(*this);
-}
-
 std::vector<EDL::Edit> CPVREpgInfoTag::GetEdl() const
 {
   std::vector<EDL::Edit> edls;
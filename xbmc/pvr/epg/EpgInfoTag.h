@@ -411,13 +411,6 @@ public:
    */
   bool IsPlayable() const;
 
-  /*!
-   * @brief Write query to persist this tag in the query queue of the given database.
-   * @param database The database.
-   * @return True on success, false otherwise.
-   */
-  bool QueuePersistQuery(const std::shared_ptr<CPVREpgDatabase>& database) const;
-
   /*!
    * @brief Update the information in this tag with the info in the given tag.
    * @param tag The new info.
@@ -15,6 +15,8 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <chrono>
+#include <iterator>
 #include <ranges>
 
 using namespace PVR;
@@ -157,18 +159,21 @@ bool CPVREpgTagsContainer::UpdateEntries(const CPVREpgTagsContainer& tags)
       }
     }
 
+    // compare by start time without searching the stored tags once per incoming tag
+    std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>> existingTagsByStart;
+    for (const auto& tag : existingTags)
+      existingTagsByStart.try_emplace(tag->StartAsUTC(), tag);
+
     bool bResetCache = false;
     for (const auto& [_, tag] : tags.m_changedTags)
     {
       tag->SetChannelData(m_channelData);
       tag->SetEpgID(m_iEpgID);
 
-      const auto it = std::ranges::find_if(existingTags, [&tag](const auto& t)
-                                           { return t->StartAsUTC() == tag->StartAsUTC(); });
-
-      if (it != existingTags.cend())
+      const auto it = existingTagsByStart.find(tag->StartAsUTC());
+      if (it != existingTagsByStart.cend())
       {
-        const std::shared_ptr<CPVREpgInfoTag>& existingTag = *it;
+        const std::shared_ptr<CPVREpgInfoTag>& existingTag = it->second;
 
         existingTag->SetChannelData(m_channelData);
         existingTag->SetEpgID(m_iEpgID);
@@ -606,35 +611,39 @@ bool CPVREpgTagsContainer::NeedsSave() const
   return !m_changedTags.empty() || !m_deletedTags.empty();
 }
 
-void CPVREpgTagsContainer::QueuePersistQuery()
+bool CPVREpgTagsContainer::Persist()
 {
-  if (m_database)
-  {
-    m_database->Lock();
+  if (!m_database)
+    return false;
 
-    CLog::LogFC(LOGDEBUG, LOGEPG, "EPG Tags Container: Updating {}, deleting {} events...",
-                m_changedTags.size(), m_deletedTags.size());
+  FixOverlappingEvents(m_changedTags);
 
-    for (const auto& [_, tag] : m_deletedTags)
-      m_database->QueueDeleteTagQuery(*tag);
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> changedTags;
+  changedTags.reserve(m_changedTags.size());
+  std::ranges::copy(m_changedTags | std::views::values, std::back_inserter(changedTags));
 
-    m_deletedTags.clear();
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> deletedTags;
+  deletedTags.reserve(m_deletedTags.size());
+  std::ranges::copy(m_deletedTags | std::views::values, std::back_inserter(deletedTags));
 
-    FixOverlappingEvents(m_changedTags);
+  const auto start = std::chrono::steady_clock::now();
 
-    for (const auto& [_, tag] : m_changedTags)
-    {
-      // remove any conflicting events from database before persisting the new event
-      m_database->QueueDeleteEpgTagsByMinEndMaxStartTimeQuery(
-          m_iEpgID, tag->StartAsUTC() + ONE_SECOND, tag->EndAsUTC() - ONE_SECOND);
+  const bool bReturn = m_database->PersistTags(m_iEpgID, changedTags, deletedTags);
 
-      tag->QueuePersistQuery(m_database);
-    }
+  CLog::LogFC(LOGDEBUG, LOGEPG, "EPG Tags Container: Updated {}, deleted {} events in {} ms",
+              changedTags.size(), deletedTags.size(),
+              std::chrono::duration_cast<std::chrono::milliseconds>(
+                  std::chrono::steady_clock::now() - start)
+                  .count());
 
+  // the tags of a failed transaction are kept for the next attempt
+  if (bReturn)
+  {
+    m_deletedTags.clear();
     Clear();
-
-    m_database->Unlock();
   }
+
+  return bReturn;
 }
 
 void CPVREpgTagsContainer::QueueDelete()
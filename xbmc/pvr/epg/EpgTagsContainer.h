@@ -165,9 +165,10 @@ public:
   bool NeedsSave() const;
 
   /*!
-   * @brief Write the query to persist data into database's queue
+   * @brief Write the changed and deleted tags to the database.
+   * @return True on success, false otherwise.
    */
-  void QueuePersistQuery();
+  bool Persist();
 
   /*!
    * @brief Queue the deletion of this container from its database.
@@ -40,7 +40,7 @@ void CGUIEPGGridContainerModel::SetInvalid() const
     gridItem.item->SetInvalid();
   for (const auto& channel : m_channelItems)
     channel->SetInvalid();
-  for (const auto& ruler : m_rulerItems)
+  for (const auto& [_, ruler] : m_rulerItems)
     ruler->SetInvalid();
 }
 
@@ -127,25 +127,12 @@ void CGUIEPGGridContainerModel::Initialize(const CFileItemList& items,
   }
 
   ////////////////////////////////////////////////////////////////////////
-  // Create ruler items
-
-  // 1) ruler date item
-  CDateTime rulerDateLocal;
-  rulerDateLocal.SetFromUTCDateTime(m_gridStart);
-  auto rulerDateItem{std::make_shared<CFileItem>(rulerDateLocal.GetAsLocalizedDate(true))};
-  rulerDateItem->SetProperty("DateLabel", true);
-  m_rulerItems.emplace_back(std::move(rulerDateItem));
-
-  // 2) ruler time items
-  const CDateTimeSpan unit(0, 0, blocksPerRulerItem * m_minutesPerBlock, 0);
-  CDateTime rulerLocal;
-  for (CDateTime rulerUTC = m_gridStart; rulerUTC < m_gridEnd; rulerUTC += unit)
-  {
-    rulerLocal.SetFromUTCDateTime(rulerUTC);
-    auto rulerItem{std::make_shared<CFileItem>(rulerLocal.GetAsLocalizedTime("", false))};
-    rulerItem->SetLabel2(rulerLocal.GetAsLocalizedDate(true));
-    m_rulerItems.emplace_back(std::move(rulerItem));
-  }
+  // Ruler items are created on demand. The first one holds the date, followed by one per
+  // blocksPerRulerItem blocks up to the grid end.
+  m_blocksPerRulerItem = std::max(blocksPerRulerItem, 1);
+  const int rulerItemSeconds = m_blocksPerRulerItem * m_minutesPerBlock * 60;
+  const int gridSeconds = (m_gridEnd - m_gridStart).GetSecondsTotal();
+  m_rulerItemsSize = 1 + (gridSeconds + rulerItemSeconds - 1) / rulerItemSeconds;
 
   m_firstActiveChannel = iFirstChannel;
   m_lastActiveChannel = iFirstChannel + iChannelsPerPage - 1;
@@ -153,6 +140,37 @@ void CGUIEPGGridContainerModel::Initialize(const CFileItemList& items,
   m_lastActiveBlock = iFirstBlock + iBlocksPerPage - 1;
 }
 
+std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::CreateRulerItem(int iIndex) const
+{
+  if (iIndex == 0)
+  {
+    // ruler date item
+    CDateTime rulerDateLocal;
+    rulerDateLocal.SetFromUTCDateTime(m_gridStart);
+    auto rulerDateItem{std::make_shared<CFileItem>(rulerDateLocal.GetAsLocalizedDate(true))};
+    rulerDateItem->SetProperty("DateLabel", true);
+    return rulerDateItem;
+  }
+
+  // ruler time item
+  const CDateTime rulerUTC =
+      m_gridStart + CDateTimeSpan(0, 0, (iIndex - 1) * m_blocksPerRulerItem * m_minutesPerBlock, 0);
+  CDateTime rulerLocal;
+  rulerLocal.SetFromUTCDateTime(rulerUTC);
+  auto rulerItem{std::make_shared<CFileItem>(rulerLocal.GetAsLocalizedTime("", false))};
+  rulerItem->SetLabel2(rulerLocal.GetAsLocalizedDate(true));
+  return rulerItem;
+}
+
+std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::GetRulerItem(int iIndex) const
+{
+  auto it = m_rulerItems.find(iIndex);
+  if (it == m_rulerItems.end())
+    it = m_rulerItems.try_emplace(iIndex, CreateRulerItem(iIndex)).first;
+
+  return (*it).second;
+}
+
 std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::CreateEpgTags(int iChannel, int iBlock) const
 {
   std::shared_ptr<CFileItem> result;
@@ -341,6 +359,27 @@ std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::GetEpgTagsAfter(EpgTags& e
   return result;
 }
 
+void CGUIEPGGridContainerModel::TrimEpgTags(EpgTags& epgTags, int firstBlock, int lastBlock) const
+{
+  auto& tags = epgTags.tags;
+
+  const auto first = std::ranges::find_if(
+      tags, [this, firstBlock](const auto& item)
+      { return GetLastEventBlock(item->GetEPGInfoTag()) >= firstBlock; });
+  tags.erase(tags.begin(), first);
+
+  const auto last = std::ranges::find_if(
+      tags, [this, lastBlock](const auto& item)
+      { return GetFirstEventBlock(item->GetEPGInfoTag()) > lastBlock; });
+  tags.erase(last, tags.end());
+
+  if (!tags.empty())
+  {
+    epgTags.firstBlock = GetFirstEventBlock(tags.front()->GetEPGInfoTag());
+    epgTags.lastBlock = GetLastEventBlock(tags.back()->GetEPGInfoTag());
+  }
+}
+
 std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::GetItem(int iChannel, int iBlock) const
 {
   std::shared_ptr<CFileItem> result;
@@ -521,60 +560,24 @@ bool CGUIEPGGridContainerModel::FreeProgrammeMemory(int firstChannel,
   // clear the grid. it will be recreated on-demand.
   m_gridIndex.clear();
 
-  bool newChannels = false;
-
-  if (channelsChanged)
+  // Drop the tags of channels which left the window, and the tags of the other channels which
+  // ended before or start after it. Channels and blocks entering the window are fetched on demand
+  // by GetItem(), which extends the tags kept here.
+  for (auto it = m_epgItems.begin(); it != m_epgItems.end();)
   {
-    // purge epg tags for inactive channels
-    for (auto it = m_epgItems.begin(); it != m_epgItems.end();)
+    if ((*it).first < firstChannel || (*it).first > lastChannel)
     {
-      if ((*it).first < firstChannel || (*it).first > lastChannel)
-      {
-        it = m_epgItems.erase(it);
-        continue; // next channel
-      }
-      ++it;
+      it = m_epgItems.erase(it);
+      continue;
     }
 
-    newChannels = (firstChannel < m_firstActiveChannel) || (lastChannel > m_lastActiveChannel);
-  }
-
-  if (blocksChanged || newChannels)
-  {
-    // clear and refetch epg tags for active channels
-    const CDateTime maxEnd = GetStartTimeForBlock(firstBlock);
-    const CDateTime minStart = GetStartTimeForBlock(lastBlock);
-    std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
-    for (int i = firstChannel; i <= lastChannel; ++i)
+    TrimEpgTags((*it).second, firstBlock, lastBlock);
+    if ((*it).second.tags.empty())
     {
-      auto it = m_epgItems.find(i);
-      if (it == m_epgItems.end())
-        it = m_epgItems.try_emplace(i).first;
-
-      if (blocksChanged || i < m_firstActiveChannel || i > m_lastActiveChannel)
-      {
-        EpgTags& epgTags = (*it).second;
-
-        (*it).second.tags.clear();
-
-        tags = GetEPGTimeline(i, maxEnd, minStart);
-        const int firstResultBlock = GetFirstEventBlock(tags.front());
-        const int lastResultBlock = GetLastEventBlock(tags.back());
-        if (firstResultBlock > lastResultBlock)
-          continue;
-
-        epgTags.firstBlock = firstResultBlock;
-        epgTags.lastBlock = lastResultBlock;
-
-        for (const auto& tag : tags)
-        {
-          if (GetFirstEventBlock(tag) > GetLastEventBlock(tag))
-            continue;
-
-          epgTags.tags.emplace_back(std::make_shared<CFileItem>(tag));
-        }
-      }
+      it = m_epgItems.erase(it);
+      continue;
     }
+    ++it;
   }
 
   m_firstActiveChannel = firstChannel;
@@ -587,25 +590,18 @@ bool CGUIEPGGridContainerModel::FreeProgrammeMemory(int firstChannel,
 
 void CGUIEPGGridContainerModel::FreeRulerMemory(int keepStart, int keepEnd)
 {
-  if (keepStart < keepEnd)
-  {
-    // remove before keepStart and after keepEnd
-    for (int i = 1; i < keepStart && i < RulerItemsSize(); ++i)
-      m_rulerItems[i]->FreeMemory();
-    for (int i = keepEnd + 1; i < RulerItemsSize(); ++i)
-      m_rulerItems[i]->FreeMemory();
-  }
-  else
-  {
-    // wrapping
-    for (int i = keepEnd + 1; i < keepStart && i < RulerItemsSize(); ++i)
-    {
-      if (i == 0)
-        continue;
-
-      m_rulerItems[i]->FreeMemory();
-    }
-  }
+  std::erase_if(m_rulerItems,
+                [keepStart, keepEnd](const auto& entry)
+                {
+                  const int i = entry.first;
+                  if (i == 0)
+                    return false; // the date item is always needed
+
+                  if (keepStart < keepEnd)
+                    return i < keepStart || i > keepEnd; // remove before keepStart and after keepEnd
+                  else
+                    return i > keepEnd && i < keepStart; // wrapping
+                });
 }
 
 unsigned int CGUIEPGGridContainerModel::GetPageNowOffset() const
@@ -83,8 +83,8 @@ public:
     return m_channelItems.empty() ? -1 : static_cast<int>(m_channelItems.size()) - 1;
   }
 
-  std::shared_ptr<CFileItem> GetRulerItem(int iIndex) const { return m_rulerItems[iIndex]; }
-  int RulerItemsSize() const { return static_cast<int>(m_rulerItems.size()); }
+  std::shared_ptr<CFileItem> GetRulerItem(int iIndex) const;
+  int RulerItemsSize() const { return m_rulerItemsSize; }
 
   int GridItemsSize() const { return m_blocks; }
   bool IsSameGridItem(int iChannel, int iBlock1, int iBlock2) const;
@@ -118,6 +118,7 @@ private:
 
   GridItem* GetGridItemPtr(int iChannel, int iBlock) const;
   std::shared_ptr<CFileItem> CreateGapItem(int iChannel) const;
+  std::shared_ptr<CFileItem> CreateRulerItem(int iIndex) const;
   std::shared_ptr<CFileItem> GetItem(int iChannel, int iBlock) const;
 
   std::vector<std::shared_ptr<CPVREpgInfoTag>> GetEPGTimeline(int iChannel,
@@ -139,6 +140,7 @@ private:
                                         int iBlock) const;
   std::shared_ptr<CFileItem> GetEpgTagsBefore(EpgTags& epgTags, int iChannel, int iBlock) const;
   std::shared_ptr<CFileItem> GetEpgTagsAfter(EpgTags& epgTags, int iChannel, int iBlock) const;
+  void TrimEpgTags(EpgTags& epgTags, int firstBlock, int lastBlock) const;
 
   mutable EpgTagsMap m_epgItems;
 
@@ -146,7 +148,11 @@ private:
   CDateTime m_gridEnd;
 
   std::vector<std::shared_ptr<CFileItem>> m_channelItems;
-  std::vector<std::shared_ptr<CFileItem>> m_rulerItems;
+
+  // created on demand, only the ones in or near the visible window are kept
+  mutable std::map<int, std::shared_ptr<CFileItem>> m_rulerItems;
+  int m_rulerItemsSize = 0;
+  int m_blocksPerRulerItem = 1;
 
   struct GridCoordinates
   {
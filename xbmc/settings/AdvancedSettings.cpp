@@ -393,6 +393,8 @@ void CAdvancedSettings::Initialize()
   m_musicArtistSeparators = { ";", " feat. ", " ft. " };
   m_videoItemSeparator = " / ";
   m_iMusicLibraryDateAdded = 1; // prefer mtime over ctime and current time
+  m_iMusicLibraryTagReaders = 4;
+  m_bMusicLibraryIncrementalUpdate = false;
   m_bMusicLibraryUseISODates = false;
   m_bMusicLibraryArtistNavigatesToSongs = false;
 
@@ -400,6 +402,7 @@ void CAdvancedSettings::Initialize()
   m_iVideoLibraryRecentlyAddedItems = 25;
   m_bVideoLibraryCleanOnUpdate = false;
   m_bVideoLibraryUseFastHash = true;
+  m_bVideoLibraryIncrementalUpdate = false;
   m_bVideoScannerIgnoreErrors = false;
   m_iVideoLibraryDateAdded = 1; // prefer mtime over ctime and current time
   m_minimumEpisodePlaylistDuration = 5 * 60; // 5 minutes
@@ -509,6 +512,8 @@ void CAdvancedSettings::Initialize()
 
   m_databaseMusic.Reset();
   m_databaseVideo.Reset();
+  m_databaseQueryProfiling = false;
+  m_databaseSlowQueryTime = 100;
 
   m_useLocaleCollation = true;
 
@@ -538,6 +543,7 @@ void CAdvancedSettings::Initialize()
 
   m_nfsTimeout = 30;
   m_nfsRetries = -1;
+  m_persistentDirectoryCache = false;
 
   m_initialized = true;
 }
@@ -883,6 +889,8 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "dateadded", m_iMusicLibraryDateAdded);
     XMLUtils::GetBoolean(pElement, "useisodates", m_bMusicLibraryUseISODates);
     XMLUtils::GetBoolean(pElement, "artistnavigatestosongs", m_bMusicLibraryArtistNavigatesToSongs);
+    XMLUtils::GetInt(pElement, "tagreaders", m_iMusicLibraryTagReaders, 1, 16);
+    XMLUtils::GetBoolean(pElement, "incrementalupdate", m_bMusicLibraryIncrementalUpdate);
     // Music artist name separators
     const TiXmlElement* separators = pElement->FirstChildElement("artistseparators");
     if (separators)
@@ -905,6 +913,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "recentlyaddeditems", m_iVideoLibraryRecentlyAddedItems, 1, INT_MAX);
     XMLUtils::GetBoolean(pElement, "cleanonupdate", m_bVideoLibraryCleanOnUpdate);
     XMLUtils::GetBoolean(pElement, "usefasthash", m_bVideoLibraryUseFastHash);
+    XMLUtils::GetBoolean(pElement, "incrementalupdate", m_bVideoLibraryIncrementalUpdate);
     XMLUtils::GetString(pElement, "itemseparator", m_videoItemSeparator);
     XMLUtils::GetBoolean(pElement, "importwatchedstate", m_bVideoLibraryImportWatchedState);
     XMLUtils::GetBoolean(pElement, "importresumepoint", m_bVideoLibraryImportResumePoint);
@@ -947,6 +956,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetString(pElement, "catrustfile", m_caTrustFile);
     XMLUtils::GetUInt(pElement, "nfstimeout", m_nfsTimeout, 0, 3600);
     XMLUtils::GetInt(pElement, "nfsretries", m_nfsRetries, -1, 30);
+    XMLUtils::GetBoolean(pElement, "persistentdirectorycache", m_persistentDirectoryCache);
   }
 
   pElement = pRootElement->FirstChildElement("jsonrpc");
@@ -1276,6 +1286,9 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
       dbElement != nullptr)
     ParseDatabaseSettings(dbElement, m_databaseEpg);
 
+  XMLUtils::GetBoolean(pRootElement, "queryprofiling", m_databaseQueryProfiling);
+  XMLUtils::GetInt(pRootElement, "slowquerytime", m_databaseSlowQueryTime, 0, INT_MAX);
+
   XMLUtils::GetBoolean(pRootElement, "enablemultimediakeys", m_enableMultimediaKeys);
 
   pElement = pRootElement->FirstChildElement("gui");
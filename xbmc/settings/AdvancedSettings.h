@@ -278,6 +278,8 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_bMusicLibraryArtistSortOnUpdate;
     bool m_bMusicLibraryUseISODates;
     bool m_bMusicLibraryArtistNavigatesToSongs;
+    int m_iMusicLibraryTagReaders; // files whose tags are read at once while scanning
+    bool m_bMusicLibraryIncrementalUpdate; // only look into folders changed since the last update
     std::string m_strMusicLibraryAlbumFormat;
     bool m_prioritiseAPEv2tags;
     std::string m_musicItemSeparator;
@@ -289,6 +291,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int m_iVideoLibraryRecentlyAddedItems;
     bool m_bVideoLibraryCleanOnUpdate;
     bool m_bVideoLibraryUseFastHash;
+    bool m_bVideoLibraryIncrementalUpdate; // only look into folders changed since the last update
     bool m_bVideoLibraryImportWatchedState{true};
     bool m_bVideoLibraryImportResumePoint{true};
 
@@ -368,6 +371,8 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     DatabaseSettings m_databaseVideo; // advanced video database setup
     DatabaseSettings m_databaseTV;    // advanced tv database setup
     DatabaseSettings m_databaseEpg;   /*!< advanced EPG database setup */
+    bool m_databaseQueryProfiling; /*!< record statements without the database log component */
+    int m_databaseSlowQueryTime; /*!< statements taking at least this many ms are logged, 0 for none */
 
     bool m_useLocaleCollation;
 
@@ -418,6 +423,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     std::string m_userAgent;
     uint32_t m_nfsTimeout;
     int m_nfsRetries;
+    bool m_persistentDirectoryCache;
 
   private:
     void Initialize();
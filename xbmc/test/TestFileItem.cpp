@@ -7,12 +7,17 @@
  */
 
 #include "FileItem.h"
+#include "FileItemList.h"
 #include "ServiceBroker.h"
 #include "URL.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "settings/lib/SettingsManager.h"
+#include "video/VideoInfoTag.h"
+
+#include <memory>
+#include <string>
 
 #include <gtest/gtest.h>
 
@@ -1000,6 +1005,49 @@ TEST(TestFileItem, TestAssignment)
   EXPECT_EQ("/local/path/file.txt", item.GetDynURL().Get());
 }
 
+TEST(TestFileItem, SortAfterChange)
+{
+  CFileItemList items;
+  items.Add(std::make_shared<CFileItem>("b"));
+  items.Add(std::make_shared<CFileItem>("c"));
+  items.Add(std::make_shared<CFileItem>("a"));
+
+  items.Sort(SortBy::LABEL, SortOrder::ASCENDING);
+  EXPECT_EQ("a", items[0]->GetLabel());
+  EXPECT_EQ("b", items[1]->GetLabel());
+  EXPECT_EQ("c", items[2]->GetLabel());
+
+  // the order must follow the changed item
+  items[0]->SetLabel("d");
+  items.Sort(SortBy::LABEL, SortOrder::ASCENDING);
+  EXPECT_EQ("b", items[0]->GetLabel());
+  EXPECT_EQ("c", items[1]->GetLabel());
+  EXPECT_EQ("d", items[2]->GetLabel());
+}
+
+TEST(TestFileItem, SortAfterTagChange)
+{
+  CFileItemList items;
+  for (const int playCount : {2, 0, 1})
+  {
+    auto item = std::make_shared<CFileItem>(std::to_string(playCount));
+    item->GetVideoInfoTag()->SetPlayCount(playCount);
+    items.Add(item);
+  }
+
+  items.Sort(SortBy::PLAYCOUNT, SortOrder::ASCENDING);
+  EXPECT_EQ("0", items[0]->GetLabel());
+  EXPECT_EQ("1", items[1]->GetLabel());
+  EXPECT_EQ("2", items[2]->GetLabel());
+
+  // changing the tag directly doesn't touch the item itself
+  items[0]->GetVideoInfoTag()->SetPlayCount(3);
+  items.Sort(SortBy::PLAYCOUNT, SortOrder::ASCENDING);
+  EXPECT_EQ("1", items[0]->GetLabel());
+  EXPECT_EQ("2", items[1]->GetLabel());
+  EXPECT_EQ("0", items[2]->GetLabel());
+}
+
 TEST(TestFileItem, MimeType)
 {
   CFileItem item("Internet Movies List");
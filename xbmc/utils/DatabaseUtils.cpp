@@ -10,12 +10,14 @@
 
 #include "dbwrappers/dataset.h"
 #include "music/MusicDatabase.h"
+#include "utils/SortUtils.h"
 #include "utils/StringUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 #include "video/VideoDatabase.h"
 #include "video/VideoDatabaseColumns.h"
 
+#include <algorithm>
 #include <sstream>
 
 MediaType DatabaseUtils::MediaTypeFromVideoContentType(VideoDbContentType videoContentType)
@@ -677,6 +679,113 @@ size_t DatabaseUtils::GetLimitCount(int end, int start)
   return 0;
 }
 
+bool DatabaseUtils::GetKeysetColumns(const MediaType& mediaType,
+                                     SortBy sortBy,
+                                     std::vector<std::string>& columns)
+{
+  columns.clear();
+
+  const std::string id = GetField(Field::ID, mediaType, DatabaseQueryPart::ORDER_BY);
+  if (id.empty())
+    return false;
+
+  // the order of any other sort method also depends on the (localized) label or on values
+  // which aren't stored in the view, so it can't be reproduced in SQL
+  if (sortBy == SortBy::DATE_ADDED)
+  {
+    // same as SortUtils' ByDateAdded
+    const std::string dateAdded =
+        GetField(Field::DATE_ADDED, mediaType, DatabaseQueryPart::ORDER_BY);
+    if (dateAdded.empty())
+      return false;
+    columns.emplace_back(dateAdded);
+  }
+  else if (sortBy != SortBy::NONE)
+    return false;
+
+  columns.emplace_back(id);
+  return true;
+}
+
+std::string DatabaseUtils::BuildKeysetOrder(const std::vector<std::string>& columns,
+                                            bool descending)
+{
+  std::string order;
+  for (const auto& column : columns)
+  {
+    if (!order.empty())
+      order += ", ";
+    order += column;
+    if (descending)
+      order += " DESC";
+  }
+  return order;
+}
+
+std::string DatabaseUtils::BuildKeysetCondition(const std::vector<std::string>& columns,
+                                                const std::vector<std::string>& values,
+                                                bool descending)
+{
+  if (columns.empty() || columns.size() != values.size())
+    return "";
+
+  // (c1 after v1) OR (c1 = v1 AND c2 after v2) OR ..., with NULL sorting before any value as
+  // it does in both SQLite and MySQL
+  std::vector<std::string> alternatives;
+  std::string equal;
+  for (size_t i = 0; i < columns.size(); ++i)
+  {
+    const std::string& column = columns[i];
+    const bool isNull = values[i] == "NULL";
+
+    std::string after;
+    if (isNull)
+    {
+      if (!descending)
+        after = column + " IS NOT NULL";
+    }
+    else if (descending)
+      after = "(" + column + " < " + values[i] + " OR " + column + " IS NULL)";
+    else
+      after = column + " > " + values[i];
+
+    if (!after.empty())
+      alternatives.emplace_back(equal.empty() ? after : equal + " AND " + after);
+
+    if (!equal.empty())
+      equal += " AND ";
+    equal += isNull ? column + " IS NULL" : column + " = " + values[i];
+  }
+
+  if (alternatives.empty())
+    return "";
+
+  return "(" + StringUtils::Join(alternatives, " OR ") + ")";
+}
+
+std::string DatabaseUtils::BuildSearchMatch(std::string_view term,
+                                            const std::vector<std::string>& columns)
+{
+  if (columns.empty() || term.find_first_of("%_") != std::string_view::npos)
+    return "";
+
+  // the tokenizer splits into trigrams of characters, not bytes
+  const auto characters = std::count_if(term.begin(), term.end(), [](char c)
+                                        { return (static_cast<unsigned char>(c) & 0xC0) != 0x80; });
+  if (characters < 3)
+    return "";
+
+  std::string phrase;
+  for (char c : term)
+  {
+    if (c == '"')
+      phrase += '"';
+    phrase += c;
+  }
+
+  return "{" + StringUtils::Join(columns, " ") + "}: \"" + phrase + "\"";
+}
+
 int DatabaseUtils::GetField(Field field, const MediaType &mediaType, bool asIndex)
 {
   if (field == Field::NONE || mediaType == MediaTypeNone)
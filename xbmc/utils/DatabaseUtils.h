@@ -13,9 +13,11 @@
 #include <map>
 #include <set>
 #include <string>
+#include <string_view>
 #include <vector>
 
 class CVariant;
+enum class SortBy;
 enum class VideoDbContentType;
 
 namespace dbiplus
@@ -189,6 +191,42 @@ public:
   static std::string BuildLimitClauseOnly(int end, int start = 0);
   static size_t GetLimitCount(int end, int start);
 
+  /*!
+   \brief Get the columns to page through a listing sorted by the given method with keyset pagination
+   \details Only sort methods whose order is fully defined by columns of the media type's view are
+   supported, the last column is always the item's id.
+   \param mediaType the media type of the listing
+   \param sortBy the sort method of the listing
+   \param columns the columns to order the listing by
+   \return true if the listing can be paged with keyset pagination, false otherwise
+   */
+  static bool GetKeysetColumns(const MediaType& mediaType,
+                               SortBy sortBy,
+                               std::vector<std::string>& columns);
+  static std::string BuildKeysetOrder(const std::vector<std::string>& columns, bool descending);
+  /*!
+   \brief Build the condition selecting the rows following a row of a listing ordered by columns
+   \param columns the columns the listing is ordered by, as returned by GetKeysetColumns()
+   \param values the values of the columns of the row as SQL literals, "NULL" for NULL
+   \param descending whether the listing is ordered descending
+   \return the condition or an empty string if no row can follow
+   */
+  static std::string BuildKeysetCondition(const std::vector<std::string>& columns,
+                                          const std::vector<std::string>& values,
+                                          bool descending);
+
+  /*!
+   \brief Build the full-text query finding a search term as part of any of the given columns
+   \details The query is meant for a search index using the trigram tokenizer, which can't find
+   terms shorter than three characters. Terms containing LIKE wildcards aren't taken literally by
+   the LIKE conditions a search index narrows down, so they aren't supported either.
+   \param term the search term
+   \param columns the columns of the search index to search in
+   \return the query or an empty string if the term can't be searched for in a search index
+   */
+  static std::string BuildSearchMatch(std::string_view term,
+                                      const std::vector<std::string>& columns);
+
 private:
   static int GetField(Field field, const MediaType &mediaType, bool asIndex);
 };
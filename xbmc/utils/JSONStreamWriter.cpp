@@ -0,0 +1,325 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "JSONStreamWriter.h"
+
+#include "utils/Variant.h"
+
+#include <charconv>
+#include <utility>
+
+#include <nlohmann/json.hpp>
+
+namespace
+{
+constexpr std::string_view REPLACEMENT_CHARACTER = "\xEF\xBF\xBD";
+constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+/*!
+ * \brief Get the length of the valid UTF-8 sequence starting at pos
+ * \return the length of the sequence, 0 if it is invalid
+ */
+size_t GetSequenceLength(std::string_view str, size_t pos)
+{
+  const auto lead = static_cast<unsigned char>(str[pos]);
+  size_t length = 0;
+  unsigned char min = 0x80;
+  unsigned char max = 0xBF;
+
+  if (lead >= 0xC2 && lead <= 0xDF)
+    length = 2;
+  else if (lead >= 0xE0 && lead <= 0xEF)
+  {
+    length = 3;
+    // reject overlong encodings and surrogates
+    if (lead == 0xE0)
+      min = 0xA0;
+    else if (lead == 0xED)
+      max = 0x9F;
+  }
+  else if (lead >= 0xF0 && lead <= 0xF4)
+  {
+    length = 4;
+    // reject overlong encodings and code points beyond U+10FFFF
+    if (lead == 0xF0)
+      min = 0x90;
+    else if (lead == 0xF4)
+      max = 0x8F;
+  }
+  else
+    return 0;
+
+  if (pos + length > str.size())
+    return 0;
+
+  for (size_t i = 1; i < length; i++)
+  {
+    const auto c = static_cast<unsigned char>(str[pos + i]);
+    if (c < (i == 1 ? min : 0x80) || c > (i == 1 ? max : 0xBF))
+      return 0;
+  }
+
+  return length;
+}
+} // unnamed namespace
+
+CJSONStreamWriter::CJSONStreamWriter(Sink sink, bool compact, size_t chunkSize)
+  : m_sink(std::move(sink)), m_compact(compact), m_chunkSize(chunkSize)
+{
+  m_buffer.reserve(m_chunkSize);
+}
+
+void CJSONStreamWriter::BeginObject()
+{
+  BeginContainer(true, '{');
+}
+
+void CJSONStreamWriter::EndObject()
+{
+  EndContainer('}');
+}
+
+void CJSONStreamWriter::BeginArray()
+{
+  BeginContainer(false, '[');
+}
+
+void CJSONStreamWriter::EndArray()
+{
+  EndContainer(']');
+}
+
+void CJSONStreamWriter::Key(std::string_view key)
+{
+  BeginValue();
+  WriteString(key);
+  Append(m_compact ? ":" : ": ");
+  m_afterKey = true;
+}
+
+void CJSONStreamWriter::Value(const CVariant& value)
+{
+  switch (value.type())
+  {
+    case CVariant::VariantTypeArray:
+      BeginArray();
+      for (auto it = value.begin_array(); it != value.end_array(); ++it)
+        Value(*it);
+      EndArray();
+      break;
+
+    case CVariant::VariantTypeObject:
+      BeginObject();
+      for (auto it = value.begin_map(); it != value.end_map(); ++it)
+      {
+        Key(it->first);
+        Value(it->second);
+      }
+      EndObject();
+      break;
+
+    default:
+      BeginValue();
+      WriteScalar(value);
+      FlushIfFull();
+      break;
+  }
+}
+
+void CJSONStreamWriter::Raw(std::string_view text)
+{
+  Append(text);
+  FlushIfFull();
+}
+
+bool CJSONStreamWriter::Flush()
+{
+  if (!m_failed && !m_buffer.empty() && !m_sink(m_buffer.data(), m_buffer.size()))
+    m_failed = true;
+
+  m_buffer.clear();
+  return !m_failed;
+}
+
+void CJSONStreamWriter::BeginValue()
+{
+  if (m_afterKey)
+  {
+    m_afterKey = false;
+    return;
+  }
+
+  if (m_containers.empty())
+    return;
+
+  Container& container = m_containers.back();
+  if (!container.empty)
+    Append(',');
+  container.empty = false;
+
+  if (!m_compact)
+  {
+    Append('\n');
+    Indent(m_containers.size());
+  }
+}
+
+void CJSONStreamWriter::BeginContainer(bool isObject, char bracket)
+{
+  BeginValue();
+  Append(bracket);
+  m_containers.push_back({isObject, true});
+}
+
+void CJSONStreamWriter::EndContainer(char bracket)
+{
+  if (m_containers.empty())
+    return;
+
+  const bool empty = m_containers.back().empty;
+  m_containers.pop_back();
+
+  if (!m_compact && !empty)
+  {
+    Append('\n');
+    Indent(m_containers.size());
+  }
+  Append(bracket);
+  FlushIfFull();
+}
+
+void CJSONStreamWriter::Indent(size_t depth)
+{
+  if (!m_failed)
+    m_buffer.append(depth, '\t');
+}
+
+void CJSONStreamWriter::WriteScalar(const CVariant& value)
+{
+  char number[24];
+  std::to_chars_result result{number, {}};
+
+  switch (value.type())
+  {
+    case CVariant::VariantTypeInteger:
+      result = std::to_chars(number, number + sizeof(number), value.asInteger());
+      Append(std::string_view(number, result.ptr - number));
+      break;
+    case CVariant::VariantTypeUnsignedInteger:
+      result = std::to_chars(number, number + sizeof(number), value.asUnsignedInteger());
+      Append(std::string_view(number, result.ptr - number));
+      break;
+    case CVariant::VariantTypeDouble:
+      // keep the number format of CJSONVariantWriter, e.g. 1.0 instead of 1
+      Append(nlohmann::json(value.asDouble()).dump());
+      break;
+    case CVariant::VariantTypeBoolean:
+      Append(value.asBoolean() ? "true" : "false");
+      break;
+    case CVariant::VariantTypeString:
+      WriteString(std::string_view(value.c_str(), value.size()));
+      break;
+    case CVariant::VariantTypeConstNull:
+    case CVariant::VariantTypeNull:
+    default:
+      Append("null");
+      break;
+  }
+}
+
+void CJSONStreamWriter::WriteString(std::string_view str)
+{
+  Append('"');
+
+  size_t pos = 0;
+  while (pos < str.size())
+  {
+    // copy runs which don't need escaping at once
+    size_t end = pos;
+    while (end < str.size())
+    {
+      const auto c = static_cast<unsigned char>(str[end]);
+      if (c < 0x20 || c == '"' || c == '\\' || c >= 0x80)
+        break;
+      end++;
+    }
+    Append(str.substr(pos, end - pos));
+    pos = end;
+    if (pos >= str.size())
+      break;
+
+    const auto c = static_cast<unsigned char>(str[pos]);
+    if (c >= 0x80)
+    {
+      const size_t length = GetSequenceLength(str, pos);
+      if (length == 0)
+      {
+        Append(REPLACEMENT_CHARACTER);
+        pos++;
+      }
+      else
+      {
+        Append(str.substr(pos, length));
+        pos += length;
+      }
+      continue;
+    }
+
+    switch (c)
+    {
+      case '"':
+        Append("\\\"");
+        break;
+      case '\\':
+        Append("\\\\");
+        break;
+      case '\b':
+        Append("\\b");
+        break;
+      case '\f':
+        Append("\\f");
+        break;
+      case '\n':
+        Append("\\n");
+        break;
+      case '\r':
+        Append("\\r");
+        break;
+      case '\t':
+        Append("\\t");
+        break;
+      default:
+      {
+        const char escaped[] = {'\\', 'u', '0', '0', HEX_DIGITS[c >> 4], HEX_DIGITS[c & 0xF]};
+        Append(std::string_view(escaped, sizeof(escaped)));
+        break;
+      }
+    }
+    pos++;
+  }
+
+  Append('"');
+}
+
+void CJSONStreamWriter::Append(std::string_view data)
+{
+  if (!m_failed)
+    m_buffer.append(data);
+}
+
+void CJSONStreamWriter::Append(char c)
+{
+  if (!m_failed)
+    m_buffer.push_back(c);
+}
+
+void CJSONStreamWriter::FlushIfFull()
+{
+  if (m_buffer.size() >= m_chunkSize)
+    Flush();
+}
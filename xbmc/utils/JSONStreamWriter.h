@@ -0,0 +1,109 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class CVariant;
+
+/*!
+ * \brief Writes JSON incrementally and hands it to a sink in chunks.
+ *
+ * Containers are opened and closed explicitly, so a document can be written while its content is
+ * still being produced and never has to exist as a whole, neither as a CVariant nor as a string.
+ * The output is the same as the one of CJSONVariantWriter for the same document.
+ *
+ * Invalid UTF-8 in strings is replaced by U+FFFD as the output may already have been sent.
+ */
+class CJSONStreamWriter
+{
+public:
+  /*!
+   * \brief Receives the written output
+   * \return false to stop writing, e.g. because the receiver went away
+   */
+  using Sink = std::function<bool(const char* data, size_t size)>;
+
+  static constexpr size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+  /*!
+   * \param sink receiver of the output
+   * \param compact whether to omit all whitespace or to indent with tabs
+   * \param chunkSize number of bytes collected before they are handed to the sink
+   */
+  CJSONStreamWriter(Sink sink, bool compact, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+  ~CJSONStreamWriter() = default;
+
+  CJSONStreamWriter(const CJSONStreamWriter&) = delete;
+  CJSONStreamWriter& operator=(const CJSONStreamWriter&) = delete;
+
+  void BeginObject();
+  void EndObject();
+  void BeginArray();
+  void EndArray();
+
+  /*!
+   * \brief Write the key of the next member of the current object
+   */
+  void Key(std::string_view key);
+
+  /*!
+   * \brief Write a complete value, either as a member of the current container or as document
+   */
+  void Value(const CVariant& value);
+
+  /*!
+   * \brief Write text outside of the document as it is, e.g. a JSONP callback
+   */
+  void Raw(std::string_view text);
+
+  /*!
+   * \brief Hand all pending output to the sink
+   * \return false if the sink refused any output
+   */
+  bool Flush();
+
+  /*!
+   * \brief Whether the sink refused output, everything written afterwards is dropped
+   */
+  bool HasFailed() const { return m_failed; }
+
+  /*!
+   * \brief Get the nesting depth of the containers currently open
+   */
+  size_t GetDepth() const { return m_containers.size(); }
+
+private:
+  struct Container
+  {
+    bool isObject;
+    bool empty;
+  };
+
+  void BeginValue();
+  void BeginContainer(bool isObject, char bracket);
+  void EndContainer(char bracket);
+  void Indent(size_t depth);
+  void WriteScalar(const CVariant& value);
+  void WriteString(std::string_view str);
+  void Append(std::string_view data);
+  void Append(char c);
+  void FlushIfFull();
+
+  Sink m_sink;
+  bool m_compact;
+  size_t m_chunkSize;
+  bool m_failed = false;
+  bool m_afterKey = false;
+  std::vector<Container> m_containers;
+  std::string m_buffer;
+};
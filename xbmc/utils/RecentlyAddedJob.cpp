@@ -15,6 +15,7 @@
 #include "guilib/GUIWindow.h"
 #include "guilib/GUIWindowManager.h"
 #include "guilib/WindowIDs.h"
+#include "media/MediaType.h"
 #include "music/MusicDatabase.h"
 #include "music/MusicDbUrl.h"
 #include "music/MusicThumbLoader.h"
@@ -346,20 +347,25 @@ bool CRecentlyAddedJob::UpdateTotal()
   if (items.Size() == 1 && items.Get(0)->HasProperty("total"))
     MusArtistTotals = static_cast<int>(items.Get(0)->GetProperty("total").asInteger());
 
-  int MusSongTotals   = atoi(musicdatabase.GetSingleValue("songview"       , "count(1)").c_str());
-  int MusAlbumTotals  = atoi(musicdatabase.GetSingleValue("songview"       , "count(distinct strAlbum)").c_str());
+  // the song, album and video counts are kept by the databases
+  CMusicDatabase::LibraryStats musicStats;
+  musicdatabase.GetLibraryStats(musicStats);
+  int MusSongTotals   = musicStats.songs;
+  int MusAlbumTotals  = musicStats.albums;
   musicdatabase.Close();
 
+  std::map<std::string, CVideoDatabase::LibraryStats, std::less<>> videoStats;
   videodatabase.Open();
-  int tvShowCount     = atoi(videodatabase.GetSingleValue("tvshow_view"     , "count(1)").c_str());
-  int movieTotals     = atoi(videodatabase.GetSingleValue("movie_view"      , "count(1)").c_str());
-  int movieWatched    = atoi(videodatabase.GetSingleValue("movie_view"      , "count(playCount)").c_str());
-  int MusVidTotals    = atoi(videodatabase.GetSingleValue("musicvideo_view" , "count(1)").c_str());
-  int MusVidWatched   = atoi(videodatabase.GetSingleValue("musicvideo_view" , "count(playCount)").c_str());
-  int EpWatched       = atoi(videodatabase.GetSingleValue("tvshow_view"     , "sum(watchedcount)").c_str());
-  int EpCount         = atoi(videodatabase.GetSingleValue("tvshow_view"     , "sum(totalcount)").c_str());
-  int TvShowsWatched  = atoi(videodatabase.GetSingleValue("tvshow_view"     , "sum(watchedcount = totalcount)").c_str());
+  videodatabase.GetLibraryStats(videoStats);
   videodatabase.Close();
+  int tvShowCount     = videoStats[MediaTypeTvShow].total;
+  int movieTotals     = videoStats[MediaTypeMovie].total;
+  int movieWatched    = videoStats[MediaTypeMovie].watched;
+  int MusVidTotals    = videoStats[MediaTypeMusicVideo].total;
+  int MusVidWatched   = videoStats[MediaTypeMusicVideo].watched;
+  int EpWatched       = videoStats[MediaTypeEpisode].watched;
+  int EpCount         = videoStats[MediaTypeEpisode].total;
+  int TvShowsWatched  = videoStats[MediaTypeTvShow].watched;
 
   home->SetProperty("TVShows.Count"         , tvShowCount);
   home->SetProperty("TVShows.Watched"       , TvShowsWatched);
@@ -31,290 +31,417 @@
 #include "video/VideoFileItemClassify.h"
 
 #include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
 
 using namespace KODI;
 using namespace KODI::VIDEO;
 using namespace std::chrono_literals;
 
-void CSaveFileState::DoWork(CFileItem& item,
-                            CBookmark& bookmark,
-                            bool updatePlayCount)
+namespace
 {
-  std::string progressTrackingFile = item.GetPath();
-  if (CUtil::UseDynPathForAddOrUpdate(item))
+struct PendingState
+{
+  CSaveFileState::FileState& state;
+  std::string progressTrackingFile;
+};
+
+CVariant GetAnnouncementData(const CFileItem& item)
+{
+  CVariant data;
+  if (item.HasVideoInfoTag())
   {
-    progressTrackingFile = item.GetDynPath();
+    data["id"] = item.GetVideoInfoTag()->m_iDbId;
+    data["type"] = item.GetVideoInfoTag()->m_type;
   }
-  else if (item.HasVideoInfoTag() && IsVideoDb(item))
+  else if (item.HasMusicInfoTag())
   {
-    progressTrackingFile =
-        item.GetVideoInfoTag()
-            ->m_strFileNameAndPath; // we need the file url of the video db item to create the bookmark
+    data["id"] = item.GetMusicInfoTag()->GetDatabaseId();
+    data["type"] = item.GetMusicInfoTag()->GetType();
   }
-  else if (item.HasProperty("original_listitem_url"))
+  return data;
+}
+
+#ifdef HAS_UPNP
+void SendUPnPUpdate(const CFileItem& item,
+                    const CBookmark& bookmark,
+                    const std::string& progressTrackingFile)
+{
+  if (auto* gui = CServiceBroker::GetGUI())
   {
-    // only use original_listitem_url for Python, UPnP and Bluray sources
-    std::string original = item.GetProperty("original_listitem_url").asString();
-    if (URIUtils::IsPlugin(original) || URIUtils::IsUPnP(original) ||
-        URIUtils::IsBlurayPath(item.GetPath()))
-      progressTrackingFile = original;
+    CFileItem updatedItem(item);
+    if (updatedItem.HasVideoInfoTag())
+      updatedItem.GetVideoInfoTag()->SetResumePoint(bookmark);
+    if (updatedItem.HasProperty("original_listitem_url"))
+      updatedItem.SetPath(updatedItem.GetProperty("original_listitem_url").asString());
+    else
+      updatedItem.SetPath(
+          progressTrackingFile); // fallback to progressTrackingFile which should be the upnp path
+
+    CGUIMessage message(GUI_MSG_NOTIFY_ALL, 0, 0, GUI_MSG_UPDATE_ITEM, 0,
+                        std::make_shared<CFileItem>(updatedItem));
+    gui->GetWindowManager().SendThreadMessage(message);
   }
+}
+#endif
+
+// runs a write of a state in a savepoint, so a write failing half way is undone without losing the
+// other states of the batch, like its own transaction did before states were written in batches
+bool WriteInSavepoint(CDatabase& database, const std::function<bool()>& write)
+{
+  if (!database.SetSavepoint("filestate"))
+    return false;
+
+  if (write())
+    return database.ReleaseSavepoint("filestate");
+
+  database.RollbackToSavepoint("filestate");
+  return false;
+}
+
+// writes the state of a video file, without a transaction of its own; returns whether the listing
+// needs to be updated
+bool SaveVideoState(CVideoDatabase& videodatabase,
+                    PendingState& pending,
+                    std::vector<CVariant>& announcements)
+{
+  CFileItem& item = *pending.state.item;
+  const CBookmark& bookmark = pending.state.bookmark;
+  const unsigned int playCountIncrements = pending.state.playCountIncrements;
+  const std::string& progressTrackingFile = pending.progressTrackingFile;
+
+  const std::string redactPath = CURL::GetRedacted(progressTrackingFile);
+  CLog::Log(LOGDEBUG, "{} - Saving file state for video item {}", __FUNCTION__, redactPath);
 
-  if (!progressTrackingFile.empty())
+  if (URIUtils::IsPlugin(progressTrackingFile) &&
+      !(item.HasVideoInfoTag() && item.GetVideoInfoTag()->m_iDbId >= 0))
   {
-#ifdef HAS_UPNP
-    // checks if UPnP server of this file is available and supports updating
-    if (URIUtils::IsUPnP(progressTrackingFile)
-        && UPNP::CUPnP::SaveFileState(item, bookmark, updatePlayCount))
+    // FileItem from plugin can lack information, make sure all needed fields are set
+    CVideoInfoTag* tag = item.GetVideoInfoTag();
+    CStreamDetails streams = tag->m_streamDetails;
+    if (videodatabase.LoadVideoInfo(progressTrackingFile, *tag))
     {
-      if (auto* gui = CServiceBroker::GetGUI())
-      {
-        CFileItem updatedItem(item);
-        if (updatedItem.HasVideoInfoTag())
-          updatedItem.GetVideoInfoTag()->SetResumePoint(bookmark);
-        if (updatedItem.HasProperty("original_listitem_url"))
-          updatedItem.SetPath(updatedItem.GetProperty("original_listitem_url").asString());
-        else
-          updatedItem.SetPath(
-              progressTrackingFile); // fallback to progressTrackingFile which should be the upnp path
-
-        CGUIMessage message(GUI_MSG_NOTIFY_ALL, 0, 0, GUI_MSG_UPDATE_ITEM, 0,
-                            std::make_shared<CFileItem>(updatedItem));
-        gui->GetWindowManager().SendThreadMessage(message);
-      }
-      return;
+      item.SetPath(progressTrackingFile);
+      item.ClearProperty("original_listitem_url");
+      tag->m_streamDetails = streams;
     }
-#endif
-    if (IsVideo(item))
-    {
-      std::string redactPath = CURL::GetRedacted(progressTrackingFile);
-      CLog::Log(LOGDEBUG, "{} - Saving file state for video item {}", __FUNCTION__, redactPath);
+  }
 
-      CVideoDatabase videodatabase;
-      if (!videodatabase.Open())
-      {
-        CLog::Log(LOGWARNING, "{} - Unable to open video database. Can not save file state!",
-                  __FUNCTION__);
-      }
-      else
+  bool updateListing = false;
+  // No resume & watched status for livetv
+  if (!item.IsLiveTV())
+  {
+    if (playCountIncrements > 0)
+    {
+      // no watched for not yet finished pvr recordings
+      if (!item.IsInProgressPVRRecording())
       {
-        if (URIUtils::IsPlugin(progressTrackingFile) && !(item.HasVideoInfoTag() && item.GetVideoInfoTag()->m_iDbId >= 0))
+        CLog::Log(LOGDEBUG, "{} - Marking video item {} as watched", __FUNCTION__, redactPath);
+
+        // consider this item as played, as often as it has been played to the end since its
+        // state has been written last
+        CDateTime newLastPlayed;
+        WriteInSavepoint(videodatabase,
+                         [&]
+                         {
+                           newLastPlayed = videodatabase.SetPlayCount(
+                               item, videodatabase.GetPlayCount(item) +
+                                         static_cast<int>(playCountIncrements));
+                           return newLastPlayed.IsValid();
+                         });
+
+        item.SetOverlayImage(CGUIListItem::ICON_OVERLAY_WATCHED);
+        updateListing = true;
+
+        if (item.HasVideoInfoTag())
         {
-          // FileItem from plugin can lack information, make sure all needed fields are set
-          CVideoInfoTag *tag = item.GetVideoInfoTag();
-          CStreamDetails streams = tag->m_streamDetails;
-          if (videodatabase.LoadVideoInfo(progressTrackingFile, *tag))
+          for (unsigned int i = 0; i < playCountIncrements; ++i)
           {
-            item.SetPath(progressTrackingFile);
-            item.ClearProperty("original_listitem_url");
-            tag->m_streamDetails = streams;
+            if (item.GetVideoInfoTag()->IncrementPlayCount())
+              item.SetProperty("playcount_incremented", CVariant{true});
           }
-        }
 
-        bool updateListing = false;
-        // No resume & watched status for livetv
-        if (!item.IsLiveTV())
-        {
-          if (updatePlayCount)
-          {
-            // no watched for not yet finished pvr recordings
-            if (!item.IsInProgressPVRRecording())
-            {
-              CLog::Log(LOGDEBUG, "{} - Marking video item {} as watched", __FUNCTION__,
-                        redactPath);
-
-              // consider this item as played
-              videodatabase.BeginTransaction();
-              const CDateTime newLastPlayed = videodatabase.IncrementPlayCount(item);
-              if (newLastPlayed.IsValid())
-                videodatabase.CommitTransaction();
-              else
-                videodatabase.RollbackTransaction();
-
-              item.SetOverlayImage(CGUIListItem::ICON_OVERLAY_WATCHED);
-              updateListing = true;
-
-              if (item.HasVideoInfoTag())
-              {
-                if (item.GetVideoInfoTag()->IncrementPlayCount())
-                  item.SetProperty("playcount_incremented", CVariant{true});
-
-                if (newLastPlayed.IsValid())
-                  item.GetVideoInfoTag()->m_lastPlayed = newLastPlayed;
-
-                CVariant data;
-                data["id"] = item.GetVideoInfoTag()->m_iDbId;
-                data["type"] = item.GetVideoInfoTag()->m_type;
-                CServiceBroker::GetAnnouncementManager()->Announce(ANNOUNCEMENT::VideoLibrary,
-                                                                   "OnUpdate", data);
-              }
-            }
-          }
-          else
-          {
-            videodatabase.BeginTransaction();
-            const CDateTime newLastPlayed = videodatabase.UpdateLastPlayed(item);
-            if (newLastPlayed.IsValid())
-              videodatabase.CommitTransaction();
-            else
-              videodatabase.RollbackTransaction();
-
-            if (item.HasVideoInfoTag() && newLastPlayed.IsValid())
-              item.GetVideoInfoTag()->m_lastPlayed = newLastPlayed;
-          }
+          if (newLastPlayed.IsValid())
+            item.GetVideoInfoTag()->m_lastPlayed = newLastPlayed;
+
+          announcements.emplace_back(GetAnnouncementData(item));
+        }
+      }
+    }
+    else
+    {
+      CDateTime newLastPlayed;
+      WriteInSavepoint(videodatabase,
+                       [&]
+                       {
+                         newLastPlayed = videodatabase.UpdateLastPlayed(item);
+                         return newLastPlayed.IsValid();
+                       });
+      if (item.HasVideoInfoTag() && newLastPlayed.IsValid())
+        item.GetVideoInfoTag()->m_lastPlayed = newLastPlayed;
+    }
 
-          if (!item.HasVideoInfoTag() ||
-              item.GetVideoInfoTag()->GetResumePoint().timeInSeconds != bookmark.timeInSeconds)
+    if (!item.HasVideoInfoTag() ||
+        item.GetVideoInfoTag()->GetResumePoint().timeInSeconds != bookmark.timeInSeconds)
+    {
+      const bool success = WriteInSavepoint(
+          videodatabase,
+          [&]
           {
-            videodatabase.BeginTransaction();
-            bool success{true};
             if (bookmark.timeInSeconds <= 0.0)
-              success = videodatabase.ClearBookMarksOfFile(progressTrackingFile, CBookmark::RESUME);
-            else
-              success = videodatabase.AddBookMarkToFile(progressTrackingFile, bookmark,
-                                                        CBookmark::RESUME);
-            if (success)
-              videodatabase.CommitTransaction();
-            else
-              videodatabase.RollbackTransaction();
-
-            if (item.HasVideoInfoTag() && success)
-              item.GetVideoInfoTag()->SetResumePoint(bookmark);
-
-            // UPnP announce resume point changes to clients
-            // however not if playcount is modified as that already announces
-            if (item.HasVideoInfoTag() && !updatePlayCount)
-            {
-              CVariant data;
-              data["id"] = item.GetVideoInfoTag()->m_iDbId;
-              data["type"] = item.GetVideoInfoTag()->m_type;
-              CServiceBroker::GetAnnouncementManager()->Announce(ANNOUNCEMENT::VideoLibrary,
-                                                                 "OnUpdate", data);
-            }
-
-            updateListing = true;
-          }
-        }
+              return videodatabase.ClearBookMarksOfFile(progressTrackingFile, CBookmark::RESUME);
+            return videodatabase.AddBookMarkToFile(progressTrackingFile, bookmark,
+                                                   CBookmark::RESUME);
+          });
 
-        if (item.HasVideoInfoTag() && item.GetVideoInfoTag()->HasStreamDetails() &&
-            !item.IsLiveTV())
-        {
-          CFileItem dbItem(item);
+      if (item.HasVideoInfoTag() && success)
+        item.GetVideoInfoTag()->SetResumePoint(bookmark);
 
-          // Check whether the item's db streamdetails need updating
-          if (!videodatabase.GetStreamDetails(dbItem) ||
-              dbItem.GetVideoInfoTag()->m_streamDetails != item.GetVideoInfoTag()->m_streamDetails)
-          {
-            videodatabase.BeginTransaction();
-
-            if (videodatabase.SetStreamDetailsForFile(item.GetVideoInfoTag()->m_streamDetails,
-                                                      progressTrackingFile))
-            {
-              videodatabase.CommitTransaction();
-              updateListing = true;
-            }
-            else
-            {
-              videodatabase.RollbackTransaction();
-            }
-          }
-        }
+      // UPnP announce resume point changes to clients
+      // however not if playcount is modified as that already announces
+      if (item.HasVideoInfoTag() && playCountIncrements == 0)
+        announcements.emplace_back(GetAnnouncementData(item));
 
-        // See if idFile of library item needs updating
-        const CVideoInfoTag* tag{item.HasVideoInfoTag() ? item.GetVideoInfoTag() : nullptr};
-
-        const bool updateNeeded{
-            [&item, &tag]
-            {
-              if (!tag || tag->m_iFileId < 0)
-                return false; // No tag or file to update
-              if (tag->m_iDbId < 0 && item.GetVideoContentType() != VideoDbContentType::UNKNOWN)
-                return false; // No video db item to update
-              if (URIUtils::IsBlurayPath(item.GetDynPath()) &&
-                  !URIUtils::IsStack(tag->m_strFileNameAndPath) &&
-                  tag->m_strFileNameAndPath != item.GetDynPath())
-                return true; // Bluray path to update
-              if (item.GetProperty("new_stack_path").asBoolean(false))
-                return true; // Stack path to update
-              return false;
-            }()};
-
-        if (updateNeeded)
-        {
-          videodatabase.BeginTransaction();
-          // tag->m_iFileId contains the idFile originally played and may be different to the idFile
-          // in the movie table entry if it's a non-default video version
-          const int newFileId{videodatabase.SetFileForMedia(
-              progressTrackingFile, item.GetVideoContentType(), tag->m_iDbId,
-              CVideoDatabase::FileRecord{.m_idFile = tag->m_iFileId,
-                                         .m_playCount = tag->GetPlayCount(),
-                                         .m_lastPlayed = tag->m_lastPlayed,
-                                         .m_dateAdded = tag->m_dateAdded})};
-          if (newFileId > 0)
-          {
-            videodatabase.CommitTransaction();
-            item.GetVideoInfoTag()->m_iFileId = newFileId;
-          }
-          else
-            videodatabase.RollbackTransaction();
-        }
+      updateListing = true;
+    }
+  }
 
-        if (updateListing)
-        {
-          CUtil::DeleteVideoDatabaseDirectoryCache();
-          CFileItemPtr msgItem(new CFileItem(item));
-          if (item.HasProperty("original_listitem_url"))
-            msgItem->SetPath(item.GetProperty("original_listitem_url").asString());
+  if (item.HasVideoInfoTag() && item.GetVideoInfoTag()->HasStreamDetails() && !item.IsLiveTV())
+  {
+    CFileItem dbItem(item);
+
+    // Check whether the item's db streamdetails need updating
+    if ((!videodatabase.GetStreamDetails(dbItem) ||
+         dbItem.GetVideoInfoTag()->m_streamDetails != item.GetVideoInfoTag()->m_streamDetails) &&
+        WriteInSavepoint(videodatabase,
+                         [&]
+                         {
+                           return videodatabase.SetStreamDetailsForFile(
+                               item.GetVideoInfoTag()->m_streamDetails, progressTrackingFile);
+                         }))
+      updateListing = true;
+  }
 
-          CGUIMessage message(GUI_MSG_NOTIFY_ALL, CServiceBroker::GetGUI()->GetWindowManager().GetActiveWindow(), 0, GUI_MSG_UPDATE_ITEM, 0, msgItem);
-          CServiceBroker::GetGUI()->GetWindowManager().SendThreadMessage(message);
-        }
+  // See if idFile of library item needs updating
+  const CVideoInfoTag* tag{item.HasVideoInfoTag() ? item.GetVideoInfoTag() : nullptr};
+
+  const bool updateNeeded{[&item, &tag]
+                          {
+                            if (!tag || tag->m_iFileId < 0)
+                              return false; // No tag or file to update
+                            if (tag->m_iDbId < 0 &&
+                                item.GetVideoContentType() != VideoDbContentType::UNKNOWN)
+                              return false; // No video db item to update
+                            if (URIUtils::IsBlurayPath(item.GetDynPath()) &&
+                                !URIUtils::IsStack(tag->m_strFileNameAndPath) &&
+                                tag->m_strFileNameAndPath != item.GetDynPath())
+                              return true; // Bluray path to update
+                            if (item.GetProperty("new_stack_path").asBoolean(false))
+                              return true; // Stack path to update
+                            return false;
+                          }()};
+
+  if (updateNeeded)
+  {
+    // tag->m_iFileId contains the idFile originally played and may be different to the idFile
+    // in the movie table entry if it's a non-default video version
+    int newFileId{-1};
+    WriteInSavepoint(videodatabase,
+                     [&]
+                     {
+                       newFileId = videodatabase.SetFileForMedia(
+                           progressTrackingFile, item.GetVideoContentType(), tag->m_iDbId,
+                           CVideoDatabase::FileRecord{.m_idFile = tag->m_iFileId,
+                                                      .m_playCount = tag->GetPlayCount(),
+                                                      .m_lastPlayed = tag->m_lastPlayed,
+                                                      .m_dateAdded = tag->m_dateAdded});
+                       return newFileId > 0;
+                     });
+    if (newFileId > 0)
+      item.GetVideoInfoTag()->m_iFileId = newFileId;
+  }
+
+  return updateListing;
+}
+
+void SaveVideoStates(std::vector<PendingState>& states)
+{
+  CVideoDatabase videodatabase;
+  if (!videodatabase.Open())
+  {
+    CLog::Log(LOGWARNING, "{} - Unable to open video database. Can not save file state!",
+              __FUNCTION__);
+    return;
+  }
 
-        videodatabase.Close();
+  std::vector<CVariant> announcements;
+  std::vector<CFileItemPtr> updatedItems;
+
+  videodatabase.BeginTransaction();
+  for (auto& pending : states)
+  {
+    // a state that can't be written is given up on its own, the others are still saved
+    videodatabase.SetSavepoint("state");
+    try
+    {
+      if (SaveVideoState(videodatabase, pending, announcements))
+        updatedItems.emplace_back(pending.state.item);
+      videodatabase.ReleaseSavepoint("state");
+    }
+    catch (...)
+    {
+      CLog::Log(LOGERROR, "{} - Unable to save file state for video item {}", __FUNCTION__,
+                CURL::GetRedacted(pending.progressTrackingFile));
+      videodatabase.RollbackToSavepoint("state");
+    }
+  }
+  if (!videodatabase.CommitTransaction())
+  {
+    CLog::Log(LOGERROR, "{} - Unable to save the state of {} video items", __FUNCTION__,
+              states.size());
+    videodatabase.Close();
+    return;
+  }
+  videodatabase.Close();
+
+  for (const auto& data : announcements)
+    CServiceBroker::GetAnnouncementManager()->Announce(ANNOUNCEMENT::VideoLibrary, "OnUpdate",
+                                                       data);
+
+  if (!updatedItems.empty())
+  {
+    CUtil::DeleteVideoDatabaseDirectoryCache();
+    if (auto* gui = CServiceBroker::GetGUI())
+    {
+      for (const auto& item : updatedItems)
+      {
+        auto msgItem = std::make_shared<CFileItem>(*item);
+        if (item->HasProperty("original_listitem_url"))
+          msgItem->SetPath(item->GetProperty("original_listitem_url").asString());
+
+        CGUIMessage message(GUI_MSG_NOTIFY_ALL, gui->GetWindowManager().GetActiveWindow(), 0,
+                            GUI_MSG_UPDATE_ITEM, 0, msgItem);
+        gui->GetWindowManager().SendThreadMessage(message);
       }
     }
+  }
+}
 
-    if (MUSIC::IsAudio(item))
+void SaveAudioStates(std::vector<PendingState>& states)
+{
+  CMusicDatabase musicdatabase;
+  if (!musicdatabase.Open())
+  {
+    CLog::Log(LOGWARNING, "{} - Unable to open music database. Can not save file state!",
+              __FUNCTION__);
+    return;
+  }
+
+  std::vector<CVariant> announcements;
+
+  musicdatabase.BeginTransaction();
+  for (const auto& pending : states)
+  {
+    const CFileItem& item = *pending.state.item;
+    const std::string redactPath = CURL::GetRedacted(pending.progressTrackingFile);
+    CLog::Log(LOGDEBUG, "{} - Saving file state for audio item {}", __FUNCTION__, redactPath);
+
+    if (pending.state.playCountIncrements > 0)
     {
-      std::string redactPath = CURL::GetRedacted(progressTrackingFile);
-      CLog::Log(LOGDEBUG, "{} - Saving file state for audio item {}", __FUNCTION__, redactPath);
+      // consider this item as played
+      CLog::Log(LOGDEBUG, "{} - Marking audio item {} as listened", __FUNCTION__, redactPath);
 
-      CMusicDatabase musicdatabase;
-      if (updatePlayCount)
-      {
-        if (!musicdatabase.Open())
-        {
-          CLog::Log(LOGWARNING, "{} - Unable to open music database. Can not save file state!",
-                    __FUNCTION__);
-        }
-        else
-        {
-          // consider this item as played
-          CLog::Log(LOGDEBUG, "{} - Marking audio item {} as listened", __FUNCTION__, redactPath);
+      for (unsigned int i = 0; i < pending.state.playCountIncrements; ++i)
+        musicdatabase.IncrementPlayCount(item);
 
-          musicdatabase.IncrementPlayCount(item);
-          musicdatabase.Close();
+      // UPnP announce resume point changes to clients
+      // however not if playcount is modified as that already announces
+      if (MUSIC::IsMusicDb(item))
+        announcements.emplace_back(GetAnnouncementData(item));
+    }
 
-          // UPnP announce resume point changes to clients
-          // however not if playcount is modified as that already announces
-          if (MUSIC::IsMusicDb(item))
-          {
-            CVariant data;
-            data["id"] = item.GetMusicInfoTag()->GetDatabaseId();
-            data["type"] = item.GetMusicInfoTag()->GetType();
-            CServiceBroker::GetAnnouncementManager()->Announce(ANNOUNCEMENT::AudioLibrary,
-                                                               "OnUpdate", data);
-          }
-        }
-      }
+    if (MUSIC::IsAudioBook(item))
+      musicdatabase.SetResumeBookmarkForAudioBook(
+          item, item.GetStartOffset() +
+                    CUtil::ConvertSecsToMilliSecs(pending.state.bookmark.timeInSeconds));
+  }
+  if (!musicdatabase.CommitTransaction())
+  {
+    CLog::Log(LOGERROR, "{} - Unable to save the state of {} audio items", __FUNCTION__,
+              states.size());
+    musicdatabase.Close();
+    return;
+  }
+  musicdatabase.Close();
 
-      if (MUSIC::IsAudioBook(item))
-      {
-        musicdatabase.Open();
-        musicdatabase.SetResumeBookmarkForAudioBook(
-            item, item.GetStartOffset() + CUtil::ConvertSecsToMilliSecs(bookmark.timeInSeconds));
-        musicdatabase.Close();
-      }
+  for (const auto& data : announcements)
+    CServiceBroker::GetAnnouncementManager()->Announce(ANNOUNCEMENT::AudioLibrary, "OnUpdate",
+                                                       data);
+}
+} // unnamed namespace
+
+std::string CSaveFileState::GetProgressTrackingFile(const CFileItem& item)
+{
+  std::string progressTrackingFile = item.GetPath();
+  if (CUtil::UseDynPathForAddOrUpdate(item))
+  {
+    progressTrackingFile = item.GetDynPath();
+  }
+  else if (item.HasVideoInfoTag() && IsVideoDb(item))
+  {
+    progressTrackingFile =
+        item.GetVideoInfoTag()
+            ->m_strFileNameAndPath; // we need the file url of the video db item to create the bookmark
+  }
+  else if (item.HasProperty("original_listitem_url"))
+  {
+    // only use original_listitem_url for Python, UPnP and Bluray sources
+    std::string original = item.GetProperty("original_listitem_url").asString();
+    if (URIUtils::IsPlugin(original) || URIUtils::IsUPnP(original) ||
+        URIUtils::IsBlurayPath(item.GetPath()))
+      progressTrackingFile = original;
+  }
+  return progressTrackingFile;
+}
+
+void CSaveFileState::DoWork(std::vector<FileState>& states)
+{
+  std::vector<PendingState> videoStates;
+  std::vector<PendingState> audioStates;
+
+  for (auto& state : states)
+  {
+    const CFileItem& item = *state.item;
+    std::string progressTrackingFile = GetProgressTrackingFile(item);
+    if (progressTrackingFile.empty())
+      continue;
+
+#ifdef HAS_UPNP
+    // checks if UPnP server of this file is available and supports updating
+    if (URIUtils::IsUPnP(progressTrackingFile) &&
+        UPNP::CUPnP::SaveFileState(item, state.bookmark, state.playCountIncrements > 0))
+    {
+      SendUPnPUpdate(item, state.bookmark, progressTrackingFile);
+      continue;
     }
+#endif
+
+    if (IsVideo(item))
+      videoStates.emplace_back(PendingState{state, progressTrackingFile});
+    if (MUSIC::IsAudio(item))
+      audioStates.emplace_back(PendingState{state, std::move(progressTrackingFile)});
+  }
+
+  if (!videoStates.empty())
+    SaveVideoStates(videoStates);
+  if (!audioStates.empty())
+    SaveAudioStates(audioStates);
+
+  for (const auto& state : states)
+  {
+    if (state.onSaved)
+      state.onSaved(*state.item);
   }
 }
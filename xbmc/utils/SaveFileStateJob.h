@@ -8,14 +8,37 @@
 
 #pragma once
 
-class CBookmark;
+#include "video/Bookmark.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
 class CFileItem;
 
 class CSaveFileState
 {
 public:
-  static void DoWork(CFileItem& item,
-                     CBookmark& bookmark,
-                     bool updatePlayCount);
-};
+  struct FileState
+  {
+    std::shared_ptr<CFileItem> item;
+    CBookmark bookmark;
+    unsigned int playCountIncrements{0};
+    //! called once the state has been written, with the item updated to it
+    std::function<void(const CFileItem& item)> onSaved;
+  };
 
+  /*!
+   \brief Write the states of files to the databases
+   \details The states of all video files are written in one transaction, the ones of all audio
+   files in another. The items are updated to the written state, and the library is notified of
+   the changes once the transactions have been committed.
+   */
+  static void DoWork(std::vector<FileState>& states);
+
+  /*!
+   \brief Get the path the state of an item is stored for
+   */
+  static std::string GetProgressTrackingFile(const CFileItem& item);
+};
@@ -0,0 +1,158 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "SaveFileStateQueue.h"
+
+#include "FileItem.h"
+#include "URL.h"
+#include "utils/log.h"
+#include "video/Bookmark.h"
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+CSaveFileStateQueue::CSaveFileStateQueue()
+  : CSaveFileStateQueue([](std::vector<CSaveFileState::FileState>& states)
+                        { CSaveFileState::DoWork(states); })
+{
+}
+
+CSaveFileStateQueue::CSaveFileStateQueue(PersistFunction persist)
+  : CThread("SaveFileState"), m_persist(std::move(persist))
+{
+}
+
+CSaveFileStateQueue::~CSaveFileStateQueue()
+{
+  Stop();
+}
+
+void CSaveFileStateQueue::Add(const CFileItem& item,
+                              const CBookmark& bookmark,
+                              bool updatePlayCount,
+                              std::function<void(const CFileItem& item)> onSaved /* = {} */)
+{
+  {
+    std::unique_lock lock(m_critSection);
+
+    const std::string file = CSaveFileState::GetProgressTrackingFile(item);
+    auto it = m_pending.find(file);
+    if (it == m_pending.end())
+    {
+      it = m_pending.try_emplace(file).first;
+    }
+    else
+    {
+      CLog::LogF(LOGDEBUG, "Merging the state of {} with the one not written yet",
+                 CURL::GetRedacted(file));
+    }
+
+    // the latest state replaces the one not written yet, except for the times the file has been
+    // played to the end in between
+    CSaveFileState::FileState& state = it->second;
+    state.item = std::make_shared<CFileItem>(item);
+    state.bookmark = bookmark;
+    if (updatePlayCount)
+      state.playCountIncrements++;
+    if (onSaved && state.onSaved)
+    {
+      state.onSaved = [first = std::move(state.onSaved),
+                       second = std::move(onSaved)](const CFileItem& savedItem)
+      {
+        first(savedItem);
+        second(savedItem);
+      };
+    }
+    else if (onSaved)
+    {
+      state.onSaved = std::move(onSaved);
+    }
+
+    if (!m_stopped)
+    {
+      if (!IsRunning())
+        Create();
+      m_pendingEvent.Set();
+      return;
+    }
+  }
+
+  Flush();
+}
+
+void CSaveFileStateQueue::Flush()
+{
+  std::unique_lock writeLock(m_writeSection);
+  WritePending();
+}
+
+void CSaveFileStateQueue::Flush(const CFileItem& item)
+{
+  {
+    std::unique_lock lock(m_critSection);
+    const std::string file = CSaveFileState::GetProgressTrackingFile(item);
+    if (!m_pending.contains(file) && !m_writing.contains(file))
+      return;
+  }
+
+  // waits for the batch being written as well
+  Flush();
+}
+
+void CSaveFileStateQueue::Stop()
+{
+  {
+    std::unique_lock lock(m_critSection);
+    m_stopped = true;
+  }
+  StopThread();
+  Flush();
+}
+
+size_t CSaveFileStateQueue::GetPendingCount() const
+{
+  std::unique_lock lock(m_critSection);
+  return m_pending.size();
+}
+
+void CSaveFileStateQueue::Process()
+{
+  while (!m_bStop)
+  {
+    if (AbortableWait(m_pendingEvent) != WAIT_SIGNALED)
+      break;
+
+    std::unique_lock writeLock(m_writeSection);
+    WritePending();
+  }
+}
+
+void CSaveFileStateQueue::WritePending()
+{
+  std::vector<CSaveFileState::FileState> states;
+  {
+    std::unique_lock lock(m_critSection);
+    states.reserve(m_pending.size());
+    for (auto& [file, state] : m_pending)
+    {
+      m_writing.emplace(file);
+      states.emplace_back(std::move(state));
+    }
+    m_pending.clear();
+  }
+
+  if (states.empty())
+    return;
+
+  CLog::LogF(LOGDEBUG, "Writing the state of {} files", states.size());
+  m_persist(states);
+
+  std::unique_lock lock(m_critSection);
+  m_writing.clear();
+}
@@ -0,0 +1,101 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "application/IApplicationComponent.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
+#include "threads/Thread.h"
+#include "utils/SaveFileStateJob.h"
+
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+class CBookmark;
+class CFileItem;
+
+/*!
+ \brief Writes the playback state of files to the databases in the background
+
+ The resume point, play count, last played date and stream details of a file are written once its
+ playback has stopped. On shared MySQL databases the player waited for each of them to be written.
+ The states are queued instead and written by a thread of the queue. States of a file queued
+ while an earlier batch is being written are merged into one, and each batch is written in a
+ single transaction per database.
+
+ Flush() writes the queued states right away. It is called before the databases become
+ unavailable, on shutdown and when the profile is logged off, and before the state of a file that
+ is still queued is read to play it again. The state of a stack is written right away, as the
+ file id it gets in the library is needed to play its next part.
+ */
+class CSaveFileStateQueue : public IApplicationComponent, private CThread
+{
+public:
+  using PersistFunction = std::function<void(std::vector<CSaveFileState::FileState>& states)>;
+
+  CSaveFileStateQueue();
+  /*!
+   \brief Create a queue writing the states with the given function instead of to the databases
+   */
+  explicit CSaveFileStateQueue(PersistFunction persist);
+  ~CSaveFileStateQueue() override;
+
+  /*!
+   \brief Queue the state of a file to be written
+   \param item the item which has been played
+   \param bookmark the resume point, 0 or less to clear it
+   \param updatePlayCount whether the item has been played to the end
+   \param onSaved called once the state has been written, with the item updated to it. When states
+   of a file are merged, the functions passed with each of them are called in the order they were
+   passed.
+   */
+  void Add(const CFileItem& item,
+           const CBookmark& bookmark,
+           bool updatePlayCount,
+           std::function<void(const CFileItem& item)> onSaved = {});
+
+  /*!
+   \brief Write the queued states and wait for them to be written
+   */
+  void Flush();
+
+  /*!
+   \brief Write the queued states if one of them is the state of the given item, and wait for it to
+   be written
+   \details Called before the resume point or play count of an item is read from the database
+   when it is played, as a file played again right after it has been stopped would be resumed from
+   the state before otherwise. Must not be called from a function passed to Add().
+   */
+  void Flush(const CFileItem& item);
+
+  /*!
+   \brief Write the queued states and stop the thread. States queued afterwards are written
+   right away.
+   */
+  void Stop();
+
+  size_t GetPendingCount() const;
+
+protected:
+  void Process() override;
+
+private:
+  void WritePending();
+
+  PersistFunction m_persist;
+  mutable CCriticalSection m_critSection;
+  CCriticalSection m_writeSection; //!< held while a batch is taken from the queue and written
+  CEvent m_pendingEvent;
+  std::map<std::string, CSaveFileState::FileState, std::less<>> m_pending;
+  std::set<std::string, std::less<>> m_writing; //!< files of the batch being written
+  bool m_stopped{false};
+};
@@ -18,7 +18,10 @@
 
 #include <algorithm>
 #include <array>
+#include <future>
 #include <limits>
+#include <numeric>
+#include <thread>
 
 std::string ArrayToString(SortAttribute attributes, const CVariant &variant, const std::string &separator = " / ")
 {
@@ -513,143 +516,142 @@ std::string ByBPM(SortAttribute attributes, const SortItem& values)
                              ByLabel(attributes, values));
 }
 
-bool preliminarySort(const SortItem& left,
-                     const SortItem& right,
-                     bool handleFolder,
-                     bool& result,
-                     std::wstring& labelLeft,
-                     std::wstring& labelRight)
+namespace
 {
-  // make sure both items have the necessary data to do the sorting
-  const auto itLeftSort = left.find(Field::SORT);
-  if (itLeftSort == left.end())
-  {
-    result = false;
-    return true;
-  }
-  const auto itRightSort = right.find(Field::SORT);
-  if (itRightSort == right.end())
-  {
-    result = true;
-    return true;
-  }
-
-  // look at special sorting behaviour
-  SortSpecial leftSortSpecial = SortSpecial::NONE;
-  SortSpecial rightSortSpecial = SortSpecial::NONE;
-  if (const auto itLeft = left.find(Field::SORT_SPECIAL);
-      itLeft != left.end() &&
-      itLeft->second.asInteger() <= static_cast<int64_t>(SortSpecial::BOTTOM))
-    leftSortSpecial = static_cast<SortSpecial>(itLeft->second.asInteger());
-  if (const auto itRight = right.find(Field::SORT_SPECIAL);
-      itRight != right.end() &&
-      itRight->second.asInteger() <= static_cast<int64_t>(SortSpecial::BOTTOM))
-    rightSortSpecial = static_cast<SortSpecial>(itRight->second.asInteger());
-
-  // one has a special sort
-  if (leftSortSpecial != rightSortSpecial)
-  {
-    // left should be sorted on top
-    // or right should be sorted on bottom
-    // => left is sorted above right
-    if (leftSortSpecial == SortSpecial::TOP || rightSortSpecial == SortSpecial::BOTTOM)
-    {
-      result = true;
-      return true;
-    }
-
-    // otherwise right is sorted above left
-    result = false;
-    return true;
-  }
-  // both have either sort on top or sort on bottom -> leave as-is
-  else if (leftSortSpecial != SortSpecial::NONE)
-  {
-    result = false;
-    return true;
-  }
+// lists shorter than this are sorted on the calling thread only
+constexpr size_t PARALLEL_SORT_MIN_ITEMS = 10000;
+constexpr unsigned int PARALLEL_SORT_MAX_THREADS = 4;
 
-  if (handleFolder)
+SortKey GetSortKey(const SortUtils::SortPreparator& preparator,
+                   const Fields& sortingFields,
+                   SortAttribute attributes,
+                   SortItem& item)
+{
+  // add all fields to the item that are required for sorting if they are currently missing
+  for (const auto& field : sortingFields)
   {
-    const auto itLeft = left.find(Field::FOLDER);
-    const auto itRight = right.find(Field::FOLDER);
-    if (itLeft != left.end() && itRight != right.end() &&
-        itLeft->second.asBoolean() != itRight->second.asBoolean())
-    {
-      result = itLeft->second.asBoolean();
-      return true;
-    }
+    if (!item.contains(field))
+      item.emplace(field, CVariant::ConstNullVariant);
   }
 
-  labelLeft = itLeftSort->second.asWideString();
-  labelRight = itRightSort->second.asWideString();
+  SortKey key;
+  g_charsetConverter.utf8ToW(preparator(attributes, item), key.label, false);
 
-  return false;
-}
+  // store the string used for sorting under FieldSort unless the item already has one
+  if (const auto [it, inserted] = item.emplace(Field::SORT, CVariant(key.label)); !inserted)
+    key.label = it->second.asWideString();
+  key.collationKey = StringUtils::AlphaNumericKey(key.label);
 
-bool SorterAscending(const SortItem &left, const SortItem &right)
-{
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, true, result, labelLeft, labelRight))
-    return result;
+  if (const auto it = item.find(Field::SORT_SPECIAL);
+      it != item.end() && it->second.asInteger() <= static_cast<int64_t>(SortSpecial::BOTTOM))
+    key.special = static_cast<SortSpecial>(it->second.asInteger());
+  if (const auto it = item.find(Field::FOLDER); it != item.end())
+    key.folder = it->second.asBoolean();
 
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) < 0;
+  return key;
 }
 
-bool SorterDescending(const SortItem &left, const SortItem &right)
+bool SortKeyLess(const SortKey& left,
+                 const SortKey& right,
+                 bool handleFolder,
+                 bool descending,
+                 bool useLocaleCollation)
 {
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, true, result, labelLeft, labelRight))
-    return result;
+  // one has a special sort: left is sorted above right if it should be sorted on top or right
+  // should be sorted on bottom
+  if (left.special != right.special)
+    return left.special == SortSpecial::TOP || right.special == SortSpecial::BOTTOM;
+  // both have either sort on top or sort on bottom -> leave as-is
+  if (left.special != SortSpecial::NONE)
+    return false;
 
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) > 0;
+  if (handleFolder && left.folder && right.folder && *left.folder != *right.folder)
+    return *left.folder;
+
+  // the locale collation can't be precomputed
+  const int64_t result = useLocaleCollation
+                             ? StringUtils::AlphaNumericCompare(left.label, right.label)
+                             : StringUtils::AlphaNumericCompare(left.collationKey,
+                                                                right.collationKey);
+  return descending ? result > 0 : result < 0;
 }
 
-bool SorterIgnoreFoldersAscending(const SortItem &left, const SortItem &right)
+template<typename Compare>
+void StableSort(std::vector<size_t>& order, const Compare& less)
 {
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, false, result, labelLeft, labelRight))
-    return result;
+  const unsigned int threads =
+      std::min(std::thread::hardware_concurrency(), PARALLEL_SORT_MAX_THREADS);
+  if (order.size() < PARALLEL_SORT_MIN_ITEMS || threads < 2)
+  {
+    std::stable_sort(order.begin(), order.end(), less);
+    return;
+  }
 
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) < 0;
-}
+  // sort one chunk per thread, then merge neighbouring chunks which keeps the order of equal
+  // items and therefore gives the same result as sorting all at once
+  std::vector<size_t> bounds;
+  const size_t chunkSize = (order.size() + threads - 1) / threads;
+  for (size_t pos = 0; pos < order.size(); pos += chunkSize)
+    bounds.push_back(pos);
+  bounds.push_back(order.size());
 
-bool SorterIgnoreFoldersDescending(const SortItem &left, const SortItem &right)
-{
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, false, result, labelLeft, labelRight))
-    return result;
+  const auto sortChunk = [&order, &bounds, &less](size_t chunk)
+  {
+    std::stable_sort(order.begin() + bounds[chunk], order.begin() + bounds[chunk + 1], less);
+  };
 
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) > 0;
-}
+  std::vector<std::future<void>> tasks;
+  for (size_t chunk = 1; chunk + 1 < bounds.size(); chunk++)
+    tasks.emplace_back(std::async(std::launch::async, sortChunk, chunk));
+  sortChunk(0);
+  for (auto& task : tasks)
+    task.get();
 
-bool SorterIndirectAscending(const std::shared_ptr<SortItem>& left,
-                             const std::shared_ptr<SortItem>& right)
-{
-  return SorterAscending(*left, *right);
+  while (bounds.size() > 2)
+  {
+    std::vector<size_t> merged;
+    for (size_t chunk = 0; chunk + 2 < bounds.size(); chunk += 2)
+    {
+      std::inplace_merge(order.begin() + bounds[chunk], order.begin() + bounds[chunk + 1],
+                         order.begin() + bounds[chunk + 2], less);
+      merged.push_back(bounds[chunk]);
+    }
+    // an odd chunk at the end is merged in the next round
+    if (bounds.size() % 2 == 0)
+      merged.push_back(bounds[bounds.size() - 2]);
+    merged.push_back(order.size());
+    bounds = std::move(merged);
+  }
 }
 
-bool SorterIndirectDescending(const std::shared_ptr<SortItem>& left,
-                              const std::shared_ptr<SortItem>& right)
+template<typename Items>
+void ApplyLimits(Items& items, int limitEnd, int limitStart)
 {
-  return SorterDescending(*left, *right);
+  if (limitStart > 0 && static_cast<size_t>(limitStart) < items.size())
+  {
+    items.erase(items.begin(), items.begin() + limitStart);
+    limitEnd -= limitStart;
+  }
+  if (limitEnd > 0 && static_cast<size_t>(limitEnd) < items.size())
+    items.erase(items.begin() + limitEnd, items.end());
 }
 
-bool SorterIndirectIgnoreFoldersAscending(const std::shared_ptr<SortItem>& left,
-                                          const std::shared_ptr<SortItem>& right)
+template<typename Items>
+void SortItemsByKeys(SortBy sortBy, SortOrder sortOrder, SortAttribute attributes, Items& items)
 {
-  return SorterIgnoreFoldersAscending(*left, *right);
-}
+  const SortKeys keys = SortUtils::GetSortKeys(sortBy, attributes, items);
+  if (keys.empty())
+    return;
 
-bool SorterIndirectIgnoreFoldersDescending(const std::shared_ptr<SortItem>& left,
-                                           const std::shared_ptr<SortItem>& right)
-{
-  return SorterIgnoreFoldersDescending(*left, *right);
+  const std::vector<size_t> order = SortUtils::GetSortOrder(sortOrder, attributes, keys);
+
+  Items sortedItems;
+  sortedItems.reserve(items.size());
+  for (const size_t index : order)
+    sortedItems.emplace_back(std::move(items[index]));
+  items = std::move(sortedItems);
 }
+} // unnamed namespace
 
 // clang-format off
 std::map<SortBy, SortUtils::SortPreparator> fillPreparators()
@@ -975,80 +977,14 @@ void SortUtils::GetFieldsForSQLSort(const MediaType& mediaType,
 
 void SortUtils::Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attributes, DatabaseResults& items, int limitEnd /* = -1 */, int limitStart /* = 0 */)
 {
-  if (sortBy != SortBy::NONE)
-  {
-    // get the matching SortPreparator
-    SortPreparator preparator = getPreparator(sortBy);
-    if (preparator)
-    {
-      Fields sortingFields = GetFieldsForSorting(sortBy);
-
-      // Prepare the string used for sorting and store it under FieldSort
-      for (auto& item : items)
-      {
-        // add all fields to the item that are required for sorting if they are currently missing
-        for (const auto& field : sortingFields)
-        {
-          if (!item.contains(field))
-            item.emplace(field, CVariant::ConstNullVariant);
-        }
-
-        std::wstring sortLabel;
-        g_charsetConverter.utf8ToW(preparator(attributes, item), sortLabel, false);
-        item.emplace(Field::SORT, CVariant(sortLabel));
-      }
-
-      // Do the sorting
-      std::stable_sort(items.begin(), items.end(), getSorter(sortOrder, attributes));
-    }
-  }
-
-  if (limitStart > 0 && static_cast<size_t>(limitStart) < items.size())
-  {
-    items.erase(items.begin(), items.begin() + limitStart);
-    limitEnd -= limitStart;
-  }
-  if (limitEnd > 0 && static_cast<size_t>(limitEnd) < items.size())
-    items.erase(items.begin() + limitEnd, items.end());
+  SortItemsByKeys(sortBy, sortOrder, attributes, items);
+  ApplyLimits(items, limitEnd, limitStart);
 }
 
 void SortUtils::Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attributes, SortItems& items, int limitEnd /* = -1 */, int limitStart /* = 0 */)
 {
-  if (sortBy != SortBy::NONE)
-  {
-    // get the matching SortPreparator
-    SortPreparator preparator = getPreparator(sortBy);
-    if (preparator)
-    {
-      Fields sortingFields = GetFieldsForSorting(sortBy);
-
-      // Prepare the string used for sorting and store it under FieldSort
-      for (auto& item : items)
-      {
-        // add all fields to the item that are required for sorting if they are currently missing
-        for (const auto& field : sortingFields)
-        {
-          if (!item->contains(field))
-            item->emplace(field, CVariant::ConstNullVariant);
-        }
-
-        std::wstring sortLabel;
-        g_charsetConverter.utf8ToW(preparator(attributes, *item), sortLabel, false);
-        item->emplace(Field::SORT, CVariant(sortLabel));
-      }
-
-      // Do the sorting
-      std::stable_sort(items.begin(), items.end(), getSorterIndirect(sortOrder, attributes));
-    }
-  }
-
-  if (limitStart > 0 && static_cast<size_t>(limitStart) < items.size())
-  {
-    items.erase(items.begin(), items.begin() + limitStart);
-    limitEnd -= limitStart;
-  }
-  if (limitEnd > 0 && static_cast<size_t>(limitEnd) < items.size())
-    items.erase(items.begin() + limitEnd, items.end());
+  SortItemsByKeys(sortBy, sortOrder, attributes, items);
+  ApplyLimits(items, limitEnd, limitStart);
 }
 
 void SortUtils::Sort(const SortDescription &sortDescription, DatabaseResults& items)
@@ -1087,28 +1023,59 @@ bool SortUtils::SortFromDataset(const SortDescription& sortDescription,
   return true;
 }
 
-const SortUtils::SortPreparator& SortUtils::getPreparator(SortBy sortBy)
+SortKeys SortUtils::GetSortKeys(SortBy sortBy, SortAttribute attributes, DatabaseResults& items)
 {
-  const auto it = m_preparators.find(sortBy);
-  return it == m_preparators.end() ? m_preparators[SortBy::NONE] : it->second;
+  SortKeys keys;
+  const SortPreparator& preparator = getPreparator(sortBy);
+  if (sortBy == SortBy::NONE || !preparator)
+    return keys;
+
+  const Fields& sortingFields = GetFieldsForSorting(sortBy);
+  keys.reserve(items.size());
+  for (auto& item : items)
+    keys.emplace_back(GetSortKey(preparator, sortingFields, attributes, item));
+
+  return keys;
 }
 
-SortUtils::Sorter SortUtils::getSorter(SortOrder sortOrder, SortAttribute attributes)
+SortKeys SortUtils::GetSortKeys(SortBy sortBy, SortAttribute attributes, SortItems& items)
 {
-  if (attributes & SortAttributeIgnoreFolders)
-    return sortOrder == SortOrder::DESCENDING ? SorterIgnoreFoldersDescending
-                                              : SorterIgnoreFoldersAscending;
+  SortKeys keys;
+  const SortPreparator& preparator = getPreparator(sortBy);
+  if (sortBy == SortBy::NONE || !preparator)
+    return keys;
+
+  const Fields& sortingFields = GetFieldsForSorting(sortBy);
+  keys.reserve(items.size());
+  for (auto& item : items)
+    keys.emplace_back(GetSortKey(preparator, sortingFields, attributes, *item));
 
-  return sortOrder == SortOrder::DESCENDING ? SorterDescending : SorterAscending;
+  return keys;
 }
 
-SortUtils::SorterIndirect SortUtils::getSorterIndirect(SortOrder sortOrder, SortAttribute attributes)
+std::vector<size_t> SortUtils::GetSortOrder(SortOrder sortOrder,
+                                            SortAttribute attributes,
+                                            const SortKeys& keys)
 {
-  if (attributes & SortAttributeIgnoreFolders)
-    return sortOrder == SortOrder::DESCENDING ? SorterIndirectIgnoreFoldersDescending
-                                              : SorterIndirectIgnoreFoldersAscending;
+  std::vector<size_t> order(keys.size());
+  std::iota(order.begin(), order.end(), 0);
+
+  const bool handleFolder = !(attributes & SortAttributeIgnoreFolders);
+  const bool descending = sortOrder == SortOrder::DESCENDING;
+  const bool useLocaleCollation = g_langInfo.UseLocaleCollation();
+  StableSort(order,
+             [&keys, handleFolder, descending, useLocaleCollation](size_t left, size_t right) {
+               return SortKeyLess(keys[left], keys[right], handleFolder, descending,
+                                  useLocaleCollation);
+             });
+
+  return order;
+}
 
-  return sortOrder == SortOrder::DESCENDING ? SorterIndirectDescending : SorterIndirectAscending;
+const SortUtils::SortPreparator& SortUtils::getPreparator(SortBy sortBy)
+{
+  const auto it = m_preparators.find(sortBy);
+  return it == m_preparators.end() ? m_preparators[SortBy::NONE] : it->second;
 }
 
 const Fields& SortUtils::GetFieldsForSorting(SortBy sortBy)
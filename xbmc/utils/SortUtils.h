@@ -14,6 +14,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -198,6 +199,21 @@ struct GUIViewSortDetails
 using SortItem = DatabaseResult;
 using SortItems = std::vector<std::shared_ptr<SortItem>>;
 
+/*!
+ \brief What an item is sorted by, computed once per item before sorting
+
+ Comparing two keys needs neither lookups in the items nor conversions of their sort labels, and
+ the keys can be reused as long as neither the items nor what they are sorted by change.
+ */
+struct SortKey
+{
+  std::wstring label;
+  std::vector<uint32_t> collationKey; //!< see StringUtils::AlphaNumericKey()
+  SortSpecial special = SortSpecial::NONE;
+  std::optional<bool> folder;
+};
+using SortKeys = std::vector<SortKey>;
+
 class SortUtils
 {
 public:
@@ -224,19 +240,31 @@ public:
                               dbiplus::Dataset& dataset,
                               DatabaseResults& results);
 
+  /*!
+   \brief Compute the sort keys of items
+   \details The items are completed with the fields sortBy needs and their sort labels are stored
+   under Field::SORT.
+   \return the keys in the order of the items or nothing if sortBy doesn't sort at all
+   */
+  static SortKeys GetSortKeys(SortBy sortBy, SortAttribute attributes, DatabaseResults& items);
+  static SortKeys GetSortKeys(SortBy sortBy, SortAttribute attributes, SortItems& items);
+
+  /*!
+   \brief Sort keys, keys comparing equal keep their order
+   \return the indices of the keys in sorted order
+   */
+  static std::vector<size_t> GetSortOrder(SortOrder sortOrder,
+                                          SortAttribute attributes,
+                                          const SortKeys& keys);
+
   static void GetFieldsForSQLSort(const MediaType& mediaType, SortBy sortMethod, FieldList& fields);
   static const Fields& GetFieldsForSorting(SortBy sortBy);
   static std::string RemoveArticles(const std::string &label);
 
   using SortPreparator = std::function<std::string(SortAttribute, const SortItem&)>;
-  using Sorter = std::function<bool(const SortItem&, const SortItem&)>;
-  using SorterIndirect =
-      std::function<bool(const std::shared_ptr<SortItem>&, const std::shared_ptr<SortItem>&)>;
 
 private:
   static const SortPreparator& getPreparator(SortBy sortBy);
-  static Sorter getSorter(SortOrder sortOrder, SortAttribute attributes);
-  static SorterIndirect getSorterIndirect(SortOrder sortOrder, SortAttribute attributes);
 
   static std::map<SortBy, SortPreparator> m_preparators;
   static std::map<SortBy, Fields> m_sortingFields;
@@ -1147,6 +1147,96 @@ int64_t StringUtils::AlphaNumericCompare(std::wstring_view left, std::wstring_vi
   return 0; // files are the same
 }
 
+namespace
+{
+// a number takes three units, the flag with its first digit followed by its value, other
+// characters one with symbols ordered before everything else
+constexpr uint32_t KEY_NUMBER = 0x80000000;
+constexpr uint32_t KEY_NO_SYMBOL = 0x40000000;
+
+uint32_t GetKeyCharacter(const std::vector<uint32_t>& key, size_t pos)
+{
+  // a number is compared to a character by its first digit
+  if (key[pos] & KEY_NUMBER)
+    return KEY_NO_SYMBOL | (key[pos] & ~KEY_NUMBER);
+  return key[pos];
+}
+} // unnamed namespace
+
+std::vector<uint32_t> StringUtils::AlphaNumericKey(std::wstring_view str)
+{
+  std::vector<uint32_t> key;
+  key.reserve(str.size());
+
+  auto c = str.cbegin();
+  while (c != str.cend())
+  {
+    if (*c >= L'0' && *c <= L'9')
+    {
+      // same chunks of up to 15 digits as in AlphaNumericCompare()
+      const auto first = c;
+      uint64_t num = *c++ - L'0';
+      while (c != str.cend() && *c >= L'0' && *c <= L'9' && std::distance(first, c) < 15)
+      {
+        num *= 10;
+        num += *c++ - L'0';
+      }
+      key.push_back(KEY_NUMBER | static_cast<uint32_t>(*first));
+      key.push_back(static_cast<uint32_t>(num >> 32));
+      key.push_back(static_cast<uint32_t>(num));
+      continue;
+    }
+
+    wchar_t wc = *c++;
+    const bool sym{(wc >= 32 && wc < L'0') || (wc > L'9' && wc < L'A') ||
+                   (wc > L'Z' && wc < L'a') || (wc > L'z' && wc < 128)};
+    if (sym)
+    {
+      key.push_back(static_cast<uint32_t>(wc));
+      continue;
+    }
+
+    if (wc > 128)
+      wc = GetCollationWeight(wc);
+    if (wc >= L'A' && wc <= L'Z')
+      wc += L'a' - L'A';
+    key.push_back(KEY_NO_SYMBOL | static_cast<uint32_t>(wc));
+  }
+
+  return key;
+}
+
+int StringUtils::AlphaNumericCompare(const std::vector<uint32_t>& left,
+                                     const std::vector<uint32_t>& right) noexcept
+{
+  // numbers are only skipped if both sides have one, so positions stay in sync
+  size_t pos = 0;
+  while (pos < left.size() && pos < right.size())
+  {
+    if ((left[pos] & KEY_NUMBER) && (right[pos] & KEY_NUMBER))
+    {
+      const uint64_t lnum = (static_cast<uint64_t>(left[pos + 1]) << 32) | left[pos + 2];
+      const uint64_t rnum = (static_cast<uint64_t>(right[pos + 1]) << 32) | right[pos + 2];
+      if (lnum != rnum)
+        return lnum < rnum ? -1 : 1;
+      pos += 3;
+      continue;
+    }
+
+    const uint32_t lc = GetKeyCharacter(left, pos);
+    const uint32_t rc = GetKeyCharacter(right, pos);
+    if (lc != rc)
+      return lc < rc ? -1 : 1;
+    pos++;
+  }
+
+  if (pos < right.size())
+    return -1;
+  if (pos < left.size())
+    return 1;
+  return 0;
+}
+
 /*
   Convert the UTF8 character to which z points into a 31-bit Unicode point.
   Return how many bytes (0 to 3) of UTF8 data encode the character.
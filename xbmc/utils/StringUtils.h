@@ -278,6 +278,15 @@ public:
   [[nodiscard]] static int FindNumber(std::string_view strInput, std::string_view strFind) noexcept;
   [[nodiscard]] static int64_t AlphaNumericCompare(std::wstring_view left,
                                                    std::wstring_view right) noexcept;
+  /*!
+   * \brief Get a key of a string which compares like the string does in AlphaNumericCompare()
+   *
+   * The digits, case folding and collation weights of the string are evaluated once instead of on
+   * every comparison. The keys only match AlphaNumericCompare() if the locale collation isn't used.
+   */
+  [[nodiscard]] static std::vector<uint32_t> AlphaNumericKey(std::wstring_view str);
+  [[nodiscard]] static int AlphaNumericCompare(const std::vector<uint32_t>& left,
+                                               const std::vector<uint32_t>& right) noexcept;
   [[nodiscard]] static int AlphaNumericCollation(int nKey1,
                                                  const void* pKey1,
                                                  int nKey2,
@@ -176,10 +176,10 @@ CVariant::CVariant(VariantType type)
       m_data = std::wstring{};
       break;
     case VariantTypeArray:
-      m_data = VariantArray{};
+      m_data = NewArray();
       break;
     case VariantTypeObject:
-      m_data = VariantMap{};
+      m_data = NewMap();
       break;
   }
 }
@@ -285,16 +285,18 @@ CVariant::CVariant(std::map<std::string, std::string>&& strMap)
 }
 
 CVariant::CVariant(const std::map<std::string, CVariant>& variantMap)
-  : m_data(std::in_place_type<VariantMap>, variantMap)
+  : m_data(std::in_place_type<VariantMap>, variantMap.begin(), variantMap.end())
 {
 }
 
 CVariant::CVariant(std::map<std::string, CVariant>&& variantMap)
-  : m_data(std::in_place_type<VariantMap>, std::move(variantMap))
+  : m_data(std::in_place_type<VariantMap>,
+           std::make_move_iterator(variantMap.begin()),
+           std::make_move_iterator(variantMap.end()))
 {
 }
 
-CVariant::CVariant(const CVariant& variant) : m_data(variant.m_data)
+CVariant::CVariant(const CVariant& variant) : CVariant(std::allocator_arg, allocator_type(), variant)
 {
 }
 
@@ -302,6 +304,37 @@ CVariant::CVariant(CVariant&& rhs) noexcept : m_data(std::move(rhs.m_data))
 {
 }
 
+CVariant::CVariant(std::allocator_arg_t, const allocator_type& alloc)
+  : m_data(Null{alloc.resource()})
+{
+}
+
+CVariant::CVariant(std::allocator_arg_t, const allocator_type& alloc, const CVariant& variant)
+{
+  std::visit(overloaded{[&](const Null&) { m_data = Null{alloc.resource()}; },
+                        [&](const VariantArray& a) { m_data.emplace<VariantArray>(a, alloc); },
+                        [&](const VariantMap& m) { m_data.emplace<VariantMap>(m, alloc); },
+                        [&](const auto& value) { m_data = value; }},
+             variant.m_data);
+}
+
+CVariant::CVariant(std::allocator_arg_t, const allocator_type& alloc, CVariant&& variant)
+{
+  if (variant.get_allocator() == alloc)
+  {
+    m_data = std::move(variant.m_data);
+    return;
+  }
+
+  // the containers move their elements one by one into the new resource
+  std::visit(
+      overloaded{[&](Null&) { m_data = Null{alloc.resource()}; },
+                 [&](VariantArray& a) { m_data.emplace<VariantArray>(std::move(a), alloc); },
+                 [&](VariantMap& m) { m_data.emplace<VariantMap>(std::move(m), alloc); },
+                 [&](auto& value) { m_data = std::move(value); }},
+      variant.m_data);
+}
+
 CVariant::~CVariant()
 {
   cleanup();
@@ -312,6 +345,26 @@ void CVariant::cleanup()
   m_data = Null{};
 }
 
+CVariant::allocator_type CVariant::get_allocator() const
+{
+  return std::visit(
+      overloaded{[](const Null& n) { return allocator_type(n.resource); },
+                 [](const VariantArray& a) { return allocator_type(a.get_allocator()); },
+                 [](const VariantMap& m) { return allocator_type(m.get_allocator()); },
+                 [](const auto&) { return allocator_type(); }},
+      m_data);
+}
+
+CVariant::VariantArray CVariant::NewArray() const
+{
+  return VariantArray(get_allocator());
+}
+
+CVariant::VariantMap CVariant::NewMap() const
+{
+  return VariantMap(get_allocator());
+}
+
 bool CVariant::isInteger() const
 {
   return isSignedInteger() || isUnsignedInteger();
@@ -468,7 +521,7 @@ CVariant& CVariant::operator[](const std::string& key) &
 {
   if (type() == VariantTypeNull)
   {
-    m_data = VariantMap{};
+    m_data = NewMap();
   }
 
   return std::visit(overloaded{[&](VariantMap& m) -> CVariant& { return m[key]; },
@@ -529,17 +582,24 @@ CVariant &CVariant::operator=(const CVariant &rhs)
   if (type() == VariantTypeConstNull || this == &rhs)
     return *this;
 
-  cleanup();
-  m_data = rhs.m_data;
+  // copy first, rhs may be part of this variant
+  CVariant copy(std::allocator_arg, get_allocator(), rhs);
+  m_data = std::move(copy.m_data);
   return *this;
 }
 
-CVariant& CVariant::operator=(CVariant&& rhs) noexcept
+CVariant& CVariant::operator=(CVariant&& rhs)
 {
   if (type() == VariantTypeConstNull || this == &rhs)
     return *this;
 
-  m_data = std::move(rhs.m_data);
+  if (get_allocator() == rhs.get_allocator())
+    m_data = std::move(rhs.m_data);
+  else
+  {
+    CVariant moved(std::allocator_arg, get_allocator(), std::move(rhs));
+    m_data = std::move(moved.m_data);
+  }
   return *this;
 }
 
@@ -552,7 +612,7 @@ void CVariant::reserve(size_t length)
 {
   if (type() == VariantTypeNull)
   {
-    m_data = VariantArray{};
+    m_data = NewArray();
   }
   if (type() == VariantTypeArray)
     std::get<VariantArray>(m_data).reserve(length);
@@ -562,7 +622,7 @@ void CVariant::push_back(const CVariant &variant)
 {
   if (type() == VariantTypeNull)
   {
-    m_data = VariantArray{};
+    m_data = NewArray();
   }
 
   if (type() == VariantTypeArray)
@@ -573,7 +633,7 @@ void CVariant::push_back(CVariant &&variant)
 {
   if (type() == VariantTypeNull)
   {
-    m_data = VariantArray{};
+    m_data = NewArray();
   }
 
   if (type() == VariantTypeArray)
@@ -597,12 +657,20 @@ const char *CVariant::c_str() const
                     m_data);
 }
 
-void CVariant::swap(CVariant& rhs) noexcept
+void CVariant::swap(CVariant& rhs)
 {
   if (type() == VariantTypeConstNull)
     rhs = VariantTypeConstNull;
-  else
+  else if (get_allocator() == rhs.get_allocator())
     std::swap(m_data, rhs.m_data);
+  else
+  {
+    // containers can't be swapped between resources, both keep theirs and take over the values
+    CVariant lhsMoved(std::allocator_arg, rhs.get_allocator(), std::move(*this));
+    CVariant rhsMoved(std::allocator_arg, get_allocator(), std::move(rhs));
+    m_data = std::move(rhsMoved.m_data);
+    rhs.m_data = std::move(lhsMoved.m_data);
+  }
 }
 
 CVariant::iterator_array CVariant::begin_array()
@@ -692,14 +760,14 @@ void CVariant::clear()
 
 void CVariant::erase(const std::string &key)
 {
-  std::visit(overloaded{[&](Null&) { m_data = VariantMap{}; }, [&](VariantMap& m) { m.erase(key); },
+  std::visit(overloaded{[&](Null&) { m_data = NewMap(); }, [&](VariantMap& m) { m.erase(key); },
                         [](const auto&) {}},
              m_data);
 }
 
 void CVariant::erase(unsigned int position)
 {
-  std::visit(overloaded{[&](Null&) { m_data = VariantArray{}; },
+  std::visit(overloaded{[&](Null&) { m_data = NewArray(); },
                         [=](VariantArray& a) { a.erase(a.begin() + position); }, [](auto&) {}},
              m_data);
 }
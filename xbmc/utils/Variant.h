@@ -9,9 +9,13 @@
 #pragma once
 
 #include <map>
+#include <memory>
+#include <memory_resource>
 #include <stdint.h>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 #include <variant>
 #include <vector>
 #include <wchar.h>
@@ -46,6 +50,20 @@ public:
     VariantTypeObject
   };
 
+  /*!
+   \brief Allocator of the arrays and objects held by a variant
+
+   All arrays and objects nested in a variant are allocated from the memory resource of the
+   variant, e.g. from a std::pmr::monotonic_buffer_resource arena when building a large JSON-RPC
+   response. The resource is kept by the containers themselves and, until it holds a value, by a
+   null variant created with an allocator, so it takes no space of its own. Variants moved into a
+   variant using a different resource are copied, swapping variants using different resources
+   copies both. Copies use the default resource, so copying detaches a variant from its arena.
+   Like the standard containers, a move constructed variant keeps the resource of its source and
+   must not outlive the arena either.
+   */
+  using allocator_type = std::pmr::polymorphic_allocator<CVariant>;
+
   CVariant();
   CVariant(VariantType type);
   CVariant(int integer);
@@ -71,8 +89,22 @@ public:
   CVariant(std::map<std::string, CVariant>&& variantMap);
   CVariant(const CVariant &variant);
   CVariant(CVariant&& rhs) noexcept;
+
+  // allocator-extended constructors, see allocator_type
+  CVariant(std::allocator_arg_t, const allocator_type& alloc);
+  CVariant(std::allocator_arg_t, const allocator_type& alloc, const CVariant& variant);
+  CVariant(std::allocator_arg_t, const allocator_type& alloc, CVariant&& variant);
+  template<typename T>
+    requires(!std::is_same_v<std::remove_cvref_t<T>, CVariant>)
+  CVariant(std::allocator_arg_t, const allocator_type& alloc, T&& value)
+    : CVariant(std::allocator_arg, alloc, CVariant(std::forward<T>(value)))
+  {
+  }
+
   ~CVariant();
 
+  allocator_type get_allocator() const;
+
 
 
   bool isInteger() const;
@@ -108,7 +140,7 @@ public:
   CVariant operator[](unsigned int position) &&;
 
   CVariant &operator=(const CVariant &rhs);
-  CVariant& operator=(CVariant&& rhs) noexcept;
+  CVariant& operator=(CVariant&& rhs);
   bool operator==(const CVariant &rhs) const;
   bool operator!=(const CVariant &rhs) const { return !(*this == rhs); }
 
@@ -120,11 +152,15 @@ public:
 
   const char *c_str() const;
 
-  void swap(CVariant& rhs) noexcept;
+  void swap(CVariant& rhs);
 
 private:
-  typedef std::vector<CVariant> VariantArray;
-  typedef std::map<std::string, CVariant> VariantMap;
+  typedef std::vector<CVariant, std::pmr::polymorphic_allocator<CVariant>> VariantArray;
+  typedef std::map<std::string,
+                   CVariant,
+                   std::less<std::string>,
+                   std::pmr::polymorphic_allocator<std::pair<const std::string, CVariant>>>
+      VariantMap;
 
 public:
   typedef VariantArray::iterator        iterator_array;
@@ -155,10 +191,17 @@ public:
 
 private:
   void cleanup();
+  VariantArray NewArray() const;
+  VariantMap NewMap() const;
 
   struct Null
   {
+    Null() : resource(std::pmr::get_default_resource()) {}
+    explicit Null(std::pmr::memory_resource* r) : resource(r) {}
     bool operator==(const Null&) const { return true; }
+
+    // what a variant created with an allocator allocates its containers from
+    std::pmr::memory_resource* resource;
   };
   struct ConstNull
   {
@@ -9,6 +9,7 @@
 #include "dbwrappers/qry_dat.h"
 #include "music/MusicDatabase.h"
 #include "utils/DatabaseUtils.h"
+#include "utils/SortUtils.h"
 #include "utils/StringUtils.h"
 #include "utils/Variant.h"
 #include "video/VideoDatabase.h"
@@ -1245,6 +1246,59 @@ TEST(TestDatabaseUtils, BuildLimitClause)
   EXPECT_STREQ(" LIMIT 100", a.c_str());
 }
 
+TEST(TestDatabaseUtils, GetKeysetColumns)
+{
+  std::vector<std::string> columns;
+
+  EXPECT_TRUE(DatabaseUtils::GetKeysetColumns(MediaTypeMovie, SortBy::NONE, columns));
+  EXPECT_EQ(std::vector<std::string>{"movie_view.idMovie"}, columns);
+
+  EXPECT_TRUE(DatabaseUtils::GetKeysetColumns(MediaTypeSong, SortBy::DATE_ADDED, columns));
+  EXPECT_EQ((std::vector<std::string>{"songview.dateAdded", "songview.idSong"}), columns);
+
+  // sorting by title depends on the label
+  EXPECT_FALSE(DatabaseUtils::GetKeysetColumns(MediaTypeMovie, SortBy::TITLE, columns));
+  EXPECT_TRUE(columns.empty());
+  EXPECT_FALSE(DatabaseUtils::GetKeysetColumns(MediaTypeNone, SortBy::NONE, columns));
+}
+
+TEST(TestDatabaseUtils, BuildKeysetCondition)
+{
+  const std::vector<std::string> columns{"dateAdded", "idMovie"};
+
+  EXPECT_EQ("dateAdded DESC, idMovie DESC", DatabaseUtils::BuildKeysetOrder(columns, true));
+
+  EXPECT_EQ("(dateAdded > '2026-01-01' OR dateAdded = '2026-01-01' AND idMovie > 12)",
+            DatabaseUtils::BuildKeysetCondition(columns, {"'2026-01-01'", "12"}, false));
+  EXPECT_EQ("((dateAdded < '2026-01-01' OR dateAdded IS NULL) OR "
+            "dateAdded = '2026-01-01' AND (idMovie < 12 OR idMovie IS NULL))",
+            DatabaseUtils::BuildKeysetCondition(columns, {"'2026-01-01'", "12"}, true));
+
+  // NULL sorts before any value
+  EXPECT_EQ("(dateAdded IS NOT NULL OR dateAdded IS NULL AND idMovie > 12)",
+            DatabaseUtils::BuildKeysetCondition(columns, {"NULL", "12"}, false));
+  EXPECT_EQ("(dateAdded IS NULL AND (idMovie < 12 OR idMovie IS NULL))",
+            DatabaseUtils::BuildKeysetCondition(columns, {"NULL", "12"}, true));
+
+  EXPECT_EQ("", DatabaseUtils::BuildKeysetCondition(columns, {"12"}, false));
+}
+
+TEST(TestDatabaseUtils, BuildSearchMatch)
+{
+  EXPECT_EQ("{strTitle}: \"dark side\"",
+            DatabaseUtils::BuildSearchMatch("dark side", {"strTitle"}));
+  EXPECT_EQ("{c00 c16}: \"the \"\"best\"\"\"",
+            DatabaseUtils::BuildSearchMatch("the \"best\"", {"c00", "c16"}));
+  EXPECT_EQ("{name}: \"Öl\u00e9\"", DatabaseUtils::BuildSearchMatch("Öl\u00e9", {"name"}));
+
+  // too short for trigrams, also if the characters take more than three bytes
+  EXPECT_EQ("", DatabaseUtils::BuildSearchMatch("ab", {"strTitle"}));
+  EXPECT_EQ("", DatabaseUtils::BuildSearchMatch("Ö\u00e9", {"strTitle"}));
+  // wildcards
+  EXPECT_EQ("", DatabaseUtils::BuildSearchMatch("100%", {"strTitle"}));
+  EXPECT_EQ("", DatabaseUtils::BuildSearchMatch("dark side", {}));
+}
+
 // class DatabaseUtils
 // {
 // public:
@@ -0,0 +1,174 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/JSONStreamWriter.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/Variant.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+CVariant CreateResponse()
+{
+  CVariant response;
+  response["id"] = 1;
+  response["jsonrpc"] = "2.0";
+  response["result"]["limits"]["start"] = 0;
+  response["result"]["limits"]["end"] = 2;
+  response["result"]["songs"] = CVariant(CVariant::VariantTypeArray);
+  for (int i = 0; i < 2; i++)
+  {
+    CVariant song;
+    song["songid"] = i;
+    song["label"] = "song";
+    song["rating"] = 0.5;
+    song["genre"] = CVariant(CVariant::VariantTypeArray);
+    song["art"] = CVariant(CVariant::VariantTypeObject);
+    response["result"]["songs"].push_back(song);
+  }
+  return response;
+}
+
+// writes the response of CreateResponse() without having it as a whole
+void StreamResponse(CJSONStreamWriter& writer)
+{
+  const CVariant response = CreateResponse();
+
+  writer.BeginObject();
+  writer.Key("id");
+  writer.Value(response["id"]);
+  writer.Key("jsonrpc");
+  writer.Value(response["jsonrpc"]);
+  writer.Key("result");
+  writer.BeginObject();
+  writer.Key("limits");
+  writer.Value(response["result"]["limits"]);
+  writer.Key("songs");
+  writer.BeginArray();
+  for (auto it = response["result"]["songs"].begin_array();
+       it != response["result"]["songs"].end_array(); ++it)
+    writer.Value(*it);
+  writer.EndArray();
+  writer.EndObject();
+  writer.EndObject();
+}
+} // unnamed namespace
+
+TEST(TestJSONStreamWriter, MatchesVariantWriter)
+{
+  for (bool compact : {true, false})
+  {
+    std::string expected;
+    ASSERT_TRUE(CJSONVariantWriter::Write(CreateResponse(), expected, compact));
+
+    std::string str;
+    CJSONStreamWriter writer(
+        [&str](const char* data, size_t size)
+        {
+          str.append(data, size);
+          return true;
+        },
+        compact);
+    StreamResponse(writer);
+    EXPECT_EQ(0u, writer.GetDepth());
+    ASSERT_TRUE(writer.Flush());
+    EXPECT_EQ(expected, str);
+  }
+}
+
+TEST(TestJSONStreamWriter, Compact)
+{
+  std::string str;
+  ASSERT_TRUE(CJSONVariantWriter::Write(CreateResponse(), str, true));
+  EXPECT_EQ("{\"id\":1,\"jsonrpc\":\"2.0\",\"result\":{\"limits\":{\"end\":2,\"start\":0},"
+            "\"songs\":[{\"art\":{},\"genre\":[],\"label\":\"song\",\"rating\":0.5,\"songid\":0},"
+            "{\"art\":{},\"genre\":[],\"label\":\"song\",\"rating\":0.5,\"songid\":1}]}}",
+            str);
+}
+
+TEST(TestJSONStreamWriter, Chunks)
+{
+  std::string expected;
+  ASSERT_TRUE(CJSONVariantWriter::Write(CreateResponse(), expected, false));
+
+  std::vector<std::string> chunks;
+  CJSONStreamWriter writer(
+      [&chunks](const char* data, size_t size)
+      {
+        chunks.emplace_back(data, size);
+        return true;
+      },
+      false, 16);
+  StreamResponse(writer);
+  ASSERT_TRUE(writer.Flush());
+
+  // output is handed over as soon as a chunk is full, not all at once at the end
+  EXPECT_GT(chunks.size(), 5u);
+
+  std::string str;
+  for (const auto& chunk : chunks)
+    str += chunk;
+  EXPECT_EQ(expected, str);
+}
+
+TEST(TestJSONStreamWriter, SinkFailure)
+{
+  unsigned int calls = 0;
+  CJSONStreamWriter writer(
+      [&calls](const char* data, size_t size)
+      {
+        calls++;
+        return false;
+      },
+      true, 8);
+  StreamResponse(writer);
+
+  EXPECT_TRUE(writer.HasFailed());
+  EXPECT_FALSE(writer.Flush());
+  EXPECT_EQ(1u, calls);
+  EXPECT_EQ(0u, writer.GetDepth());
+}
+
+TEST(TestJSONStreamWriter, Strings)
+{
+  std::string str;
+
+  ASSERT_TRUE(CJSONVariantWriter::Write(CVariant("a\"b\\c/d\n\t\x01"), str, true));
+  EXPECT_EQ("\"a\\\"b\\\\c/d\\n\\t\\u0001\"", str);
+
+  // valid multibyte sequences are kept as they are
+  ASSERT_TRUE(CJSONVariantWriter::Write(CVariant("\xC3\xA4\xE2\x82\xAC\xF0\x9F\x8E\xB5"), str, true));
+  EXPECT_EQ("\"\xC3\xA4\xE2\x82\xAC\xF0\x9F\x8E\xB5\"", str);
+
+  // invalid ones, including truncated sequences and surrogates, are replaced
+  ASSERT_TRUE(CJSONVariantWriter::Write(CVariant("a\xFF" "b\xC3"), str, true));
+  EXPECT_EQ("\"a\xEF\xBF\xBD" "b\xEF\xBF\xBD\"", str);
+  ASSERT_TRUE(CJSONVariantWriter::Write(CVariant("\xED\xA0\x80"), str, true));
+  EXPECT_EQ("\"\xEF\xBF\xBD\xEF\xBF\xBD\xEF\xBF\xBD\"", str);
+}
+
+TEST(TestJSONStreamWriter, Raw)
+{
+  std::string str;
+  CJSONStreamWriter writer(
+      [&str](const char* data, size_t size)
+      {
+        str.append(data, size);
+        return true;
+      },
+      true);
+  writer.Raw("callback(");
+  writer.Value(CVariant(true));
+  writer.Raw(");");
+  ASSERT_TRUE(writer.Flush());
+  EXPECT_EQ("callback(true);", str);
+}
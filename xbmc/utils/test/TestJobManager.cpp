@@ -13,7 +13,11 @@
 #include "utils/XTimeUtils.h"
 
 #include <atomic>
+#include <chrono>
+#include <memory>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -211,3 +215,76 @@ TEST_F(TestJobManager, IsProcessing)
 
   job->FinishAndStopBlocking();
 }
+
+TEST_F(TestJobManager, HighPriorityLane)
+{
+  std::vector<std::unique_ptr<Flags>> flags;
+  const auto addJob = [&flags](CJob::PRIORITY priority)
+  {
+    flags.emplace_back(std::make_unique<Flags>());
+    CServiceBroker::GetJobManager()->AddJob(new DummyJob(flags.back().get()), nullptr, priority);
+    return flags.back().get();
+  };
+
+  // fill the worker budget of the lower priority lanes
+  for (int i = 0; i < 3; i++)
+  {
+    const Flags* f = addJob(CJob::PRIORITY_LOW);
+    ASSERT_TRUE(poll([f]() -> bool { return f->started; }));
+  }
+  const Flags* normal = addJob(CJob::PRIORITY_NORMAL);
+  ASSERT_TRUE(poll([normal]() -> bool { return normal->started; }));
+
+  // high priority jobs must not wait for any of them, up to the global cap
+  for (unsigned int i = 4; i < CJobManager::GetMaxConcurrentWorkers(); i++)
+  {
+    const Flags* f = addJob(CJob::PRIORITY_HIGH);
+    EXPECT_TRUE(poll([f]() -> bool { return f->started; }));
+  }
+
+  // while lower priority jobs and high priority jobs above the cap have to
+  const Flags* high = addJob(CJob::PRIORITY_HIGH);
+  const Flags* low = addJob(CJob::PRIORITY_LOW);
+  normal = addJob(CJob::PRIORITY_NORMAL);
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_FALSE(high->started);
+  EXPECT_FALSE(low->started);
+  EXPECT_FALSE(normal->started);
+
+  for (auto& f : flags)
+    f->lingerAtWork = false;
+  for (auto& f : flags)
+  {
+    const Flags* ptr = f.get();
+    EXPECT_TRUE(poll([ptr]() -> bool { return ptr->finished; }));
+  }
+}
+
+namespace
+{
+class StatisticsJob : public ReallyDumbJob
+{
+public:
+  using ReallyDumbJob::ReallyDumbJob;
+  const char* GetType() const override { return "StatisticsJob"; }
+};
+} // namespace
+
+TEST_F(TestJobManager, Statistics)
+{
+  Flags flags;
+  CServiceBroker::GetJobManager()->AddJob(new StatisticsJob(&flags), nullptr);
+  ASSERT_TRUE(poll([&flags]() -> bool { return flags.finished; }));
+
+  const auto hasCompleted = []
+  {
+    for (const auto& stats : CServiceBroker::GetJobManager()->GetStatistics())
+    {
+      if (stats.type == "StatisticsJob")
+        return stats.started == 1 && stats.completed == 1 && stats.queued == 0 &&
+               stats.processing == 0;
+    }
+    return false;
+  };
+  EXPECT_TRUE(poll(hasCompleted));
+}
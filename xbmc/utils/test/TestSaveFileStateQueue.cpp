@@ -0,0 +1,155 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "threads/Event.h"
+#include "utils/SaveFileStateQueue.h"
+#include "video/Bookmark.h"
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+struct WrittenState
+{
+  std::string path;
+  double resumeTime;
+  unsigned int playCountIncrements;
+};
+
+class TestSaveFileStateQueue : public ::testing::Test
+{
+protected:
+  TestSaveFileStateQueue()
+    : m_queue(
+          [this](std::vector<CSaveFileState::FileState>& states)
+          {
+            m_writing.Set();
+            m_continue.Wait();
+
+            std::vector<WrittenState> batch;
+            for (const auto& state : states)
+            {
+              batch.emplace_back(WrittenState{state.item->GetPath(), state.bookmark.timeInSeconds,
+                                              state.playCountIncrements});
+              if (state.onSaved)
+                state.onSaved(*state.item);
+            }
+
+            std::unique_lock lock(m_critSection);
+            m_batches.emplace_back(std::move(batch));
+          })
+  {
+  }
+
+  ~TestSaveFileStateQueue() override { m_continue.Set(); }
+
+  void Add(const std::string& path, double resumeTime, bool updatePlayCount)
+  {
+    CBookmark bookmark;
+    bookmark.timeInSeconds = resumeTime;
+    m_queue.Add(CFileItem(path, false), bookmark, updatePlayCount);
+  }
+
+  CEvent m_writing;
+  CEvent m_continue{true};
+  CCriticalSection m_critSection;
+  std::vector<std::vector<WrittenState>> m_batches;
+  CSaveFileStateQueue m_queue;
+};
+} // namespace
+
+TEST_F(TestSaveFileStateQueue, Coalesced)
+{
+  // the first state is taken by the thread, which waits before writing it
+  Add("/movies/a.mkv", 10.0, false);
+  ASSERT_TRUE(m_writing.Wait(5s));
+
+  Add("/movies/b.mkv", 20.0, true);
+  Add("/movies/c.mkv", 30.0, false);
+  Add("/movies/b.mkv", -1.0, true);
+  Add("/movies/b.mkv", 40.0, false);
+  EXPECT_EQ(2u, m_queue.GetPendingCount());
+
+  m_continue.Set();
+  m_queue.Flush();
+  EXPECT_EQ(0u, m_queue.GetPendingCount());
+
+  std::unique_lock lock(m_critSection);
+  ASSERT_EQ(2u, m_batches.size());
+  ASSERT_EQ(1u, m_batches[0].size());
+  EXPECT_EQ("/movies/a.mkv", m_batches[0][0].path);
+
+  const auto& batch = m_batches[1];
+  ASSERT_EQ(2u, batch.size());
+  EXPECT_EQ("/movies/b.mkv", batch[0].path);
+  EXPECT_EQ(40.0, batch[0].resumeTime);
+  EXPECT_EQ(2u, batch[0].playCountIncrements);
+  EXPECT_EQ("/movies/c.mkv", batch[1].path);
+  EXPECT_EQ(0u, batch[1].playCountIncrements);
+}
+
+TEST_F(TestSaveFileStateQueue, MergedCallbacks)
+{
+  Add("/movies/a.mkv", 10.0, false);
+  ASSERT_TRUE(m_writing.Wait(5s));
+
+  std::vector<int> saved;
+  m_queue.Add(CFileItem("/movies/b.mkv", false), CBookmark(), false,
+              [&saved](const CFileItem&) { saved.emplace_back(1); });
+  m_queue.Add(CFileItem("/movies/b.mkv", false), CBookmark(), true,
+              [&saved](const CFileItem&) { saved.emplace_back(2); });
+
+  m_continue.Set();
+  m_queue.Flush();
+  EXPECT_EQ((std::vector<int>{1, 2}), saved);
+}
+
+TEST_F(TestSaveFileStateQueue, FlushItem)
+{
+  Add("/movies/a.mkv", 10.0, false);
+  ASSERT_TRUE(m_writing.Wait(5s));
+  Add("/movies/b.mkv", 20.0, false);
+
+  // nothing to wait for
+  m_queue.Flush(CFileItem("/movies/c.mkv", false));
+  EXPECT_EQ(1u, m_queue.GetPendingCount());
+
+  // waits for the batch being written and writes the queued one
+  m_continue.Set();
+  m_queue.Flush(CFileItem("/movies/a.mkv", false));
+  EXPECT_EQ(0u, m_queue.GetPendingCount());
+
+  std::unique_lock lock(m_critSection);
+  ASSERT_EQ(2u, m_batches.size());
+  EXPECT_EQ("/movies/b.mkv", m_batches[1][0].path);
+}
+
+TEST_F(TestSaveFileStateQueue, Stop)
+{
+  m_continue.Set();
+  m_queue.Stop();
+
+  // written right away once stopped
+  int saved = 0;
+  m_queue.Add(CFileItem("/movies/a.mkv", false), CBookmark(), true,
+              [&saved](const CFileItem&) { saved++; });
+  EXPECT_EQ(1, saved);
+  EXPECT_EQ(0u, m_queue.GetPendingCount());
+
+  std::unique_lock lock(m_critSection);
+  ASSERT_EQ(1u, m_batches.size());
+  EXPECT_EQ(1u, m_batches[0][0].playCountIncrements);
+}
@@ -103,6 +103,59 @@ TEST(TestSortUtils, Sort_SortDescription)
   EXPECT_STREQ("R Artist", (*items.at(6))[Field::ARTIST].asString().c_str());
 }
 
+TEST(TestSortUtils, GetSortOrder)
+{
+  SortItems items;
+  for (const auto& [label, special] :
+       std::initializer_list<std::pair<const char*, SortSpecial>>{{"Track 10", SortSpecial::NONE},
+                                                                  {"..", SortSpecial::TOP},
+                                                                  {"Track 2", SortSpecial::NONE},
+                                                                  {"Add", SortSpecial::BOTTOM},
+                                                                  {"track 2", SortSpecial::NONE}})
+  {
+    auto item = std::make_shared<SortItem>();
+    (*item)[Field::LABEL] = label;
+    (*item)[Field::SORT_SPECIAL] = static_cast<int>(special);
+    items.push_back(item);
+  }
+
+  const SortKeys keys = SortUtils::GetSortKeys(SortBy::LABEL, SortAttributeNone, items);
+  ASSERT_EQ(items.size(), keys.size());
+  EXPECT_EQ(L"Track 10", keys[0].label);
+  EXPECT_EQ(L"Track 10", (*items[0])[Field::SORT].asWideString());
+
+  // items to be sorted on top or bottom stay there, equal labels keep their order
+  EXPECT_EQ((std::vector<size_t>{1, 2, 4, 0, 3}),
+            SortUtils::GetSortOrder(SortOrder::ASCENDING, SortAttributeNone, keys));
+  EXPECT_EQ((std::vector<size_t>{1, 0, 2, 4, 3}),
+            SortUtils::GetSortOrder(SortOrder::DESCENDING, SortAttributeNone, keys));
+}
+
+TEST(TestSortUtils, Sort_LongList)
+{
+  // long lists are sorted in parallel and have to end up in the same order
+  DatabaseResults items;
+  for (int i = 0; i < 25000; i++)
+  {
+    DatabaseResult item;
+    item[Field::ID] = i;
+    item[Field::TRACK_NUMBER] = (i * 7919) % 1000;
+    items.push_back(item);
+  }
+
+  SortUtils::Sort(SortBy::TRACK_NUMBER, SortOrder::ASCENDING, SortAttributeNone, items);
+
+  ASSERT_EQ(25000U, items.size());
+  for (size_t i = 1; i < items.size(); i++)
+  {
+    const int64_t previous = items[i - 1][Field::TRACK_NUMBER].asInteger();
+    const int64_t current = items[i][Field::TRACK_NUMBER].asInteger();
+    ASSERT_LE(previous, current);
+    if (previous == current)
+      ASSERT_LT(items[i - 1][Field::ID].asInteger(), items[i][Field::ID].asInteger());
+  }
+}
+
 TEST(TestSortUtils, GetFieldsForSorting)
 {
   Fields fields;
@@ -431,6 +431,28 @@ TEST(TestStringUtils, AlphaNumericCompare)
   EXPECT_EQ(StringUtils::AlphaNumericCompare(L"12345678901234567890", L"12345678901234567890"), 0);
 }
 
+TEST(TestStringUtils, AlphaNumericKey)
+{
+  const std::vector<std::wstring> strings = {
+      L"",        L"123abc", L"abc123", L"124abc", L"123bbc", L"abc124", L"bbc123",
+      L"2",       L"12",     L"012",    L"ABC123", L"abc 123", L"abc-123", L"\u00e9t\u00e9",
+      L"Ete",     L"ete2",   L"12345678901234567890", L"12345678901234567891", L"!abc",
+      L"\u4e2d", L"z",      L"a1b2c3", L"a01b2c3"};
+
+  // keys have to compare like the strings themselves
+  for (const auto& left : strings)
+  {
+    for (const auto& right : strings)
+    {
+      const int64_t expected = StringUtils::AlphaNumericCompare(left, right);
+      const int result = StringUtils::AlphaNumericCompare(StringUtils::AlphaNumericKey(left),
+                                                          StringUtils::AlphaNumericKey(right));
+      EXPECT_EQ(expected < 0, result < 0);
+      EXPECT_EQ(expected > 0, result > 0);
+    }
+  }
+}
+
 TEST(TestStringUtils, TimeStringToSeconds)
 {
   EXPECT_EQ(77455, StringUtils::TimeStringToSeconds("21:30:55"));
@@ -9,7 +9,10 @@
 #include "utils/Variant.h"
 
 #include <map>
+#include <memory>
+#include <memory_resource>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -415,3 +418,59 @@ TEST(TestVariant, ConstNullVariant_cant_be_changed)
   EXPECT_EQ(CVariant::VariantTypeConstNull, CVariant::ConstNullVariant.type());
   EXPECT_EQ(CVariant::VariantTypeConstNull, c3.type());
 }
+
+TEST(TestVariant, Allocator)
+{
+  const std::string title("a title which doesn't fit into the small string buffer");
+  std::pmr::monotonic_buffer_resource arena;
+  CVariant root(std::allocator_arg, &arena);
+  root["items"].push_back(CVariant(CVariant::VariantTypeObject));
+  root["items"][0u]["title"] = title;
+  root["items"][0u]["genre"].push_back("drama");
+
+  // nested containers are allocated from the arena
+  EXPECT_EQ(&arena, root["items"].get_allocator().resource());
+  EXPECT_EQ(&arena, root["items"][0u].get_allocator().resource());
+  EXPECT_EQ(&arena, root["items"][0u]["genre"].get_allocator().resource());
+
+  // copies detach from the arena
+  CVariant copy(root);
+  EXPECT_EQ(std::pmr::get_default_resource(), copy["items"][0u].get_allocator().resource());
+  EXPECT_EQ(root, copy);
+
+  // moving into a variant using another resource moves the elements over
+  CVariant moved;
+  moved = std::move(root["items"]);
+  EXPECT_EQ(std::pmr::get_default_resource(), moved[0u]["genre"].get_allocator().resource());
+  EXPECT_EQ(title, moved[0u]["title"].asString());
+  EXPECT_EQ("drama", moved[0u]["genre"][0u].asString());
+
+  // and moving within a resource keeps it
+  CVariant arenaMoved(std::allocator_arg, &arena);
+  arenaMoved = std::move(moved);
+  EXPECT_EQ(&arena, arenaMoved[0u].get_allocator().resource());
+  EXPECT_EQ(copy["items"], arenaMoved);
+
+  // as does move construction
+  CVariant moveConstructed(std::move(arenaMoved));
+  EXPECT_EQ(&arena, moveConstructed.get_allocator().resource());
+  EXPECT_EQ(&arena, moveConstructed[0u].get_allocator().resource());
+  EXPECT_EQ(copy["items"], moveConstructed);
+
+  // swapping between resources keeps the resource of either variant
+  CVariant swapped(copy["items"]);
+  swapped[0u]["title"] = "another title";
+  const CVariant swappedCopy(swapped);
+  swapped.swap(moveConstructed);
+  EXPECT_EQ(std::pmr::get_default_resource(), swapped[0u].get_allocator().resource());
+  EXPECT_EQ(&arena, moveConstructed[0u].get_allocator().resource());
+  EXPECT_EQ(copy["items"], swapped);
+  EXPECT_EQ(swappedCopy, moveConstructed);
+
+  // a null variant keeps its resource for the containers it becomes
+  CVariant null(std::allocator_arg, &arena);
+  EXPECT_EQ(&arena, null.get_allocator().resource());
+  EXPECT_EQ(std::pmr::get_default_resource(), CVariant(null).get_allocator().resource());
+  null.push_back(title);
+  EXPECT_EQ(&arena, null.get_allocator().resource());
+}
@@ -71,6 +71,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <optional>
 #include <ranges>
 #include <set>
 #include <string>
@@ -87,6 +88,34 @@ using namespace KODI::GUILIB;
 using namespace KODI::VIDEO;
 using namespace std::chrono_literals;
 
+namespace
+{
+std::string GetColumn(int field)
+{
+  return StringUtils::Format("c{:02}", field);
+}
+
+// columns of the full-text search indexes, see CVideoDatabase::CreateAnalytics()
+const std::vector<std::string> movieTitleColumns{GetColumn(VIDEODB_ID_TITLE),
+                                                 GetColumn(VIDEODB_ID_ORIGINALTITLE)};
+const std::vector<std::string> moviePlotColumns{GetColumn(VIDEODB_ID_PLOT),
+                                                GetColumn(VIDEODB_ID_PLOTOUTLINE),
+                                                GetColumn(VIDEODB_ID_TAGLINE)};
+const std::vector<std::string> tvshowTitleColumns{GetColumn(VIDEODB_ID_TV_TITLE)};
+const std::vector<std::string> episodeTitleColumns{GetColumn(VIDEODB_ID_EPISODE_TITLE)};
+const std::vector<std::string> episodePlotColumns{GetColumn(VIDEODB_ID_EPISODE_PLOT)};
+const std::vector<std::string> musicvideoTitleColumns{GetColumn(VIDEODB_ID_MUSICVIDEO_TITLE)};
+const std::vector<std::string> actorNameColumns{"name"};
+
+template<typename... Columns>
+std::vector<std::string> Concat(const Columns&... columns)
+{
+  std::vector<std::string> result;
+  (result.insert(result.end(), columns.begin(), columns.end()), ...);
+  return result;
+}
+} // namespace
+
 CVideoDatabase::FileInformation::FileInformation(std::string&& newPath,
                                                  int newFileId,
                                                  int newVvId,
@@ -118,12 +147,22 @@ void CVideoDatabase::CreateTables()
 void CVideoDatabase::CreateAnalytics()
 {
   KODI::DATABASE::CVideoDatabaseDDL::CreateAnalytics(*this);
+
+  // Full-text search indexes (SQLite only, searches fall back to LIKE scans without them)
+  CreateSearchIndex("moviesearch", "movie", "idMovie",
+                    Concat(movieTitleColumns, moviePlotColumns));
+  CreateSearchIndex("tvshowsearch", "tvshow", "idShow", tvshowTitleColumns);
+  CreateSearchIndex("episodesearch", "episode", "idEpisode",
+                    Concat(episodeTitleColumns, episodePlotColumns));
+  CreateSearchIndex("musicvideosearch", "musicvideo", "idMVideo", musicvideoTitleColumns);
+  CreateSearchIndex("actorsearch", "actor", "actor_id", actorNameColumns);
+
+  UpdateLibraryStats();
 }
 
 //********************************************************************************************************************************
 int CVideoDatabase::GetPathId(const std::string& strPath)
 {
-  std::string strSQL;
   try
   {
     int idPath=-1;
@@ -138,8 +177,7 @@ int CVideoDatabase::GetPathId(const std::string& strPath)
 
     URIUtils::AddSlashAtEnd(strPath1);
 
-    strSQL=PrepareSQL("select idPath from path where strPath='%s'",strPath1.c_str());
-    m_pDS->query(strSQL);
+    m_pDS->query("SELECT idPath FROM path WHERE strPath = ?", make_bind_list(strPath1));
     if (!m_pDS->eof())
       idPath = m_pDS->fv("path.idPath").get_asInt();
 
@@ -148,7 +186,7 @@ int CVideoDatabase::GetPathId(const std::string& strPath)
   }
   catch (...)
   {
-    CLog::LogF(LOGERROR, "unable to getpath ({})", strSQL);
+    CLog::LogF(LOGERROR, "unable to getpath ({})", strPath);
   }
   return -1;
 }
@@ -376,21 +414,12 @@ int CVideoDatabase::AddPath(const std::string& strPath, const std::string &paren
     int idParentPath = GetPathId(parentPath.empty() ? URIUtils::GetParentPath(strPath1) : parentPath);
 
     // add the path
-    if (idParentPath < 0)
-    {
-      if (dateAdded.IsValid())
-        strSQL=PrepareSQL("insert into path (idPath, strPath, dateAdded) values (NULL, '%s', '%s')", strPath1.c_str(), dateAdded.GetAsDBDateTime().c_str());
-      else
-        strSQL=PrepareSQL("insert into path (idPath, strPath) values (NULL, '%s')", strPath1.c_str());
-    }
-    else
-    {
-      if (dateAdded.IsValid())
-        strSQL = PrepareSQL("insert into path (idPath, strPath, dateAdded, idParentPath) values (NULL, '%s', '%s', %i)", strPath1.c_str(), dateAdded.GetAsDBDateTime().c_str(), idParentPath);
-      else
-        strSQL=PrepareSQL("insert into path (idPath, strPath, idParentPath) values (NULL, '%s', %i)", strPath1.c_str(), idParentPath);
-    }
-    m_pDS->exec(strSQL);
+    strSQL = "INSERT INTO path (idPath, strPath, dateAdded, idParentPath) VALUES (NULL, ?, ?, ?)";
+    m_pDS->exec(strSQL, make_bind_list(strPath1,
+                                       dateAdded.IsValid()
+                                           ? std::optional(dateAdded.GetAsDBDateTime())
+                                           : std::nullopt,
+                                       idParentPath < 0 ? std::nullopt : std::optional(idParentPath)));
     idPath = static_cast<int>(m_pDS->lastinsertid());
     return idPath;
   }
@@ -544,16 +573,15 @@ int CVideoDatabase::AddOrUpdateFile(const std::string& fileAndPath,
     if (idPath < 0)
       return -1;
 
-    const std::string playCount{fileInfo.m_playCount > 0 ? std::to_string(fileInfo.m_playCount)
-                                                         : "NULL"};
-    const std::string lastPlayed{fileInfo.m_lastPlayed.IsValid()
-                                     ? "'" + fileInfo.m_lastPlayed.GetAsDBDateTime() + "'"
-                                     : "NULL"};
+    const std::optional<int> playCount{fileInfo.m_playCount > 0
+                                           ? std::optional(fileInfo.m_playCount)
+                                           : std::nullopt};
+    const std::optional<std::string> lastPlayed{
+        fileInfo.m_lastPlayed.IsValid() ? std::optional(fileInfo.m_lastPlayed.GetAsDBDateTime())
+                                        : std::nullopt};
 
-    sql = PrepareSQL("SELECT idFile FROM files WHERE strFileName = '%s' AND idPath=%i",
-                     strFileName.c_str(), idPath);
-
-    m_pDS->query(sql);
+    sql = "SELECT idFile FROM files WHERE strFileName = ? AND idPath = ?";
+    m_pDS->query(sql, make_bind_list(strFileName, idPath));
     if (m_pDS->num_rows() > 0)
     {
       const int idFile{m_pDS->fv("idFile").get_asInt()};
@@ -561,18 +589,9 @@ int CVideoDatabase::AddOrUpdateFile(const std::string& fileAndPath,
 
       if (existsAction == FileExistsAction::ACTION_UPDATE)
       {
-        sql = PrepareSQL("UPDATE files "
-                         "SET playCount = " +
-                             playCount +
-                             ", "
-                             "lastPlayed = " +
-                             lastPlayed +
-                             ", "
-                             "dateAdded = '%s' "
-                             "WHERE idFile = %i",
-                         finalDateAdded.GetAsDBDateTime().c_str(), idFile);
-
-        m_pDS->exec(sql);
+        sql = "UPDATE files SET playCount = ?, lastPlayed = ?, dateAdded = ? WHERE idFile = ?";
+        m_pDS->exec(sql, make_bind_list(playCount, lastPlayed, finalDateAdded.GetAsDBDateTime(),
+                                        idFile));
       }
 
       return idFile;
@@ -580,13 +599,10 @@ int CVideoDatabase::AddOrUpdateFile(const std::string& fileAndPath,
 
     m_pDS->close();
 
-    sql = PrepareSQL(
-        "INSERT INTO files (idFile, idPath, strFileName, playCount, lastPlayed, dateAdded) "
-        "VALUES(NULL, %i, '%s', " +
-            playCount + ", " + lastPlayed + ", '%s')",
-        idPath, strFileName.c_str(), finalDateAdded.GetAsDBDateTime().c_str());
-
-    m_pDS->exec(sql);
+    sql = "INSERT INTO files (idFile, idPath, strFileName, playCount, lastPlayed, dateAdded) "
+          "VALUES(NULL, ?, ?, ?, ?, ?)";
+    m_pDS->exec(sql, make_bind_list(idPath, strFileName, playCount, lastPlayed,
+                                    finalDateAdded.GetAsDBDateTime()));
 
     return static_cast<int>(m_pDS->lastinsertid());
   }
@@ -769,9 +785,8 @@ int CVideoDatabase::GetFileId(const std::string& strFilenameAndPath)
     int idPath = GetPathId(strPath);
     if (idPath >= 0)
     {
-      std::string strSQL;
-      strSQL=PrepareSQL("select idFile from files where strFileName='%s' and idPath=%i", strFileName.c_str(),idPath);
-      m_pDS->query(strSQL);
+      m_pDS->query("SELECT idFile FROM files WHERE strFileName = ? AND idPath = ?",
+                   make_bind_list(strFileName, idPath));
       if (m_pDS->num_rows() > 0)
       {
         int idFile = m_pDS->fv("files.idFile").get_asInt();
@@ -7748,17 +7763,36 @@ bool CVideoDatabase::GetMoviesByWhere(const std::string& strBaseDir, const Filte
       return false;
 
     // Apply the limiting directly here if there's no special sorting but limiting
-    if (extFilter.limit.empty() && sorting.sortBy == SortBy::NONE &&
-        (sorting.limitStart > 0 || sorting.limitEnd > 0 ||
-         (sorting.limitStart == 0 && sorting.limitEnd == 0)))
+    const bool limited = extFilter.limit.empty() &&
+                         (sorting.limitStart > 0 || sorting.limitEnd > 0 ||
+                          (sorting.limitStart == 0 && sorting.limitEnd == 0));
+    // Sorting which only depends on columns of the view is done in SQL as well, and pages are
+    // read with keyset pagination
+    std::vector<std::string> keysetColumns;
+    const bool pagedInSQL =
+        limited && extFilter.order.empty() &&
+        DatabaseUtils::GetKeysetColumns(MediaTypeMovie, sorting.sortBy, keysetColumns);
+    if (limited && (pagedInSQL || sorting.sortBy == SortBy::NONE))
     {
       total = GetSingleValueInt(PrepareSQL(strSQL, "COUNT(1)") + strSQLExtra, *m_pDS);
-      strSQLExtra += DatabaseUtils::BuildLimitClause(sorting.limitEnd, sorting.limitStart);
+      if (pagedInSQL)
+      {
+        SetKeysetPage(PrepareSQL(strSQL, "*") + strSQLExtra, keysetColumns,
+                      sorting.sortOrder == SortOrder::DESCENDING, sorting.limitStart,
+                      sorting.limitEnd, extFilter);
+        strSQLExtra.clear();
+        if (!CDatabase::BuildSQL(strSQLExtra, extFilter, strSQLExtra))
+          return false;
+      }
+      else
+        strSQLExtra += DatabaseUtils::BuildLimitClause(sorting.limitEnd, sorting.limitStart);
     }
 
     strSQL = PrepareSQL(strSQL, !extFilter.fields.empty() ? extFilter.fields.c_str() : "*") + strSQLExtra;
 
     int iRowsFound = RunQuery(strSQL);
+    if (pagedInSQL)
+      StoreKeysetPage(*m_pDS);
 
     // store the total value of items as a property
     if (total < iRowsFound)
@@ -7771,7 +7805,8 @@ bool CVideoDatabase::GetMoviesByWhere(const std::string& strBaseDir, const Filte
     DatabaseResults results;
     results.reserve(iRowsFound);
 
-    if (!SortUtils::SortFromDataset(sortDescription, MediaTypeMovie, *m_pDS, results))
+    if (!SortUtils::SortFromDataset(pagedInSQL ? SortDescription() : sortDescription,
+                                    MediaTypeMovie, *m_pDS, results))
       return false;
 
     // get data from returned rows
@@ -8023,17 +8058,36 @@ bool CVideoDatabase::GetEpisodesByWhere(const std::string& strBaseDir, const Fil
       return false;
 
     // Apply the limiting directly here if there's no special sorting but limiting
-    if (extFilter.limit.empty() && sorting.sortBy == SortBy::NONE &&
-        (sorting.limitStart > 0 || sorting.limitEnd > 0 ||
-         (sorting.limitStart == 0 && sorting.limitEnd == 0)))
+    const bool limited = extFilter.limit.empty() &&
+                         (sorting.limitStart > 0 || sorting.limitEnd > 0 ||
+                          (sorting.limitStart == 0 && sorting.limitEnd == 0));
+    // Sorting which only depends on columns of the view is done in SQL as well, and pages are
+    // read with keyset pagination
+    std::vector<std::string> keysetColumns;
+    const bool pagedInSQL =
+        limited && extFilter.order.empty() &&
+        DatabaseUtils::GetKeysetColumns(MediaTypeEpisode, sorting.sortBy, keysetColumns);
+    if (limited && (pagedInSQL || sorting.sortBy == SortBy::NONE))
     {
       total = GetSingleValueInt(PrepareSQL(strSQL, "COUNT(1)") + strSQLExtra, *m_pDS);
-      strSQLExtra += DatabaseUtils::BuildLimitClause(sorting.limitEnd, sorting.limitStart);
+      if (pagedInSQL)
+      {
+        SetKeysetPage(PrepareSQL(strSQL, "*") + strSQLExtra, keysetColumns,
+                      sorting.sortOrder == SortOrder::DESCENDING, sorting.limitStart,
+                      sorting.limitEnd, extFilter);
+        strSQLExtra.clear();
+        if (!CDatabase::BuildSQL(strSQLExtra, extFilter, strSQLExtra))
+          return false;
+      }
+      else
+        strSQLExtra += DatabaseUtils::BuildLimitClause(sorting.limitEnd, sorting.limitStart);
     }
 
     strSQL = PrepareSQL(strSQL, !extFilter.fields.empty() ? extFilter.fields.c_str() : "*") + strSQLExtra;
 
     int iRowsFound = RunQuery(strSQL);
+    if (pagedInSQL)
+      StoreKeysetPage(*m_pDS);
 
     // store the total value of items as a property
     if (total < iRowsFound)
@@ -8045,7 +8099,8 @@ bool CVideoDatabase::GetEpisodesByWhere(const std::string& strBaseDir, const Fil
 
     DatabaseResults results;
     results.reserve(iRowsFound);
-    if (!SortUtils::SortFromDataset(sorting, MediaTypeEpisode, *m_pDS, results))
+    if (!SortUtils::SortFromDataset(pagedInSQL ? SortDescription() : sorting, MediaTypeEpisode,
+                                    *m_pDS, results))
       return false;
 
     // get data from returned rows
@@ -8217,9 +8272,9 @@ bool CVideoDatabase::HasSets() const
     if (nullptr == m_pDS)
       return false;
 
-    m_pDS->query("SELECT movie_view.idSet,COUNT(1) AS c FROM movie_view "
-                 "JOIN sets ON sets.idSet = movie_view.idSet "
-                 "GROUP BY movie_view.idSet HAVING c>1");
+    m_pDS->query("SELECT movie.idSet,COUNT(1) AS c FROM movie "
+                 "JOIN sets ON sets.idSet = movie.idSet "
+                 "GROUP BY movie.idSet HAVING c>1");
 
     bool bResult = (m_pDS->num_rows() > 0);
     m_pDS->close();
@@ -8285,14 +8340,15 @@ bool CVideoDatabase::HasContent(VideoDbContentType type)
     if (nullptr == m_pDS)
       return false;
 
-    std::string sql;
+    std::string mediaType;
     if (type == VideoDbContentType::MOVIES)
-      sql = "select count(1) from movie";
+      mediaType = MediaTypeMovie;
     else if (type == VideoDbContentType::TVSHOWS)
-      sql = "select count(1) from tvshow";
+      mediaType = MediaTypeTvShow;
     else if (type == VideoDbContentType::MUSICVIDEOS)
-      sql = "select count(1) from musicvideo";
-    m_pDS->query( sql );
+      mediaType = MediaTypeMusicVideo;
+    m_pDS->query(
+        PrepareSQL("SELECT total FROM librarystats WHERE media_type = '%s'", mediaType.c_str()));
 
     if (!m_pDS->eof())
       result = (m_pDS->fv(0).get_asInt() > 0);
@@ -8306,6 +8362,77 @@ bool CVideoDatabase::HasContent(VideoDbContentType type)
   return result;
 }
 
+bool CVideoDatabase::GetLibraryStats(std::map<std::string, LibraryStats, std::less<>>& stats) const
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    m_pDS->query("SELECT media_type, total, watched FROM librarystats");
+    while (!m_pDS->eof())
+    {
+      LibraryStats& entry = stats[m_pDS->fv(0).get_asString()];
+      entry.total = m_pDS->fv(1).get_asInt();
+      entry.watched = m_pDS->fv(2).get_asInt();
+      m_pDS->next();
+    }
+    m_pDS->close();
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed");
+  }
+  return false;
+}
+
+void CVideoDatabase::UpdateLibraryStats()
+{
+  if (nullptr == m_pDB)
+    return;
+  if (nullptr == m_pDS)
+    return;
+
+  const bool transaction = !InTransaction();
+  try
+  {
+    if (transaction)
+      BeginTransaction();
+
+    m_pDS->exec("DELETE FROM librarystats");
+    for (const auto& [mediaType, table] : {std::pair{MediaTypeMovie, "movie"},
+                                           std::pair{MediaTypeEpisode, "episode"},
+                                           std::pair{MediaTypeMusicVideo, "musicvideo"}})
+    {
+      m_pDS->exec(PrepareSQL("INSERT INTO librarystats (media_type, total, watched) "
+                             "SELECT '%s', COUNT(1), COUNT(files.playCount) FROM %s "
+                             "LEFT JOIN files ON files.idFile = %s.idFile",
+                             mediaType, table, table));
+    }
+    // a tv show is watched once it has episodes and all of them have been played
+    m_pDS->exec(PrepareSQL("INSERT INTO librarystats (media_type, total, watched) "
+                           "SELECT '%s', COUNT(1), COALESCE(SUM(s.t > 0 AND s.t = s.w), 0) FROM "
+                           "(SELECT COUNT(episode.idEpisode) AS t, COUNT(files.playCount) AS w "
+                           "FROM tvshow "
+                           "LEFT JOIN episode ON episode.idShow = tvshow.idShow "
+                           "LEFT JOIN files ON files.idFile = episode.idFile "
+                           "GROUP BY tvshow.idShow) AS s",
+                           MediaTypeTvShow));
+
+    if (transaction)
+      CommitTransaction();
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed");
+    if (transaction)
+      RollbackTransaction();
+  }
+}
+
 ScraperPtr CVideoDatabase::GetScraperForPath(const std::string& strPath,
                                              ScraperCache* scraperCache /*= nullptr*/)
 {
@@ -8705,6 +8832,12 @@ void CVideoDatabase::GetMovieActorsByName(const std::string& strSearch, CFileIte
       strSQL=PrepareSQL("SELECT actor.actor_id, actor.name, path.strPath FROM actor INNER JOIN actor_link ON actor_link.actor_id=actor.actor_id INNER JOIN movie ON actor_link.media_id=movie.idMovie INNER JOIN files ON files.idFile=movie.idFile INNER JOIN path ON path.idPath=files.idPath WHERE actor_link.media_type='movie' AND actor.name LIKE '%%%s%%'", strSearch.c_str());
     else
       strSQL=PrepareSQL("SELECT DISTINCT actor.actor_id, actor.name FROM actor INNER JOIN actor_link ON actor_link.actor_id=actor.actor_id INNER JOIN movie ON actor_link.media_id=movie.idMovie WHERE actor_link.media_type='movie' AND actor.name LIKE '%%%s%%'", strSearch.c_str());
+
+    const std::string indexed =
+        GetSearchCondition("actorsearch", "actor.actor_id", actorNameColumns, strSearch);
+    if (!indexed.empty())
+      strSQL += " AND " + indexed;
+
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -8748,6 +8881,12 @@ void CVideoDatabase::GetTvShowsActorsByName(const std::string& strSearch, CFileI
       strSQL=PrepareSQL("SELECT actor.actor_id, actor.name, path.strPath FROM actor INNER JOIN actor_link ON actor_link.actor_id=actor.actor_id INNER JOIN tvshow ON actor_link.media_id=tvshow.idShow INNER JOIN tvshowlinkpath ON tvshowlinkpath.idPath=tvshow.idShow INNER JOIN path ON path.idPath=tvshowlinkpath.idPath WHERE actor_link.media_type='tvshow' AND actor.name LIKE '%%%s%%'", strSearch.c_str());
     else
       strSQL=PrepareSQL("SELECT DISTINCT actor.actor_id, actor.name FROM actor INNER JOIN actor_link ON actor_link.actor_id=actor.actor_id INNER JOIN tvshow ON actor_link.media_id=tvshow.idShow WHERE actor_link.media_type='tvshow' AND actor.name LIKE '%%%s%%'",strSearch.c_str());
+
+    const std::string indexed =
+        GetSearchCondition("actorsearch", "actor.actor_id", actorNameColumns, strSearch);
+    if (!indexed.empty())
+      strSQL += " AND " + indexed;
+
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -9175,14 +9314,20 @@ void CVideoDatabase::GetMoviesByName(const std::string& strSearch, CFileItemList
       strSQL = PrepareSQL("SELECT movie.idMovie, movie.c%02d, path.strPath, movie.idSet FROM movie "
                           "INNER JOIN files ON files.idFile=movie.idFile INNER JOIN path ON "
                           "path.idPath=files.idPath "
-                          "WHERE movie.c%02d LIKE '%%%s%%' OR movie.c%02d LIKE '%%%s%%'",
+                          "WHERE (movie.c%02d LIKE '%%%s%%' OR movie.c%02d LIKE '%%%s%%')",
                           VIDEODB_ID_TITLE, VIDEODB_ID_TITLE, strSearch.c_str(),
                           VIDEODB_ID_ORIGINALTITLE, strSearch.c_str());
     else
       strSQL = PrepareSQL("SELECT movie.idMovie,movie.c%02d, movie.idSet FROM movie WHERE "
-                          "movie.c%02d like '%%%s%%' OR movie.c%02d LIKE '%%%s%%'",
+                          "(movie.c%02d like '%%%s%%' OR movie.c%02d LIKE '%%%s%%')",
                           VIDEODB_ID_TITLE, VIDEODB_ID_TITLE, strSearch.c_str(),
                           VIDEODB_ID_ORIGINALTITLE, strSearch.c_str());
+
+    const std::string indexed =
+        GetSearchCondition("moviesearch", "movie.idMovie", movieTitleColumns, strSearch);
+    if (!indexed.empty())
+      strSQL += " AND " + indexed;
+
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -9232,6 +9377,12 @@ void CVideoDatabase::GetTvShowsByName(const std::string& strSearch, CFileItemLis
       strSQL = PrepareSQL("SELECT tvshow.idShow, tvshow.c%02d, path.strPath FROM tvshow INNER JOIN tvshowlinkpath ON tvshowlinkpath.idShow=tvshow.idShow INNER JOIN path ON path.idPath=tvshowlinkpath.idPath WHERE tvshow.c%02d LIKE '%%%s%%'", VIDEODB_ID_TV_TITLE, VIDEODB_ID_TV_TITLE, strSearch.c_str());
     else
       strSQL = PrepareSQL("select tvshow.idShow,tvshow.c%02d from tvshow where tvshow.c%02d like '%%%s%%'",VIDEODB_ID_TV_TITLE,VIDEODB_ID_TV_TITLE,strSearch.c_str());
+
+    const std::string indexed =
+        GetSearchCondition("tvshowsearch", "tvshow.idShow", tvshowTitleColumns, strSearch);
+    if (!indexed.empty())
+      strSQL += " AND " + indexed;
+
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -9278,6 +9429,12 @@ void CVideoDatabase::GetEpisodesByName(const std::string& strSearch, CFileItemLi
       strSQL = PrepareSQL("SELECT episode.idEpisode, episode.c%02d, episode.c%02d, episode.idShow, tvshow.c%02d, path.strPath FROM episode INNER JOIN tvshow ON tvshow.idShow=episode.idShow INNER JOIN files ON files.idFile=episode.idFile INNER JOIN path ON path.idPath=files.idPath WHERE episode.c%02d LIKE '%%%s%%'", VIDEODB_ID_EPISODE_TITLE, VIDEODB_ID_EPISODE_SEASON, VIDEODB_ID_TV_TITLE, VIDEODB_ID_EPISODE_TITLE, strSearch.c_str());
     else
       strSQL = PrepareSQL("SELECT episode.idEpisode, episode.c%02d, episode.c%02d, episode.idShow, tvshow.c%02d FROM episode INNER JOIN tvshow ON tvshow.idShow=episode.idShow WHERE episode.c%02d like '%%%s%%'", VIDEODB_ID_EPISODE_TITLE, VIDEODB_ID_EPISODE_SEASON, VIDEODB_ID_TV_TITLE, VIDEODB_ID_EPISODE_TITLE, strSearch.c_str());
+
+    const std::string indexed =
+        GetSearchCondition("episodesearch", "episode.idEpisode", episodeTitleColumns, strSearch);
+    if (!indexed.empty())
+      strSQL += " AND " + indexed;
+
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -9328,6 +9485,12 @@ void CVideoDatabase::GetMusicVideosByName(const std::string& strSearch, CFileIte
       strSQL = PrepareSQL("SELECT musicvideo.idMVideo, musicvideo.c%02d, path.strPath FROM musicvideo INNER JOIN files ON files.idFile=musicvideo.idFile INNER JOIN path ON path.idPath=files.idPath WHERE musicvideo.c%02d LIKE '%%%s%%'", VIDEODB_ID_MUSICVIDEO_TITLE, VIDEODB_ID_MUSICVIDEO_TITLE, strSearch.c_str());
     else
       strSQL = PrepareSQL("select musicvideo.idMVideo,musicvideo.c%02d from musicvideo where musicvideo.c%02d like '%%%s%%'",VIDEODB_ID_MUSICVIDEO_TITLE,VIDEODB_ID_MUSICVIDEO_TITLE,strSearch.c_str());
+
+    const std::string indexed = GetSearchCondition("musicvideosearch", "musicvideo.idMVideo",
+                                                   musicvideoTitleColumns, strSearch);
+    if (!indexed.empty())
+      strSQL += " AND " + indexed;
+
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -9380,6 +9543,12 @@ void CVideoDatabase::GetEpisodesByPlot(const std::string& strSearch, CFileItemLi
       strSQL = PrepareSQL("SELECT episode.idEpisode, episode.c%02d, episode.c%02d, episode.idShow, tvshow.c%02d, path.strPath FROM episode INNER JOIN tvshow ON tvshow.idShow=episode.idShow INNER JOIN files ON files.idFile=episode.idFile INNER JOIN path ON path.idPath=files.idPath WHERE episode.c%02d LIKE '%%%s%%'", VIDEODB_ID_EPISODE_TITLE, VIDEODB_ID_EPISODE_SEASON, VIDEODB_ID_TV_TITLE, VIDEODB_ID_EPISODE_PLOT, strSearch.c_str());
     else
       strSQL = PrepareSQL("SELECT episode.idEpisode, episode.c%02d, episode.c%02d, episode.idShow, tvshow.c%02d FROM episode INNER JOIN tvshow ON tvshow.idShow=episode.idShow WHERE episode.c%02d LIKE '%%%s%%'", VIDEODB_ID_EPISODE_TITLE, VIDEODB_ID_EPISODE_SEASON, VIDEODB_ID_TV_TITLE, VIDEODB_ID_EPISODE_PLOT, strSearch.c_str());
+
+    const std::string indexed =
+        GetSearchCondition("episodesearch", "episode.idEpisode", episodePlotColumns, strSearch);
+    if (!indexed.empty())
+      strSQL += " AND " + indexed;
+
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -9423,10 +9592,15 @@ void CVideoDatabase::GetMoviesByPlot(const std::string& strSearch, CFileItemList
 
     if (m_profileManager.GetMasterProfile().getLockMode() != LockMode::EVERYONE &&
         !g_passwordManager.bMasterUser)
-      strSQL = PrepareSQL("select movie.idMovie, movie.c%02d, path.strPath FROM movie INNER JOIN files ON files.idFile=movie.idFile INNER JOIN path ON path.idPath=files.idPath WHERE movie.c%02d LIKE '%%%s%%' OR movie.c%02d LIKE '%%%s%%' OR movie.c%02d LIKE '%%%s%%'", VIDEODB_ID_TITLE,VIDEODB_ID_PLOT, strSearch.c_str(), VIDEODB_ID_PLOTOUTLINE, strSearch.c_str(), VIDEODB_ID_TAGLINE,strSearch.c_str());
+      strSQL = PrepareSQL("select movie.idMovie, movie.c%02d, path.strPath FROM movie INNER JOIN files ON files.idFile=movie.idFile INNER JOIN path ON path.idPath=files.idPath WHERE (movie.c%02d LIKE '%%%s%%' OR movie.c%02d LIKE '%%%s%%' OR movie.c%02d LIKE '%%%s%%')", VIDEODB_ID_TITLE,VIDEODB_ID_PLOT, strSearch.c_str(), VIDEODB_ID_PLOTOUTLINE, strSearch.c_str(), VIDEODB_ID_TAGLINE,strSearch.c_str());
     else
       strSQL = PrepareSQL("SELECT movie.idMovie, movie.c%02d FROM movie WHERE (movie.c%02d LIKE '%%%s%%' OR movie.c%02d LIKE '%%%s%%' OR movie.c%02d LIKE '%%%s%%')", VIDEODB_ID_TITLE, VIDEODB_ID_PLOT, strSearch.c_str(), VIDEODB_ID_PLOTOUTLINE, strSearch.c_str(), VIDEODB_ID_TAGLINE, strSearch.c_str());
 
+    const std::string indexed =
+        GetSearchCondition("moviesearch", "movie.idMovie", moviePlotColumns, strSearch);
+    if (!indexed.empty())
+      strSQL += " AND " + indexed;
+
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -9962,6 +10136,9 @@ void CVideoDatabase::CleanDatabase(CGUIDialogProgressBarHandle* handle,
             "WHERE NOT EXISTS (SELECT 1 FROM movie WHERE movie.idSet = sets.idSet)";
       m_pDS->exec(sql);
 
+      // the triggers keep the counts up to date, recount them anyway after removing this much
+      UpdateLibraryStats();
+
       CommitTransaction();
 
       if (handle)
@@ -18,6 +18,7 @@
 
 #include <array>
 #include <functional>
+#include <map>
 #include <memory>
 #include <set>
 #include <stdexcept>
@@ -708,6 +709,26 @@ public:
   bool HasContent(VideoDbContentType type);
   bool HasSets() const;
 
+  struct LibraryStats
+  {
+    int total{0};
+    int watched{0}; //!< played at least once, tv shows once all of their episodes are
+  };
+
+  /*!
+   * \brief Get the number of movies, tv shows, episodes and music videos in the library
+   * \details The counts are kept up to date by triggers in the librarystats table, so they are
+   * read without going through the media tables.
+   * \param[out] stats the counts by media type (MediaTypeMovie, MediaTypeTvShow, ...)
+   * \return true on success, false otherwise
+   */
+  bool GetLibraryStats(std::map<std::string, LibraryStats, std::less<>>& stats) const;
+
+  /*!
+   * \brief Count the items of the library statistics again from the media tables
+   */
+  void UpdateLibraryStats();
+
   void CleanDatabase(CGUIDialogProgressBarHandle* handle = nullptr,
                      const std::set<int>& paths = std::set<int>(),
                      bool showProgress = true);
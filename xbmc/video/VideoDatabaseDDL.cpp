@@ -20,6 +20,78 @@
 
 using namespace KODI::DATABASE;
 
+namespace
+{
+// The triggers below keep the counters of the librarystats table up to date, see
+// CVideoDatabase::UpdateLibraryStats() for what they count.
+
+// 1 if the file has been played, 0 otherwise
+std::string IsWatched(const std::string& idFile)
+{
+  return "(SELECT COUNT(1) FROM files WHERE files.idFile = " + idFile +
+         " AND files.playCount IS NOT NULL)";
+}
+
+// Update the number of watched tv shows after episodes of a show have been added or removed. A
+// show is watched when it has episodes and all of them have been played. The counts before the
+// change are the ones after it minus the episodes and watched episodes added.
+std::string UpdateWatchedTvShow(const std::string& idShow,
+                                const std::string& episodesAdded,
+                                const std::string& watchedAdded,
+                                const std::string& condition = "1 = 1")
+{
+  return StringUtils::Format(
+      "UPDATE librarystats SET watched = watched + "
+      "(SELECT (s.t > 0 AND s.t = s.w) - (s.t - ({1}) > 0 AND s.t - ({1}) = s.w - ({2})) FROM "
+      "(SELECT COUNT(1) AS t, COUNT(files.playCount) AS w FROM episode "
+      "LEFT JOIN files ON files.idFile = episode.idFile WHERE episode.idShow = {0}) AS s) "
+      "WHERE media_type = 'tvshow' AND EXISTS (SELECT 1 FROM tvshow WHERE idShow = {0}) "
+      "AND {3}; ",
+      idShow, episodesAdded, watchedAdded, condition);
+}
+
+// Update the watched counters after the file has been played or reset, or removed
+std::string UpdateWatchedFile(const std::string& idFile,
+                              const std::string& watchedAdded,
+                              const std::string& condition)
+{
+  return StringUtils::Format(
+      "UPDATE librarystats SET watched = watched + ({1}) * CASE media_type "
+      "WHEN 'movie' THEN (SELECT COUNT(1) FROM movie WHERE idFile = {0}) "
+      "WHEN 'episode' THEN (SELECT COUNT(1) FROM episode WHERE idFile = {0}) "
+      "WHEN 'musicvideo' THEN (SELECT COUNT(1) FROM musicvideo WHERE idFile = {0}) END "
+      "WHERE media_type IN ('movie', 'episode', 'musicvideo') AND {2}; "
+      // the counts after the change for each show with episodes in the file
+      "UPDATE librarystats SET watched = watched + COALESCE("
+      "(SELECT SUM((s.t = s.w) - (s.t = s.w - ({1}) * s.k)) FROM "
+      "(SELECT COUNT(1) AS t, COUNT(files.playCount) AS w, SUM(episode.idFile = {0}) AS k "
+      "FROM episode JOIN tvshow ON tvshow.idShow = episode.idShow "
+      "LEFT JOIN files ON files.idFile = episode.idFile "
+      "WHERE episode.idShow IN (SELECT idShow FROM episode WHERE idFile = {0}) "
+      "GROUP BY episode.idShow) AS s), 0) "
+      "WHERE media_type = 'tvshow' AND {2}; ",
+      idFile, watchedAdded, condition);
+}
+
+// Update the counters after a movie, episode or music video has been added or removed
+std::string UpdateItemCount(const std::string& mediaType,
+                            const std::string& idFile,
+                            const std::string& sign)
+{
+  return StringUtils::Format("UPDATE librarystats SET total = total {1} 1, watched = watched {1} "
+                             "{2} WHERE media_type = '{0}'; ",
+                             mediaType, sign, IsWatched(idFile));
+}
+
+// Update the watched counter after a movie, episode or music video has been moved to another file
+std::string UpdateItemFile(const std::string& mediaType)
+{
+  return StringUtils::Format("UPDATE librarystats SET watched = watched + {1} - {2} "
+                             "WHERE media_type = '{0}' AND new.idFile <> old.idFile; ",
+                             mediaType, IsWatched("new.idFile"), IsWatched("old.idFile"));
+}
+} // unnamed namespace
+
 void CVideoDatabaseDDL::InitializeVideoVersionTypeTable(CDatabase& db)
 {
   assert(db.InTransaction());
@@ -194,6 +266,10 @@ void CVideoDatabaseDDL::CreateTables(CDatabase& db)
   db.ExecuteQuery(
       "CREATE TABLE videoversion (idFile INTEGER PRIMARY KEY, idMedia INTEGER, media_type "
       "TEXT, itemType INTEGER, idType INTEGER)");
+
+  CLog::Log(LOGINFO, "create librarystats table");
+  db.ExecuteQuery("CREATE TABLE librarystats (media_type VARCHAR(20) PRIMARY KEY, "
+                  "total INTEGER NOT NULL DEFAULT 0, watched INTEGER NOT NULL DEFAULT 0)");
 }
 
 void CVideoDatabaseDDL::CreateLinkIndex(CDatabase& db, const std::string& table)
@@ -315,8 +391,8 @@ void CVideoDatabaseDDL::CreateTriggers(CDatabase& db)
                   "DELETE FROM rating WHERE media_id=old.idMovie AND media_type='movie'; "
                   "DELETE FROM uniqueid WHERE media_id=old.idMovie AND media_type='movie'; "
                   "DELETE FROM videoversion "
-                  "WHERE idFile=old.idFile AND idMedia=old.idMovie AND media_type='movie'; "
-                  "END");
+                  "WHERE idFile=old.idFile AND idMedia=old.idMovie AND media_type='movie'; " +
+                  UpdateItemCount("movie", "old.idFile", "-") + "END");
   db.ExecuteQuery("CREATE TRIGGER delete_tvshow AFTER DELETE ON tvshow FOR EACH ROW BEGIN "
                   "DELETE FROM actor_link WHERE media_id=old.idShow AND media_type='tvshow'; "
                   "DELETE FROM director_link WHERE media_id=old.idShow AND media_type='tvshow'; "
@@ -329,6 +405,12 @@ void CVideoDatabaseDDL::CreateTriggers(CDatabase& db)
                   "DELETE FROM tag_link WHERE media_id=old.idShow AND media_type='tvshow'; "
                   "DELETE FROM rating WHERE media_id=old.idShow AND media_type='tvshow'; "
                   "DELETE FROM uniqueid WHERE media_id=old.idShow AND media_type='tvshow'; "
+                  "UPDATE librarystats SET total = total - 1, watched = watched - "
+                  "(SELECT (s.t > 0 AND s.t = s.w) FROM "
+                  "(SELECT COUNT(1) AS t, COUNT(files.playCount) AS w FROM episode "
+                  "LEFT JOIN files ON files.idFile = episode.idFile "
+                  "WHERE episode.idShow = old.idShow) AS s) "
+                  "WHERE media_type = 'tvshow'; "
                   "END");
   db.ExecuteQuery(
       "CREATE TRIGGER delete_musicvideo AFTER DELETE ON musicvideo FOR EACH ROW BEGIN "
@@ -338,8 +420,8 @@ void CVideoDatabaseDDL::CreateTriggers(CDatabase& db)
       "DELETE FROM studio_link WHERE media_id=old.idMVideo AND media_type='musicvideo'; "
       "DELETE FROM art WHERE media_id=old.idMVideo AND media_type='musicvideo'; "
       "DELETE FROM tag_link WHERE media_id=old.idMVideo AND media_type='musicvideo'; "
-      "DELETE FROM uniqueid WHERE media_id=old.idMVideo AND media_type='musicvideo'; "
-      "END");
+      "DELETE FROM uniqueid WHERE media_id=old.idMVideo AND media_type='musicvideo'; " +
+      UpdateItemCount("musicvideo", "old.idFile", "-") + "END");
   db.ExecuteQuery(
       "CREATE TRIGGER delete_episode AFTER DELETE ON episode FOR EACH ROW BEGIN "
       "DELETE FROM actor_link WHERE media_id=old.idEpisode AND media_type='episode'; "
@@ -347,8 +429,9 @@ void CVideoDatabaseDDL::CreateTriggers(CDatabase& db)
       "DELETE FROM writer_link WHERE media_id=old.idEpisode AND media_type='episode'; "
       "DELETE FROM art WHERE media_id=old.idEpisode AND media_type='episode'; "
       "DELETE FROM rating WHERE media_id=old.idEpisode AND media_type='episode'; "
-      "DELETE FROM uniqueid WHERE media_id=old.idEpisode AND media_type='episode'; "
-      "END");
+      "DELETE FROM uniqueid WHERE media_id=old.idEpisode AND media_type='episode'; " +
+      UpdateItemCount("episode", "old.idFile", "-") +
+      UpdateWatchedTvShow("old.idShow", "-1", "-" + IsWatched("old.idFile")) + "END");
   db.ExecuteQuery("CREATE TRIGGER delete_season AFTER DELETE ON seasons FOR EACH ROW BEGIN "
                   "DELETE FROM art WHERE media_id=old.idSeason AND media_type='season'; "
                   "END");
@@ -370,13 +453,46 @@ void CVideoDatabaseDDL::CreateTriggers(CDatabase& db)
                   "DELETE FROM stacktimes WHERE idFile=old.idFile; "
                   "DELETE FROM streamdetails WHERE idFile=old.idFile; "
                   "DELETE FROM videoversion WHERE idFile=old.idFile; "
-                  "DELETE FROM art WHERE media_id=old.idFile AND media_type='videoversion'; "
-                  "END");
+                  "DELETE FROM art WHERE media_id=old.idFile AND media_type='videoversion'; " +
+                  UpdateWatchedFile("old.idFile", "-1", "old.playCount IS NOT NULL") + "END");
   db.ExecuteQuery(
       "CREATE TRIGGER delete_videoversion AFTER DELETE ON videoversion FOR EACH ROW BEGIN "
       "DELETE FROM art WHERE media_id=old.idFile AND media_type='videoversion'; "
       "DELETE FROM streamdetails WHERE idFile=old.idFile; "
       "END");
+
+  CLog::Log(LOGINFO, "Creating video database library statistics triggers");
+  db.ExecuteQuery("CREATE TRIGGER insert_movie AFTER INSERT ON movie FOR EACH ROW BEGIN " +
+                  UpdateItemCount("movie", "new.idFile", "+") + "END");
+  db.ExecuteQuery("CREATE TRIGGER update_movie AFTER UPDATE ON movie FOR EACH ROW BEGIN " +
+                  UpdateItemFile("movie") + "END");
+  db.ExecuteQuery("CREATE TRIGGER insert_musicvideo AFTER INSERT ON musicvideo FOR EACH ROW BEGIN " +
+                  UpdateItemCount("musicvideo", "new.idFile", "+") + "END");
+  db.ExecuteQuery("CREATE TRIGGER update_musicvideo AFTER UPDATE ON musicvideo FOR EACH ROW BEGIN " +
+                  UpdateItemFile("musicvideo") + "END");
+  db.ExecuteQuery("CREATE TRIGGER insert_tvshow AFTER INSERT ON tvshow FOR EACH ROW BEGIN "
+                  "UPDATE librarystats SET total = total + 1 WHERE media_type = 'tvshow'; "
+                  "END");
+  db.ExecuteQuery(
+      "CREATE TRIGGER insert_episode AFTER INSERT ON episode FOR EACH ROW BEGIN " +
+      UpdateItemCount("episode", "new.idFile", "+") +
+      UpdateWatchedTvShow("new.idShow", "1", IsWatched("new.idFile")) + "END");
+  // an episode moved to another show is removed from the old one and added to the new one
+  db.ExecuteQuery(
+      "CREATE TRIGGER update_episode AFTER UPDATE ON episode FOR EACH ROW BEGIN " +
+      UpdateItemFile("episode") +
+      UpdateWatchedTvShow("new.idShow", "0",
+                          IsWatched("new.idFile") + " - " + IsWatched("old.idFile"),
+                          "new.idFile <> old.idFile AND new.idShow = old.idShow") +
+      UpdateWatchedTvShow("old.idShow", "-1", "-" + IsWatched("old.idFile"),
+                          "new.idShow <> old.idShow") +
+      UpdateWatchedTvShow("new.idShow", "1", IsWatched("new.idFile"), "new.idShow <> old.idShow") +
+      "END");
+  db.ExecuteQuery("CREATE TRIGGER update_file AFTER UPDATE ON files FOR EACH ROW BEGIN " +
+                  UpdateWatchedFile("new.idFile",
+                                    "(new.playCount IS NOT NULL) - (old.playCount IS NOT NULL)",
+                                    "(new.playCount IS NULL) <> (old.playCount IS NULL)") +
+                  "END");
 }
 
 /*!
@@ -1150,9 +1150,16 @@ void CVideoDatabase::UpdateTables(int iVersion)
 
   if (iVersion < 144)
     m_pDS->exec("ALTER TABLE streamdetails ADD strHdrDetail text");
+
+  if (iVersion < 146)
+  {
+    // filled when the analytics are created
+    m_pDS->exec("CREATE TABLE librarystats (media_type VARCHAR(20) PRIMARY KEY, "
+                "total INTEGER NOT NULL DEFAULT 0, watched INTEGER NOT NULL DEFAULT 0)");
+  }
 }
 
 int CVideoDatabase::GetSchemaVersion() const
 {
-  return 144;
+  return 146;
 }
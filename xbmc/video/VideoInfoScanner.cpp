@@ -24,6 +24,7 @@
 #include "events/EventLog.h"
 #include "events/MediaLibraryEvent.h"
 #include "filesystem/Directory.h"
+#include "filesystem/DirectoryChangeDetector.h"
 #include "filesystem/DiscDirectoryHelper.h"
 #include "filesystem/File.h"
 #include "filesystem/MultiPathDirectory.h"
@@ -54,6 +55,7 @@
 #include "utils/log.h"
 #include "video/VideoFileItemClassify.h"
 #include "video/VideoInfoTag.h"
+#include "video/VideoLibraryQueue.h"
 #include "video/VideoManagerTypes.h"
 #include "video/VideoThumbLoader.h"
 #include "video/VideoUtils.h"
@@ -237,6 +239,23 @@ CVideoInfoScanner::~CVideoInfoScanner()
       // result in unexpected behaviour.
       m_bCanInterrupt = false;
 
+      if (m_changeDetector)
+      {
+        std::set<std::string> changedFolders;
+        m_changeDetector->GetChangedFolders(m_pathsToScan, changedFolders, m_bStop);
+
+        // a path is scanned as a whole if anything in it changed since the last update
+        std::erase_if(m_pathsToScan,
+                      [&changedFolders](const std::string& path)
+                      {
+                        const auto it = changedFolders.lower_bound(path);
+                        return it == changedFolders.end() || !URIUtils::PathHasParent(*it, path);
+                      });
+        CLog::Log(LOGDEBUG,
+                  "VideoInfoScanner: {} folders changed since the last update, {} paths to scan",
+                  changedFolders.size(), m_pathsToScan.size());
+      }
+
       bool bCancelled = false;
       while (!bCancelled && !m_pathsToScan.empty())
       {
@@ -266,9 +285,19 @@ CVideoInfoScanner::~CVideoInfoScanner()
           bCancelled = true;
       }
 
+      bCancelled = bCancelled || m_bStop;
+      if (m_changeDetector)
+      {
+        if (!bCancelled)
+          m_changeDetector->CommitChanges();
+        else
+          m_changeDetector->DiscardChanges();
+      }
+
       if (!bCancelled)
       {
-        if (m_bClean)
+        // no paths to clean means all of them, which is only right if all have been scanned
+        if (m_bClean && (!m_changeDetector || !m_pathsToClean.empty()))
           m_database.CleanDatabase(m_handle, m_pathsToClean, false);
         else
         {
@@ -313,6 +342,10 @@ CVideoInfoScanner::~CVideoInfoScanner()
     { // scan all paths in the database.  We do this by scanning all paths in the db, and crossing them off the list as
       // we go.
       m_database.GetPaths(m_pathsToScan);
+
+      // the folders of an emptied library have to be looked into again
+      if (m_advancedSettings->m_bVideoLibraryIncrementalUpdate && !m_database.HasContent())
+        CVideoLibraryQueue::GetInstance().GetChangeDetector().Reset();
     }
     else
     { // scan all the paths of this subtree that is in the database
@@ -334,6 +367,12 @@ CVideoInfoScanner::~CVideoInfoScanner()
     m_database.Close();
     m_bClean = m_advancedSettings->m_bVideoLibraryCleanOnUpdate;
 
+    // an update of the whole library only needs to look into the paths which changed since the
+    // last one
+    m_changeDetector = nullptr;
+    if (strDirectory.empty() && m_advancedSettings->m_bVideoLibraryIncrementalUpdate)
+      m_changeDetector = &CVideoLibraryQueue::GetInstance().GetChangeDetector();
+
     m_bRunning = true;
     Process();
   }
@@ -690,6 +729,10 @@ CVideoInfoScanner::~CVideoInfoScanner()
         FoundSomeInfo = false;
         break;
       }
+      // a folder with an item which couldn't be scraped is looked into again by the next update
+      if (m_changeDetector && (ret == InfoRet::INFO_ERROR || ret == InfoRet::NOT_FOUND))
+        m_changeDetector->ForgetFolder(pItem->IsFolder() ? pItem->GetPath() : items.GetPath());
+
       if (ret == InfoRet::CANCELLED || ret == InfoRet::INFO_ERROR)
       {
         CLog::Log(LOGWARNING,
@@ -14,6 +14,7 @@
 #include "guilib/GUIListItem.h"
 #include "utils/Artwork.h"
 
+#include <atomic>
 #include <set>
 #include <string>
 #include <vector>
@@ -23,6 +24,11 @@ class CRegExp;
 class CFileItem;
 class CFileItemList;
 
+namespace XFILE
+{
+class CDirectoryChangeDetector;
+}
+
 namespace KODI::VIDEO
 {
   class IVideoInfoTagLoader;
@@ -321,12 +327,13 @@ namespace KODI::VIDEO
     std::pair<InfoType, std::unique_ptr<IVideoInfoTagLoader>> ReadInfoTag(
         CFileItem& item, const ADDON::ScraperPtr& scraper, bool lookInFolder, bool resetTag);
 
-    bool m_bStop;
+    std::atomic<bool> m_bStop;
     bool m_scanAll;
     bool m_ignoreVideoVersions{false};
     bool m_ignoreVideoExtras{false};
     CVideoDatabase m_database;
     std::set<int> m_pathsToClean;
+    XFILE::CDirectoryChangeDetector* m_changeDetector{nullptr}; //!< set for incremental updates
     std::shared_ptr<CAdvancedSettings> m_advancedSettings;
     CVideoDatabase::ScraperCache m_scraperCache;
   };
@@ -11,6 +11,7 @@
 #include "GUIUserMessages.h"
 #include "ServiceBroker.h"
 #include "Util.h"
+#include "filesystem/DirectoryChangeDetector.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIWindowManager.h"
 #include "video/jobs/VideoLibraryCleaningJob.h"
@@ -25,7 +26,9 @@
 
 CVideoLibraryQueue::CVideoLibraryQueue()
   : CJobQueue(false, 1, CJob::PRIORITY_LOW),
-    m_jobs()
+    m_jobs(),
+    m_changeDetector(std::make_unique<XFILE::CDirectoryChangeDetector>(
+        "special://database/VideoFolders.json"))
 { }
 
 CVideoLibraryQueue::~CVideoLibraryQueue()
@@ -84,6 +87,9 @@ bool CVideoLibraryQueue::CleanLibrary(const std::set<int>& paths /* = std::set<i
                                       bool asynchronous /* = true */,
                                       CGUIDialogProgressBarHandle* progressBar /* = NULL */)
 {
+  // cleaning may remove items of folders which haven't changed
+  m_changeDetector->Reset();
+
   CVideoLibraryCleaningJob* cleaningJob = new CVideoLibraryCleaningJob(paths, progressBar);
 
   if (asynchronous)
@@ -113,6 +119,8 @@ bool CVideoLibraryQueue::CleanLibraryModal(const std::set<int>& paths /* = std::
   if (IsRunning())
     return false;
 
+  m_changeDetector->Reset();
+
   m_modal = true;
   m_cleaning = true;
   CVideoLibraryCleaningJob cleaningJob(paths, true);
@@ -19,6 +19,11 @@ class CFileItem;
 class CGUIDialogProgressBarHandle;
 class CVideoLibraryJob;
 
+namespace XFILE
+{
+class CDirectoryChangeDetector;
+}
+
 /*!
  \brief Queue for video library jobs.
 
@@ -142,6 +147,11 @@ public:
    */
   bool IsRunning() const;
 
+  /*!
+   \brief Gets the detector of the folders changed since the last library update.
+   */
+  XFILE::CDirectoryChangeDetector& GetChangeDetector() { return *m_changeDetector; }
+
 protected:
   // implementation of IJobCallback
   void OnJobComplete(unsigned int jobID, bool success, CJob *job) override;
@@ -163,4 +173,6 @@ private:
 
   bool m_modal = false;
   bool m_cleaning = false;
+
+  std::unique_ptr<XFILE::CDirectoryChangeDetector> m_changeDetector;
 };
@@ -11,6 +11,7 @@
 #include "FileItem.h"
 #include "FileItemList.h"
 #include "ServiceBroker.h"
+#include "TextureCache.h"
 #include "TextureDatabase.h"
 #include "URL.h"
 #include "Util.h"
@@ -397,7 +398,10 @@ bool CVideoLibraryRefreshingJob::Work(CVideoDatabase &db)
     if (textureDb.Open())
     {
       for (const auto& artwork : m_item->GetArt())
+      {
         textureDb.InvalidateCachedTexture(artwork.second);
+        CServiceBroker::GetTextureCache()->ForgetCachedImage(artwork.second);
+      }
 
       textureDb.Close();
     }
@@ -27,6 +27,7 @@
 #include "dialogs/GUIDialogSmartPlaylistEditor.h"
 #include "dialogs/GUIDialogYesNo.h"
 #include "filesystem/Directory.h"
+#include "filesystem/DirectoryChangeDetector.h"
 #include "filesystem/MultiPathDirectory.h"
 #include "filesystem/VideoDatabaseDirectory.h"
 #include "filesystem/VideoDatabaseDirectory/DirectoryNode.h"
@@ -1411,6 +1412,7 @@ bool CGUIWindowVideoBase::OnUnAssignContent(const std::string &path, int header,
     CGUIDialogProgress *progress = CServiceBroker::GetGUI()->GetWindowManager().GetWindow<CGUIDialogProgress>(WINDOW_DIALOG_PROGRESS);
     db.RemoveContentForPath(path, progress);
     db.Close();
+    CVideoLibraryQueue::GetInstance().GetChangeDetector().Reset();
     CUtil::DeleteVideoDatabaseDirectoryCache();
     return true;
   }
@@ -1452,6 +1454,9 @@ void CGUIWindowVideoBase::OnAssignContent(const std::string &path)
         bScan = true;
     }
     db.SetScraperForPath(path, info, settings);
+
+    // the folders of the path have to be looked into again with the new settings
+    CVideoLibraryQueue::GetInstance().GetChangeDetector().Reset();
   }
 
   if (bScan)
@@ -21,6 +21,7 @@
 #include "guilib/GUITextLayout.h"
 #include "guilib/GUIWindowManager.h"
 #include "input/WindowTranslator.h"
+#include "jobs/JobManager.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/CPUInfo.h"
@@ -29,8 +30,45 @@
 #include "utils/Variant.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
 #include <inttypes.h>
 
+namespace
+{
+// the jobs queued and processing, and the job type with the longest queue
+std::string GetJobsInfo()
+{
+  const auto jobManager = CServiceBroker::GetJobManager();
+  if (!jobManager)
+    return {};
+
+  const std::vector<CJobManager::JobStatistics> statistics = jobManager->GetStatistics();
+  size_t queued = 0;
+  size_t processing = 0;
+  for (const auto& stats : statistics)
+  {
+    queued += stats.queued;
+    processing += stats.processing;
+  }
+
+  std::string info = StringUtils::Format("JOBS: {} queued, {} processing", queued, processing);
+
+  const auto longest = std::ranges::max_element(
+      statistics, [](const auto& a, const auto& b) { return a.queued < b.queued; });
+  if (longest != statistics.end() && longest->queued > 0)
+  {
+    const auto average = [](std::chrono::microseconds total, uint64_t count)
+    { return count ? total.count() / 1000.0 / count : 0.0; };
+    info += StringUtils::Format(" - {}: {} queued, wait {:.1f} ms, run {:.1f} ms", longest->type,
+                                longest->queued,
+                                average(longest->totalWaitTime, longest->started),
+                                average(longest->totalRunTime, longest->completed));
+  }
+
+  return info;
+}
+} // unnamed namespace
+
 CGUIWindowDebugInfo::CGUIWindowDebugInfo(void)
   : CGUIDialog(WINDOW_DEBUG_INFO, "", DialogModalityType::MODELESS)
 {
@@ -133,6 +171,10 @@ void CGUIWindowDebugInfo::Process(unsigned int currentTime, CDirtyRegionList &di
                                    .GetFPS(),
                                strCores, ucAppName, dCPU, profiling);
 #endif
+
+    const std::string jobs = GetJobsInfo();
+    if (!jobs.empty())
+      info += "\n" + jobs;
   }
 
   // render the skin debug info